@@ -0,0 +1,18 @@
+#pragma once
+
+#include <chrono>
+
+// Wall-clock timing for the benchmarks
+using BenchmarkClock = std::chrono::steady_clock;
+
+inline double microsecondsSince(BenchmarkClock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(BenchmarkClock::now() - start).count();
+}
+
+// Keeps results alive so the optimizer cannot drop the measured work
+template <typename T>
+void keepAlive(const T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
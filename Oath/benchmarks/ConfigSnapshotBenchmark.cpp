@@ -0,0 +1,206 @@
+// benchmarks/ConfigSnapshotBenchmark.cpp
+// Crime and mount tuning read per call: the JSON lookups CrimeRecord and
+// MountSystemConfig made before the snapshots, against CrimeLawSettings and
+// the published MountSystemConfig, checked to give the same answers. Then
+// readers on other threads take crime snapshots while the config reloads.
+#include "BenchmarkClock.hpp"
+#include "systems/crime/CrimeLawConfig.hpp"
+#include "systems/crime/CrimeRecord.hpp"
+#include "systems/mount/Mount.hpp"
+#include "systems/mount/MountSystemConfig.hpp"
+#include "systems/mount/MountSystemController.hpp"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int LOOKUPS = 2000000;
+const int RELOADS = 200;
+const int READERS = 3;
+const int READS_PER_READER = 1000000;
+
+// CrimeRecord::calculateBounty before CrimeLawSettings
+int oldBounty(nlohmann::json& crimeLawConfig, const std::string& type, int severity, bool witnessed)
+{
+    int baseBounty = crimeLawConfig["baseBounties"].contains(type) ? crimeLawConfig["baseBounties"][type].get<int>() : 0;
+    int adjustedBounty = baseBounty * severity / 5;
+    if (witnessed)
+        adjustedBounty *= crimeLawConfig["crimeConfig"]["bountyWitnessMultiplier"].get<int>();
+    return adjustedBounty;
+}
+
+// MountSystemConfig::canUseAbility before the snapshot, on a mutable config
+bool oldCanUseAbility(MountSystemConfig& config, const MountStats& stats, const std::string& abilityId)
+{
+    if (config.specialAbilities.find(abilityId) == config.specialAbilities.end()) {
+        return false;
+    }
+    const SpecialAbilityInfo& ability = config.specialAbilities[abilityId];
+    if (abilityId == "jump" && !stats.canJump)
+        return false;
+    if (abilityId == "swim" && !stats.canSwim)
+        return false;
+    if (abilityId == "climb" && !stats.canClimb)
+        return false;
+    if (stats.stamina < ability.staminaCost)
+        return false;
+    if (stats.specialTraining.find(ability.trainingType) != stats.specialTraining.end()) {
+        return stats.specialTraining.at(ability.trainingType) >= ability.skillRequired;
+    }
+    return false;
+}
+
+// A copy of the config with every bounty and the witness multiplier raised by
+// one, so a reader can tell whether a snapshot mixes the two
+std::string writeShiftedConfig(const nlohmann::json& config)
+{
+    nlohmann::json shifted = config;
+    for (auto& [type, bounty] : shifted["baseBounties"].items()) {
+        bounty = bounty.get<int>() + 1;
+    }
+    shifted["crimeConfig"]["bountyWitnessMultiplier"] = config["crimeConfig"]["bountyWitnessMultiplier"].get<int>() + 1;
+
+    std::string path = (std::filesystem::temp_directory_path() / "ConfigSnapshotBenchmark.json").string();
+    std::ofstream file(path);
+    file << shifted;
+    return path;
+}
+
+} // namespace
+
+int main()
+{
+    const std::string crimePath = OATH_RESOURCE_DIR "/CrimeLaw.json";
+    std::ifstream file(crimePath);
+    if (!file.is_open()) {
+        std::cerr << "Could not open " << crimePath << std::endl;
+        return 1;
+    }
+    nlohmann::json crimeConfig;
+    file >> crimeConfig;
+    loadCrimeLawConfig(crimePath);
+
+    // Every crime type, severity and witness combination
+    int mismatches = 0;
+    std::vector<CrimeRecord> records;
+    for (auto& [type, bounty] : crimeConfig["baseBounties"].items()) {
+        for (int severity = 1; severity <= 10; severity++) {
+            for (bool witnessed : { false, true }) {
+                records.emplace_back(type, "region", "town", witnessed, severity);
+                mismatches += records.back().bounty != oldBounty(crimeConfig, type, severity, witnessed);
+            }
+        }
+    }
+
+    long sum = 0;
+    auto start = BenchmarkClock::now();
+    for (int i = 0; i < LOOKUPS; i++) {
+        const CrimeRecord& record = records[i % records.size()];
+        sum += oldBounty(crimeConfig, record.type, record.severity, record.witnessed);
+    }
+    double oldBountyTime = microsecondsSince(start) * 1000.0 / LOOKUPS;
+
+    start = BenchmarkClock::now();
+    for (int i = 0; i < LOOKUPS; i++) {
+        sum += records[i % records.size()].calculateBounty();
+    }
+    double bountyTime = microsecondsSince(start) * 1000.0 / LOOKUPS;
+
+    // One mount of every breed, with training and stamina across their ranges
+    std::ostringstream sink;
+    std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+    MountSystemController mounts("MountSystem", OATH_RESOURCE_DIR "/Mount.json");
+    std::cout.rdbuf(console);
+    auto mountConfig = mounts.config.get();
+    MountSystemConfig oldConfig = *mountConfig;
+
+    std::vector<MountStats> stats;
+    for (const auto& [breedId, breed] : mounts.breedTypes) {
+        Mount* mount = mounts.createMount("Bench", breedId);
+        for (int level = 0; level <= 100; level += 25) {
+            MountStats trained = mount->stats;
+            trained.stamina = level;
+            for (const auto& [type, description] : mountConfig->trainingTypes) {
+                trained.specialTraining[type] = level;
+            }
+            stats.push_back(trained);
+        }
+        delete mount;
+    }
+    std::vector<std::string> abilities;
+    for (const auto& [id, ability] : mountConfig->specialAbilities) {
+        abilities.push_back(id);
+    }
+    abilities.push_back("unknown");
+
+    int usable = 0;
+    for (const MountStats& s : stats) {
+        for (const std::string& ability : abilities) {
+            bool now = mountConfig->canUseAbility(s, ability);
+            usable += now;
+            mismatches += now != oldCanUseAbility(oldConfig, s, ability);
+        }
+    }
+
+    start = BenchmarkClock::now();
+    for (int i = 0; i < LOOKUPS; i++) {
+        sum += oldCanUseAbility(oldConfig, stats[i % stats.size()], abilities[i % abilities.size()]);
+    }
+    double oldAbilityTime = microsecondsSince(start) * 1000.0 / LOOKUPS;
+
+    start = BenchmarkClock::now();
+    for (int i = 0; i < LOOKUPS; i++) {
+        sum += mounts.config.get()->canUseAbility(stats[i % stats.size()], abilities[i % abilities.size()]);
+    }
+    double abilityTime = microsecondsSince(start) * 1000.0 / LOOKUPS;
+    keepAlive(sum);
+
+    // Reloads alternate between the shipped config and the shifted copy; a
+    // snapshot must hold one or the other whole
+    const std::string shiftedPath = writeShiftedConfig(crimeConfig);
+    auto base = crimeLawSettings();
+    std::atomic<bool> reloading(true);
+    std::atomic<long> inconsistent(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; r++) {
+        readers.emplace_back([&]() {
+            long bad = 0;
+            for (int i = 0; i < READS_PER_READER || reloading; i++) {
+                auto law = crimeLawSettings();
+                int shift = law->bountyWitnessMultiplier - base->bountyWitnessMultiplier;
+                for (int k = 0; k < CRIME_KIND_COUNT - 1; k++) {
+                    bad += law->baseBounty[k] - base->baseBounty[k] != shift;
+                }
+            }
+            inconsistent += bad;
+        });
+    }
+    for (int i = 0; i < RELOADS; i++) {
+        loadCrimeLawConfig(i % 2 == 0 ? shiftedPath : crimePath);
+    }
+    loadCrimeLawConfig(crimePath);
+    reloading = false;
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    std::filesystem::remove(shiftedPath);
+    mismatches += static_cast<int>(inconsistent);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "crime bounty    " << std::setw(10) << oldBountyTime << " ns via JSON, "
+              << bountyTime << " ns via snapshot\n"
+              << "mount ability   " << std::setw(10) << oldAbilityTime << " ns on the config, "
+              << abilityTime << " ns taking the snapshot, " << usable << "/" << stats.size() * abilities.size()
+              << " usable\n"
+              << "reloads         " << std::setw(10) << RELOADS << " during " << READERS << "x"
+              << READS_PER_READER << " reads, " << inconsistent << " inconsistent\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+// benchmarks/DiseaseExposureBenchmark.cpp
+// Exposure checks against 1000 diseases: the scan over the disease map that
+// DiseaseManager::checkExposure used, against DiseaseIndex and immunity slots.
+#include "BenchmarkClock.hpp"
+#include "systems/health/DiseaseIndex.hpp"
+#include "systems/health/DiseaseManager.hpp"
+#include "systems/health/HealthState.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+
+// Every allocation in the process, to show the checks allocate nothing
+namespace {
+long long allocations = 0;
+}
+
+void* operator new(size_t size)
+{
+    allocations++;
+    void* p = std::malloc(size);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+// Symptom.cpp and DiseaseManager.cpp do not build on their own yet (the health
+// sources are still off in the top-level CMakeLists). These stand in for the
+// two functions the disease and health sources link against; nothing here
+// loads symptoms from JSON or contracts a disease.
+Symptom::Symptom(const nlohmann::json&)
+    : severity(SymptomSeverity::NONE)
+    , hasDamageOverTime(false)
+    , damagePerUpdate(0.0f)
+{
+}
+
+const Disease* DiseaseManager::getDiseaseById(const std::string&) const
+{
+    return nullptr;
+}
+
+namespace {
+
+const int DISEASES = 1000;
+const int REGIONS = 500;
+const int REGIONS_PER_DISEASE = 20;
+const int IMMUNITIES = 30;
+const int QUERIES = 200000;
+const int QUERY_MASK = 4095;
+const int CURRENT_DAY = 10;
+const char* const VECTORS[] = { "air", "water", "contact", "food", "insect" };
+
+// DiseaseManager::checkExposure's lookup before DiseaseIndex
+float oldExposure(const std::map<std::string, Disease>& diseases, const HealthState& health, const std::string& region, const std::string& vector)
+{
+    std::vector<const Disease*> common;
+    for (const auto& [id, disease] : diseases) {
+        if (disease.isCommonIn(region)) {
+            common.push_back(&disease);
+        }
+    }
+
+    float risk = 0.0f;
+    for (const Disease* disease : common) {
+        if (!disease->transmitsVia(vector) || health.hasDisease(disease->id)) {
+            continue;
+        }
+        risk += disease->contagiousness * (1.0f - health.getImmunityStrength(disease->id, CURRENT_DAY));
+    }
+    return risk;
+}
+
+float indexedExposure(const DiseaseIndex& index, HealthState& health, const std::string& region, const std::string& vector)
+{
+    if (!health.immunitySlotsCurrent(index)) {
+        health.indexImmunities(index);
+    }
+
+    float risk = 0.0f;
+    for (int slot : index.find(region, vector)) {
+        const Disease& disease = index.disease(slot);
+        if (health.hasDisease(disease.id)) {
+            continue;
+        }
+        risk += disease.contagiousness * (1.0f - health.getImmunityStrength(slot, CURRENT_DAY));
+    }
+    return risk;
+}
+
+} // namespace
+
+int main()
+{
+    // Each disease common in 20 regions and spread by one to three vectors
+    std::mt19937 rng(7);
+    std::map<std::string, Disease> diseases;
+    for (int d = 0; d < DISEASES; d++) {
+        Disease disease("disease_" + std::to_string(d), "Disease " + std::to_string(d));
+        for (int r = 0; r < REGIONS_PER_DISEASE; r++) {
+            disease.addRegion("region_" + std::to_string(rng() % REGIONS));
+        }
+        for (int v = 1 + static_cast<int>(rng() % 3); v > 0; v--) {
+            disease.addVector(VECTORS[rng() % 5]);
+        }
+        diseases.emplace(disease.id, disease);
+    }
+
+    VitalsTable vitals;
+    HealthState health(vitals, vitals.add());
+    for (int i = 0; i < IMMUNITIES; i++) {
+        health.immunities.push_back(Immunity("disease_" + std::to_string(rng() % DISEASES), 0.8f, -1, 0));
+    }
+
+    std::vector<std::string> regions;
+    std::vector<std::string> vectors;
+    for (int q = 0; q <= QUERY_MASK; q++) {
+        regions.push_back("region_" + std::to_string(rng() % REGIONS));
+        vectors.push_back(VECTORS[rng() % 5]);
+    }
+
+    float oldSum = 0.0f;
+    long long before = allocations;
+    auto start = BenchmarkClock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        oldSum += oldExposure(diseases, health, regions[q & QUERY_MASK], vectors[q & QUERY_MASK]);
+    }
+    double oldTime = microsecondsSince(start) * 1000.0 / QUERIES;
+    double oldAllocations = static_cast<double>(allocations - before) / QUERIES;
+
+    DiseaseIndex index;
+    start = BenchmarkClock::now();
+    index.build(diseases);
+    double buildTime = microsecondsSince(start) / 1000.0;
+    health.indexImmunities(index);
+
+    float indexedSum = 0.0f;
+    before = allocations;
+    start = BenchmarkClock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        indexedSum += indexedExposure(index, health, regions[q & QUERY_MASK], vectors[q & QUERY_MASK]);
+    }
+    double indexedTime = microsecondsSince(start) * 1000.0 / QUERIES;
+    double indexedAllocations = static_cast<double>(allocations - before) / QUERIES;
+    keepAlive(oldSum + indexedSum);
+
+    int mismatches = 0;
+    for (int q = 0; q <= QUERY_MASK; q++) {
+        float expected = oldExposure(diseases, health, regions[q], vectors[q]);
+        mismatches += std::abs(expected - indexedExposure(index, health, regions[q], vectors[q])) > 1e-5f;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "disease map scan  " << std::setw(10) << oldTime << " ns/check, "
+              << std::setprecision(2) << oldAllocations << " allocations/check\n"
+              << std::setprecision(1)
+              << "DiseaseIndex      " << std::setw(10) << indexedTime << " ns/check, "
+              << std::setprecision(2) << indexedAllocations << " allocations/check\n"
+              << "index built in " << buildTime << " ms\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
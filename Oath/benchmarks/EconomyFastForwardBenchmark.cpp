@@ -0,0 +1,281 @@
+// benchmarks/EconomyFastForwardBenchmark.cpp
+// A 30-day skip of 50 quiet markets, day by day against one step: the markets
+// alone, then through EconomicSystemNode::advanceDays, which still records
+// every day's prices. Then checks the skip against 30 single days: markets by
+// their odds over many trials, the asset ledger's counts and totals exactly.
+#include "BenchmarkClock.hpp"
+#include "systems/economy/AssetLedger.hpp"
+#include "systems/economy/EconomicSystemNode.hpp"
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int MARKETS = 50;
+const int SPAN = 30;
+const int REPEATS = 20;
+const int TRIALS = 20000;
+const double Z_LIMIT = 4.5;
+const int PROPERTIES = 200;
+const int INVESTMENTS = 100;
+const char* const GOODS[] = { "iron", "grain", "silk", "timber", "spice" };
+const int GOOD_COUNT = 5;
+
+Market* makeMarket(int index)
+{
+    Market* market = new Market("market_" + std::to_string(index), "Market", MarketType::GENERAL);
+    market->restockDays = 5 + index % 4;
+    market->daysSinceRestock = index % 3;
+    for (int g = 0; g < GOOD_COUNT; g++) {
+        float price = 10.0f + g * 10.0f;
+        int supply = 100 + ((index * 7 + g) % 5) * 20;
+        market->commodities.push_back({ GOODS[g], GOODS[g], price, price, supply, 80, 100, 80, "", g == 2, 0.2f });
+    }
+    return market;
+}
+
+// An economy with markets and nothing else, so advanceDays may skip
+void buildEconomy(EconomicSystemNode& economy)
+{
+    for (Market* market : economy.markets) {
+        delete market;
+    }
+    economy.markets.clear();
+    economy.tradeRoutes.clear();
+    economy.activeEvents.clear();
+    economy.potentialEvents.clear();
+    economy.traders = TraderSimulation();
+    for (int m = 0; m < MARKETS; m++) {
+        economy.markets.push_back(makeMarket(m));
+    }
+}
+
+// Running sums of a value and its square
+struct Moments {
+    double sum = 0.0;
+    double squares = 0.0;
+    double fourth = 0.0;
+
+    void add(double x)
+    {
+        sum += x;
+        squares += x * x;
+        fourth += x * x * x * x;
+    }
+};
+
+// Welch z of the means of x (or of x squared) between two samples of n
+double meanZ(const Moments& a, const Moments& b, int n, bool squared)
+{
+    double meanA = (squared ? a.squares : a.sum) / n;
+    double meanB = (squared ? b.squares : b.sum) / n;
+    double varA = (squared ? a.fourth : a.squares) / n - meanA * meanA;
+    double varB = (squared ? b.fourth : b.squares) / n - meanB * meanB;
+    double error = std::sqrt((varA + varB) / n);
+    return error > 0.0 ? std::abs(meanA - meanB) / error : (meanA == meanB ? 0.0 : 1e9);
+}
+
+// Supply, demand and price of every commodity after the span, day by day
+// against one step. Restock timing is deterministic and must match exactly.
+int checkMarketOdds(const Market& reference, double& worstZ)
+{
+    int mismatches = 0;
+    Moments daily[GOOD_COUNT][3];
+    Moments skipped[GOOD_COUNT][3];
+    std::vector<float> closingPrices;
+    for (int trial = 0; trial < TRIALS; trial++) {
+        Market a = reference;
+        Market b = reference;
+        for (int day = 0; day < SPAN; day++) {
+            a.advanceDay();
+        }
+        b.fastForward(SPAN, &closingPrices);
+        mismatches += a.daysSinceRestock != b.daysSinceRestock;
+        for (int g = 0; g < GOOD_COUNT; g++) {
+            mismatches += closingPrices[g * SPAN + SPAN - 1] != b.commodities[g].currentPrice;
+            daily[g][0].add(a.commodities[g].supply);
+            daily[g][1].add(a.commodities[g].demand);
+            daily[g][2].add(a.commodities[g].currentPrice);
+            skipped[g][0].add(b.commodities[g].supply);
+            skipped[g][1].add(b.commodities[g].demand);
+            skipped[g][2].add(b.commodities[g].currentPrice);
+        }
+    }
+
+    for (int g = 0; g < GOOD_COUNT; g++) {
+        for (int v = 0; v < 3; v++) {
+            for (bool squared : { false, true }) {
+                double z = meanZ(daily[g][v], skipped[g][v], TRIALS, squared);
+                worstZ = std::max(worstZ, z);
+                mismatches += z > Z_LIMIT;
+            }
+        }
+    }
+    return mismatches;
+}
+
+void buildLedger(AssetLedger& ledger, unsigned int seed)
+{
+    ledger.setSeed(seed);
+    for (int p = 0; p < PROPERTIES; p++) {
+        Property property;
+        property.weeklyIncome = 70 + p;
+        property.weeklyUpkeep = 10 + p % 7;
+        for (int t = 0; t < 2; t++) {
+            Property::Tenant tenant;
+            tenant.rentAmount = 20 + t * 5;
+            tenant.daysSinceLastPayment = (p + t) % 3;
+            tenant.paymentInterval = 3 + (p + t) % 7;
+            tenant.reliability = 0.7f;
+            property.tenants.push_back(tenant);
+        }
+        ledger.addProperty(property, p % 4, p, p % 7);
+    }
+    for (int i = 0; i < INVESTMENTS; i++) {
+        BusinessInvestment investment;
+        investment.playerInvestment = 1000;
+        investment.daysSinceLastPayout = i % 5;
+        investment.payoutInterval = 5 + i % 10;
+        ledger.addInvestment(investment, i % 4, i);
+    }
+}
+
+// Totals per entry type: events counted and gold moved
+void tally(const AssetLedger& ledger, long counts[5], long amounts[5])
+{
+    for (const LedgerTransaction& entry : ledger.getTransactions()) {
+        counts[static_cast<int>(entry.type)] += entry.count;
+        amounts[static_cast<int>(entry.type)] += entry.amount;
+    }
+}
+
+// Income, upkeep, due rent and payouts are fixed by the calendar; only rent
+// paid against missed and the payout amounts are random
+int checkLedger()
+{
+    AssetLedger daily;
+    AssetLedger skipped;
+    buildLedger(daily, 1);
+    buildLedger(skipped, 2);
+    for (int day = 0; day < SPAN; day++) {
+        daily.settleDay(1.0f);
+    }
+    skipped.fastForward(SPAN, 1.0f);
+
+    long dailyCounts[5] = {};
+    long dailyAmounts[5] = {};
+    long skippedCounts[5] = {};
+    long skippedAmounts[5] = {};
+    tally(daily, dailyCounts, dailyAmounts);
+    tally(skipped, skippedCounts, skippedAmounts);
+
+    const int income = static_cast<int>(LedgerEntryType::PROPERTY_INCOME);
+    const int paid = static_cast<int>(LedgerEntryType::RENT_PAID);
+    const int missed = static_cast<int>(LedgerEntryType::RENT_MISSED);
+    const int upkeep = static_cast<int>(LedgerEntryType::UPKEEP);
+    const int profit = static_cast<int>(LedgerEntryType::INVESTMENT_PROFIT);
+    int mismatches = 0;
+    mismatches += dailyAmounts[income] != skippedAmounts[income];
+    mismatches += dailyAmounts[upkeep] != skippedAmounts[upkeep] || dailyCounts[upkeep] != skippedCounts[upkeep];
+    mismatches += dailyCounts[paid] + dailyCounts[missed] != skippedCounts[paid] + skippedCounts[missed];
+    mismatches += dailyCounts[profit] != skippedCounts[profit];
+    mismatches += daily.getCurrentDay() != skipped.getCurrentDay();
+    return mismatches;
+}
+
+} // namespace
+
+int main()
+{
+    // Restocks print, and look for a stock file this rig does not have
+    std::ostringstream sink;
+    std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+    std::streambuf* errors = std::cerr.rdbuf(sink.rdbuf());
+
+    EconomicSystemNode daily("EconomicSystem");
+    EconomicSystemNode skipped("EconomicSystem");
+    buildEconomy(daily);
+    buildEconomy(skipped);
+
+    // The markets' own drift, without the price history
+    std::vector<Market*> markets;
+    for (int m = 0; m < MARKETS; m++) {
+        markets.push_back(makeMarket(m));
+    }
+    double marketDailyTime = 0.0;
+    double marketSkippedTime = 0.0;
+    for (int r = 0; r < REPEATS; r++) {
+        auto start = BenchmarkClock::now();
+        for (int day = 0; day < SPAN; day++) {
+            for (Market* market : markets) {
+                market->advanceDay();
+            }
+        }
+        marketDailyTime += microsecondsSince(start);
+
+        start = BenchmarkClock::now();
+        for (Market* market : markets) {
+            market->fastForward(SPAN);
+        }
+        marketSkippedTime += microsecondsSince(start);
+        sink.str("");
+    }
+
+    double dailyTime = 0.0;
+    double skippedTime = 0.0;
+    for (int r = 0; r < REPEATS; r++) {
+        auto start = BenchmarkClock::now();
+        for (int day = 0; day < SPAN; day++) {
+            daily.advanceDays(1);
+        }
+        dailyTime += microsecondsSince(start);
+
+        start = BenchmarkClock::now();
+        skipped.advanceDays(SPAN);
+        skippedTime += microsecondsSince(start);
+        sink.str("");
+    }
+
+    // Both must have closed every day of every commodity
+    int mismatches = 0;
+    for (int m = 0; m < MARKETS; m++) {
+        for (int g = 0; g < GOOD_COUNT; g++) {
+            const std::string& market = daily.markets[m]->id;
+            mismatches += daily.priceHistory.getSeries(market, GOODS[g]).getRecordedDays() != REPEATS * SPAN;
+            mismatches += skipped.priceHistory.getSeries(market, GOODS[g]).getRecordedDays() != REPEATS * SPAN;
+        }
+        mismatches += daily.markets[m]->daysSinceRestock != skipped.markets[m]->daysSinceRestock;
+    }
+
+    // With restocks in the span, and without them, where the daily changes
+    // alone set the spread
+    double worstZ = 0.0;
+    Market* restocking = makeMarket(1);
+    Market* quiet = makeMarket(2);
+    quiet->restockDays = SPAN * 10;
+    mismatches += checkMarketOdds(*restocking, worstZ);
+    mismatches += checkMarketOdds(*quiet, worstZ);
+    for (Market* market : { restocking, quiet }) {
+        delete market;
+    }
+    for (Market* market : markets) {
+        delete market;
+    }
+    mismatches += checkLedger();
+
+    std::cout.rdbuf(console);
+    std::cerr.rdbuf(errors);
+    std::cout << std::fixed << std::setprecision(2)
+              << MARKETS << " markets, " << SPAN << "-day span\n"
+              << "markets alone   " << std::setw(10) << marketDailyTime / REPEATS / 1000.0 << " ms day by day, "
+              << marketSkippedTime / REPEATS / 1000.0 << " ms in one step\n"
+              << "with history    " << std::setw(10) << dailyTime / REPEATS / 1000.0 << " ms day by day, "
+              << skippedTime / REPEATS / 1000.0 << " ms in one step\n"
+              << "market odds     " << std::setw(10) << TRIALS << " trials, worst z " << worstZ << "\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+// benchmarks/EffectTimelineBenchmark.cpp
+// 1M timed effects over 100k owners: per-owner maps polled every day, as
+// ReligiousStats kept blessings, against EffectTimeline. Then a randomized
+// check of the timeline against a plain map model.
+#include "BenchmarkClock.hpp"
+#include "data/EffectTimeline.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int OWNERS = 100000;
+const int KINDS = 10;
+const int STATS = 4;
+const int EFFECTS = OWNERS * KINDS;
+const int DAYS = 100;
+const int REFRESHES_PER_DAY = 10000;
+const int OLD_DAYS = 10;
+const int MODIFIER_READS = 10000000;
+
+// ReligiousStats::updateBlessings before the timeline, for every owner
+void oldAdvanceDay(std::vector<std::map<std::string, int>>& owners)
+{
+    for (auto& durations : owners) {
+        std::set<std::string> expired;
+        for (auto& [effect, duration] : durations) {
+            duration--;
+            if (duration <= 0) {
+                expired.insert(effect);
+            }
+        }
+        for (const auto& effect : expired) {
+            durations.erase(effect);
+        }
+    }
+}
+
+// Every operation mirrored in a map keyed by (owner, kind); returns how
+// often the timeline disagreed with it
+long randomizedCheck()
+{
+    const int owners = 300;
+    const int kinds = 20;
+    const int stats = 12;
+    const int steps = 200000;
+
+    struct Expected {
+        int64_t expiresAt;
+        int stat;
+        float amount;
+    };
+
+    std::mt19937_64 rng(11);
+    EffectTimeline timeline;
+    std::map<std::pair<int, int>, Expected> model;
+    for (int s = 0; s < stats; s++) {
+        timeline.statId("stat_" + std::to_string(s));
+    }
+
+    int64_t now = 0;
+    long mismatches = 0;
+    std::vector<EffectRecord> expired;
+    for (int step = 0; step < steps; step++) {
+        int op = static_cast<int>(rng() % 10);
+        if (op < 6) {
+            // Some expiries already past, some far beyond the wheel
+            int owner = static_cast<int>(rng() % owners);
+            int kind = static_cast<int>(rng() % kinds);
+            int64_t expiresAt = now + static_cast<int64_t>(rng() % 3000) - 5;
+            int stat = static_cast<int>(rng() % (stats + 1)) - 1;
+            float amount = static_cast<float>(rng() % 7);
+            timeline.apply(owner, kind, expiresAt, stat, amount);
+            if (expiresAt <= now) {
+                model.erase({ owner, kind });
+            } else {
+                model[{ owner, kind }] = { expiresAt, stat, amount };
+            }
+        } else if (op < 8) {
+            int owner = static_cast<int>(rng() % owners);
+            int kind = static_cast<int>(rng() % kinds);
+            mismatches += timeline.remove(owner, kind) != (model.erase({ owner, kind }) > 0);
+        } else {
+            int64_t to = now + static_cast<int64_t>(rng() % 4 == 0 ? rng() % 5000 : rng() % 3);
+            expired.clear();
+            int ended = timeline.advanceTo(to, &expired);
+
+            int expected = 0;
+            for (auto it = model.begin(); it != model.end();) {
+                if (it->second.expiresAt <= to) {
+                    expected++;
+                    it = model.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            int64_t previous = -1;
+            for (const EffectRecord& record : expired) {
+                mismatches += record.expiresAt < previous;
+                previous = record.expiresAt;
+            }
+            mismatches += ended != expected || static_cast<int>(expired.size()) != ended;
+            now = std::max(now, to);
+        }
+
+        if (step % 1000 == 0) {
+            for (int owner = 0; owner < owners; owner++) {
+                for (int stat = 0; stat < stats; stat++) {
+                    float sum = 0.0f;
+                    for (const auto& [key, effect] : model) {
+                        if (key.first == owner && effect.stat == stat) {
+                            sum += effect.amount;
+                        }
+                    }
+                    mismatches += std::abs(sum - timeline.modifier(owner, stat)) > 1e-3f;
+                }
+            }
+            mismatches += static_cast<int>(model.size()) != timeline.size();
+            for (const auto& [key, effect] : model) {
+                mismatches += timeline.expiresAt(key.first, key.second) != effect.expiresAt;
+            }
+        }
+    }
+    return mismatches;
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 rng(5);
+    EffectTimeline timeline;
+    int stats[STATS];
+    for (int s = 0; s < STATS; s++) {
+        stats[s] = timeline.statId("stat_" + std::to_string(s));
+    }
+    int kinds[KINDS];
+    for (int k = 0; k < KINDS; k++) {
+        kinds[k] = timeline.kindId("effect_" + std::to_string(k));
+    }
+    std::vector<int> durations(EFFECTS);
+    for (int& duration : durations) {
+        duration = 1 + static_cast<int>(rng() % DAYS);
+    }
+
+    auto start = BenchmarkClock::now();
+    for (int i = 0; i < EFFECTS; i++) {
+        timeline.apply(i / KINDS, kinds[i % KINDS], durations[i], stats[i % STATS], 1.0f);
+    }
+    double applyTime = microsecondsSince(start) * 1000.0 / EFFECTS;
+
+    // New effects arrive and old ones are refreshed between days
+    std::vector<EffectRecord> expired;
+    double advanceTotal = 0.0;
+    double advanceWorst = 0.0;
+    long ended = 0;
+    for (int day = 1; day <= DAYS; day++) {
+        for (int r = 0; r < REFRESHES_PER_DAY; r++) {
+            int owner = static_cast<int>(rng() % OWNERS);
+            int k = static_cast<int>(rng() % KINDS);
+            timeline.apply(owner, kinds[k], day + 1 + static_cast<int64_t>(rng() % DAYS), stats[k % STATS], 1.0f);
+        }
+        expired.clear();
+        start = BenchmarkClock::now();
+        ended += timeline.advanceTo(day, &expired);
+        double elapsed = microsecondsSince(start) / 1000.0;
+        advanceTotal += elapsed;
+        advanceWorst = std::max(advanceWorst, elapsed);
+    }
+
+    float sum = 0.0f;
+    start = BenchmarkClock::now();
+    for (int q = 0; q < MODIFIER_READS; q++) {
+        sum += timeline.modifier(q % OWNERS, stats[q % STATS]);
+    }
+    double modifierTime = microsecondsSince(start) * 1000.0 / MODIFIER_READS;
+    keepAlive(sum);
+
+    std::vector<std::map<std::string, int>> oldOwners(OWNERS);
+    for (int i = 0; i < EFFECTS; i++) {
+        oldOwners[i / KINDS]["effect_" + std::to_string(i % KINDS)] = durations[i];
+    }
+    start = BenchmarkClock::now();
+    for (int day = 0; day < OLD_DAYS; day++) {
+        oldAdvanceDay(oldOwners);
+    }
+    double oldDayTime = microsecondsSince(start) / 1000.0 / OLD_DAYS;
+
+    long mismatches = randomizedCheck();
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "apply                 " << std::setw(10) << applyTime << " ns/effect\n"
+              << "advance a day         " << std::setw(10) << advanceTotal / DAYS << " ms avg, "
+              << advanceWorst << " ms worst, " << ended / DAYS << " ended/day\n"
+              << "polling maps          " << std::setw(10) << oldDayTime << " ms/day\n"
+              << "modifier read         " << std::setw(10) << modifierTime << " ns\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
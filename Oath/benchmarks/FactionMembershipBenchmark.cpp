@@ -0,0 +1,141 @@
+// benchmarks/FactionMembershipBenchmark.cpp
+// Membership queries over 100k NPCs: scanning Faction::members sets and
+// per-location lists, against FactionMembershipIndex.
+#include "BenchmarkClock.hpp"
+#include "systems/faction/FactionMembershipIndex.hpp"
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+
+using oath::Faction;
+using oath::FactionMembershipIndex;
+
+namespace {
+
+const int NPCS = 100000;
+const int FACTIONS = 200;
+const int REGIONS = 50;
+const int LOCATIONS = 2000;
+const int QUERIES = 20000;
+
+template <typename Query>
+void time(const std::string& label, Query query, long& checksum)
+{
+    auto start = BenchmarkClock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        checksum += query(q);
+    }
+    std::cout << std::left << std::setw(44) << label << std::right << std::fixed << std::setprecision(3)
+              << std::setw(10) << microsecondsSince(start) / QUERIES << " us" << std::endl;
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(7);
+    std::map<std::string, Faction> factions;
+    std::vector<std::string> factionIds;
+    for (int f = 0; f < FACTIONS; f++) {
+        factionIds.push_back("faction_" + std::to_string(f));
+        factions[factionIds.back()] = Faction(factionIds.back(), factionIds.back());
+    }
+
+    // NPCs fill locations in order, each in three random factions
+    std::vector<std::string> npcIds;
+    std::vector<int> npcLocation;
+    std::vector<std::vector<std::string>> locationNpcs(LOCATIONS);
+    std::unordered_map<std::string, int> npcRegion;
+    for (int n = 0; n < NPCS; n++) {
+        npcIds.push_back("npc_" + std::to_string(n));
+        int location = n / (NPCS / LOCATIONS);
+        npcLocation.push_back(location);
+        npcRegion[npcIds.back()] = location / (LOCATIONS / REGIONS);
+        locationNpcs[location].push_back(npcIds.back());
+        for (int k = 0; k < 3; k++) {
+            factions[factionIds[rng() % FACTIONS]].members.insert(npcIds.back());
+        }
+    }
+
+    auto start = BenchmarkClock::now();
+    FactionMembershipIndex index;
+    for (const auto& id : factionIds) {
+        index.addFaction(id);
+    }
+    for (const auto& id : npcIds) {
+        index.addNpc(id);
+    }
+    index.loadFromFactions(factions);
+    for (int r = 0; r < REGIONS; r++) {
+        index.addRegion("region_" + std::to_string(r));
+    }
+    for (int l = 0; l < LOCATIONS; l++) {
+        index.addLocation("location_" + std::to_string(l));
+    }
+    for (int n = 0; n < NPCS; n++) {
+        index.placeNpc(n, npcRegion[npcIds[n]], npcLocation[n]);
+    }
+    std::cout << "index built in " << std::fixed << std::setprecision(1) << microsecondsSince(start) / 1000.0 << " ms" << std::endl;
+
+    // Registered in order, so faction index f is factionIds[f]
+    long checksum = 0;
+    time("factions of an NPC, scanning member sets", [&](int q) {
+        const std::string& id = npcIds[(q * 7919) % NPCS];
+        int count = 0;
+        for (const auto& [factionId, faction] : factions) {
+            count += static_cast<int>(faction.members.count(id));
+        }
+        return count;
+    }, checksum);
+    time("factions of an NPC, index", [&](int q) {
+        return index.factionCountOf((q * 7919) % NPCS);
+    }, checksum);
+
+    time("members at a location, list x set lookups", [&](int q) {
+        const Faction& faction = factions[factionIds[q % FACTIONS]];
+        int count = 0;
+        for (const auto& id : locationNpcs[(q * 31) % LOCATIONS]) {
+            count += static_cast<int>(faction.members.count(id));
+        }
+        return count;
+    }, checksum);
+    time("members at a location, index", [&](int q) {
+        return index.countMembersAtLocation(q % FACTIONS, (q * 31) % LOCATIONS);
+    }, checksum);
+
+    time("members in a region, scanning members", [&](int q) {
+        const Faction& faction = factions[factionIds[q % FACTIONS]];
+        int region = (q * 13) % REGIONS;
+        int count = 0;
+        for (const auto& id : faction.members) {
+            count += npcRegion[id] == region ? 1 : 0;
+        }
+        return count;
+    }, checksum);
+    time("members in a region, index", [&](int q) {
+        return index.countMembersInRegion(q % FACTIONS, (q * 13) % REGIONS);
+    }, checksum);
+    keepAlive(checksum);
+
+    int mismatches = 0;
+    for (int q = 0; q < 500; q++) {
+        const Faction& faction = factions[factionIds[q % FACTIONS]];
+        int f = index.factionIndex(factionIds[q % FACTIONS]);
+        int region = (q * 13) % REGIONS;
+        int location = (q * 31) % LOCATIONS;
+
+        int inRegion = 0;
+        for (const auto& id : faction.members) {
+            inRegion += npcRegion[id] == region ? 1 : 0;
+        }
+        int atLocation = 0;
+        for (const auto& id : locationNpcs[location]) {
+            atLocation += static_cast<int>(faction.members.count(id));
+        }
+        mismatches += inRegion != index.countMembersInRegion(f, region);
+        mismatches += atLocation != index.countMembersAtLocation(f, location);
+    }
+    std::cout << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,195 @@
+// benchmarks/FactionRelationBenchmark.cpp
+// Reputation ripples and relation state lookups: the nested string maps
+// FactionSystemNode used before FactionRelationMatrix, against the matrix.
+#include "BenchmarkClock.hpp"
+#include "systems/faction/FactionRelationMatrix.hpp"
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using oath::FactionRelationMatrix;
+
+namespace {
+
+// The old layout: factionRelations[a][b] holding the value and its state
+struct MapRelation {
+    int value = 0;
+    std::string state = "neutral";
+};
+using RelationMap = std::map<std::string, std::map<std::string, MapRelation>>;
+
+const std::map<std::string, int> THRESHOLDS = {
+    { "war", -75 }, { "hostile", -50 }, { "unfriendly", -20 }, { "neutral", 20 },
+    { "friendly", 50 }, { "cordial", 75 }, { "allied", 100 }
+};
+
+std::string stateFor(int value)
+{
+    std::string state = "war";
+    int best = -1000;
+    for (const auto& [name, threshold] : THRESHOLDS) {
+        if (value >= threshold && threshold > best) {
+            best = threshold;
+            state = name;
+        }
+    }
+    return state;
+}
+
+int mapRelation(const RelationMap& relations, const std::string& a, const std::string& b)
+{
+    auto row = relations.find(a);
+    if (row == relations.end()) {
+        return 0;
+    }
+    auto cell = row->second.find(b);
+    return cell != row->second.end() ? cell->second.value : 0;
+}
+
+// FactionSystemNode::applyReputationRippleEffects before the matrix
+int oldRipple(int relation, int amount)
+{
+    if (relation >= 50) {
+        return amount / 2;
+    }
+    if (relation <= -50) {
+        return -amount / 3;
+    }
+    return 0;
+}
+
+void oldPropagate(const RelationMap& relations, const std::vector<std::string>& ids, int source, int amount, std::vector<int>& out)
+{
+    out.assign(ids.size(), 0);
+    if (std::abs(amount) < 5) {
+        return;
+    }
+    for (size_t other = 0; other < ids.size(); other++) {
+        if (static_cast<int>(other) != source) {
+            out[other] = oldRipple(mapRelation(relations, ids[source], ids[other]), amount);
+        }
+    }
+}
+
+// The matrix keeps fractional shares; the old rule truncated toward zero
+int truncated(float change)
+{
+    return static_cast<int>(change + (change > 0.0f ? 1e-4f : -1e-4f));
+}
+
+void runCase(int factionCount)
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> relationRoll(-100, 100);
+    std::uniform_int_distribution<int> factionRoll(0, factionCount - 1);
+
+    std::vector<std::string> ids;
+    RelationMap relations;
+    FactionRelationMatrix matrix;
+    for (int i = 0; i < factionCount; i++) {
+        ids.push_back("faction_" + std::to_string(i));
+        matrix.addFaction(ids.back());
+    }
+    matrix.configureRipple({ { "hops", 1 } });
+
+    // Every pair exists as the old node created them; about six strong ties each
+    for (int a = 0; a < factionCount; a++) {
+        for (int b = 0; b < factionCount; b++) {
+            if (a != b) {
+                relations[ids[a]][ids[b]] = MapRelation();
+            }
+        }
+    }
+    for (int a = 0; a < factionCount; a++) {
+        for (int k = 0; k < 6; k++) {
+            int b = factionRoll(rng);
+            if (b == a) {
+                continue;
+            }
+            int value = relationRoll(rng);
+            relations[ids[a]][ids[b]] = { value, stateFor(value) };
+            matrix.set(a, b, value);
+        }
+    }
+
+    const int rounds = factionCount <= 100 ? 2000 : 200;
+    std::vector<int> oldOut;
+    std::vector<float> matrixOut;
+
+    auto start = BenchmarkClock::now();
+    for (int r = 0; r < rounds; r++) {
+        oldPropagate(relations, ids, r % factionCount, r % 2 ? 12 : -20, oldOut);
+        keepAlive(oldOut);
+    }
+    double oldRippleTime = microsecondsSince(start) / rounds;
+
+    start = BenchmarkClock::now();
+    for (int r = 0; r < rounds; r++) {
+        matrix.propagate(r % factionCount, r % 2 ? 12 : -20, matrixOut);
+        keepAlive(matrixOut);
+    }
+    double matrixRippleTime = microsecondsSince(start) / rounds;
+
+    // One hop with the default shares must match the old rule exactly
+    long mismatches = 0;
+    for (int source = 0; source < factionCount; source++) {
+        for (int amount : { 12, -20, 7, 3 }) {
+            oldPropagate(relations, ids, source, amount, oldOut);
+            matrix.propagate(source, amount, matrixOut);
+            for (int other = 0; other < factionCount; other++) {
+                mismatches += truncated(matrixOut[other]) != oldOut[other];
+            }
+        }
+    }
+
+    matrix.configureRipple({ { "hops", 3 }, { "decay", 0.5 } });
+    start = BenchmarkClock::now();
+    for (int r = 0; r < rounds; r++) {
+        matrix.propagate(r % factionCount, 12, matrixOut);
+        keepAlive(matrixOut);
+    }
+    double threeHopTime = microsecondsSince(start) / rounds;
+
+    const int lookups = 200 * factionCount;
+    std::vector<std::pair<int, int>> pairs;
+    for (int k = 0; k < lookups; k++) {
+        int a = factionRoll(rng);
+        int b = factionRoll(rng);
+        if (a != b) {
+            pairs.push_back({ a, b });
+        }
+    }
+
+    size_t checksum = 0;
+    start = BenchmarkClock::now();
+    for (const auto& [a, b] : pairs) {
+        checksum += relations.at(ids[a]).at(ids[b]).state.size();
+    }
+    double oldLookupTime = microsecondsSince(start) * 1000.0 / pairs.size();
+
+    start = BenchmarkClock::now();
+    for (const auto& [a, b] : pairs) {
+        checksum += matrix.stateOf(matrix.indexOf(ids[a]), matrix.indexOf(ids[b])).size();
+    }
+    double matrixLookupTime = microsecondsSince(start) * 1000.0 / pairs.size();
+    keepAlive(checksum);
+
+    std::cout << std::fixed << std::setprecision(2)
+              << factionCount << " factions: ripple maps " << oldRippleTime << " us, matrix "
+              << matrixRippleTime << " us, matrix 3 hops " << threeHopTime << " us, "
+              << mismatches << " mismatches | state lookup maps " << oldLookupTime
+              << " ns, matrix " << matrixLookupTime << " ns" << std::endl;
+}
+
+} // namespace
+
+int main()
+{
+    for (int factionCount : { 6, 100, 300, 600 }) {
+        runCase(factionCount);
+    }
+    return 0;
+}
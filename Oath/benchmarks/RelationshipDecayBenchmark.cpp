@@ -0,0 +1,138 @@
+// benchmarks/RelationshipDecayBenchmark.cpp
+// The player's daily relationship pass over 100k NPCs: NPCRelationshipManager's
+// string-keyed maps and config getters, against PlayerRelationTable.
+#include "BenchmarkClock.hpp"
+#include "systems/relationship/PlayerRelationTable.hpp"
+#include "systems/relationship/RelationshipConfig.hpp"
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+
+namespace {
+
+const int NPCS = 100000;
+const int DAYS = 20;
+const int FAST_FORWARD_DAYS = 30;
+
+// NPCRelationshipManager's player maps before PlayerRelationTable
+struct OldPlayerRelations {
+    std::map<std::string, int> values;
+    std::map<std::string, RelationshipType> types;
+    std::map<std::string, RelationshipState> states;
+
+    void updateType(const std::string& npcId)
+    {
+        RelationshipConfig& config = RelationshipConfig::getInstance();
+        int value = values[npcId];
+        if (value <= config.getHatredThreshold()) {
+            types[npcId] = RelationshipType::Enemy;
+        } else if (value <= config.getDislikeThreshold()) {
+            types[npcId] = RelationshipType::Rival;
+        } else if (value <= config.getNeutralThreshold()) {
+            types[npcId] = RelationshipType::None;
+        } else if (value <= config.getFriendlyThreshold()) {
+            types[npcId] = RelationshipType::Acquaintance;
+        } else if (value <= config.getCloseThreshold()) {
+            types[npcId] = RelationshipType::Friend;
+        } else if (value <= config.getIntimateThreshold()) {
+            types[npcId] = RelationshipType::CloseFriend;
+        } else {
+            types[npcId] = RelationshipType::BestFriend;
+        }
+    }
+
+    void advanceDay()
+    {
+        RelationshipConfig& config = RelationshipConfig::getInstance();
+        for (auto& [npcId, value] : values) {
+            if (value > config.getCloseThreshold()) {
+                continue;
+            }
+            value = std::max(value + config.getDailyDecayAmount(), config.getMinRelationship());
+            updateType(npcId);
+        }
+        for (auto& [npcId, state] : states) {
+            if (state != RelationshipState::Neutral && std::rand() % 3 == 0) {
+                state = RelationshipState::Neutral;
+            }
+        }
+    }
+};
+
+} // namespace
+
+int main()
+{
+    // The config loads resources/json relative to the working directory on
+    // first use, as the game does from its build directory
+    std::filesystem::current_path(OATH_RESOURCE_DIR "/../..");
+    RelationshipConfig& config = RelationshipConfig::getInstance();
+    if (config.getNPCs().empty()) {
+        return 1;
+    }
+    const RelationshipThresholds& thresholds = config.settings()->thresholds;
+
+    // Values across the whole range, one in ten NPCs in a temporary state
+    std::mt19937 rng(1);
+    OldPlayerRelations old;
+    PlayerRelationTable table;
+    table.resize(NPCS);
+    for (int i = 0; i < NPCS; i++) {
+        std::string npcId = "npc_" + std::to_string(i);
+        int value = static_cast<int>(rng() % 201) - 100;
+        RelationshipState state = rng() % 10 == 0 ? RelationshipState::Happy : RelationshipState::Neutral;
+        old.values[npcId] = value;
+        old.types[npcId] = thresholds.classify(value);
+        old.states[npcId] = state;
+        table.track(i);
+        table.values[i] = value;
+        table.setType(i, thresholds.classify(value));
+        table.setState(i, state);
+    }
+
+    auto start = BenchmarkClock::now();
+    for (int day = 0; day < DAYS; day++) {
+        old.advanceDay();
+    }
+    double oldPerDay = microsecondsSince(start) / 1000.0 / DAYS;
+
+    std::vector<RelationshipChange> changes;
+    size_t changeCount = 0;
+    start = BenchmarkClock::now();
+    for (int day = 0; day < DAYS; day++) {
+        changes.clear();
+        table.advanceDays(thresholds, day + 1, 1, changes);
+        changeCount += changes.size();
+    }
+    double tablePerDay = microsecondsSince(start) / 1000.0 / DAYS;
+
+    // State resets roll differently by design; values and types must agree
+    int mismatches = 0;
+    for (int i = 0; i < NPCS; i++) {
+        std::string npcId = "npc_" + std::to_string(i);
+        mismatches += old.values[npcId] != table.values[i] || old.types[npcId] != table.type(i);
+    }
+
+    // fastForward: single days and one pass over the same span must agree exactly
+    PlayerRelationTable stepped = table;
+    PlayerRelationTable batched = table;
+    for (int day = 0; day < FAST_FORWARD_DAYS; day++) {
+        stepped.advanceDays(thresholds, 100 + day, 1, changes);
+    }
+    batched.advanceDays(thresholds, 100, FAST_FORWARD_DAYS, changes);
+    for (int i = 0; i < NPCS; i++) {
+        mismatches += stepped.values[i] != batched.values[i] || stepped.types[i] != batched.types[i]
+            || stepped.states[i] != batched.states[i];
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "map pass    " << std::setw(10) << oldPerDay << " ms/day\n"
+              << "dense pass  " << std::setw(10) << tablePerDay << " ms/day, "
+              << changeCount / DAYS << " changes/day\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+// benchmarks/RumorBenchmark.cpp
+// Crime rumors over 100k NPCs and ~1M edges: 300 new ones a day for 30 days,
+// stepped by RumorMills with 1 and 4 threads, which must hear the same things.
+// Then NPCRelationshipManager::fastForward against the same days of
+// advanceDay with a rumor in flight.
+#include "BenchmarkClock.hpp"
+#include "systems/relationship/NPCRelationshipManager.hpp"
+#include "systems/relationship/RumorMill.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int NPCS = 100000;
+const int EDGES_PER_NPC = 10;
+const int NEIGHBORHOOD = 50;
+const int DAYS = 30;
+const int RUMORS_PER_DAY = 300;
+const int THREAD_COUNTS[] = { 1, 4 };
+const int FAST_FORWARD_DAYS[] = { 1, 3, 10, 40 };
+
+void buildGraph(SocialGraph& graph)
+{
+    std::mt19937 rng(3);
+    for (int i = 0; i < NPCS; i++) {
+        graph.addNpc("npc_" + std::to_string(i));
+    }
+    for (int i = 0; i < NPCS; i++) {
+        for (int k = 0; k < EDGES_PER_NPC; k++) {
+            int j = (i / NEIGHBORHOOD * NEIGHBORHOOD + static_cast<int>(rng() % NEIGHBORHOOD)) % NPCS;
+            if (rng() % 8 == 0) {
+                j = static_cast<int>(rng() % NPCS);
+            }
+            graph.setEdge(i, j, RelationshipType::Friend, static_cast<int>(rng() % 161) - 60, RelationshipState::Neutral);
+        }
+    }
+    graph.commit();
+}
+
+// Every fifth NPC is extroverted and every seventh suspicious
+void setTraits(RumorMill& mill)
+{
+    for (int i = 0; i < NPCS; i++) {
+        TraitMask traits = 0;
+        if (i % 5 == 0) {
+            traits |= traitBit(PersonalityTrait::Extroverted);
+        }
+        if (i % 7 == 0) {
+            traits |= traitBit(PersonalityTrait::Suspicious);
+        }
+        mill.setTraits(i, traits);
+    }
+}
+
+bool sameArrivals(const std::vector<RumorArrival>& a, const std::vector<RumorArrival>& b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const RumorArrival& x, const RumorArrival& y) {
+        return x.rumor == y.rumor && x.npc == y.npc && x.hops == y.hops && x.strength == y.strength;
+    });
+}
+
+// The config's NPCs come without relationships to each other; make them all
+// friends so the rumor has somewhere to go
+void befriendAll(NPCRelationshipManager& manager)
+{
+    SocialGraph& graph = manager.getSocialGraph();
+    for (int i = 0; i < graph.npcCount(); i++) {
+        for (int j = 0; j < graph.npcCount(); j++) {
+            if (i != j) {
+                graph.setEdge(i, j, RelationshipType::Friend, 80, RelationshipState::Happy);
+            }
+        }
+    }
+    graph.commit();
+}
+
+// Two managers from the relationship config, one betrayed NPC each: days
+// calls to advanceDay against one fastForward(days). A third without the
+// betrayal shows who the rumor reached.
+int checkFastForward(int days, int& reached)
+{
+    NPCRelationshipManager stepped;
+    NPCRelationshipManager forwarded;
+    NPCRelationshipManager untouched;
+    for (NPCRelationshipManager* manager : { &stepped, &forwarded, &untouched }) {
+        befriendAll(*manager);
+    }
+    const SocialGraph& graph = stepped.getSocialGraph();
+    if (graph.npcCount() == 0) {
+        return 1;
+    }
+    std::string betrayed = graph.npcId(0);
+    stepped.handleBetrayal(betrayed, 8);
+    forwarded.handleBetrayal(betrayed, 8);
+
+    for (int day = 0; day < days; day++) {
+        stepped.advanceDay();
+    }
+    forwarded.fastForward(days);
+    untouched.fastForward(days);
+
+    int mismatches = stepped.getPlayerRelationships() != forwarded.getPlayerRelationships();
+    mismatches += stepped.getRumors().activeCount() != forwarded.getRumors().activeCount();
+    reached = 0;
+    for (int i = 0; i < graph.npcCount(); i++) {
+        const std::string& npcId = graph.npcId(i);
+        mismatches += stepped.getRelationshipType(npcId) != forwarded.getRelationshipType(npcId);
+        mismatches += stepped.getRelationshipState(npcId) != forwarded.getRelationshipState(npcId);
+        reached += npcId != betrayed && forwarded.getRelationshipValue(npcId) != untouched.getRelationshipValue(npcId);
+    }
+    return mismatches;
+}
+
+} // namespace
+
+int main()
+{
+    // The relationship config is read from resources/json relative to the
+    // working directory, as the game does from its build directory
+    std::filesystem::current_path(OATH_RESOURCE_DIR "/../..");
+
+    SocialGraph graph;
+    buildGraph(graph);
+
+    std::vector<RumorMill> mills(std::size(THREAD_COUNTS));
+    for (size_t m = 0; m < mills.size(); m++) {
+        mills[m].settings.threads = THREAD_COUNTS[m];
+        setTraits(mills[m]);
+    }
+
+    // The mills run side by side so each day's arrivals can be compared
+    std::vector<double> stepTime(mills.size(), 0.0);
+    long arrivals = 0;
+    int peakActive = 0;
+    int mismatches = 0;
+    std::mt19937 origins(11);
+    for (int day = 0; day < DAYS; day++) {
+        for (int k = 0; k < RUMORS_PER_DAY; k++) {
+            Rumor rumor;
+            rumor.kind = RumorKind::Crime;
+            rumor.severity = 5;
+            int origin = static_cast<int>(origins() % NPCS);
+            for (RumorMill& mill : mills) {
+                mill.start(rumor, origin, day);
+            }
+        }
+        // Each mill reuses its arrivals buffer, so compare before the next day
+        std::vector<const std::vector<RumorArrival>*> heard;
+        for (size_t m = 0; m < mills.size(); m++) {
+            auto start = BenchmarkClock::now();
+            heard.push_back(&mills[m].stepDay(graph, day));
+            stepTime[m] += microsecondsSince(start);
+        }
+        for (size_t m = 1; m < mills.size(); m++) {
+            mismatches += !sameArrivals(*heard[m], *heard[0]);
+            mismatches += mills[m].activeCount() != mills[0].activeCount();
+        }
+        arrivals += static_cast<long>(heard[0]->size());
+        peakActive = std::max(peakActive, mills[0].activeCount());
+    }
+
+    // The manager prints as it loads and as relationships change
+    std::ostringstream sink;
+    std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+    int configNpcs = 0;
+    std::vector<int> reached;
+    for (int days : FAST_FORWARD_DAYS) {
+        reached.push_back(0);
+        mismatches += checkFastForward(days, reached.back());
+    }
+    configNpcs = NPCRelationshipManager().getSocialGraph().npcCount();
+    std::cout.rdbuf(console);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << NPCS << " NPCs, " << graph.edgeCount() << " edges, " << RUMORS_PER_DAY << " new rumors a day\n"
+              << "peak active     " << std::setw(10) << peakActive << " rumors\n"
+              << "arrivals        " << std::setw(10) << arrivals / DAYS << " a day\n";
+    for (size_t m = 0; m < mills.size(); m++) {
+        std::cout << THREAD_COUNTS[m] << " thread" << (THREAD_COUNTS[m] == 1 ? " " : "s") << "       "
+                  << std::setw(10) << stepTime[m] / 1000.0 / DAYS << " ms/day\n";
+    }
+    for (size_t d = 0; d < reached.size(); d++) {
+        std::cout << "fastForward " << std::setw(2) << FAST_FORWARD_DAYS[d] << "  " << std::setw(10) << reached[d] << "/"
+                  << configNpcs - 1 << " NPCs reached by the betrayal\n";
+    }
+    std::cout << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
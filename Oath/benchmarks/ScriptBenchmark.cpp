@@ -0,0 +1,94 @@
+// benchmarks/ScriptBenchmark.cpp
+// Content conditions: the JSON-walking lambdas JSONLoader used to build and
+// hand-written lambdas, against compiled GameCondition bytecode.
+#include "BenchmarkClock.hpp"
+#include "data/GameContext.hpp"
+#include "data/GameScript.hpp"
+#include "data/ItemCatalog.hpp"
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+const int EVALUATIONS = 2000000;
+
+template <typename Condition>
+double nanosecondsPerCall(const Condition& condition, const GameContext& context, long& trueCount)
+{
+    auto start = BenchmarkClock::now();
+    for (int i = 0; i < EVALUATIONS; i++) {
+        trueCount += condition(context) ? 1 : 0;
+    }
+    return microsecondsSince(start) * 1000.0 / EVALUATIONS;
+}
+
+void report(const std::string& label, double nanoseconds)
+{
+    std::cout << std::left << std::setw(48) << label << std::right << std::fixed
+              << std::setprecision(1) << std::setw(8) << nanoseconds << " ns" << std::endl;
+}
+
+} // namespace
+
+int main()
+{
+    GameContext context;
+    context.playerStats.setSkill("persuasion", 4);
+    context.playerStats.setFactionRep("merchants_guild", 30);
+    context.worldState.daysPassed = 12;
+    context.worldState.currentSeason = "winter";
+    context.script.set("weather.stormy", 1.0f);
+    ItemCatalog::getInstance().intern("iron_ore", "Iron Ore", "material", 3);
+    context.playerInventory.addItem(Item("iron_ore", "Iron Ore", "material", 3, 5));
+
+    long trueCount = 0;
+    int mismatches = 0;
+
+    // A dialogue requirement as JSONLoader turned it into a lambda, rereading the json each call
+    nlohmann::json requirements = nlohmann::json::parse(R"([
+        { "type": "skill", "skill": "persuasion", "level": 3 },
+        { "type": "item", "item": "iron_ore", "amount": 2 }
+    ])");
+    std::function<bool(const GameContext&)> jsonLambda = [requirements](const GameContext& ctx) {
+        for (const auto& req : requirements) {
+            if (req["type"] == "skill") {
+                if (!ctx.playerStats.hasSkill(req["skill"], req["level"])) {
+                    return false;
+                }
+            } else if (req["type"] == "item") {
+                if (!ctx.playerInventory.hasItem(req["item"].get<std::string>(), req["amount"])) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    GameCondition fromJson = GameCondition::fromJson(requirements);
+    mismatches += jsonLambda(context) != fromJson(context);
+    report("JSON lambda, skill + item", nanosecondsPerCall(jsonLambda, context, trueCount));
+    report("compiled from the same JSON", nanosecondsPerCall(fromJson, context, trueCount));
+
+    std::function<bool(const GameContext&)> handWritten = [](const GameContext& ctx) {
+        auto skill = ctx.playerStats.skills.find("persuasion");
+        auto rep = ctx.playerStats.factionReputation.find("merchants_guild");
+        return skill != ctx.playerStats.skills.end() && skill->second >= 3
+            && rep != ctx.playerStats.factionReputation.end() && rep->second > 20
+            && !ctx.worldState.hasFlag("bridge_destroyed");
+    };
+    GameCondition compiled = GameCondition::compile("skill.persuasion >= 3 && rep.merchants_guild > 20 && !flag.bridge_destroyed");
+    mismatches += handWritten(context) != compiled(context);
+    report("hand-written lambda, 3 terms", nanosecondsPerCall(handWritten, context, trueCount));
+    report("compiled, 3 terms", nanosecondsPerCall(compiled, context, trueCount));
+
+    // Reads only time and published variables, so it is cached; the fact term defeats that
+    GameCondition cached = GameCondition::compile("day >= 10 && weather.stormy && time.hour > 3 || season == 'winter'");
+    GameCondition uncached = GameCondition::compile("day >= 10 && weather.stormy && time.hour > 3 || season == 'winter' || fact.never_set");
+    mismatches += cached(context) != uncached(context);
+    report("time and weather, uncached", nanosecondsPerCall(uncached, context, trueCount));
+    report(std::string("time and weather, ") + (cached.isCached() ? "cached" : "not cached (!)"), nanosecondsPerCall(cached, context, trueCount));
+
+    keepAlive(trueCount);
+    std::cout << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,225 @@
+// benchmarks/SocialGraphBenchmark.cpp
+// NPC-to-NPC relationships for 100k NPCs and ~1M edges: the per-NPC vectors
+// RelationshipNPC kept, scanned by id string, against SocialGraph's CSR rows.
+// Then a batch of changes through commit(), and the graph algorithms with 1
+// and 4 threads, which must give the same results.
+#include "BenchmarkClock.hpp"
+#include "systems/relationship/SocialGraph.hpp"
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const int NPCS = 100000;
+const int EDGES_PER_NPC = 11;
+const int NEIGHBORHOOD = 50; // Most relationships stay within a village
+const int LOOKUPS = 200000;
+const int CHANGES = 10000;
+const int ROUNDS = 30;
+const int SPREAD_HOPS = 8;
+const int THREAD_COUNTS[] = { 1, 4 };
+
+// RelationshipNPC's relationships before SocialGraph
+struct OldRelationship {
+    std::string npcId;
+    RelationshipType type;
+    int value;
+    RelationshipState state;
+    std::string historyNotes;
+};
+
+struct OldNpc {
+    std::string id;
+    std::vector<OldRelationship> relationships;
+
+    OldRelationship* findRelationship(const std::string& npcId)
+    {
+        for (auto& relationship : relationships) {
+            if (relationship.npcId == npcId) {
+                return &relationship;
+            }
+        }
+        return nullptr;
+    }
+
+    void setRelationship(const std::string& npcId, RelationshipType type, int value, RelationshipState state)
+    {
+        if (OldRelationship* existing = findRelationship(npcId)) {
+            existing->type = type;
+            existing->value = value;
+            existing->state = state;
+        } else {
+            relationships.push_back({ npcId, type, value, state, "" });
+        }
+    }
+};
+
+struct Run {
+    double spreadTime = 0.0;
+    double circlesTime = 0.0;
+    double influenceTime = 0.0;
+    std::vector<int> hops;
+    std::vector<int> circles;
+    std::vector<float> influence;
+};
+
+int neighborOf(int npc, std::mt19937& rng)
+{
+    return (npc / NEIGHBORHOOD * NEIGHBORHOOD + static_cast<int>(rng() % NEIGHBORHOOD)) % NPCS;
+}
+
+Run runAlgorithms(SocialGraph& graph, int threads)
+{
+    Run run;
+    graph.threads = threads;
+    auto start = BenchmarkClock::now();
+    run.hops = graph.spreadFrom(0, 0, SPREAD_HOPS);
+    run.spreadTime = microsecondsSince(start);
+
+    start = BenchmarkClock::now();
+    run.circles = graph.findCircles(ROUNDS);
+    run.circlesTime = microsecondsSince(start);
+
+    start = BenchmarkClock::now();
+    run.influence = graph.influence(ROUNDS);
+    run.influenceTime = microsecondsSince(start);
+    return run;
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(7);
+    SocialGraph graph;
+    std::vector<OldNpc> old(NPCS);
+    for (int i = 0; i < NPCS; i++) {
+        old[i].id = "npc_" + std::to_string(i);
+        graph.addNpc(old[i].id);
+    }
+    for (int i = 0; i < NPCS; i++) {
+        for (int k = 0; k < EDGES_PER_NPC; k++) {
+            int j = neighborOf(i, rng);
+            if (rng() % 10 == 0) {
+                j = static_cast<int>(rng() % NPCS);
+            }
+            int value = static_cast<int>(rng() % 201) - 100;
+            graph.setEdge(i, j, RelationshipType::Friend, value, RelationshipState::Neutral);
+            old[i].setRelationship(old[j].id, RelationshipType::Friend, value, RelationshipState::Neutral);
+        }
+    }
+    graph.commit();
+
+    // Lookups within the neighborhood, so most find an edge
+    std::vector<std::pair<int, int>> queries;
+    for (int k = 0; k < LOOKUPS; k++) {
+        int i = static_cast<int>(rng() % NPCS);
+        queries.push_back({ i, neighborOf(i, rng) });
+    }
+    long oldSum = 0;
+    int oldFound = 0;
+    auto start = BenchmarkClock::now();
+    for (const auto& [from, to] : queries) {
+        if (const OldRelationship* relationship = old[from].findRelationship(old[to].id)) {
+            oldSum += relationship->value;
+            oldFound++;
+        }
+    }
+    double oldLookupTime = microsecondsSince(start);
+
+    long graphSum = 0;
+    int graphFound = 0;
+    start = BenchmarkClock::now();
+    for (const auto& [from, to] : queries) {
+        int edge = graph.findEdge(from, to);
+        if (edge != SocialGraph::NO_EDGE) {
+            graphSum += graph.edgeValue(edge);
+            graphFound++;
+        }
+    }
+    double graphLookupTime = microsecondsSince(start);
+
+    long oldTotal = 0;
+    size_t oldEdges = 0;
+    start = BenchmarkClock::now();
+    for (const OldNpc& npc : old) {
+        for (const OldRelationship& relationship : npc.relationships) {
+            oldTotal += relationship.value;
+        }
+        oldEdges += npc.relationships.size();
+    }
+    double oldIterateTime = microsecondsSince(start);
+
+    long graphTotal = 0;
+    start = BenchmarkClock::now();
+    for (int i = 0; i < NPCS; i++) {
+        graph.forEachNeighbor(i, [&graph, &graphTotal](int, int edge) { graphTotal += graph.edgeValue(edge); });
+    }
+    double graphIterateTime = microsecondsSince(start);
+
+    int mismatches = (oldSum != graphSum) + (oldFound != graphFound) + (oldTotal != graphTotal)
+        + (oldEdges != static_cast<size_t>(graph.edgeCount()));
+
+    // Rivalries across the map, inserted and overwritten together
+    std::vector<std::pair<int, int>> changes;
+    for (int k = 0; k < CHANGES; k++) {
+        changes.push_back({ static_cast<int>(rng() % NPCS), static_cast<int>(rng() % NPCS) });
+    }
+    start = BenchmarkClock::now();
+    for (const auto& [from, to] : changes) {
+        graph.setEdge(from, to, RelationshipType::Rival, -20, RelationshipState::Angry);
+    }
+    graph.commit();
+    double commitTime = microsecondsSince(start);
+
+    for (const auto& [from, to] : changes) {
+        int edge = graph.findEdge(from, to);
+        mismatches += edge == SocialGraph::NO_EDGE || graph.edgeValue(edge) != -20
+            || graph.edgeState(edge) != RelationshipState::Angry;
+    }
+
+    std::vector<Run> runs;
+    for (int threads : THREAD_COUNTS) {
+        runs.push_back(runAlgorithms(graph, threads));
+    }
+    for (size_t r = 1; r < runs.size(); r++) {
+        mismatches += runs[r].hops != runs[0].hops;
+        mismatches += runs[r].circles != runs[0].circles;
+        mismatches += runs[r].influence != runs[0].influence;
+    }
+
+    int reached = 0;
+    for (int hop : runs[0].hops) {
+        reached += hop >= 0;
+    }
+    int circleCount = 0;
+    for (int i = 0; i < NPCS; i++) {
+        circleCount += runs[0].circles[i] == i;
+    }
+    double influenceTotal = 0.0;
+    for (float score : runs[0].influence) {
+        influenceTotal += score;
+    }
+    mismatches += std::abs(influenceTotal - 1.0) > 1e-3;
+
+    std::cout << std::fixed << std::setprecision(1)
+              << NPCS << " NPCs, " << graph.edgeCount() << " edges\n"
+              << "lookup, id scan " << std::setw(10) << oldLookupTime * 1000.0 / LOOKUPS << " ns\n"
+              << "lookup, CSR     " << std::setw(10) << graphLookupTime * 1000.0 / LOOKUPS << " ns\n"
+              << "iterate, vectors" << std::setw(10) << oldIterateTime / 1000.0 << " ms\n"
+              << "iterate, CSR    " << std::setw(10) << graphIterateTime / 1000.0 << " ms\n"
+              << "commit " << CHANGES << "    " << std::setw(10) << commitTime / 1000.0 << " ms\n";
+    for (size_t r = 0; r < runs.size(); r++) {
+        std::cout << THREAD_COUNTS[r] << " thread" << (THREAD_COUNTS[r] == 1 ? " " : "s") << "       "
+                  << " spread " << runs[r].spreadTime / 1000.0 << " ms, circles " << runs[r].circlesTime / 1000.0
+                  << " ms, influence " << runs[r].influenceTime / 1000.0 << " ms\n";
+    }
+    std::cout << "spread reached " << reached << " NPCs, " << circleCount << " circles\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
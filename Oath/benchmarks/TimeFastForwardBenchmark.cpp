@@ -0,0 +1,122 @@
+// benchmarks/TimeFastForwardBenchmark.cpp
+// Sleeping 8 hours and travelling 5 days with the weather subscribed to the
+// clock: one advance per hour, as before the subscriber registry, against one
+// advance for the whole span. Then checks that a span crossing into spring
+// walks its winter hours with the winter tables.
+#include "BenchmarkClock.hpp"
+#include "systems/weather/WeatherSystemNode.hpp"
+#include "systems/world/TimeNode.hpp"
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+const int REPEATS = 50;
+const int SEASON_RUNS = 100;
+
+// Winter turns Clear to Snowy, which no other season allows; Snowy then
+// never leaves. Outside winter the weather only swaps Clear and Cloudy.
+const char* const SEASON_CHECK_CONFIG = R"({
+    "weatherChangeInterval": { "min": 4, "max": 12 },
+    "weatherTransitionProbabilities": {
+        "Clear": { "Cloudy": 1.0, "Snowy": 1.0 },
+        "Cloudy": { "Clear": 1.0 },
+        "Snowy": { "Snowy": 1.0 }
+    },
+    "seasonalModifiers": { "winter": { "Cloudy": 0.0 } }
+})";
+
+// The clock with the weather subscribed as hookWeatherToTimeSystem does
+struct Rig {
+    GameContext context;
+    TimeNode time { "TimeSystem" };
+    WeatherSystemNode weather { "WeatherSystem" };
+
+    explicit Rig(unsigned int seed)
+    {
+        weather.rng.seed(seed);
+        time.subscribe("WeatherSystem", TimeCadence::Hour, [this](GameContext* context, int hours) {
+            weather.updateWeather(context, hours, time.hour);
+        });
+    }
+};
+
+// Both clocks and the world must agree after the span
+bool sameClock(const Rig& a, const Rig& b)
+{
+    return a.time.day == b.time.day && a.time.hour == b.time.hour && a.time.season == b.time.season
+        && a.context.worldState.daysPassed == b.context.worldState.daysPassed
+        && a.context.worldState.currentSeason == b.context.worldState.currentSeason;
+}
+
+double timeSpan(int hours, bool batched, int& mismatches)
+{
+    double total = 0.0;
+    for (int r = 0; r < REPEATS; r++) {
+        Rig hourly(r);
+        Rig batch(r);
+        Rig& rig = batched ? batch : hourly;
+        auto start = BenchmarkClock::now();
+        if (batched) {
+            rig.time.advanceHours(&rig.context, hours);
+        } else {
+            for (int h = 0; h < hours; h++) {
+                rig.time.advanceHour(&rig.context);
+            }
+        }
+        total += microsecondsSince(start);
+
+        Rig& other = batched ? hourly : batch;
+        other.time.advanceHours(&other.context, hours);
+        mismatches += !sameClock(hourly, batch);
+    }
+    return total / REPEATS;
+}
+
+} // namespace
+
+int main()
+{
+    // WeatherSystemNode reads resources/json relative to the working
+    // directory, as the game does from its build directory
+    std::filesystem::current_path(OATH_RESOURCE_DIR "/../..");
+
+    // The clock and the weather print every change; keep that out of the timing
+    std::ostringstream sink;
+    std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+
+    int mismatches = 0;
+    double sleepHourly = timeSpan(8, false, mismatches);
+    double sleepBatched = timeSpan(8, true, mismatches);
+    double travelHourly = timeSpan(5 * 24, false, mismatches);
+    double travelBatched = timeSpan(5 * 24, true, mismatches);
+
+    // Five days from late winter into spring: changes on winter days reach
+    // Snowy, and spring cannot leave it. Walking the whole span with the
+    // spring table would never get there.
+    nlohmann::json config = nlohmann::json::parse(SEASON_CHECK_CONFIG);
+    int snowy = 0;
+    for (int run = 0; run < SEASON_RUNS; run++) {
+        Rig rig(1000 + run);
+        rig.weather.applyWeatherConfig(config);
+        rig.weather.globalWeather = WeatherCondition(WeatherType::Clear, WeatherIntensity::Light);
+        rig.context.worldState.daysPassed = 355;
+        rig.context.worldState.currentSeason = "winter";
+        rig.time.advanceHours(&rig.context, 5 * 24);
+        snowy += rig.weather.globalWeather.type == WeatherType::Snowy;
+        mismatches += rig.context.worldState.currentSeason != "spring" || rig.weather.globalWeather.type != WeatherType::Snowy;
+    }
+
+    std::cout.rdbuf(console);
+    std::cout << std::fixed << std::setprecision(0)
+              << "sleep 8 hours   hourly " << std::setw(8) << sleepHourly << " us, batched "
+              << std::setw(8) << sleepBatched << " us\n"
+              << "travel 5 days   hourly " << std::setw(8) << travelHourly << " us, batched "
+              << std::setw(8) << travelBatched << " us\n"
+              << "winter into spring: " << snowy << "/" << SEASON_RUNS << " spans reached Snowy\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
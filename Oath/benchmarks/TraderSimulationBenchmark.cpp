@@ -0,0 +1,136 @@
+// benchmarks/TraderSimulationBenchmark.cpp
+// A year of NPC trading: 45k merchants and caravans over 50 markets and 100
+// routes, in orders matched per second. A second run with the same seed must
+// reproduce every tick.
+#include "BenchmarkClock.hpp"
+#include "systems/economy/TraderSimulation.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int MARKETS = 50;
+const int ROUTES = 100;
+const int MERCHANTS_PER_COMMODITY = 160;
+const int CARAVANS_PER_GOOD = 10;
+const int DAYS = 365;
+const int REPLAY_DAYS = 60;
+const unsigned int SEED = 42;
+const char* const GOODS[] = { "iron", "grain", "silk", "timber", "spice" };
+const int GOOD_COUNT = 5;
+
+// Markets that each stock every good, at slightly different supply levels
+struct World {
+    std::vector<std::unique_ptr<Market>> owned;
+    std::vector<Market*> markets;
+    std::vector<TradeRoute> routes;
+};
+
+void buildWorld(World& world)
+{
+    for (int m = 0; m < MARKETS; m++) {
+        world.owned.push_back(std::make_unique<Market>("market_" + std::to_string(m), "Market", MarketType::GENERAL));
+        Market* market = world.owned.back().get();
+        for (int g = 0; g < GOOD_COUNT; g++) {
+            float price = 10.0f + g * 10.0f;
+            int supply = 100 + ((m * 7 + g) % 5) * 20;
+            market->commodities.push_back({ GOODS[g], GOODS[g], price, price, supply, 80, 100, 80, "", g == 2, 0.2f });
+        }
+        world.markets.push_back(market);
+    }
+
+    for (int r = 0; r < ROUTES; r++) {
+        TradeRoute route;
+        route.id = "route_" + std::to_string(r);
+        route.name = route.id;
+        route.sourceMarket = "market_" + std::to_string(r % MARKETS);
+        route.destinationMarket = "market_" + std::to_string((r * 13 + 7) % MARKETS);
+        route.distance = 40.0f + r % 100;
+        route.dangerLevel = 0.1f;
+        route.isActive = true;
+        route.travelDays = std::max(1, static_cast<int>(route.distance / 20));
+        route.tradedGoods.assign(std::begin(GOODS), std::end(GOODS));
+        world.routes.push_back(route);
+    }
+}
+
+void populate(TraderSimulation& simulation, World& world)
+{
+    simulation.setSeed(SEED);
+    simulation.initialize(world.markets, &world.routes);
+    simulation.spawnMerchants(MERCHANTS_PER_COMMODITY, 500.0f);
+    simulation.spawnCaravans(CARAVANS_PER_GOOD, 800.0f);
+}
+
+} // namespace
+
+int main()
+{
+    World world;
+    buildWorld(world);
+    TraderSimulation simulation;
+    populate(simulation, world);
+
+    // Replays the first days from the same seed alongside the timed run
+    World replayWorld;
+    buildWorld(replayWorld);
+    TraderSimulation replay;
+    populate(replay, replayWorld);
+
+    size_t orders = 0;
+    size_t fills = 0;
+    long long units = 0;
+    double tickTime = 0.0;
+    double worstTick = 0.0;
+    int mismatches = 0;
+    for (int day = 0; day < DAYS; day++) {
+        auto start = BenchmarkClock::now();
+        simulation.tick();
+        double elapsed = microsecondsSince(start);
+        tickTime += elapsed;
+        worstTick = std::max(worstTick, elapsed);
+        orders += simulation.getLastOrderCount();
+        fills += simulation.getLastFillCount();
+        units += simulation.getLastTradedUnits();
+
+        if (day < REPLAY_DAYS) {
+            replay.tick();
+            mismatches += replay.getLastOrderCount() != simulation.getLastOrderCount()
+                || replay.getLastFillCount() != simulation.getLastFillCount()
+                || replay.getLastTradedUnits() != simulation.getLastTradedUnits();
+            for (int m = 0; m < MARKETS; m++) {
+                for (int g = 0; g < GOOD_COUNT; g++) {
+                    const TradeCommodity& a = world.markets[m]->commodities[g];
+                    const TradeCommodity& b = replayWorld.markets[m]->commodities[g];
+                    mismatches += a.currentPrice != b.currentPrice || a.supply != b.supply || a.demand != b.demand;
+                }
+            }
+        }
+    }
+
+    // How far the traders moved prices over the year
+    float lowest = 1e9f;
+    float highest = 0.0f;
+    for (const Market* market : world.markets) {
+        for (const TradeCommodity& commodity : market->commodities) {
+            float ratio = commodity.currentPrice / commodity.basePrice;
+            lowest = std::min(lowest, ratio);
+            highest = std::max(highest, ratio);
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << simulation.getAgentCount() << " agents, " << simulation.getBookCount() << " order books, "
+              << DAYS << " ticks\n"
+              << "tick            " << std::setw(10) << tickTime / 1000.0 / DAYS << " ms avg, "
+              << worstTick / 1000.0 << " ms worst\n"
+              << "throughput      " << std::setw(10) << orders / (tickTime / 1e6) / 1e6 << " M orders/s, "
+              << fills / DAYS << " fills/tick, " << units / DAYS << " units/tick\n"
+              << "prices          " << std::setw(10) << lowest << " to " << highest << " x base\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
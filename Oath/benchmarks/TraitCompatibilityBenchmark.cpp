@@ -0,0 +1,152 @@
+// benchmarks/TraitCompatibilityBenchmark.cpp
+// Trait compatibility over 20k NPCs: the std::set scorer RelationshipNPC used,
+// rereading the opposing pairs each call, against TraitCompatibility.
+#include "BenchmarkClock.hpp"
+#include "systems/relationship/TraitCompatibility.hpp"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+
+namespace {
+
+const int NPCS = 20000;
+const int OLD_SAMPLE = 200;
+const int TRAIT_KINDS = 30;
+
+nlohmann::json config;
+
+PersonalityTrait traitNamed(const std::string& name)
+{
+    const auto& names = config["personalityTraits"];
+    for (size_t i = 0; i < names.size(); i++) {
+        if (names[i] == name) {
+            return static_cast<PersonalityTrait>(i);
+        }
+    }
+    return PersonalityTrait::Agreeable;
+}
+
+// RelationshipConfig::getOpposingTraits as it parsed the config on every call
+std::map<PersonalityTrait, PersonalityTrait> opposingTraits()
+{
+    std::map<PersonalityTrait, PersonalityTrait> result;
+    for (const auto& pair : config["opposingTraits"]) {
+        result[traitNamed(pair["trait1"])] = traitNamed(pair["trait2"]);
+    }
+    return result;
+}
+
+// RelationshipNPC::calculateTraitCompatibility before TraitCompatibility
+float oldScore(const std::set<PersonalityTrait>& a, const std::set<PersonalityTrait>& b, float sharedBonus, float opposingPenalty)
+{
+    float score = 0.0f;
+    for (const auto& trait : a) {
+        if (b.find(trait) != b.end()) {
+            score += sharedBonus;
+        }
+    }
+    for (const auto& [trait1, trait2] : opposingTraits()) {
+        bool aHas1 = a.count(trait1) > 0;
+        bool aHas2 = a.count(trait2) > 0;
+        bool bHas1 = b.count(trait1) > 0;
+        bool bHas2 = b.count(trait2) > 0;
+        if ((aHas1 && bHas2) || (aHas2 && bHas1)) {
+            score -= opposingPenalty;
+        }
+    }
+    return score;
+}
+
+TraitProfile profileAt(const TraitProfileTable& table, int i)
+{
+    return { table.traits[i], table.firstOfPair[i], table.secondOfPair[i] };
+}
+
+} // namespace
+
+int main()
+{
+    std::ifstream file(OATH_RESOURCE_DIR "/NPCRelationships.json");
+    if (!file.is_open()) {
+        std::cerr << "Could not open " << OATH_RESOURCE_DIR "/NPCRelationships.json" << std::endl;
+        return 1;
+    }
+    file >> config;
+
+    TraitCompatibility compatibility;
+    compatibility.sharedBonus = config["relationshipConstants"]["traitInfluence"]["sharedTraitBonus"];
+    compatibility.opposingPenalty = config["relationshipConstants"]["traitInfluence"]["opposingTraitPenalty"];
+    int pairs[PERSONALITY_TRAIT_COUNT];
+    std::fill(std::begin(pairs), std::end(pairs), -1);
+    for (const auto& [trait1, trait2] : opposingTraits()) {
+        pairs[static_cast<int>(trait1)] = static_cast<int>(trait2);
+    }
+    compatibility.setPairs(pairs);
+
+    // Two to five traits each
+    std::mt19937 rng(5);
+    std::vector<std::set<PersonalityTrait>> traitSets(NPCS);
+    TraitProfileTable table;
+    table.resize(NPCS);
+    for (int i = 0; i < NPCS; i++) {
+        TraitMask mask = 0;
+        for (int k = 2 + static_cast<int>(rng() % 4); k > 0; k--) {
+            auto trait = static_cast<PersonalityTrait>(rng() % TRAIT_KINDS);
+            traitSets[i].insert(trait);
+            mask |= traitBit(trait);
+        }
+        table.set(i, compatibility.profile(mask));
+    }
+
+    double sum = 0.0;
+    auto start = BenchmarkClock::now();
+    for (int i = 0; i < OLD_SAMPLE; i++) {
+        for (int j = 0; j < OLD_SAMPLE; j++) {
+            sum += oldScore(traitSets[i], traitSets[j], compatibility.sharedBonus, compatibility.opposingPenalty);
+        }
+    }
+    double oldPerPair = microsecondsSince(start) * 1000.0 / (OLD_SAMPLE * OLD_SAMPLE);
+
+    const double allPairs = static_cast<double>(NPCS) * NPCS;
+    start = BenchmarkClock::now();
+    for (int i = 0; i < NPCS; i++) {
+        TraitProfile a = profileAt(table, i);
+        for (int j = 0; j < NPCS; j++) {
+            sum += compatibility.score(a, profileAt(table, j));
+        }
+    }
+    double scalarPerPair = microsecondsSince(start) * 1000.0 / allPairs;
+
+    std::vector<float> scores(NPCS);
+    start = BenchmarkClock::now();
+    for (int i = 0; i < NPCS; i++) {
+        compatibility.scoreAgainst(profileAt(table, i), table, scores.data());
+        sum += scores[(i * 7) % NPCS];
+    }
+    double batchPerPair = microsecondsSince(start) * 1000.0 / allPairs;
+    keepAlive(sum);
+
+    int mismatches = 0;
+    for (int i = 0; i < OLD_SAMPLE; i++) {
+        compatibility.scoreAgainst(profileAt(table, i), table, scores.data());
+        for (int j = 0; j < OLD_SAMPLE; j++) {
+            float expected = oldScore(traitSets[i], traitSets[j], compatibility.sharedBonus, compatibility.opposingPenalty);
+            mismatches += std::abs(expected - compatibility.score(profileAt(table, i), profileAt(table, j))) > 1e-4f;
+            mismatches += std::abs(expected - scores[j]) > 1e-4f;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "std::set scorer      " << std::setw(10) << oldPerPair << " ns/pair (" << OLD_SAMPLE << "x" << OLD_SAMPLE << " sample)\n"
+              << "popcount, one pair   " << std::setw(10) << scalarPerPair << " ns/pair\n"
+              << "popcount, scoreAgainst" << std::setw(9) << batchPerPair << " ns/pair\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+// benchmarks/TriggerBenchmark.cpp
+// Content conditions polled every tick against the same conditions watched by
+// a TriggerEngine, which re-checks only those whose skill or flag changed.
+// Each tick bumps one skill and one flag; the callbacks must agree with polling.
+#include "BenchmarkClock.hpp"
+#include "data/GameContext.hpp"
+#include "data/GameScript.hpp"
+#include "data/TriggerEngine.hpp"
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int SIZES[] = { 1000, 10000, 50000 };
+const int SKILLS = 500;
+const int FLAGS = 300;
+const int TICKS = 200;
+
+void tick(GameContext& context, int t)
+{
+    context.playerStats.improveSkill("s" + std::to_string(t % SKILLS), 1);
+    context.worldState.setWorldFlag("f" + std::to_string(t % FLAGS), t & 1);
+}
+
+// A quest requirement through a day: lazy before the tick ends, one callback
+// per flip, nothing re-checked when nothing changed
+int checkLifecycle()
+{
+    GameContext context;
+    TriggerEngine engine;
+    context.attachTriggers(&engine);
+
+    int fired = 0;
+    bool last = false;
+    GameCondition condition = GameCondition::compile("skill.persuasion >= 3 && !flag.bridge_destroyed && day > 2");
+    condition.watch(engine, {}, [&fired, &last](GameContext*, bool value) {
+        fired++;
+        last = value;
+    });
+    engine.update(&context);
+    int mismatches = fired != 0 || condition(context);
+
+    context.playerStats.improveSkill("persuasion", 3);
+    for (int day = 0; day < 3; day++) {
+        context.worldState.advanceDay();
+    }
+    mismatches += !condition(context) || fired != 0;
+    engine.update(&context);
+    mismatches += fired != 1 || !last;
+
+    context.worldState.setWorldFlag("bridge_destroyed", true);
+    mismatches += engine.update(&context) != 1 || fired != 2 || last;
+    mismatches += engine.update(&context) != 0;
+    return mismatches;
+}
+
+} // namespace
+
+int main()
+{
+    int mismatches = checkLifecycle();
+
+    std::cout << std::fixed;
+    for (int size : SIZES) {
+        GameContext context;
+        TriggerEngine engine;
+        context.attachTriggers(&engine);
+
+        // Copies taken before watching keep polling
+        std::vector<GameCondition> polled;
+        for (int i = 0; i < size; i++) {
+            polled.push_back(GameCondition::compile("skill.s" + std::to_string(i % SKILLS) + " >= " + std::to_string(i % 7)
+                + " && !flag.f" + std::to_string(i % FLAGS)));
+        }
+        std::vector<GameCondition> watched = polled;
+        std::vector<char> reported(size, 0);
+        for (int i = 0; i < size; i++) {
+            watched[i].watch(engine, {}, [&reported, i](GameContext*, bool value) { reported[i] = value; });
+        }
+        engine.update(&context);
+
+        long trueCount = 0;
+        auto start = BenchmarkClock::now();
+        for (int t = 0; t < TICKS; t++) {
+            tick(context, t);
+            for (const GameCondition& condition : polled) {
+                trueCount += condition(context);
+            }
+        }
+        double pollTime = microsecondsSince(start) / TICKS;
+
+        long checks = 0;
+        start = BenchmarkClock::now();
+        for (int t = 0; t < TICKS; t++) {
+            tick(context, t);
+            checks += engine.update(&context);
+        }
+        double triggerTime = microsecondsSince(start) / TICKS;
+        keepAlive(trueCount);
+
+        // Another round, comparing every condition after each tick
+        for (int t = 0; t < TICKS; t++) {
+            tick(context, t);
+            engine.update(&context);
+            for (int i = 0; i < size; i++) {
+                bool value = polled[i](context);
+                mismatches += watched[i](context) != value || reported[i] != value;
+            }
+        }
+
+        std::cout << std::setw(6) << size << " conditions  polling " << std::setprecision(1) << std::setw(8) << pollTime
+                  << " us/tick, triggers " << std::setprecision(2) << std::setw(7) << triggerTime << " us/tick ("
+                  << std::setprecision(0) << static_cast<double>(checks) / TICKS << " checks)\n";
+    }
+    std::cout << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,244 @@
+// benchmarks/VitalsBenchmark.cpp
+// 1M actors' hunger, thirst, stamina, fatigue and health over a 72-hour wait:
+// per-object virtual updates stepped hourly, as NutritionState::update and
+// natural healing ran before VitalsTable, against one advance of the table.
+// Checks values, bands and band events against the old updates and levels,
+// then rests the player's HealthState on a row of the same table.
+#include "BenchmarkClock.hpp"
+#include "data/VitalsTable.hpp"
+#include "systems/health/DiseaseManager.hpp"
+#include "systems/health/HealthState.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+// Symptom.cpp and DiseaseManager.cpp do not build on their own yet (the health
+// sources are still off in the top-level CMakeLists). These stand in for the
+// two functions the disease and health sources link against; nothing here
+// loads symptoms from JSON or contracts a disease.
+Symptom::Symptom(const nlohmann::json&)
+    : severity(SymptomSeverity::NONE)
+    , hasDamageOverTime(false)
+    , damagePerUpdate(0.0f)
+{
+}
+
+const Disease* DiseaseManager::getDiseaseById(const std::string&) const
+{
+    return nullptr;
+}
+
+namespace {
+
+const int ACTORS = 1000000;
+const int WAIT_HOURS = 72;
+const float SHORT_STEP = 0.001f; // a frame's worth, mostly no crossings
+const float TOLERANCE = 0.01f; // 72 hourly float steps against one product
+const int REST_HOURS = 8;
+
+// Before VitalsTable: each actor updated itself, an hour at a time
+class OldActor {
+public:
+    virtual ~OldActor() = default;
+    virtual void update(float hours) = 0;
+};
+
+class OldVitals : public OldActor {
+public:
+    float values[VITAL_COUNT];
+    float rates[VITAL_COUNT];
+
+    // NutritionState::update for hunger and thirst, then healing, stamina and
+    // fatigue each clamped to their range
+    void update(float hours) override
+    {
+        for (int v = 0; v < VITAL_COUNT; v++) {
+            values[v] = std::min(std::max(values[v] + rates[v] * hours, 0.0f), 100.0f);
+        }
+    }
+};
+
+// The levels the owners read, from the value
+int oldBand(Vital vital, float value)
+{
+    switch (vital) {
+    case Vital::Hunger:
+    case Vital::Thirst:
+        // NutritionState::getHungerLevel and getThirstLevel
+        if (value >= 75.0f)
+            return 0;
+        if (value >= 50.0f)
+            return 1;
+        if (value >= 25.0f)
+            return 2;
+        if (value >= 10.0f)
+            return 3;
+        if (value > 0)
+            return 4;
+        return 5;
+    case Vital::Stamina:
+        return value <= 10.0f;
+    case Vital::Fatigue:
+        return (value > 40.0f) + (value > 70.0f) + (value >= 90.0f);
+    case Vital::Health:
+        return value <= 0.0f;
+    }
+    return -1;
+}
+
+uint64_t xorShift(uint64_t& x)
+{
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return x;
+}
+
+// Hunger and thirst fall at their own rates; stamina and health recover or
+// drain; fatigue eases off
+void populate(VitalsTable& table, std::vector<std::unique_ptr<OldActor>>& actors)
+{
+    uint64_t x = 3;
+    for (int i = 0; i < ACTORS; i++) {
+        auto actor = std::make_unique<OldVitals>();
+        float reserve = static_cast<float>(xorShift(x) % 100);
+        float rate = 0.5f + (xorShift(x) % 40) / 10.0f;
+        float sign = xorShift(x) % 2 ? 1.0f : -1.0f;
+        const float values[VITAL_COUNT] = { reserve, reserve, static_cast<float>(xorShift(x) % 100),
+            static_cast<float>(xorShift(x) % 100), static_cast<float>(xorShift(x) % 100) };
+        const float rates[VITAL_COUNT] = { -rate, -1.5f * rate, 5.0f * sign, -4.0f, 1.0f * sign };
+
+        int entity = table.add();
+        for (int v = 0; v < VITAL_COUNT; v++) {
+            table.set(entity, static_cast<Vital>(v), values[v]);
+            table.setRate(entity, static_cast<Vital>(v), rates[v]);
+            actor->values[v] = values[v];
+            actor->rates[v] = rates[v];
+        }
+        actors.push_back(std::move(actor));
+    }
+}
+
+// Values against the hourly objects, bands against the old levels of the
+// table's own values, and one event per threshold each vital moved across
+int checkTable(const VitalsTable& start, const VitalsTable& table, const std::vector<std::unique_ptr<OldActor>>& actors,
+    const std::vector<VitalEvent>& events, float hours)
+{
+    int mismatches = 0;
+    long crossings = 0;
+    for (int i = 0; i < ACTORS; i++) {
+        const OldVitals& actor = static_cast<const OldVitals&>(*actors[i]);
+        for (int v = 0; v < VITAL_COUNT; v++) {
+            Vital vital = static_cast<Vital>(v);
+            float value = table.get(i, vital);
+            mismatches += std::abs(value - actor.values[v]) > TOLERANCE;
+            mismatches += table.getBand(i, vital) != oldBand(vital, value);
+            crossings += std::abs(table.getBand(i, vital) - start.getBand(i, vital));
+        }
+    }
+
+    mismatches += crossings != static_cast<long>(events.size());
+    for (const VitalEvent& event : events) {
+        mismatches += event.atHour < 0.0f || event.atHour > hours || std::abs(event.toBand - event.fromBand) != 1;
+    }
+    return mismatches;
+}
+
+// The player rests on a row after the actors, as RestNode does through
+// HealthContext: recovery rates for the rest, one advance, rates back to 0
+int checkRest(VitalsTable& table, int& staminaEvents)
+{
+    int player = table.add();
+    HealthState health(table, player);
+    health.naturalHealRate = 1.0f;
+    health.takeDamage(60.0f);
+    health.useStamina(90.0f);
+
+    // Before the table: heal and restoreStamina by the whole rest
+    float expectedHealth = std::min(health.getMaxHealth(), health.getHealth() + health.naturalHealRate * REST_HOURS);
+    float expectedStamina = std::min(health.getMaxStamina(), health.getStamina() + health.getMaxStamina() * 0.1f * REST_HOURS);
+    int mismatches = table.getBand(player, Vital::Stamina) != 1;
+
+    std::vector<VitalEvent> events;
+    health.setRecoveryRates(health.naturalHealRate, health.getMaxStamina() * 0.1f);
+    table.advance(static_cast<float>(REST_HOURS), events);
+    health.setRecoveryRates(0.0f, 0.0f);
+    mismatches += std::abs(health.getHealth() - expectedHealth) > TOLERANCE;
+    mismatches += std::abs(health.getStamina() - expectedStamina) > TOLERANCE;
+
+    // Exhausted at the start, recovered by the end
+    staminaEvents = 0;
+    for (const VitalEvent& event : events) {
+        staminaEvents += event.entity == player && event.vital == Vital::Stamina && event.fromBand == 1 && event.toBand == 0;
+    }
+    mismatches += staminaEvents != 1;
+
+    // Awake again, nothing moves
+    table.advance(5.0f, events);
+    mismatches += std::abs(health.getHealth() - expectedHealth) > TOLERANCE;
+    return mismatches;
+}
+
+} // namespace
+
+int main()
+{
+    VitalsTable table;
+    std::vector<std::unique_ptr<OldActor>> actors;
+    populate(table, actors);
+
+    std::vector<VitalEvent> events;
+    events.reserve(1 << 23);
+
+    VitalsTable copy = table;
+    auto start = BenchmarkClock::now();
+    copy.advance(SHORT_STEP, events);
+    double shortTime = microsecondsSince(start);
+
+    copy = table;
+    events.clear();
+    start = BenchmarkClock::now();
+    copy.advance(1.0f, events);
+    double hourTime = microsecondsSince(start);
+    size_t hourEvents = events.size();
+
+    copy = table;
+    events.clear();
+    start = BenchmarkClock::now();
+    copy.advance(static_cast<float>(WAIT_HOURS), events);
+    double waitTime = microsecondsSince(start);
+    size_t waitEvents = events.size();
+
+    start = BenchmarkClock::now();
+    for (int hour = 0; hour < WAIT_HOURS; hour++) {
+        for (auto& actor : actors) {
+            actor->update(1.0f);
+        }
+    }
+    double oldWaitTime = microsecondsSince(start);
+
+    int mismatches = checkTable(table, copy, actors, events, static_cast<float>(WAIT_HOURS));
+
+    // takeDamage reports falling unconscious; keep the output to the results
+    std::ostringstream sink;
+    std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+    int staminaEvents = 0;
+    mismatches += checkRest(copy, staminaEvents);
+    std::cout.rdbuf(console);
+
+    std::cout << std::fixed << std::setprecision(2)
+              << ACTORS << " actors, " << VITAL_COUNT << " vitals each\n"
+              << "table 0.001 h  " << std::setw(10) << shortTime / 1000.0 << " ms\n"
+              << "table 1 h      " << std::setw(10) << hourTime / 1000.0 << " ms, " << hourEvents << " band events\n"
+              << "table " << WAIT_HOURS << " h     " << std::setw(10) << waitTime / 1000.0 << " ms, " << waitEvents
+              << " band events\n"
+              << "objects hourly " << std::setw(10) << oldWaitTime / 1000.0 << " ms for " << WAIT_HOURS << " h\n"
+              << "player rest    " << std::setw(10) << REST_HOURS << " h, " << staminaEvents << " stamina recovery event\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+// benchmarks/WeatherTablesBenchmark.cpp
+// Weather changes per second: WeatherSystemNode's walk of the JSON config with
+// cumulative sampling, against WeatherTables' alias tables. A chi-square test
+// checks both draw the same next types and intensities from every state.
+#include "BenchmarkClock.hpp"
+#include "systems/weather/WeatherTables.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+
+namespace {
+
+const int DRAWS_PER_STATE = 200000;
+const int OLD_CHANGES = 100000;
+const int TABLE_CHANGES = 2000000;
+const char* const SEASONS[WEATHER_SEASON_COUNT] = { "spring", "summer", "autumn", "winter" };
+
+// Chi-square critical values at p = 0.001 by degrees of freedom
+const double CRITICAL[WEATHER_TYPE_COUNT] = { 0.0, 10.83, 13.82, 16.27, 18.47, 20.52, 22.46, 24.32 };
+
+struct WeatherChange {
+    int hours;
+    WeatherType type;
+    WeatherIntensity intensity;
+};
+
+// WeatherSystemNode::updateWeather's sampling before WeatherTables
+WeatherChange oldChange(nlohmann::json& config, const std::string& season, WeatherType from, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    WeatherChange change { 0, from, WeatherIntensity::Light };
+
+    int minHours = config["weatherChangeInterval"]["min"];
+    int maxHours = config["weatherChangeInterval"]["max"];
+    change.hours = minHours + (rng() % (maxHours - minHours + 1));
+
+    std::string fromName = weatherTypeToString(from);
+    std::string nextName = fromName;
+    std::map<std::string, float> transitions;
+    float total = 0.0f;
+    for (auto& [type, probability] : config["weatherTransitionProbabilities"][fromName].items()) {
+        if ((type == "Snowy" || type == "Blizzard") && season != "winter") {
+            continue;
+        }
+        float prob = probability.get<float>();
+        if (config.contains("seasonalModifiers") && config["seasonalModifiers"].contains(season) && config["seasonalModifiers"][season].contains(type)) {
+            prob *= config["seasonalModifiers"][season][type].get<float>();
+        }
+        transitions[type] = prob;
+        total += prob;
+    }
+    if (total > 0.0f) {
+        for (auto& [type, prob] : transitions) {
+            prob /= total;
+        }
+    }
+
+    float roll = dist(rng);
+    float cumulative = 0.0f;
+    for (const auto& [type, probability] : transitions) {
+        cumulative += probability;
+        if (roll < cumulative) {
+            nextName = type;
+            change.type = stringToWeatherType(type);
+            break;
+        }
+    }
+
+    if (config.contains("intensityProbabilities") && config["intensityProbabilities"].contains(nextName)) {
+        std::map<std::string, float> intensities;
+        float intensityTotal = 0.0f;
+        for (auto& [intensity, probability] : config["intensityProbabilities"][nextName].items()) {
+            intensities[intensity] = probability.get<float>();
+            intensityTotal += probability.get<float>();
+        }
+        float intensityRoll = dist(rng) * intensityTotal;
+        cumulative = 0.0f;
+        for (const auto& [intensity, probability] : intensities) {
+            cumulative += probability;
+            if (intensityRoll < cumulative) {
+                change.intensity = stringToWeatherIntensity(intensity);
+                break;
+            }
+        }
+    }
+    return change;
+}
+
+// Two-sample chi-square over k outcomes; true when the histograms differ at p = 0.001
+bool differs(const long* a, const long* b, int k, double& ratio)
+{
+    double chi = 0.0;
+    int degrees = -1;
+    for (int j = 0; j < k; j++) {
+        if (a[j] + b[j] == 0) {
+            continue;
+        }
+        degrees++;
+        double d = static_cast<double>(a[j] - b[j]);
+        chi += d * d / (a[j] + b[j]);
+    }
+    if (degrees <= 0) {
+        ratio = 0.0;
+        return false;
+    }
+    ratio = chi / CRITICAL[degrees];
+    return ratio > 1.0;
+}
+
+} // namespace
+
+int main()
+{
+    std::ifstream file(OATH_RESOURCE_DIR "/Weather.json");
+    if (!file.is_open()) {
+        std::cerr << "Could not open " << OATH_RESOURCE_DIR "/Weather.json" << std::endl;
+        return 1;
+    }
+    nlohmann::json config;
+    file >> config;
+    WeatherTables tables;
+    tables.compile(config);
+
+    // One step from every (season, type), next type and its intensity
+    std::mt19937 rng(42);
+    int tests = 0;
+    int mismatches = 0;
+    double worst = 0.0;
+    for (int season = 0; season < WEATHER_SEASON_COUNT; season++) {
+        for (int from = 0; from < WEATHER_TYPE_COUNT; from++) {
+            long oldTypes[WEATHER_TYPE_COUNT] = {};
+            long tableTypes[WEATHER_TYPE_COUNT] = {};
+            long oldIntensities[WEATHER_INTENSITY_COUNT] = {};
+            long tableIntensities[WEATHER_INTENSITY_COUNT] = {};
+            for (int i = 0; i < DRAWS_PER_STATE; i++) {
+                WeatherChange change = oldChange(config, SEASONS[season], static_cast<WeatherType>(from), rng);
+                oldTypes[static_cast<int>(change.type)]++;
+                oldIntensities[static_cast<int>(change.intensity)]++;
+
+                WeatherType next = tables.sampleTransition(season, static_cast<WeatherType>(from), rng);
+                tableTypes[static_cast<int>(next)]++;
+                tableIntensities[static_cast<int>(tables.sampleIntensity(next, rng))]++;
+            }
+
+            double ratio;
+            mismatches += differs(oldTypes, tableTypes, WEATHER_TYPE_COUNT, ratio);
+            worst = std::max(worst, ratio);
+            mismatches += differs(oldIntensities, tableIntensities, WEATHER_INTENSITY_COUNT, ratio);
+            worst = std::max(worst, ratio);
+            tests += 2;
+        }
+    }
+
+    int hours = 0;
+    WeatherType type = WeatherType::Clear;
+    auto start = BenchmarkClock::now();
+    for (int i = 0; i < OLD_CHANGES; i++) {
+        WeatherChange change = oldChange(config, SEASONS[i % WEATHER_SEASON_COUNT], type, rng);
+        hours += change.hours + static_cast<int>(change.intensity);
+        type = change.type;
+    }
+    double oldRate = OLD_CHANGES / (microsecondsSince(start) / 1e6);
+
+    type = WeatherType::Clear;
+    start = BenchmarkClock::now();
+    for (int i = 0; i < TABLE_CHANGES; i++) {
+        hours += tables.rollChangeInterval(rng);
+        type = tables.sampleTransition(i % WEATHER_SEASON_COUNT, type, rng);
+        hours += static_cast<int>(tables.sampleIntensity(type, rng));
+    }
+    double tableRate = TABLE_CHANGES / (microsecondsSince(start) / 1e6);
+    keepAlive(hours);
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "JSON walk      " << std::setw(10) << oldRate / 1e6 << " M changes/s\n"
+              << "alias tables   " << std::setw(10) << tableRate / 1e6 << " M changes/s\n"
+              << "chi-square     " << std::setw(10) << tests << " tests at p=0.001, worst "
+              << worst << "x critical\n"
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
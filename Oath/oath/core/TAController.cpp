@@ -6,6 +6,11 @@
 #include <fstream>
 #include <iostream>
 
+TAController::TAController()
+{
+    gameContext.attachTriggers(&triggers);
+}
+
 bool TAController::processInput(const std::string& systemName, const TAInput& input)
 {
     if (systemRoots.find(systemName) == systemRoots.end()) {
@@ -19,6 +24,7 @@ bool TAController::processInput(const std::string& systemName, const TAInput& in
         currentNodes[systemName]->onEnter(&gameContext);
     }
 
+    bool transitioned = false;
     TANode* nextNode = nullptr;
     if (currentNodes[systemName]->evaluateTransition(input, nextNode)) {
         if (nextNode != currentNodes[systemName]) {
@@ -29,10 +35,12 @@ bool TAController::processInput(const std::string& systemName, const TAInput& in
             updateCurrentNodePersistentID(systemName);
 
             nextNode->onEnter(&gameContext);
-            return true;
+            transitioned = true;
         }
     }
-    return false;
+
+    triggers.update(&gameContext);
+    return transitioned;
 }
 
 void TAController::updateCurrentNodePersistentID(const std::string& systemName)
@@ -392,6 +400,8 @@ bool TAController::loadState_old(const std::string& filename)
         gameContext.playerStats.knownFacts.insert(fact);
     }
 
+    // Loaded state bypassed the setters
+    triggers.markAllDirty();
     return true;
 }
 
@@ -531,6 +541,9 @@ bool TAController::loadState(const std::string& filename)
 
         inFile.close();
 
+        // Loaded state bypassed the setters
+        triggers.markAllDirty();
+
         std::cout << "Game state successfully loaded from " << filename << std::endl;
         return true;
     } catch (const std::exception& e) {
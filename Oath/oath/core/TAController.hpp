@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../data/GameContext.hpp"
+#include "../data/TriggerEngine.hpp"
 #include "../systems/dialogue/NPC.hpp"
 #include "../utils/JSONSerializer.hpp"
 
@@ -36,13 +37,19 @@ public:
     // Owned nodes for memory management
     std::vector<std::unique_ptr<TANode>> ownedNodes;
 
+    // Re-checks content conditions when the state they read changes
+    TriggerEngine triggers;
+
     // Game context
     GameContext gameContext;
 
     // Game data storage for references
     std::map<std::string, std::map<std::string, NPC*>> gameData;
 
-    // Process an input and potentially transition to a new state
+    TAController();
+
+    // Process an input and potentially transition to a new state; ends the tick
+    // by re-checking the triggers whose inputs changed
     bool processInput(const std::string& systemName, const TAInput& input);
 
     void updateCurrentNodePersistentID(const std::string& systemName);
@@ -42,20 +42,120 @@ bool CharacterStats::hasAbility(const std::string& ability) const
 
 void CharacterStats::learnFact(const std::string& fact)
 {
-    knownFacts.insert(fact);
+    if (knownFacts.insert(fact).second) {
+        notify(StateField::Fact, fact);
+    }
 }
 
 void CharacterStats::unlockAbility(const std::string& ability)
 {
-    unlockedAbilities.insert(ability);
+    if (unlockedAbilities.insert(ability).second) {
+        notify(StateField::Ability, ability);
+    }
 }
 
 void CharacterStats::improveSkill(const std::string& skill, int amount)
 {
     skills[skill] += amount;
+    if (amount != 0) {
+        notify(StateField::Skill, skill);
+    }
 }
 
 void CharacterStats::changeFactionRep(const std::string& faction, int amount)
 {
     factionReputation[faction] += amount;
+    if (amount != 0) {
+        notify(StateField::Reputation, faction);
+    }
+}
+
+void CharacterStats::setSkill(const std::string& skill, int level)
+{
+    int& current = skills[skill];
+    if (current != level) {
+        current = level;
+        notify(StateField::Skill, skill);
+    }
+}
+
+void CharacterStats::setFactionRep(const std::string& faction, int reputation)
+{
+    int& current = factionReputation[faction];
+    if (current != reputation) {
+        current = reputation;
+        notify(StateField::Reputation, faction);
+    }
+}
+
+void CharacterStats::forgetFact(const std::string& fact)
+{
+    if (knownFacts.erase(fact) > 0) {
+        notify(StateField::Fact, fact);
+    }
+}
+
+void CharacterStats::lockAbility(const std::string& ability)
+{
+    if (unlockedAbilities.erase(ability) > 0) {
+        notify(StateField::Ability, ability);
+    }
+}
+
+bool CharacterStats::changeStat(const std::string& stat, int amount)
+{
+    int* value = findStat(stat);
+    if (!value) {
+        return false;
+    }
+    return setStat(stat, *value + amount);
+}
+
+bool CharacterStats::setStat(const std::string& stat, int value)
+{
+    int* current = findStat(stat);
+    if (!current) {
+        return false;
+    }
+    if (*current != value) {
+        *current = value;
+        notify(StateField::Stat, stat);
+    }
+    return true;
+}
+
+int CharacterStats::getStat(const std::string& stat) const
+{
+    int* value = const_cast<CharacterStats*>(this)->findStat(stat);
+    return value ? *value : 0;
+}
+
+int* CharacterStats::findStat(const std::string& stat)
+{
+    if (stat == "strength")
+        return &strength;
+    if (stat == "dexterity")
+        return &dexterity;
+    if (stat == "constitution")
+        return &constitution;
+    if (stat == "intelligence")
+        return &intelligence;
+    if (stat == "wisdom")
+        return &wisdom;
+    if (stat == "charisma")
+        return &charisma;
+    if (stat == "health")
+        return &health;
+    if (stat == "mana")
+        return &mana;
+    if (stat == "stamina")
+        return &stamina;
+    return nullptr;
+}
+
+void CharacterStats::notify(StateField field, const std::string& name) const
+{
+    if (listener) {
+        listener->stateChanged(field, name);
+    }
 }
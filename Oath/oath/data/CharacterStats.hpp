@@ -1,5 +1,7 @@
 #pragma once
 
+#include "StateListener.hpp"
+
 #include <map>
 #include <set>
 #include <string>
@@ -22,6 +24,9 @@ struct CharacterStats {
     std::set<std::string> knownFacts;
     std::set<std::string> unlockedAbilities;
 
+    // Told about changes made through the setters below; direct field writes go unreported
+    StateListener* listener = nullptr;
+
     CharacterStats();
     bool hasSkill(const std::string& skill, int minLevel) const;
     bool hasFactionReputation(const std::string& faction, int minRep) const;
@@ -31,4 +36,17 @@ struct CharacterStats {
     void unlockAbility(const std::string& ability);
     void improveSkill(const std::string& skill, int amount);
     void changeFactionRep(const std::string& faction, int amount);
+    void setSkill(const std::string& skill, int level);
+    void setFactionRep(const std::string& faction, int reputation);
+    void forgetFact(const std::string& fact);
+    void lockAbility(const std::string& ability);
+
+    // Base stats by name ("strength" ... "stamina"); false for an unknown name
+    bool changeStat(const std::string& stat, int amount);
+    bool setStat(const std::string& stat, int value);
+    int getStat(const std::string& stat) const;
+
+private:
+    int* findStat(const std::string& stat);
+    void notify(StateField field, const std::string& name) const;
 };
\ No newline at end of file
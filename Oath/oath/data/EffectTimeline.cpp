@@ -0,0 +1,309 @@
+#include "EffectTimeline.hpp"
+#include <algorithm>
+
+namespace {
+const int64_t WHEEL_MASK = EffectTimeline::WHEEL_TICKS - 1;
+}
+
+EffectTimeline::EffectTimeline()
+    : wheel(WHEEL_TICKS)
+    , statStride(8)
+    , clock(0)
+{
+}
+
+void EffectTimeline::clear()
+{
+    records.clear();
+    freeSlots.clear();
+    for (auto& bucket : wheel) {
+        bucket.clear();
+    }
+    heap.clear();
+    bucketOf.clear();
+    position.clear();
+    slotsByKey.clear();
+    totals.clear();
+}
+
+int EffectTimeline::kindId(const std::string& kind)
+{
+    auto it = kindIndices.find(kind);
+    if (it != kindIndices.end()) {
+        return it->second;
+    }
+
+    int id = static_cast<int>(kindNames.size());
+    kindNames.push_back(kind);
+    kindIndices[kind] = id;
+    return id;
+}
+
+int EffectTimeline::findKind(const std::string& kind) const
+{
+    auto it = kindIndices.find(kind);
+    return it != kindIndices.end() ? it->second : -1;
+}
+
+int EffectTimeline::statId(const std::string& stat)
+{
+    auto it = statIndices.find(stat);
+    if (it != statIndices.end()) {
+        return it->second;
+    }
+
+    int id = static_cast<int>(statNames.size());
+    statNames.push_back(stat);
+    statIndices[stat] = id;
+
+    // Widen every owner's row when the stats outgrow it
+    if (id >= statStride) {
+        int wider = statStride * 2;
+        int owners = static_cast<int>(totals.size()) / statStride;
+        std::vector<float> moved(static_cast<size_t>(owners) * wider, 0.0f);
+        for (int o = 0; o < owners; o++) {
+            for (int s = 0; s < statStride; s++) {
+                moved[static_cast<size_t>(o) * wider + s] = totals[static_cast<size_t>(o) * statStride + s];
+            }
+        }
+        totals.swap(moved);
+        statStride = wider;
+    }
+    return id;
+}
+
+uint64_t EffectTimeline::key(int owner, int kind)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(owner)) << 32) | static_cast<uint32_t>(kind);
+}
+
+void EffectTimeline::addModifier(const EffectRecord& record, float sign)
+{
+    if (record.stat == NO_STAT) {
+        return;
+    }
+
+    size_t at = static_cast<size_t>(record.owner) * statStride + record.stat;
+    if (at >= totals.size()) {
+        totals.resize((static_cast<size_t>(record.owner) + 1) * statStride, 0.0f);
+    }
+    totals[at] += sign * record.amount;
+}
+
+void EffectTimeline::apply(int owner, int kind, int64_t expiresAt, int stat, float amount)
+{
+    if (expiresAt <= clock) {
+        remove(owner, kind);
+        return;
+    }
+
+    EffectRecord record { expiresAt, owner, kind, stat, amount };
+    auto it = slotsByKey.find(key(owner, kind));
+    if (it != slotsByKey.end()) {
+        // Refresh in place
+        int slot = it->second;
+        unschedule(slot);
+        addModifier(records[slot], -1.0f);
+        records[slot] = record;
+        addModifier(record, 1.0f);
+        schedule(slot);
+        return;
+    }
+
+    int slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        records[slot] = record;
+    } else {
+        slot = static_cast<int>(records.size());
+        records.push_back(record);
+        bucketOf.push_back(-1);
+        position.push_back(-1);
+    }
+
+    slotsByKey[key(owner, kind)] = slot;
+    addModifier(record, 1.0f);
+    schedule(slot);
+}
+
+bool EffectTimeline::remove(int owner, int kind)
+{
+    auto it = slotsByKey.find(key(owner, kind));
+    if (it == slotsByKey.end()) {
+        return false;
+    }
+
+    int slot = it->second;
+    unschedule(slot);
+    addModifier(records[slot], -1.0f);
+    slotsByKey.erase(it);
+    freeSlots.push_back(slot);
+    return true;
+}
+
+void EffectTimeline::schedule(int slot)
+{
+    int64_t expiresAt = records[slot].expiresAt;
+    if (expiresAt - clock < WHEEL_TICKS) {
+        int bucket = static_cast<int>(expiresAt & WHEEL_MASK);
+        bucketOf[slot] = bucket;
+        position[slot] = static_cast<int>(wheel[bucket].size());
+        wheel[bucket].push_back(slot);
+        return;
+    }
+
+    bucketOf[slot] = -1;
+    heap.push_back({ expiresAt, slot });
+    position[slot] = static_cast<int>(heap.size()) - 1;
+    siftUp(position[slot]);
+}
+
+void EffectTimeline::unschedule(int slot)
+{
+    int pos = position[slot];
+    if (bucketOf[slot] >= 0) {
+        // Buckets are unordered; the last slot fills the gap
+        std::vector<int>& bucket = wheel[bucketOf[slot]];
+        int moved = bucket.back();
+        bucket[pos] = moved;
+        position[moved] = pos;
+        bucket.pop_back();
+        return;
+    }
+
+    HeapEntry last = heap.back();
+    heap.pop_back();
+    if (last.slot != slot) {
+        place(pos, last);
+        siftUp(pos);
+        siftDown(position[last.slot]);
+    }
+}
+
+void EffectTimeline::expire(int slot, std::vector<EffectRecord>* expired)
+{
+    const EffectRecord& record = records[slot];
+    if (expired) {
+        expired->push_back(record);
+    }
+    addModifier(record, -1.0f);
+    slotsByKey.erase(key(record.owner, record.kind));
+    freeSlots.push_back(slot);
+}
+
+bool EffectTimeline::isActive(int owner, int kind) const
+{
+    return slotsByKey.find(key(owner, kind)) != slotsByKey.end();
+}
+
+int64_t EffectTimeline::expiresAt(int owner, int kind) const
+{
+    const EffectRecord* record = find(owner, kind);
+    return record ? record->expiresAt : -1;
+}
+
+const EffectRecord* EffectTimeline::find(int owner, int kind) const
+{
+    auto it = slotsByKey.find(key(owner, kind));
+    return it != slotsByKey.end() ? &records[it->second] : nullptr;
+}
+
+float EffectTimeline::modifier(int owner, int stat) const
+{
+    size_t at = static_cast<size_t>(owner) * statStride + stat;
+    return stat >= 0 && at < totals.size() ? totals[at] : 0.0f;
+}
+
+int EffectTimeline::advanceTo(int64_t time, std::vector<EffectRecord>* expired)
+{
+    if (time <= clock) {
+        return 0;
+    }
+
+    // Wheel entries all fall before the old clock + WHEEL_TICKS, one tick per
+    // bucket, so walking the passed ticks in order ends them earliest first
+    int ended = 0;
+    int64_t lastTick = std::min(time, clock + WHEEL_TICKS - 1);
+    for (int64_t tick = clock + 1; tick <= lastTick; tick++) {
+        std::vector<int>& bucket = wheel[tick & WHEEL_MASK];
+        for (int slot : bucket) {
+            expire(slot, expired);
+        }
+        ended += static_cast<int>(bucket.size());
+        bucket.clear();
+    }
+    clock = time;
+
+    // Heap entries are all later than the wheel's
+    while (!heap.empty() && heap[0].expiresAt <= clock) {
+        int slot = heap[0].slot;
+        HeapEntry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        expire(slot, expired);
+        ended++;
+    }
+
+    // Bring what is now in range into the wheel
+    while (!heap.empty() && heap[0].expiresAt - clock < WHEEL_TICKS) {
+        int slot = heap[0].slot;
+        HeapEntry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        schedule(slot);
+    }
+    return ended;
+}
+
+void EffectTimeline::place(int pos, const HeapEntry& entry)
+{
+    heap[pos] = entry;
+    position[entry.slot] = pos;
+}
+
+void EffectTimeline::siftUp(int pos)
+{
+    HeapEntry entry = heap[pos];
+    while (pos > 0) {
+        int parent = (pos - 1) / 4;
+        if (heap[parent].expiresAt <= entry.expiresAt) {
+            break;
+        }
+        place(pos, heap[parent]);
+        pos = parent;
+    }
+    place(pos, entry);
+}
+
+void EffectTimeline::siftDown(int pos)
+{
+    int count = static_cast<int>(heap.size());
+    HeapEntry entry = heap[pos];
+    while (true) {
+        // Earliest of up to four children
+        int first = 4 * pos + 1;
+        if (first >= count) {
+            break;
+        }
+        int child = first;
+        int lastChild = std::min(first + 4, count);
+        for (int c = first + 1; c < lastChild; c++) {
+            if (heap[c].expiresAt < heap[child].expiresAt) {
+                child = c;
+            }
+        }
+        if (heap[child].expiresAt >= entry.expiresAt) {
+            break;
+        }
+        place(pos, heap[child]);
+        pos = child;
+    }
+    place(pos, entry);
+}
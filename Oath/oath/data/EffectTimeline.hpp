@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// One timed effect: an owner has it until expiresAt, and while it lasts
+// amount is added to the owner's stat (none when stat is -1)
+struct EffectRecord {
+    int64_t expiresAt;
+    int owner; // 0 for the player, NPCs by their own dense index
+    int kind;
+    int stat;
+    float amount;
+};
+
+// Timed effects of any number of owners on one game clock, in whatever unit
+// the caller counts (the religion system uses days). Effects due within the
+// next WHEEL_TICKS sit in a timer wheel with a bucket per tick, so advancing
+// the clock empties only the buckets it passes; later ones wait in a 4-ary
+// min-heap and move into the wheel as their tick comes in range. Each owner's
+// stat modifiers are kept summed as effects start and end, and nothing is
+// scanned per tick. An owner has at most one effect of each kind; applying it
+// again refreshes it.
+class EffectTimeline {
+public:
+    static const int NO_STAT = -1;
+    static const int WHEEL_TICKS = 1024; // Power of two
+
+    EffectTimeline();
+
+    void clear(); // Drops every effect; names and the clock stay
+
+    // Interned names
+    int kindId(const std::string& kind);
+    int statId(const std::string& stat);
+    int findKind(const std::string& kind) const; // -1 for a name never interned
+    const std::string& kindName(int kind) const { return kindNames[kind]; }
+    const std::string& statName(int stat) const { return statNames[stat]; }
+
+    // Start or refresh the effect; an expiry not after now() removes it
+    void apply(int owner, int kind, int64_t expiresAt, int stat = NO_STAT, float amount = 0.0f);
+    bool remove(int owner, int kind);
+
+    bool isActive(int owner, int kind) const;
+    int64_t expiresAt(int owner, int kind) const; // -1 when not active
+    const EffectRecord* find(int owner, int kind) const;
+
+    // Sum of the owner's active effects on the stat
+    float modifier(int owner, int stat) const;
+
+    // Moves the clock and ends every effect due by then, earliest first.
+    // Ended effects are appended to expired when given; returns how many.
+    int advanceTo(int64_t time, std::vector<EffectRecord>* expired = nullptr);
+    int64_t now() const { return clock; }
+
+    int size() const { return static_cast<int>(slotsByKey.size()); }
+
+private:
+    std::vector<EffectRecord> records; // By slot; free slots are reused
+    std::vector<int> freeSlots;
+
+    // Every effect has expiresAt > clock. Those before clock + WHEEL_TICKS
+    // are in bucket expiresAt % WHEEL_TICKS, which then holds only that tick;
+    // the rest are in the heap, expiry kept beside the slot for sifting.
+    struct HeapEntry {
+        int64_t expiresAt;
+        int slot;
+    };
+    std::vector<std::vector<int>> wheel;
+    std::vector<HeapEntry> heap;
+    std::vector<int> bucketOf; // By slot; -1 when in the heap
+    std::vector<int> position; // Index in the bucket or heap, by slot
+    std::unordered_map<uint64_t, int> slotsByKey; // (owner, kind) -> slot
+
+    // Stat totals of owner o are [o * statStride, (o + 1) * statStride)
+    std::vector<float> totals;
+    int statStride;
+
+    std::vector<std::string> kindNames;
+    std::unordered_map<std::string, int> kindIndices;
+    std::vector<std::string> statNames;
+    std::unordered_map<std::string, int> statIndices;
+
+    int64_t clock;
+
+    static uint64_t key(int owner, int kind);
+    void addModifier(const EffectRecord& record, float sign);
+    void schedule(int slot);
+    void unschedule(int slot);
+    void expire(int slot, std::vector<EffectRecord>* expired);
+    void siftUp(int pos);
+    void siftDown(int pos);
+    void place(int pos, const HeapEntry& entry);
+};
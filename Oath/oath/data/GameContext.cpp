@@ -0,0 +1,22 @@
+#include "GameContext.hpp"
+#include "TriggerEngine.hpp"
+
+void GameContext::attachTriggers(TriggerEngine* engine)
+{
+    triggers = engine;
+    playerStats.listener = engine;
+    playerInventory.listener = engine;
+    worldState.listener = engine;
+    script.listener = engine;
+}
+
+void GameContext::setQuestState(const std::string& quest, const std::string& state)
+{
+    std::string& current = questJournal[quest];
+    if (current != state) {
+        current = state;
+        if (triggers) {
+            triggers->stateChanged(StateField::Quest, quest);
+        }
+    }
+}
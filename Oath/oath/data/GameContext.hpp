@@ -2,6 +2,7 @@
 
 #include "CharacterStats.hpp"
 #include "Inventory.hpp"
+#include "ScriptState.hpp"
 #include "WorldState.hpp"
 
 // #include "../core/TAController.hpp"
@@ -12,6 +13,7 @@
 #include <string>
 
 // class TAController;
+class TriggerEngine;
 struct CharacterStats;
 class Inventory;
 
@@ -32,4 +34,15 @@ struct GameContext {
 
     std::map<std::string, std::string> questJournal;
     std::map<std::string, std::string> dialogueHistory;
+
+    // Variables published by systems for compiled conditions
+    ScriptState script;
+
+    // Engine told about changes made through the state setters, if attached
+    TriggerEngine* triggers = nullptr;
+
+    // Route setter notifications from every part of the context to the engine
+    void attachTriggers(TriggerEngine* engine);
+
+    void setQuestState(const std::string& quest, const std::string& state);
 };
@@ -0,0 +1,1097 @@
+#include "GameScript.hpp"
+
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+enum ScriptStat {
+    STAT_STRENGTH,
+    STAT_DEXTERITY,
+    STAT_CONSTITUTION,
+    STAT_INTELLIGENCE,
+    STAT_WISDOM,
+    STAT_CHARISMA,
+    STAT_HEALTH,
+    STAT_MANA,
+    STAT_STAMINA,
+    STAT_COUNT
+};
+
+const char* const STAT_NAMES[STAT_COUNT] = {
+    "strength", "dexterity", "constitution", "intelligence", "wisdom", "charisma", "health", "mana", "stamina"
+};
+
+int statValue(const CharacterStats& stats, int stat)
+{
+    const int* fields[STAT_COUNT] = {
+        &stats.strength, &stats.dexterity, &stats.constitution, &stats.intelligence, &stats.wisdom,
+        &stats.charisma, &stats.health, &stats.mana, &stats.stamina
+    };
+    return *fields[stat];
+}
+
+int findStat(const std::string& name)
+{
+    for (int stat = 0; stat < STAT_COUNT; stat++) {
+        if (name == STAT_NAMES[stat]) {
+            return stat;
+        }
+    }
+    return -1;
+}
+
+std::atomic<int> nextCacheSlot { 0 };
+
+enum class TokenType {
+    End,
+    Number,
+    String,
+    Identifier,
+    Operator
+};
+
+struct Token {
+    TokenType type = TokenType::End;
+    std::string text;
+    float number = 0.0f;
+};
+
+// Recursive descent over the expression grammar, emitting bytecode as it goes:
+//   or         := and (("||" | "or") and)*
+//   and        := comparison (("&&" | "and") comparison)*
+//   comparison := sum (("==" | "!=" | "<" | "<=" | ">" | ">=") sum)?  |  text-identifier ("==" | "!=") 'string'
+//   sum        := term (("+" | "-") term)*
+//   term       := unary (("*" | "/") unary)*
+//   unary      := ("!" | "not" | "-") unary | primary
+//   primary    := number | true | false | identifier | "(" or ")"
+class ScriptParser {
+public:
+    std::string error;
+
+    ScriptParser(const std::string& sourceText, ScriptProgram& target)
+        : text(sourceText)
+        , pos(0)
+        , program(target)
+        , depth(0)
+    {
+        next();
+    }
+
+    bool parseCondition()
+    {
+        if (current.type == TokenType::End) {
+            emit(ScriptOp::Push, 0, 0, 1.0f);
+            return true;
+        }
+        if (!parseOr()) {
+            return false;
+        }
+        return current.type == TokenType::End || fail("Unexpected '" + current.text + "'");
+    }
+
+    bool parseEffects()
+    {
+        while (current.type != TokenType::End) {
+            if (isOperator(";")) {
+                next();
+                continue;
+            }
+            if (!parseStatement()) {
+                return false;
+            }
+            if (current.type != TokenType::End && !isOperator(";")) {
+                return fail("Expected ';' before '" + current.text + "'");
+            }
+        }
+        return true;
+    }
+
+private:
+    const std::string& text;
+    size_t pos;
+    Token current;
+    ScriptProgram& program;
+    int depth;
+
+    bool fail(const std::string& message)
+    {
+        if (error.empty()) {
+            error = message + " (at character " + std::to_string(pos) + ")";
+        }
+        return false;
+    }
+
+    void next()
+    {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            pos++;
+        }
+
+        current = Token();
+        if (pos >= text.size()) {
+            return;
+        }
+
+        char c = text[pos];
+        if (std::isdigit(static_cast<unsigned char>(c)) || (c == '.' && pos + 1 < text.size() && std::isdigit(static_cast<unsigned char>(text[pos + 1])))) {
+            char* end = nullptr;
+            current.type = TokenType::Number;
+            current.number = std::strtof(text.c_str() + pos, &end);
+            current.text = text.substr(pos, end - (text.c_str() + pos));
+            pos = end - text.c_str();
+        } else if (c == '\'' || c == '"') {
+            size_t close = text.find(c, pos + 1);
+            current.type = TokenType::String;
+            current.text = text.substr(pos + 1, close == std::string::npos ? std::string::npos : close - pos - 1);
+            pos = close == std::string::npos ? text.size() : close + 1;
+        } else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            size_t start = pos;
+            while (pos < text.size() && (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '_' || text[pos] == '.')) {
+                pos++;
+            }
+            current.type = TokenType::Identifier;
+            current.text = text.substr(start, pos - start);
+        } else {
+            static const char* const twoChar[] = { "&&", "||", "==", "!=", "<=", ">=", "+=", "-=" };
+            current.type = TokenType::Operator;
+            current.text = std::string(1, c);
+            for (const char* op : twoChar) {
+                if (text.compare(pos, 2, op) == 0) {
+                    current.text = op;
+                    break;
+                }
+            }
+            pos += current.text.size();
+        }
+    }
+
+    bool isOperator(const char* op) const
+    {
+        return current.type == TokenType::Operator && current.text == op;
+    }
+
+    bool isKeyword(const char* word) const
+    {
+        return current.type == TokenType::Identifier && current.text == word;
+    }
+
+    int name(const std::string& value)
+    {
+        for (size_t i = 0; i < program.names.size(); i++) {
+            if (program.names[i] == value) {
+                return static_cast<int>(i);
+            }
+        }
+        program.names.push_back(value);
+        return static_cast<int>(program.names.size()) - 1;
+    }
+
+    bool emit(ScriptOp op, int32_t a = 0, int32_t b = 0, float value = 0.0f)
+    {
+        switch (op) {
+        case ScriptOp::Not:
+        case ScriptOp::Negate:
+        case ScriptOp::Truthy:
+            break;
+        case ScriptOp::Push:
+        case ScriptOp::LoadStat:
+        case ScriptOp::LoadSkill:
+        case ScriptOp::LoadReputation:
+        case ScriptOp::LoadItem:
+        case ScriptOp::LoadVariable:
+        case ScriptOp::LoadDay:
+        case ScriptOp::HasFlag:
+        case ScriptOp::HasFact:
+        case ScriptOp::HasAbility:
+        case ScriptOp::HasQuest:
+        case ScriptOp::SeasonIs:
+        case ScriptOp::QuestIs:
+        case ScriptOp::LocationIs:
+        case ScriptOp::FactionStateIs:
+            depth++;
+            break;
+        default:
+            // Binary operators, and jumps on their fall-through path
+            depth--;
+            break;
+        }
+
+        if (depth > ScriptProgram::MAX_STACK) {
+            return fail("Expression too deeply nested");
+        }
+        program.code.push_back({ op, a, b, value });
+        return true;
+    }
+
+    // Split "prefix.rest"; rest is empty if there is no dot
+    static void splitIdentifier(const std::string& identifier, std::string& prefix, std::string& rest)
+    {
+        size_t dot = identifier.find('.');
+        prefix = identifier.substr(0, dot);
+        rest = dot == std::string::npos ? "" : identifier.substr(dot + 1);
+    }
+
+    static bool isVariablePrefix(const std::string& prefix)
+    {
+        return prefix == "var" || prefix == "weather" || prefix == "time";
+    }
+
+    static int variableSlot(const std::string& identifier, const std::string& prefix, const std::string& rest)
+    {
+        return ScriptState::slotOf(prefix == "var" ? rest : identifier);
+    }
+
+    bool parseOr()
+    {
+        if (!parseAnd()) {
+            return false;
+        }
+        std::vector<size_t> jumps;
+        while (isOperator("||") || isKeyword("or")) {
+            next();
+            jumps.push_back(program.code.size());
+            if (!emit(ScriptOp::JumpIfTrue) || !parseAnd()) {
+                return false;
+            }
+        }
+        return closeJumps(jumps);
+    }
+
+    bool parseAnd()
+    {
+        if (!parseComparison()) {
+            return false;
+        }
+        std::vector<size_t> jumps;
+        while (isOperator("&&") || isKeyword("and")) {
+            next();
+            jumps.push_back(program.code.size());
+            if (!emit(ScriptOp::JumpIfFalse) || !parseComparison()) {
+                return false;
+            }
+        }
+        return closeJumps(jumps);
+    }
+
+    bool closeJumps(const std::vector<size_t>& jumps)
+    {
+        if (jumps.empty()) {
+            return true;
+        }
+        // The last operand is not followed by a jump, so collapse it to 0/1 like the others
+        if (!emit(ScriptOp::Truthy)) {
+            return false;
+        }
+        for (size_t jump : jumps) {
+            program.code[jump].a = static_cast<int32_t>(program.code.size());
+        }
+        return true;
+    }
+
+    bool parseComparison()
+    {
+        // Text state compared against a string literal
+        if (current.type == TokenType::Identifier) {
+            std::string prefix;
+            std::string rest;
+            splitIdentifier(current.text, prefix, rest);
+
+            ScriptOp op = ScriptOp::Push;
+            if (current.text == "season") {
+                op = ScriptOp::SeasonIs;
+            } else if (prefix == "quest" && !rest.empty()) {
+                op = ScriptOp::QuestIs;
+            } else if (prefix == "location" && !rest.empty()) {
+                op = ScriptOp::LocationIs;
+            } else if (prefix == "faction" && !rest.empty()) {
+                op = ScriptOp::FactionStateIs;
+            }
+
+            if (op != ScriptOp::Push) {
+                size_t savedPos = pos;
+                Token identifier = current;
+                next();
+                if (isOperator("==") || isOperator("!=")) {
+                    bool negate = isOperator("!=");
+                    next();
+                    if (current.type != TokenType::String) {
+                        return fail("Expected a quoted string after " + identifier.text);
+                    }
+                    if (!emit(op, name(rest), name(current.text))) {
+                        return false;
+                    }
+                    next();
+                    return !negate || emit(ScriptOp::Not);
+                }
+                pos = savedPos;
+                current = identifier;
+            }
+        }
+
+        if (!parseSum()) {
+            return false;
+        }
+
+        static const std::pair<const char*, ScriptOp> comparisons[] = {
+            { "==", ScriptOp::Equal }, { "!=", ScriptOp::NotEqual }, { "<", ScriptOp::Less },
+            { "<=", ScriptOp::LessEqual }, { ">", ScriptOp::Greater }, { ">=", ScriptOp::GreaterEqual }
+        };
+        for (const auto& [symbol, op] : comparisons) {
+            if (isOperator(symbol)) {
+                next();
+                return parseSum() && emit(op);
+            }
+        }
+        return true;
+    }
+
+    bool parseSum()
+    {
+        if (!parseTerm()) {
+            return false;
+        }
+        while (isOperator("+") || isOperator("-")) {
+            ScriptOp op = isOperator("+") ? ScriptOp::Add : ScriptOp::Subtract;
+            next();
+            if (!parseTerm() || !emit(op)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool parseTerm()
+    {
+        if (!parseUnary()) {
+            return false;
+        }
+        while (isOperator("*") || isOperator("/")) {
+            ScriptOp op = isOperator("*") ? ScriptOp::Multiply : ScriptOp::Divide;
+            next();
+            if (!parseUnary() || !emit(op)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool parseUnary()
+    {
+        if (isOperator("!") || isKeyword("not")) {
+            next();
+            return parseUnary() && emit(ScriptOp::Not);
+        }
+        if (isOperator("-")) {
+            next();
+            return parseUnary() && emit(ScriptOp::Negate);
+        }
+        return parsePrimary();
+    }
+
+    bool parsePrimary()
+    {
+        if (current.type == TokenType::Number) {
+            float value = current.number;
+            next();
+            return emit(ScriptOp::Push, 0, 0, value);
+        }
+
+        if (isOperator("(")) {
+            next();
+            if (!parseOr()) {
+                return false;
+            }
+            if (!isOperator(")")) {
+                return fail("Expected ')'");
+            }
+            next();
+            return true;
+        }
+
+        if (current.type != TokenType::Identifier) {
+            return fail(current.type == TokenType::End ? "Unexpected end of expression" : "Unexpected '" + current.text + "'");
+        }
+
+        std::string identifier = current.text;
+        next();
+        return emitLoad(identifier);
+    }
+
+    bool emitLoad(const std::string& identifier)
+    {
+        if (identifier == "true" || identifier == "false") {
+            return emit(ScriptOp::Push, 0, 0, identifier == "true" ? 1.0f : 0.0f);
+        }
+        if (identifier == "day") {
+            program.dependencies |= SCRIPT_DEPENDS_TIME;
+            return emit(ScriptOp::LoadDay);
+        }
+        int stat = findStat(identifier);
+        if (stat >= 0) {
+            program.dependencies |= SCRIPT_DEPENDS_STATS;
+            return emit(ScriptOp::LoadStat, stat);
+        }
+
+        std::string prefix;
+        std::string rest;
+        splitIdentifier(identifier, prefix, rest);
+        if (rest.empty()) {
+            return fail("Unknown name '" + identifier + "'");
+        }
+
+        if (prefix == "skill") {
+            program.dependencies |= SCRIPT_DEPENDS_SKILLS;
+            return emit(ScriptOp::LoadSkill, name(rest));
+        }
+        if (prefix == "rep") {
+            program.dependencies |= SCRIPT_DEPENDS_REPUTATION;
+            return emit(ScriptOp::LoadReputation, name(rest));
+        }
+        if (prefix == "item") {
+            // Resolve the catalog index now if the item is known; otherwise by name when run
+            ItemIndex index = ItemCatalog::getInstance().findIndex(rest);
+            program.dependencies |= SCRIPT_DEPENDS_ITEMS;
+            return emit(ScriptOp::LoadItem, name(rest), index == INVALID_ITEM_INDEX ? -1 : static_cast<int32_t>(index));
+        }
+        if (prefix == "flag") {
+            program.dependencies |= SCRIPT_DEPENDS_FLAGS;
+            return emit(ScriptOp::HasFlag, name(rest));
+        }
+        if (prefix == "fact") {
+            program.dependencies |= SCRIPT_DEPENDS_FLAGS;
+            return emit(ScriptOp::HasFact, name(rest));
+        }
+        if (prefix == "ability") {
+            program.dependencies |= SCRIPT_DEPENDS_FLAGS;
+            return emit(ScriptOp::HasAbility, name(rest));
+        }
+        if (prefix == "quest") {
+            program.dependencies |= SCRIPT_DEPENDS_STATES;
+            return emit(ScriptOp::HasQuest, name(rest));
+        }
+        if (isVariablePrefix(prefix)) {
+            program.dependencies |= SCRIPT_DEPENDS_VARIABLES;
+            return emit(ScriptOp::LoadVariable, variableSlot(identifier, prefix, rest));
+        }
+        if (prefix == "location" || prefix == "faction") {
+            return fail("'" + identifier + "' must be compared with a quoted string");
+        }
+        return fail("Unknown name '" + identifier + "'");
+    }
+
+    bool parseStatement()
+    {
+        if (current.type != TokenType::Identifier) {
+            return fail("Expected an effect target");
+        }
+
+        std::string identifier = current.text;
+        std::string prefix;
+        std::string rest;
+        splitIdentifier(identifier, prefix, rest);
+        next();
+
+        std::string assign = current.text;
+        if (!isOperator("=") && !isOperator("+=") && !isOperator("-=")) {
+            return fail("Expected '=', '+=' or '-=' after " + identifier);
+        }
+        next();
+
+        ScriptStatement statement { ScriptEffectOp::SetFlag, 0, -1, 0, 0 };
+
+        // Text assignments
+        if (prefix == "quest" || prefix == "location" || prefix == "faction") {
+            if (assign != "=" || current.type != TokenType::String || rest.empty()) {
+                return fail(identifier + " takes '=' and a quoted string");
+            }
+            statement.op = prefix == "quest" ? ScriptEffectOp::SetQuest : prefix == "location" ? ScriptEffectOp::SetLocation : ScriptEffectOp::SetFactionState;
+            statement.target = name(rest);
+            statement.text = name(current.text);
+            statement.codeBegin = statement.codeEnd = static_cast<int32_t>(program.code.size());
+            next();
+            program.statements.push_back(statement);
+            return true;
+        }
+
+        bool additive = assign != "=";
+        int stat = findStat(identifier);
+        if (stat >= 0) {
+            statement.op = additive ? ScriptEffectOp::AddStat : ScriptEffectOp::SetStat;
+            statement.target = stat;
+        } else if (prefix == "rep" && !rest.empty()) {
+            statement.op = additive ? ScriptEffectOp::AddReputation : ScriptEffectOp::SetReputation;
+            statement.target = name(rest);
+        } else if (prefix == "skill" && !rest.empty()) {
+            statement.op = additive ? ScriptEffectOp::AddSkill : ScriptEffectOp::SetSkill;
+            statement.target = name(rest);
+        } else if (prefix == "item" && !rest.empty() && additive) {
+            statement.op = assign == "+=" ? ScriptEffectOp::AddItem : ScriptEffectOp::RemoveItem;
+            statement.target = name(rest);
+        } else if ((prefix == "flag" || prefix == "fact" || prefix == "ability") && !rest.empty() && !additive) {
+            statement.op = prefix == "flag" ? ScriptEffectOp::SetFlag : prefix == "fact" ? ScriptEffectOp::SetFact : ScriptEffectOp::SetAbility;
+            statement.target = name(rest);
+        } else if (isVariablePrefix(prefix) && !rest.empty()) {
+            statement.op = ScriptEffectOp::SetVariable;
+            statement.target = variableSlot(identifier, prefix, rest);
+        } else {
+            return fail("Cannot assign '" + assign + "' to " + identifier);
+        }
+
+        depth = 0;
+        statement.codeBegin = static_cast<int32_t>(program.code.size());
+        if (statement.op == ScriptEffectOp::SetVariable && additive && !emit(ScriptOp::LoadVariable, statement.target)) {
+            return false;
+        }
+        if (!parseOr()) {
+            return false;
+        }
+        if (statement.op == ScriptEffectOp::SetVariable && additive && !emit(assign == "+=" ? ScriptOp::Add : ScriptOp::Subtract)) {
+            return false;
+        }
+        if (assign == "-=" && statement.op != ScriptEffectOp::SetVariable && statement.op != ScriptEffectOp::RemoveItem && !emit(ScriptOp::Negate)) {
+            return false;
+        }
+        statement.codeEnd = static_cast<int32_t>(program.code.size());
+
+        program.statements.push_back(statement);
+        return true;
+    }
+};
+
+int findMapValue(const std::map<std::string, int>& values, const std::string& key)
+{
+    auto it = values.find(key);
+    return it != values.end() ? it->second : 0;
+}
+
+const std::string& findText(const std::map<std::string, std::string>& values, const std::string& key)
+{
+    static const std::string empty;
+    auto it = values.find(key);
+    return it != values.end() ? it->second : empty;
+}
+
+// Older JSON requirement/effect objects, rewritten as script text
+std::string legacyConditionSource(const nlohmann::json& j)
+{
+    if (j.is_string()) {
+        return j.get<std::string>();
+    }
+
+    if (j.is_array()) {
+        std::string joined;
+        for (const auto& part : j) {
+            std::string text = legacyConditionSource(part);
+            if (!text.empty()) {
+                joined += (joined.empty() ? "(" : " && (") + text + ")";
+            }
+        }
+        return joined;
+    }
+
+    if (!j.is_object()) {
+        return "";
+    }
+
+    std::string type = j.value("type", "");
+    if (type == "skill") {
+        return "skill." + j.value("skill", "") + " >= " + std::to_string(j.value("level", j.value("value", 0)));
+    }
+    if (type == "item") {
+        return "item." + j.value("item", "") + " >= " + std::to_string(j.value("amount", 1));
+    }
+    if (type == "worldflag") {
+        return std::string(j.value("value", true) ? "" : "!") + "flag." + j.value("flag", "");
+    }
+    if (type == "faction") {
+        return "rep." + j.value("faction", j.value("target", "")) + " >= " + std::to_string(j.value("value", j.value("minimum", 0)));
+    }
+    if (type == "knowledge") {
+        return "fact." + j.value("fact", j.value("target", ""));
+    }
+    return "";
+}
+
+std::string legacyEffectSource(const nlohmann::json& j)
+{
+    if (j.is_string()) {
+        return j.get<std::string>();
+    }
+
+    if (j.is_array()) {
+        std::string joined;
+        for (const auto& part : j) {
+            std::string text = legacyEffectSource(part);
+            if (!text.empty()) {
+                joined += (joined.empty() ? "" : "; ") + text;
+            }
+        }
+        return joined;
+    }
+
+    if (!j.is_object()) {
+        return "";
+    }
+
+    std::string type = j.value("type", "");
+    std::string action = j.value("action", "");
+    if (type == "quest" && action == "activate") {
+        return "quest." + j.value("target", "") + " = 'Active'";
+    }
+    if (type == "knowledge" && action == "add") {
+        return "fact." + j.value("target", "") + " = true";
+    }
+    if (type == "faction" && action == "change") {
+        return "rep." + j.value("target", "") + " += " + std::to_string(j.value("amount", 0));
+    }
+    if (type == "location") {
+        return "location." + j.value("target", "") + " = '" + j.value("state", "") + "'";
+    }
+    if (type == "item") {
+        return "item." + j.value("item", "") + " += " + std::to_string(j.value("quantity", j.value("amount", 1)));
+    }
+    if (type == "worldflag") {
+        return "flag." + j.value("flag", "") + " = " + (j.value("value", true) ? "true" : "false");
+    }
+    return "";
+}
+}
+
+float ScriptProgram::run(const GameContext& context, int begin, int end) const
+{
+    float stack[MAX_STACK];
+    int top = -1;
+
+    for (int pc = begin; pc < end; pc++) {
+        const ScriptInstruction& instruction = code[pc];
+        switch (instruction.op) {
+        case ScriptOp::Push:
+            stack[++top] = instruction.value;
+            break;
+        case ScriptOp::LoadStat:
+            stack[++top] = static_cast<float>(statValue(context.playerStats, instruction.a));
+            break;
+        case ScriptOp::LoadSkill:
+            stack[++top] = static_cast<float>(findMapValue(context.playerStats.skills, names[instruction.a]));
+            break;
+        case ScriptOp::LoadReputation:
+            stack[++top] = static_cast<float>(findMapValue(context.playerStats.factionReputation, names[instruction.a]));
+            break;
+        case ScriptOp::LoadItem: {
+            ItemIndex index = instruction.b >= 0 ? static_cast<ItemIndex>(instruction.b) : ItemCatalog::getInstance().findIndex(names[instruction.a]);
+            stack[++top] = index == INVALID_ITEM_INDEX ? 0.0f : static_cast<float>(context.playerInventory.getQuantity(index));
+            break;
+        }
+        case ScriptOp::LoadVariable:
+            stack[++top] = context.script.get(instruction.a);
+            break;
+        case ScriptOp::LoadDay:
+            stack[++top] = static_cast<float>(context.worldState.daysPassed);
+            break;
+        case ScriptOp::HasFlag:
+            stack[++top] = context.worldState.hasFlag(names[instruction.a]) ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::HasFact:
+            stack[++top] = context.playerStats.hasKnowledge(names[instruction.a]) ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::HasAbility:
+            stack[++top] = context.playerStats.hasAbility(names[instruction.a]) ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::HasQuest:
+            stack[++top] = context.questJournal.count(names[instruction.a]) ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::SeasonIs:
+            stack[++top] = context.worldState.currentSeason == names[instruction.b] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::QuestIs:
+            stack[++top] = findText(context.questJournal, names[instruction.a]) == names[instruction.b] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::LocationIs:
+            stack[++top] = findText(context.worldState.locationStates, names[instruction.a]) == names[instruction.b] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::FactionStateIs:
+            stack[++top] = findText(context.worldState.factionStates, names[instruction.a]) == names[instruction.b] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::Not:
+            stack[top] = stack[top] == 0.0f ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::Negate:
+            stack[top] = -stack[top];
+            break;
+        case ScriptOp::Truthy:
+            stack[top] = stack[top] != 0.0f ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::Add:
+            top--;
+            stack[top] += stack[top + 1];
+            break;
+        case ScriptOp::Subtract:
+            top--;
+            stack[top] -= stack[top + 1];
+            break;
+        case ScriptOp::Multiply:
+            top--;
+            stack[top] *= stack[top + 1];
+            break;
+        case ScriptOp::Divide:
+            top--;
+            stack[top] = stack[top + 1] != 0.0f ? stack[top] / stack[top + 1] : 0.0f;
+            break;
+        case ScriptOp::Less:
+            top--;
+            stack[top] = stack[top] < stack[top + 1] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::LessEqual:
+            top--;
+            stack[top] = stack[top] <= stack[top + 1] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::Greater:
+            top--;
+            stack[top] = stack[top] > stack[top + 1] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::GreaterEqual:
+            top--;
+            stack[top] = stack[top] >= stack[top + 1] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::Equal:
+            top--;
+            stack[top] = stack[top] == stack[top + 1] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::NotEqual:
+            top--;
+            stack[top] = stack[top] != stack[top + 1] ? 1.0f : 0.0f;
+            break;
+        case ScriptOp::JumpIfFalse:
+            if (stack[top] == 0.0f) {
+                pc = instruction.a - 1;
+            } else {
+                top--;
+            }
+            break;
+        case ScriptOp::JumpIfTrue:
+            if (stack[top] != 0.0f) {
+                stack[top] = 1.0f;
+                pc = instruction.a - 1;
+            } else {
+                top--;
+            }
+            break;
+        }
+    }
+
+    return top >= 0 ? stack[top] : 1.0f;
+}
+
+std::vector<StateRead> ScriptProgram::reads() const
+{
+    std::vector<StateRead> result;
+    for (const ScriptInstruction& instruction : code) {
+        switch (instruction.op) {
+        case ScriptOp::LoadStat:
+            result.push_back({ StateField::Stat, STAT_NAMES[instruction.a] });
+            break;
+        case ScriptOp::LoadSkill:
+            result.push_back({ StateField::Skill, names[instruction.a] });
+            break;
+        case ScriptOp::LoadReputation:
+            result.push_back({ StateField::Reputation, names[instruction.a] });
+            break;
+        case ScriptOp::LoadItem:
+            result.push_back({ StateField::Item, names[instruction.a] });
+            break;
+        case ScriptOp::LoadVariable:
+            result.push_back({ StateField::Variable, ScriptState::nameOf(instruction.a) });
+            break;
+        case ScriptOp::LoadDay:
+            result.push_back({ StateField::Day, "" });
+            break;
+        case ScriptOp::HasFlag:
+            result.push_back({ StateField::Flag, names[instruction.a] });
+            break;
+        case ScriptOp::HasFact:
+            result.push_back({ StateField::Fact, names[instruction.a] });
+            break;
+        case ScriptOp::HasAbility:
+            result.push_back({ StateField::Ability, names[instruction.a] });
+            break;
+        case ScriptOp::HasQuest:
+        case ScriptOp::QuestIs:
+            result.push_back({ StateField::Quest, names[instruction.a] });
+            break;
+        case ScriptOp::SeasonIs:
+            result.push_back({ StateField::Season, "" });
+            break;
+        case ScriptOp::LocationIs:
+            result.push_back({ StateField::Location, names[instruction.a] });
+            break;
+        case ScriptOp::FactionStateIs:
+            result.push_back({ StateField::FactionState, names[instruction.a] });
+            break;
+        default:
+            break;
+        }
+    }
+    return result;
+}
+
+bool compileScriptCondition(const std::string& source, ScriptProgram& program, std::string& error)
+{
+    program = ScriptProgram();
+    ScriptParser parser(source, program);
+    bool ok = parser.parseCondition();
+    error = parser.error;
+    return ok;
+}
+
+bool compileScriptEffect(const std::string& source, ScriptProgram& program, std::string& error)
+{
+    program = ScriptProgram();
+    ScriptParser parser(source, program);
+    bool ok = parser.parseEffects();
+    error = parser.error;
+    return ok;
+}
+
+GameCondition::GameCondition()
+    : cacheSlot(-1)
+    , failed(false)
+    , engine(nullptr)
+    , trigger(TriggerEngine::NO_TRIGGER)
+{
+}
+
+GameCondition GameCondition::compile(const std::string& source)
+{
+    GameCondition condition;
+    condition.source = source;
+
+    auto program = std::make_shared<ScriptProgram>();
+    std::string error;
+    if (!compileScriptCondition(source, *program, error)) {
+        std::cerr << "Condition \"" << source << "\" failed to compile: " << error << std::endl;
+        condition.failed = true;
+        return condition;
+    }
+
+    // Reads nothing but time and published variables: cache the result per tick
+    if (program->dependencies != SCRIPT_DEPENDS_NONE && (program->dependencies & ~SCRIPT_DEPENDS_SLOW) == 0) {
+        condition.cacheSlot = nextCacheSlot++;
+    }
+    condition.program = std::move(program);
+    return condition;
+}
+
+GameCondition GameCondition::fromJson(const nlohmann::json& j)
+{
+    std::string source = legacyConditionSource(j);
+    return source.empty() ? GameCondition() : compile(source);
+}
+
+bool GameCondition::operator()(const GameContext& context) const
+{
+    if (trigger != TriggerEngine::NO_TRIGGER && context.triggers == engine) {
+        return engine->evaluate(trigger, context);
+    }
+    return check(context);
+}
+
+bool GameCondition::check(const GameContext& context) const
+{
+    if (failed) {
+        return false;
+    }
+    if (!program) {
+        return native ? native(context) : true;
+    }
+
+    if (cacheSlot < 0) {
+        return program->run(context, 0, static_cast<int>(program->code.size())) != 0.0f;
+    }
+
+    // Stamp covers every slow input: published variables and the day (which sets the season)
+    uint64_t stamp = static_cast<uint64_t>(context.script.getGeneration()) << 32 | static_cast<uint32_t>(context.worldState.daysPassed);
+    bool result = false;
+    if (!context.script.lookupCached(cacheSlot, stamp, result)) {
+        result = program->run(context, 0, static_cast<int>(program->code.size())) != 0.0f;
+        context.script.storeCached(cacheSlot, stamp, result);
+    }
+    return result;
+}
+
+void GameCondition::watch(TriggerEngine& triggerEngine, const std::vector<StateRead>& reads, TriggerCallback onChange)
+{
+    if (failed || trigger != TriggerEngine::NO_TRIGGER) {
+        return;
+    }
+
+    // The engine keeps an unwatched copy to run the actual check
+    GameCondition unwatched = *this;
+    TriggerCheck checkNow = [unwatched](const GameContext& context) { return unwatched.check(context); };
+
+    if (program) {
+        trigger = triggerEngine.add(checkNow, program->reads(), onChange);
+    } else if (!reads.empty()) {
+        trigger = triggerEngine.add(checkNow, reads, onChange);
+    } else {
+        trigger = triggerEngine.addPolled(checkNow, onChange);
+    }
+    engine = &triggerEngine;
+}
+
+bool GameCondition::isCompiled() const
+{
+    return program != nullptr;
+}
+
+bool GameCondition::isCached() const
+{
+    return cacheSlot >= 0;
+}
+
+bool GameCondition::isWatched() const
+{
+    return trigger != TriggerEngine::NO_TRIGGER;
+}
+
+const std::string& GameCondition::getSource() const
+{
+    return source;
+}
+
+ScriptDependencyMask GameCondition::getDependencies() const
+{
+    return program ? program->dependencies : SCRIPT_DEPENDS_NONE;
+}
+
+nlohmann::json GameCondition::toJson() const
+{
+    return source.empty() && !program ? nlohmann::json() : nlohmann::json(source);
+}
+
+GameEffect::GameEffect()
+{
+}
+
+GameEffect GameEffect::compile(const std::string& source)
+{
+    GameEffect effect;
+    effect.source = source;
+
+    auto program = std::make_shared<ScriptProgram>();
+    std::string error;
+    if (!compileScriptEffect(source, *program, error)) {
+        std::cerr << "Effect \"" << source << "\" failed to compile: " << error << std::endl;
+        return effect;
+    }
+    effect.program = std::move(program);
+    return effect;
+}
+
+GameEffect GameEffect::fromJson(const nlohmann::json& j)
+{
+    std::string source = legacyEffectSource(j);
+    return source.empty() ? GameEffect() : compile(source);
+}
+
+void GameEffect::operator()(GameContext* context) const
+{
+    if (!context) {
+        return;
+    }
+    if (!program) {
+        if (native) {
+            native(context);
+        }
+        return;
+    }
+
+    const ScriptProgram& code = *program;
+    for (const ScriptStatement& statement : code.statements) {
+        float value = statement.codeBegin < statement.codeEnd ? code.run(*context, statement.codeBegin, statement.codeEnd) : 0.0f;
+        int amount = static_cast<int>(std::lround(value));
+
+        switch (statement.op) {
+        case ScriptEffectOp::SetFlag:
+            context->worldState.setWorldFlag(code.names[statement.target], value != 0.0f);
+            break;
+        case ScriptEffectOp::SetFact:
+            if (value != 0.0f) {
+                context->playerStats.learnFact(code.names[statement.target]);
+            } else {
+                context->playerStats.forgetFact(code.names[statement.target]);
+            }
+            break;
+        case ScriptEffectOp::SetAbility:
+            if (value != 0.0f) {
+                context->playerStats.unlockAbility(code.names[statement.target]);
+            } else {
+                context->playerStats.lockAbility(code.names[statement.target]);
+            }
+            break;
+        case ScriptEffectOp::AddReputation:
+            context->playerStats.changeFactionRep(code.names[statement.target], amount);
+            break;
+        case ScriptEffectOp::SetReputation:
+            context->playerStats.setFactionRep(code.names[statement.target], amount);
+            break;
+        case ScriptEffectOp::AddSkill:
+            context->playerStats.improveSkill(code.names[statement.target], amount);
+            break;
+        case ScriptEffectOp::SetSkill:
+            context->playerStats.setSkill(code.names[statement.target], amount);
+            break;
+        case ScriptEffectOp::AddItem:
+            if (amount > 0) {
+                const std::string& itemId = code.names[statement.target];
+                ItemIndex index = ItemCatalog::getInstance().findIndex(itemId);
+                if (index != INVALID_ITEM_INDEX) {
+                    context->playerInventory.addItem(Item(index, ItemCatalog::getInstance().get(index).baseValue, amount));
+                } else {
+                    context->playerInventory.addItem(Item(itemId, itemId, "event_reward", 1, amount));
+                }
+            }
+            break;
+        case ScriptEffectOp::RemoveItem:
+            if (amount > 0) {
+                context->playerInventory.removeItem(code.names[statement.target], amount);
+            }
+            break;
+        case ScriptEffectOp::AddStat:
+            context->playerStats.changeStat(STAT_NAMES[statement.target], amount);
+            break;
+        case ScriptEffectOp::SetStat:
+            context->playerStats.setStat(STAT_NAMES[statement.target], amount);
+            break;
+        case ScriptEffectOp::SetVariable:
+            context->script.set(statement.target, value);
+            break;
+        case ScriptEffectOp::SetQuest:
+            context->setQuestState(code.names[statement.target], code.names[statement.text]);
+            break;
+        case ScriptEffectOp::SetLocation:
+            context->worldState.setLocationState(code.names[statement.target], code.names[statement.text]);
+            break;
+        case ScriptEffectOp::SetFactionState:
+            context->worldState.setFactionState(code.names[statement.target], code.names[statement.text]);
+            break;
+        }
+    }
+}
+
+bool GameEffect::isCompiled() const
+{
+    return program != nullptr;
+}
+
+const std::string& GameEffect::getSource() const
+{
+    return source;
+}
+
+nlohmann::json GameEffect::toJson() const
+{
+    return source.empty() ? nlohmann::json() : nlohmann::json(source);
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "GameContext.hpp"
+#include "ScriptState.hpp"
+#include "TriggerEngine.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct GameContext;
+
+enum class ScriptOp : uint8_t {
+    Push, // value
+    LoadStat, // a = stat
+    LoadSkill, // a = name
+    LoadReputation, // a = name
+    LoadItem, // a = name, b = item index or -1 to resolve by name
+    LoadVariable, // a = variable slot
+    LoadDay,
+    HasFlag, // a = name
+    HasFact,
+    HasAbility,
+    HasQuest,
+    SeasonIs, // b = text
+    QuestIs, // a = name, b = text
+    LocationIs,
+    FactionStateIs,
+    Not,
+    Negate,
+    Truthy, // Collapse the top value to 0 or 1
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    JumpIfFalse, // a = target; if the top is false keep 0 and jump, else pop
+    JumpIfTrue // a = target; if the top is true keep 1 and jump, else pop
+};
+
+struct ScriptInstruction {
+    ScriptOp op;
+    int32_t a;
+    int32_t b;
+    float value;
+};
+
+enum class ScriptEffectOp : uint8_t {
+    SetFlag,
+    SetFact,
+    SetAbility,
+    AddReputation,
+    SetReputation,
+    AddSkill,
+    SetSkill,
+    AddItem,
+    RemoveItem,
+    AddStat,
+    SetStat,
+    SetVariable,
+    SetQuest, // Text assignments take a string literal
+    SetLocation,
+    SetFactionState
+};
+
+// One effect statement; its value is code[codeBegin, codeEnd)
+struct ScriptStatement {
+    ScriptEffectOp op;
+    int32_t target; // Name index, stat or variable slot
+    int32_t text; // Name index of the assigned text, -1 if numeric
+    int32_t codeBegin;
+    int32_t codeEnd;
+};
+
+// Flat bytecode for a stack machine. Names are interned once per program and
+// variables resolved to slots at compile time, so running it never allocates.
+struct ScriptProgram {
+    static const int MAX_STACK = 32;
+
+    std::vector<ScriptInstruction> code;
+    std::vector<ScriptStatement> statements; // Effects only
+    std::vector<std::string> names;
+    ScriptDependencyMask dependencies = SCRIPT_DEPENDS_NONE;
+
+    float run(const GameContext& context, int begin, int end) const;
+
+    // Every piece of state the code reads, for trigger registration
+    std::vector<StateRead> reads() const;
+};
+
+// Compile expression text, e.g.
+//   "skill.persuasion >= 3 && rep.merchants_guild > 20 && !flag.bridge_destroyed"
+//   "season == 'winter' || weather.stormy"
+// Returns false and fills error on a syntax error.
+bool compileScriptCondition(const std::string& source, ScriptProgram& program, std::string& error);
+
+// Compile effect statements separated by ';', e.g.
+//   "quest.find_sword = 'Active'; rep.merchants_guild += 5; item.iron_ore -= 2"
+bool compileScriptEffect(const std::string& source, ScriptProgram& program, std::string& error);
+
+// Condition over the game context: either compiled script or a native callable.
+// Compiled conditions can be loaded from JSON, saved by source text and inspected;
+// those reading only time and published variables are cached per tick.
+class GameCondition {
+public:
+    // Always true
+    GameCondition();
+
+    template <typename Fn,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<Fn>, GameCondition> && std::is_invocable_r_v<bool, Fn&, const GameContext&>>>
+    GameCondition(Fn fn)
+        : native(std::move(fn))
+        , cacheSlot(-1)
+        , failed(false)
+        , engine(nullptr)
+        , trigger(TriggerEngine::NO_TRIGGER)
+    {
+    }
+
+    // Compile expression text; a condition that fails to compile is always false
+    static GameCondition compile(const std::string& source);
+
+    // Accepts expression text, or the older requirement objects/arrays
+    // ({"type": "skill", "skill": ..., "level": ...}, "item", "worldflag", "faction", "knowledge")
+    static GameCondition fromJson(const nlohmann::json& j);
+
+    bool operator()(const GameContext& context) const;
+
+    // Register with a trigger engine; calls with a context attached to that
+    // engine then return its result, re-checked only when a read changed.
+    // Compiled conditions know their reads; native ones take them here and are
+    // polled on every update if none are given. Copies share the registration.
+    void watch(TriggerEngine& engine, const std::vector<StateRead>& reads = {}, TriggerCallback onChange = nullptr);
+
+    bool isCompiled() const;
+    bool isCached() const;
+    bool isWatched() const;
+    const std::string& getSource() const;
+    ScriptDependencyMask getDependencies() const;
+
+    // Source text for compiled conditions, null for native ones
+    nlohmann::json toJson() const;
+
+private:
+    std::shared_ptr<const ScriptProgram> program;
+    std::function<bool(const GameContext&)> native;
+    std::string source;
+    int cacheSlot;
+    bool failed;
+    TriggerEngine* engine;
+    TriggerId trigger;
+
+    bool check(const GameContext& context) const;
+};
+
+// Effect on the game context: compiled statements or a native callable
+class GameEffect {
+public:
+    // Does nothing
+    GameEffect();
+
+    template <typename Fn,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<Fn>, GameEffect> && std::is_invocable_v<Fn&, GameContext*>>>
+    GameEffect(Fn fn)
+        : native(std::move(fn))
+    {
+    }
+
+    static GameEffect compile(const std::string& source);
+
+    // Accepts statement text, or the older effect objects/arrays
+    // ({"type": "quest", "action": "activate", "target": ...}, "knowledge", "faction", "location", "item")
+    static GameEffect fromJson(const nlohmann::json& j);
+
+    void operator()(GameContext* context) const;
+
+    bool isCompiled() const;
+    const std::string& getSource() const;
+    nlohmann::json toJson() const;
+
+private:
+    std::shared_ptr<const ScriptProgram> program;
+    std::function<void(GameContext*)> native;
+    std::string source;
+};
@@ -1,9 +1,14 @@
 #include "Inventory.hpp"
 
 bool Inventory::hasItem(const std::string& itemId, int quantity) const
+{
+    return hasItem(ItemCatalog::getInstance().findIndex(itemId), quantity);
+}
+
+bool Inventory::hasItem(ItemIndex itemIndex, int quantity) const
 {
     for (const auto& item : items) {
-        if (item.id == itemId && item.quantity >= quantity) {
+        if (item.catalogIndex == itemIndex && item.quantity >= quantity) {
             return true;
         }
     }
@@ -14,26 +19,35 @@ bool Inventory::addItem(const Item& item)
 {
     // Check if item already exists
     for (auto& existingItem : items) {
-        if (existingItem.id == item.id) {
+        if (existingItem.catalogIndex == item.catalogIndex) {
             existingItem.quantity += item.quantity;
+            notify(item.catalogIndex);
             return true;
         }
     }
 
     // Add new item
     items.push_back(item);
+    notify(item.catalogIndex);
     return true;
 }
 
 bool Inventory::removeItem(const std::string& itemId, int quantity)
+{
+    return removeItem(ItemCatalog::getInstance().findIndex(itemId), quantity);
+}
+
+bool Inventory::removeItem(ItemIndex itemIndex, int quantity)
 {
     for (auto it = items.begin(); it != items.end(); ++it) {
-        if (it->id == itemId) {
+        if (it->catalogIndex == itemIndex) {
             if (it->quantity > quantity) {
                 it->quantity -= quantity;
+                notify(itemIndex);
                 return true;
             } else if (it->quantity == quantity) {
                 items.erase(it);
+                notify(itemIndex);
                 return true;
             } else {
                 return false; // Not enough quantity
@@ -41,4 +55,21 @@ bool Inventory::removeItem(const std::string& itemId, int quantity)
         }
     }
     return false; // Item not found
-}
\ No newline at end of file
+}
+
+int Inventory::getQuantity(ItemIndex itemIndex) const
+{
+    for (const auto& item : items) {
+        if (item.catalogIndex == itemIndex) {
+            return item.quantity;
+        }
+    }
+    return 0;
+}
+
+void Inventory::notify(ItemIndex itemIndex) const
+{
+    if (listener && itemIndex != INVALID_ITEM_INDEX) {
+        listener->stateChanged(StateField::Item, ItemCatalog::getInstance().get(itemIndex).id);
+    }
+}
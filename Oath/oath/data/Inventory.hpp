@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Item.hpp"
+#include "StateListener.hpp"
 
 #include <string>
 #include <vector>
@@ -10,7 +11,16 @@ class Inventory {
 public:
     std::vector<Item> items;
 
+    // Told about quantity changes made through addItem/removeItem
+    StateListener* listener = nullptr;
+
     bool hasItem(const std::string& itemId, int quantity = 1) const;
+    bool hasItem(ItemIndex itemIndex, int quantity = 1) const;
     bool addItem(const Item& item);
     bool removeItem(const std::string& itemId, int quantity = 1);
-};
\ No newline at end of file
+    bool removeItem(ItemIndex itemIndex, int quantity = 1);
+    int getQuantity(ItemIndex itemIndex) const;
+
+private:
+    void notify(ItemIndex itemIndex) const;
+};
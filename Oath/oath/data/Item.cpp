@@ -2,10 +2,99 @@
 
 Item::Item(const std::string& itemId, const std::string& itemName,
     const std::string& itemType, int itemValue, int itemQty)
-    : id(itemId)
-    , name(itemName)
-    , type(itemType)
+    : catalogIndex(ItemCatalog::getInstance().intern(itemId, itemName, itemType, itemValue))
     , value(itemValue)
     , quantity(itemQty)
 {
-}
\ No newline at end of file
+}
+
+Item::Item(ItemIndex index, int itemValue, int itemQty)
+    : catalogIndex(index)
+    , value(itemValue)
+    , quantity(itemQty)
+{
+}
+
+Item::Item(const Item& other)
+    : catalogIndex(other.catalogIndex)
+    , value(other.value)
+    , quantity(other.quantity)
+    , overrides(other.overrides ? std::make_unique<ItemProperties>(*other.overrides) : nullptr)
+{
+}
+
+Item& Item::operator=(const Item& other)
+{
+    if (this != &other) {
+        catalogIndex = other.catalogIndex;
+        value = other.value;
+        quantity = other.quantity;
+        overrides = other.overrides ? std::make_unique<ItemProperties>(*other.overrides) : nullptr;
+    }
+    return *this;
+}
+
+const ItemDefinition& Item::definition() const
+{
+    return ItemCatalog::getInstance().get(catalogIndex);
+}
+
+const std::string& Item::id() const
+{
+    return definition().id;
+}
+
+const std::string& Item::name() const
+{
+    return definition().name;
+}
+
+const std::string& Item::type() const
+{
+    return definition().type;
+}
+
+ItemCategory Item::category() const
+{
+    return definition().category;
+}
+
+const ItemPropertyValue* Item::getProperty(const std::string& key) const
+{
+    if (overrides) {
+        auto it = overrides->find(key);
+        if (it != overrides->end()) {
+            return &it->second;
+        }
+    }
+
+    const auto& shared = definition().properties;
+    auto it = shared.find(key);
+    return it != shared.end() ? &it->second : nullptr;
+}
+
+void Item::setProperty(const std::string& key, const ItemPropertyValue& propertyValue)
+{
+    // Values identical to the shared block don't need an instance copy
+    if (!overrides) {
+        const auto& shared = definition().properties;
+        auto it = shared.find(key);
+        if (it != shared.end() && it->second == propertyValue) {
+            return;
+        }
+        overrides = std::make_unique<ItemProperties>();
+    }
+
+    (*overrides)[key] = propertyValue;
+}
+
+ItemProperties Item::getProperties() const
+{
+    ItemProperties merged = definition().properties;
+    if (overrides) {
+        for (const auto& [key, propertyValue] : *overrides) {
+            merged[key] = propertyValue;
+        }
+    }
+    return merged;
+}
@@ -1,18 +1,37 @@
 #pragma once
 
-#include <map>
+#include "ItemCatalog.hpp"
+
+#include <memory>
 #include <string>
-#include <variant>
 
-// Item system for crafting
+// Item stack: a catalog index plus per-stack state. Names, types and the shared
+// property block live in the ItemCatalog; only instance overrides are stored here.
 struct Item {
-    std::string id;
-    std::string name;
-    std::string type;
+    ItemIndex catalogIndex;
     int value;
     int quantity;
-    std::map<std::string, std::variant<int, float, std::string, bool>> properties;
+    std::unique_ptr<ItemProperties> overrides; // Instance-specific properties (enchantments, crafted stats)
 
     Item(const std::string& itemId, const std::string& itemName,
         const std::string& itemType, int itemValue = 1, int itemQty = 1);
-};
\ No newline at end of file
+    Item(ItemIndex index, int itemValue, int itemQty = 1);
+
+    Item(const Item& other);
+    Item& operator=(const Item& other);
+    Item(Item&& other) noexcept = default;
+    Item& operator=(Item&& other) noexcept = default;
+
+    const ItemDefinition& definition() const;
+    const std::string& id() const;
+    const std::string& name() const;
+    const std::string& type() const;
+    ItemCategory category() const;
+
+    // Look up a property, preferring instance overrides over the shared block
+    const ItemPropertyValue* getProperty(const std::string& key) const;
+    void setProperty(const std::string& key, const ItemPropertyValue& propertyValue);
+
+    // Merged view of shared and instance properties
+    ItemProperties getProperties() const;
+};
@@ -0,0 +1,77 @@
+#include "ItemCatalog.hpp"
+#include <iostream>
+
+ItemCategory stringToItemCategory(const std::string& typeStr)
+{
+    static const std::unordered_map<std::string, ItemCategory> categories = {
+        { "weapon", ITEM_CATEGORY_WEAPON },
+        { "armor", ITEM_CATEGORY_ARMOR },
+        { "metal", ITEM_CATEGORY_METAL },
+        { "potion", ITEM_CATEGORY_POTION },
+        { "herb", ITEM_CATEGORY_HERB },
+        { "ingredient", ITEM_CATEGORY_INGREDIENT },
+        { "clothing", ITEM_CATEGORY_CLOTHING },
+        { "fabric", ITEM_CATEGORY_FABRIC },
+        { "jewelry", ITEM_CATEGORY_JEWELRY },
+        { "gem", ITEM_CATEGORY_GEM },
+        { "book", ITEM_CATEGORY_BOOK },
+        { "scroll", ITEM_CATEGORY_SCROLL },
+        { "magic", ITEM_CATEGORY_MAGIC },
+        { "soul_gem", ITEM_CATEGORY_SOUL_GEM },
+        { "staff", ITEM_CATEGORY_STAFF },
+        { "food", ITEM_CATEGORY_FOOD },
+        { "drink", ITEM_CATEGORY_DRINK },
+        { "material", ITEM_CATEGORY_MATERIAL },
+        { "tool", ITEM_CATEGORY_TOOL },
+        { "container", ITEM_CATEGORY_CONTAINER }
+    };
+
+    auto it = categories.find(typeStr);
+    return it != categories.end() ? it->second : ITEM_CATEGORY_MISC;
+}
+
+ItemCatalog::ItemCatalog()
+{
+}
+
+ItemCatalog& ItemCatalog::getInstance()
+{
+    static ItemCatalog instance;
+    return instance;
+}
+
+ItemIndex ItemCatalog::intern(const std::string& itemId, const std::string& itemName,
+    const std::string& itemType, int baseValue, const ItemProperties& properties)
+{
+    auto it = indexById.find(itemId);
+    if (it != indexById.end()) {
+        // Stack values vary by market, but the name and type are the definition
+        const ItemDefinition& existing = definitions[it->second];
+        if (existing.name != itemName || existing.type != itemType) {
+            std::cerr << "Error: item \"" << itemId << "\" redefined as \"" << itemName << "\" (" << itemType
+                      << "), keeping \"" << existing.name << "\" (" << existing.type << ")" << std::endl;
+        }
+        return it->second;
+    }
+
+    ItemIndex index = static_cast<ItemIndex>(definitions.size());
+    definitions.push_back({ itemId, itemName, itemType, stringToItemCategory(itemType), baseValue, properties });
+    indexById[itemId] = index;
+    return index;
+}
+
+ItemIndex ItemCatalog::findIndex(const std::string& itemId) const
+{
+    auto it = indexById.find(itemId);
+    return it != indexById.end() ? it->second : INVALID_ITEM_INDEX;
+}
+
+const ItemDefinition& ItemCatalog::get(ItemIndex index) const
+{
+    return definitions[index];
+}
+
+size_t ItemCatalog::size() const
+{
+    return definitions.size();
+}
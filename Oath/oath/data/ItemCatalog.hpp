@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+// Property block shared by every stack of the same item
+using ItemPropertyValue = std::variant<int, float, std::string, bool>;
+using ItemProperties = std::map<std::string, ItemPropertyValue>;
+
+// Dense index into the item catalog
+using ItemIndex = uint32_t;
+constexpr ItemIndex INVALID_ITEM_INDEX = 0xFFFFFFFFu;
+
+// Item type categories as bit flags so specialization checks are a single AND
+using ItemCategoryMask = uint32_t;
+
+enum ItemCategory : ItemCategoryMask {
+    ITEM_CATEGORY_NONE = 0,
+    ITEM_CATEGORY_WEAPON = 1u << 0,
+    ITEM_CATEGORY_ARMOR = 1u << 1,
+    ITEM_CATEGORY_METAL = 1u << 2,
+    ITEM_CATEGORY_POTION = 1u << 3,
+    ITEM_CATEGORY_HERB = 1u << 4,
+    ITEM_CATEGORY_INGREDIENT = 1u << 5,
+    ITEM_CATEGORY_CLOTHING = 1u << 6,
+    ITEM_CATEGORY_FABRIC = 1u << 7,
+    ITEM_CATEGORY_JEWELRY = 1u << 8,
+    ITEM_CATEGORY_GEM = 1u << 9,
+    ITEM_CATEGORY_BOOK = 1u << 10,
+    ITEM_CATEGORY_SCROLL = 1u << 11,
+    ITEM_CATEGORY_MAGIC = 1u << 12,
+    ITEM_CATEGORY_SOUL_GEM = 1u << 13,
+    ITEM_CATEGORY_STAFF = 1u << 14,
+    ITEM_CATEGORY_FOOD = 1u << 15,
+    ITEM_CATEGORY_DRINK = 1u << 16,
+    ITEM_CATEGORY_MATERIAL = 1u << 17,
+    ITEM_CATEGORY_TOOL = 1u << 18,
+    ITEM_CATEGORY_CONTAINER = 1u << 19,
+    ITEM_CATEGORY_MISC = 1u << 31,
+
+    ITEM_CATEGORY_ALL = 0xFFFFFFFFu
+};
+
+// Convert an item type string ("weapon", "herb", ...) to its category bit
+ItemCategory stringToItemCategory(const std::string& typeStr);
+
+// Immutable definition of an item, owned by the catalog
+struct ItemDefinition {
+    std::string id;
+    std::string name;
+    std::string type;
+    ItemCategory category;
+    int baseValue;
+    ItemProperties properties;
+};
+
+// Global item database. Definitions are append-only: once an id is interned its
+// index and definition never change, so stacks can hold the index instead of strings.
+class ItemCatalog {
+private:
+    // Deque keeps references to definitions stable while the catalog grows
+    std::deque<ItemDefinition> definitions;
+    std::unordered_map<std::string, ItemIndex> indexById;
+
+    ItemCatalog();
+
+public:
+    ItemCatalog(const ItemCatalog&) = delete;
+    ItemCatalog& operator=(const ItemCatalog&) = delete;
+
+    // Singleton access
+    static ItemCatalog& getInstance();
+
+    // Return the index for an id, registering a new definition if it is unknown.
+    // An id already registered under another name or type keeps its first
+    // definition and the conflict is logged.
+    ItemIndex intern(const std::string& itemId, const std::string& itemName,
+        const std::string& itemType, int baseValue = 1,
+        const ItemProperties& properties = {});
+
+    // Find an already registered item, or INVALID_ITEM_INDEX
+    ItemIndex findIndex(const std::string& itemId) const;
+
+    const ItemDefinition& get(ItemIndex index) const;
+    size_t size() const;
+};
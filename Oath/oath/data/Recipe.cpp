@@ -42,9 +42,7 @@ bool Recipe::craft(GameContext* context)
     }
 
     // Create result item
-    Item craftedItem(result.itemId, result.name, result.type, 1,
-        result.quantity);
-    craftedItem.properties = result.properties;
+    Item craftedItem(result.itemIndex, 1, result.quantity);
 
     // Add to inventory
     context->playerInventory.addItem(craftedItem);
@@ -52,7 +50,7 @@ bool Recipe::craft(GameContext* context)
     // Mark as discovered
     discovered = true;
 
-    std::cout << "Crafted " << result.quantity << "x " << result.name
+    std::cout << "Crafted " << result.quantity << "x " << craftedItem.name()
               << std::endl;
     return true;
 }
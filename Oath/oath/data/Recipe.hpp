@@ -26,13 +26,10 @@ public:
     };
     std::vector<Ingredient> ingredients;
 
-    // Result of crafting
+    // Result of crafting; name, type and properties live in the item catalog
     struct Result {
-        std::string itemId;
-        std::string name;
-        std::string type;
-        int quantity;
-        std::map<std::string, std::variant<int, float, std::string, bool>> properties;
+        ItemIndex itemIndex = INVALID_ITEM_INDEX;
+        int quantity = 1;
     };
     Result result;
 
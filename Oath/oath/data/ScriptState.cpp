@@ -0,0 +1,98 @@
+#include "ScriptState.hpp"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+const uint64_t NO_STAMP = ~0ull;
+
+struct SlotRegistry {
+    std::mutex mutex;
+    std::unordered_map<std::string, int> slots;
+    std::deque<std::string> names; // Deque keeps nameOf references stable
+};
+
+SlotRegistry& registry()
+{
+    static SlotRegistry instance;
+    return instance;
+}
+}
+
+int ScriptState::slotOf(const std::string& name)
+{
+    SlotRegistry& slots = registry();
+    std::lock_guard<std::mutex> lock(slots.mutex);
+
+    auto it = slots.slots.find(name);
+    if (it != slots.slots.end()) {
+        return it->second;
+    }
+
+    int slot = static_cast<int>(slots.names.size());
+    slots.names.push_back(name);
+    slots.slots[name] = slot;
+    return slot;
+}
+
+const std::string& ScriptState::nameOf(int slot)
+{
+    SlotRegistry& slots = registry();
+    std::lock_guard<std::mutex> lock(slots.mutex);
+    return slots.names[slot];
+}
+
+float ScriptState::get(int slot) const
+{
+    return slot >= 0 && slot < static_cast<int>(values.size()) ? values[slot] : 0.0f;
+}
+
+void ScriptState::set(int slot, float value)
+{
+    if (slot < 0) {
+        return;
+    }
+    if (slot >= static_cast<int>(values.size())) {
+        values.resize(slot + 1, 0.0f);
+    }
+    if (values[slot] != value) {
+        values[slot] = value;
+        generation++;
+        if (listener) {
+            listener->stateChanged(StateField::Variable, nameOf(slot));
+        }
+    }
+}
+
+void ScriptState::set(const std::string& name, float value)
+{
+    set(slotOf(name), value);
+}
+
+uint32_t ScriptState::getGeneration() const
+{
+    return generation;
+}
+
+bool ScriptState::lookupCached(int cacheSlot, uint64_t stamp, bool& result) const
+{
+    if (cacheSlot < 0 || cacheSlot >= static_cast<int>(cacheStamps.size()) || cacheStamps[cacheSlot] != stamp) {
+        return false;
+    }
+    result = cacheResults[cacheSlot] != 0;
+    return true;
+}
+
+void ScriptState::storeCached(int cacheSlot, uint64_t stamp, bool result) const
+{
+    if (cacheSlot < 0) {
+        return;
+    }
+    if (cacheSlot >= static_cast<int>(cacheStamps.size())) {
+        cacheStamps.resize(cacheSlot + 1, NO_STAMP);
+        cacheResults.resize(cacheSlot + 1, 0);
+    }
+    cacheStamps[cacheSlot] = stamp;
+    cacheResults[cacheSlot] = result ? 1 : 0;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "StateListener.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Which parts of the game state a script reads, as bit flags
+using ScriptDependencyMask = uint32_t;
+
+enum ScriptDependency : ScriptDependencyMask {
+    SCRIPT_DEPENDS_NONE = 0,
+    SCRIPT_DEPENDS_STATS = 1u << 0,
+    SCRIPT_DEPENDS_SKILLS = 1u << 1,
+    SCRIPT_DEPENDS_REPUTATION = 1u << 2,
+    SCRIPT_DEPENDS_ITEMS = 1u << 3,
+    SCRIPT_DEPENDS_FLAGS = 1u << 4, // World flags, known facts and abilities
+    SCRIPT_DEPENDS_STATES = 1u << 5, // Quest, location and faction state strings
+    SCRIPT_DEPENDS_TIME = 1u << 6, // Day and season
+    SCRIPT_DEPENDS_VARIABLES = 1u << 7, // Values published by systems, e.g. weather
+
+    // Only change when time passes or a system publishes; safe to cache per tick
+    SCRIPT_DEPENDS_SLOW = SCRIPT_DEPENDS_TIME | SCRIPT_DEPENDS_VARIABLES
+};
+
+// Numeric variables that systems publish for scripts ("weather.stormy",
+// "time.hour"), plus cached results of conditions that read only slow state.
+// Variable names map to slots shared by every context, so compiled scripts
+// hold the slot index instead of the name.
+class ScriptState {
+public:
+    // Slot for a variable name, registering it if new
+    static int slotOf(const std::string& name);
+    static const std::string& nameOf(int slot);
+
+    float get(int slot) const;
+    void set(int slot, float value);
+    void set(const std::string& name, float value);
+
+    // Bumped whenever a variable changes value
+    uint32_t getGeneration() const;
+
+    // Cached condition results, valid while the stamp (generation and day) matches
+    bool lookupCached(int cacheSlot, uint64_t stamp, bool& result) const;
+    void storeCached(int cacheSlot, uint64_t stamp, bool result) const;
+
+    // Told about variable changes
+    StateListener* listener = nullptr;
+
+private:
+    std::vector<float> values;
+    uint32_t generation = 0;
+
+    mutable std::vector<uint64_t> cacheStamps;
+    mutable std::vector<uint8_t> cacheResults;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Parts of the game state a condition can read, for change tracking
+enum class StateField : uint8_t {
+    Stat, // Name is the stat, e.g. "strength"
+    Skill,
+    Reputation,
+    Item,
+    Flag,
+    Fact,
+    Ability,
+    Quest,
+    Location,
+    FactionState,
+    Day, // No name
+    Season, // No name
+    Variable // Script variable name, e.g. "weather.stormy"
+};
+
+const int STATE_FIELD_COUNT = static_cast<int>(StateField::Variable) + 1;
+
+// Told about every change made through the state setters
+class StateListener {
+public:
+    virtual ~StateListener() = default;
+    virtual void stateChanged(StateField field, const std::string& name) = 0;
+};
@@ -0,0 +1,201 @@
+#include "TriggerEngine.hpp"
+
+#include <algorithm>
+
+TriggerId TriggerEngine::allocate(TriggerCheck check, TriggerCallback onChange, bool isPolled)
+{
+    TriggerId id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<TriggerId>(triggers.size());
+        triggers.emplace_back();
+    }
+
+    Trigger& trigger = triggers[id];
+    trigger.check = std::move(check);
+    trigger.onChange = std::move(onChange);
+    trigger.keys.clear();
+    trigger.live = true;
+    trigger.polled = isPolled;
+    trigger.dirty = false;
+    trigger.pending = false;
+    trigger.value = false;
+    trigger.reported = false;
+    liveCount++;
+
+    markDirty(id);
+    return id;
+}
+
+TriggerId TriggerEngine::add(TriggerCheck check, const std::vector<StateRead>& reads, TriggerCallback onChange)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    TriggerId id = allocate(std::move(check), std::move(onChange), false);
+    for (const StateRead& read : reads) {
+        auto& fieldKeys = keys[static_cast<int>(read.field)];
+        auto it = fieldKeys.find(read.name);
+        int key;
+        if (it != fieldKeys.end()) {
+            key = it->second;
+        } else {
+            key = static_cast<int>(dependents.size());
+            fieldKeys.emplace(read.name, key);
+            dependents.emplace_back();
+        }
+
+        // A condition may read the same thing twice
+        std::vector<int>& triggerKeys = triggers[id].keys;
+        if (std::find(triggerKeys.begin(), triggerKeys.end(), key) == triggerKeys.end()) {
+            triggerKeys.push_back(key);
+            dependents[key].push_back(id);
+        }
+    }
+    return id;
+}
+
+TriggerId TriggerEngine::addPolled(TriggerCheck check, TriggerCallback onChange)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    TriggerId id = allocate(std::move(check), std::move(onChange), true);
+    polled.push_back(id);
+    return id;
+}
+
+void TriggerEngine::remove(TriggerId id)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    if (id < 0 || id >= static_cast<TriggerId>(triggers.size()) || !triggers[id].live) {
+        return;
+    }
+
+    Trigger& trigger = triggers[id];
+    for (int key : trigger.keys) {
+        auto& readers = dependents[key];
+        readers.erase(std::remove(readers.begin(), readers.end(), id), readers.end());
+    }
+    if (trigger.polled) {
+        polled.erase(std::remove(polled.begin(), polled.end(), id), polled.end());
+    }
+    if (trigger.pending) {
+        pending.erase(std::remove(pending.begin(), pending.end(), id), pending.end());
+    }
+
+    trigger = Trigger();
+    trigger.live = false;
+    freeIds.push_back(id);
+    liveCount--;
+}
+
+bool TriggerEngine::evaluate(TriggerId id, const GameContext& context)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    if (id < 0 || id >= static_cast<TriggerId>(triggers.size()) || !triggers[id].live) {
+        return false;
+    }
+
+    // Clear the flag first: the check may evaluate other triggers
+    if (triggers[id].dirty) {
+        triggers[id].dirty = false;
+        TriggerCheck check = triggers[id].check;
+        bool value = check(context);
+        triggers[id].value = value;
+    }
+    return triggers[id].value;
+}
+
+int TriggerEngine::update(GameContext* context)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    if (!context) {
+        return 0;
+    }
+
+    for (TriggerId id : polled) {
+        markDirty(id);
+    }
+
+    int checks = 0;
+    std::vector<TriggerId> batch;
+    for (int round = 0; round < MAX_ROUNDS && !pending.empty(); round++) {
+        batch.swap(pending);
+        pending.clear();
+
+        for (TriggerId id : batch) {
+            // Callbacks may add triggers, so index instead of holding references
+            if (!triggers[id].live) {
+                continue;
+            }
+            triggers[id].pending = false;
+
+            if (triggers[id].dirty) {
+                evaluate(id, *context);
+                checks++;
+            }
+
+            bool value = triggers[id].value;
+            if (value != triggers[id].reported) {
+                triggers[id].reported = value;
+                if (triggers[id].onChange) {
+                    TriggerCallback onChange = triggers[id].onChange;
+                    onChange(context, value);
+                }
+            }
+        }
+    }
+    return checks;
+}
+
+void TriggerEngine::markAllDirty()
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    for (TriggerId id = 0; id < static_cast<TriggerId>(triggers.size()); id++) {
+        if (triggers[id].live) {
+            markDirty(id);
+        }
+    }
+}
+
+void TriggerEngine::markDirty(TriggerId id)
+{
+    Trigger& trigger = triggers[id];
+    trigger.dirty = true;
+    if (!trigger.pending) {
+        trigger.pending = true;
+        pending.push_back(id);
+    }
+}
+
+void TriggerEngine::stateChanged(StateField field, const std::string& name)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    const auto& fieldKeys = keys[static_cast<int>(field)];
+    auto it = fieldKeys.find(name);
+    if (it == fieldKeys.end()) {
+        return; // Nothing reads it
+    }
+
+    for (TriggerId id : dependents[it->second]) {
+        markDirty(id);
+    }
+}
+
+size_t TriggerEngine::size() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return liveCount;
+}
+
+size_t TriggerEngine::getPendingCount() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return pending.size();
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "StateListener.hpp"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct GameContext;
+
+// One piece of state a trigger reads, e.g. { StateField::Skill, "persuasion" }
+struct StateRead {
+    StateField field;
+    std::string name;
+};
+
+using TriggerId = int;
+using TriggerCheck = std::function<bool(const GameContext&)>;
+using TriggerCallback = std::function<void(GameContext*, bool)>;
+
+// Re-checks conditions only when something they read has changed. Each trigger
+// lists the state it reads; the setters on an attached context report changes,
+// which mark just the dependent triggers dirty. update() at the end of a tick
+// re-checks the dirty ones and reports those whose result flipped, so the cost
+// follows what changed rather than how many triggers exist.
+class TriggerEngine : public StateListener {
+public:
+    static const TriggerId NO_TRIGGER = -1;
+
+    // Checked on the next update; onChange also fires then if the result is true
+    TriggerId add(TriggerCheck check, const std::vector<StateRead>& reads, TriggerCallback onChange = nullptr);
+
+    // For checks whose reads are unknown: re-checked on every update
+    TriggerId addPolled(TriggerCheck check, TriggerCallback onChange = nullptr);
+
+    void remove(TriggerId id);
+
+    // Current result, re-checked now if anything it reads changed since the last check
+    bool evaluate(TriggerId id, const GameContext& context);
+
+    // Re-check dirty triggers and fire callbacks for results that changed.
+    // Changes made by callbacks are picked up in further rounds, up to a limit.
+    // Returns the number of checks run.
+    int update(GameContext* context);
+
+    // After bulk changes that bypassed the setters, e.g. loading a save
+    void markAllDirty();
+
+    void stateChanged(StateField field, const std::string& name) override;
+
+    size_t size() const;
+    size_t getPendingCount() const;
+
+private:
+    static const int MAX_ROUNDS = 8;
+
+    struct Trigger {
+        TriggerCheck check;
+        TriggerCallback onChange;
+        std::vector<int> keys;
+        bool live;
+        bool polled;
+        bool dirty; // Result is stale
+        bool pending; // Queued for the next update
+        bool value;
+        bool reported; // Result the callback last saw
+    };
+
+    std::vector<Trigger> triggers;
+    std::vector<TriggerId> freeIds;
+    size_t liveCount = 0;
+
+    // Key per (field, name), and the triggers that read it
+    std::unordered_map<std::string, int> keys[STATE_FIELD_COUNT];
+    std::vector<std::vector<TriggerId>> dependents;
+
+    std::vector<TriggerId> pending;
+    std::vector<TriggerId> polled;
+
+    // Concurrent time subscribers can report changes at the same time
+    mutable std::recursive_mutex mutex;
+
+    TriggerId allocate(TriggerCheck check, TriggerCallback onChange, bool isPolled);
+    void markDirty(TriggerId id);
+};
@@ -0,0 +1,199 @@
+#include "VitalsTable.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if (defined(__SSE2__) || defined(_M_X64)) && !defined(OATH_VITALS_NO_SIMD)
+#include <emmintrin.h>
+#define OATH_VITALS_SSE 1
+#endif
+
+namespace {
+const float NEVER = std::numeric_limits<float>::infinity();
+
+// NutritionState's hunger levels: 75 satisfied, 50 normal, 25 hungry, 10
+// starving, then critical at 0. The bands are NutritionLevel.
+const float HUNGER_BANDS[VitalsTable::BAND_THRESHOLDS] = { 75.0f, 50.0f, 25.0f, 10.0f, 0.0f };
+const unsigned HUNGER_INCLUSIVE = 1u << 4;
+
+// Its thirst levels at the same points; the bands are HydrationLevel
+const float THIRST_BANDS[VitalsTable::BAND_THRESHOLDS] = { 75.0f, 50.0f, 25.0f, 10.0f, 0.0f };
+const unsigned THIRST_INCLUSIVE = 1u << 4;
+
+// Exhausted at 10 or less, as MountStats::isExhausted and spell training read it
+const float STAMINA_BANDS[VitalsTable::BAND_THRESHOLDS] = { 10.0f, -NEVER, -NEVER, -NEVER, -NEVER };
+const unsigned STAMINA_INCLUSIVE = 1u << 0;
+
+// MountStats' fatigue steps: tired past 40, worn past 70, exhausted from 90
+const float FATIGUE_BANDS[VitalsTable::BAND_THRESHOLDS] = { 40.0f, 70.0f, 90.0f, NEVER, NEVER };
+const unsigned FATIGUE_INCLUSIVE = 1u << 2;
+
+// Unconscious at 0, as HealthState::takeDamage
+const float HEALTH_BANDS[VitalsTable::BAND_THRESHOLDS] = { 0.0f, -NEVER, -NEVER, -NEVER, -NEVER };
+const unsigned HEALTH_INCLUSIVE = 1u << 0;
+}
+
+VitalsTable::VitalsTable()
+{
+    setBands(Vital::Hunger, HUNGER_BANDS, false, HUNGER_INCLUSIVE);
+    setBands(Vital::Thirst, THIRST_BANDS, false, THIRST_INCLUSIVE);
+    setBands(Vital::Stamina, STAMINA_BANDS, false, STAMINA_INCLUSIVE);
+    setBands(Vital::Fatigue, FATIGUE_BANDS, true, FATIGUE_INCLUSIVE);
+    setBands(Vital::Health, HEALTH_BANDS, false, HEALTH_INCLUSIVE);
+}
+
+void VitalsTable::clear()
+{
+    for (int v = 0; v < VITAL_COUNT; v++) {
+        values[v].clear();
+        rates[v].clear();
+        maxima[v].clear();
+        bands[v].clear();
+    }
+}
+
+int VitalsTable::add()
+{
+    int entity = size();
+    for (int v = 0; v < VITAL_COUNT; v++) {
+        float start = v == index(Vital::Fatigue) ? 0.0f : 100.0f;
+        values[v].push_back(start);
+        rates[v].push_back(0.0f);
+        maxima[v].push_back(100.0f);
+        bands[v].push_back(bandOf(v, start));
+    }
+    return entity;
+}
+
+void VitalsTable::set(int entity, Vital vital, float value)
+{
+    int v = index(vital);
+    values[v][entity] = std::clamp(value, 0.0f, maxima[v][entity]);
+    bands[v][entity] = bandOf(v, values[v][entity]);
+}
+
+void VitalsTable::change(int entity, Vital vital, float amount)
+{
+    set(entity, vital, get(entity, vital) + amount);
+}
+
+void VitalsTable::setMax(int entity, Vital vital, float max)
+{
+    int v = index(vital);
+    maxima[v][entity] = std::max(max, 0.0f);
+    set(entity, vital, values[v][entity]);
+}
+
+void VitalsTable::setRate(int entity, Vital vital, float perHour)
+{
+    rates[index(vital)][entity] = perHour;
+}
+
+void VitalsTable::setBands(Vital vital, const float (&limits)[BAND_THRESHOLDS], bool rising, unsigned inclusive)
+{
+    int v = index(vital);
+    sign[v] = rising ? -1.0f : 1.0f;
+    for (int k = 0; k < BAND_THRESHOLDS; k++) {
+        thresholds[v][k] = sign[v] * limits[k];
+        if (inclusive & (1u << k)) {
+            thresholds[v][k] = std::nextafter(thresholds[v][k], NEVER);
+        }
+    }
+
+    for (int entity = 0; entity < size(); entity++) {
+        bands[v][entity] = bandOf(v, values[v][entity]);
+    }
+}
+
+int VitalsTable::bandOf(int v, float value) const
+{
+    float signedValue = sign[v] * value;
+    int band = 0;
+    for (int k = 0; k < BAND_THRESHOLDS; k++) {
+        band += signedValue < thresholds[v][k];
+    }
+    return band;
+}
+
+void VitalsTable::reportCrossings(int entity, int v, float start, float hours, int fromBand, int toBand, std::vector<VitalEvent>& events) const
+{
+    // Drift is linear, so each threshold between the bands was crossed once,
+    // in band order
+    float rate = rates[v][entity];
+    int step = toBand > fromBand ? 1 : -1;
+    for (int band = fromBand; band != toBand; band += step) {
+        int crossed = step > 0 ? band : band - 1;
+        float at = rate != 0.0f ? (sign[v] * thresholds[v][crossed] - start) / rate : 0.0f;
+        events.push_back({ entity, static_cast<Vital>(v), band, band + step, std::clamp(at, 0.0f, hours) });
+    }
+}
+
+void VitalsTable::advance(float hours, std::vector<VitalEvent>& events)
+{
+    if (hours <= 0.0f) {
+        return;
+    }
+
+    const int count = size();
+    for (int v = 0; v < VITAL_COUNT; v++) {
+        float* value = values[v].data();
+        const float* rate = rates[v].data();
+        const float* max = maxima[v].data();
+        int32_t* band = bands[v].data();
+        int i = 0;
+
+#ifdef OATH_VITALS_SSE
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 span = _mm_set1_ps(hours);
+        const __m128 direction = _mm_set1_ps(sign[v]);
+        __m128 limit[BAND_THRESHOLDS];
+        for (int k = 0; k < BAND_THRESHOLDS; k++) {
+            limit[k] = _mm_set1_ps(thresholds[v][k]);
+        }
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 start = _mm_loadu_ps(value + i);
+            __m128 next = _mm_add_ps(start, _mm_mul_ps(_mm_loadu_ps(rate + i), span));
+            next = _mm_min_ps(_mm_max_ps(next, zero), _mm_loadu_ps(max + i));
+            _mm_storeu_ps(value + i, next);
+
+            // Each passed threshold is an all-ones lane, -1 as an integer
+            __m128 signedNext = _mm_mul_ps(next, direction);
+            __m128i passed = _mm_setzero_si128();
+            for (int k = 0; k < BAND_THRESHOLDS; k++) {
+                passed = _mm_sub_epi32(passed, _mm_castps_si128(_mm_cmplt_ps(signedNext, limit[k])));
+            }
+
+            __m128i before = _mm_loadu_si128(reinterpret_cast<const __m128i*>(band + i));
+            int same = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(passed, before)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(band + i), passed);
+            if (same == 0xF) {
+                continue;
+            }
+
+            // Rare: a lane changed band
+            alignas(16) float starts[4];
+            alignas(16) int32_t after[4];
+            alignas(16) int32_t was[4];
+            _mm_store_ps(starts, start);
+            _mm_store_si128(reinterpret_cast<__m128i*>(after), passed);
+            _mm_store_si128(reinterpret_cast<__m128i*>(was), before);
+            for (int lane = 0; lane < 4; lane++) {
+                if (!(same & (1 << lane))) {
+                    reportCrossings(i + lane, v, starts[lane], hours, was[lane], after[lane], events);
+                }
+            }
+        }
+#endif
+
+        for (; i < count; i++) {
+            float start = value[i];
+            value[i] = std::min(std::max(start + rate[i] * hours, 0.0f), max[i]);
+            int next = bandOf(v, value[i]);
+            if (next != band[i]) {
+                reportCrossings(i, v, start, hours, band[i], next, events);
+                band[i] = next;
+            }
+        }
+    }
+}
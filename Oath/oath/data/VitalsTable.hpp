@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Vital signs kept by VitalsTable
+enum class Vital {
+    Hunger, // 100 full, 0 starving, as in NutritionState
+    Thirst, // 100 hydrated, 0 parched
+    Stamina,
+    Fatigue, // 0 fresh, rising with exertion, as in MountStats
+    Health
+};
+constexpr int VITAL_COUNT = 5;
+
+// A vital moving from one band to the next during VitalsTable::advance
+struct VitalEvent {
+    int entity;
+    Vital vital;
+    int fromBand;
+    int toBand;
+    float atHour; // Into the span advanced
+};
+
+// Hunger, thirst, stamina, fatigue and health of any number of entities in
+// one array per vital. Each vital drifts at its own rate per hour
+// between 0 and the entity's maximum, so advancing any span is one pass per
+// vital with no per-entity calls, SSE2 where available. Each vital also has
+// a band: how many of its BAND_THRESHOLDS the value has passed. By default
+// the Hunger and Thirst bands are NutritionLevel and HydrationLevel, Fatigue
+// climbs MountStats' steps, and Stamina and Health reach band 1 at exhausted
+// and unconscious. advance reports every band crossed, with the hour it
+// happened, so owners react to STARVING and the like without polling.
+// HealthContext keeps the player's health and nutrition in one.
+class VitalsTable {
+public:
+    static const int BAND_THRESHOLDS = 5;
+
+    VitalsTable();
+
+    void clear();
+
+    // A new entity, every vital at 100 of 100 and not drifting
+    int add();
+    int size() const { return static_cast<int>(values[0].size()); }
+
+    float get(int entity, Vital vital) const { return values[index(vital)][entity]; }
+    float getMax(int entity, Vital vital) const { return maxima[index(vital)][entity]; }
+    float getRate(int entity, Vital vital) const { return rates[index(vital)][entity]; }
+    int getBand(int entity, Vital vital) const { return bands[index(vital)][entity]; }
+
+    // Clamped to [0, max]; the band follows without an event
+    void set(int entity, Vital vital, float value);
+    void change(int entity, Vital vital, float amount);
+    void setMax(int entity, Vital vital, float max);
+    void setRate(int entity, Vital vital, float perHour);
+
+    // Falling thresholds are passed by going below them, in descending order;
+    // rising ones by going above them, ascending. Bit k of inclusive makes
+    // threshold k passed on reaching it, as MountStats' fatigue >= 90. Pad
+    // unused ones with a value never passed (-infinity falling, +infinity
+    // rising).
+    void setBands(Vital vital, const float (&thresholds)[BAND_THRESHOLDS], bool rising, unsigned inclusive = 0);
+
+    // Moves every vital of every entity hours on, appending an event for each
+    // band crossed
+    void advance(float hours, std::vector<VitalEvent>& events);
+
+private:
+    std::vector<float> values[VITAL_COUNT];
+    std::vector<float> rates[VITAL_COUNT];
+    std::vector<float> maxima[VITAL_COUNT];
+    std::vector<int32_t> bands[VITAL_COUNT];
+
+    // Thresholds stored times the sign (-1 rising), so every band test is
+    // sign * value < threshold. Inclusive ones are stored as the next float
+    // up, which makes < the same test as <= on the threshold itself.
+    float thresholds[VITAL_COUNT][BAND_THRESHOLDS];
+    float sign[VITAL_COUNT];
+
+    static int index(Vital vital) { return static_cast<int>(vital); }
+    int bandOf(int v, float value) const;
+    void reportCrossings(int entity, int v, float start, float hours, int fromBand, int toBand, std::vector<VitalEvent>& events) const;
+};
@@ -39,22 +39,35 @@ std::string WorldState::getFactionState(const std::string& faction) const
 
 void WorldState::setLocationState(const std::string& location, const std::string& state)
 {
-    locationStates[location] = state;
+    std::string& current = locationStates[location];
+    if (current != state) {
+        current = state;
+        notify(StateField::Location, location);
+    }
 }
 
 void WorldState::setFactionState(const std::string& faction, const std::string& state)
 {
-    factionStates[faction] = state;
+    std::string& current = factionStates[faction];
+    if (current != state) {
+        current = state;
+        notify(StateField::FactionState, faction);
+    }
 }
 
 void WorldState::setWorldFlag(const std::string& flag, bool value)
 {
-    worldFlags[flag] = value;
+    auto it = worldFlags.find(flag);
+    if (it == worldFlags.end() || it->second != value) {
+        worldFlags[flag] = value;
+        notify(StateField::Flag, flag);
+    }
 }
 
 void WorldState::advanceDay()
 {
     daysPassed++;
+    notify(StateField::Day, "");
 
     // Update season every 90 days
     if (daysPassed % 90 == 0) {
@@ -66,5 +79,13 @@ void WorldState::advanceDay()
             currentSeason = "winter";
         else if (currentSeason == "winter")
             currentSeason = "spring";
+        notify(StateField::Season, "");
+    }
+}
+
+void WorldState::notify(StateField field, const std::string& name) const
+{
+    if (listener) {
+        listener->stateChanged(field, name);
     }
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "StateListener.hpp"
+
 #include <map>
 #include <string>
 
@@ -11,6 +13,9 @@ struct WorldState {
     int daysPassed = 0;
     std::string currentSeason = "spring";
 
+    // Told about changes made through the setters below
+    StateListener* listener = nullptr;
+
     WorldState();
     bool hasFlag(const std::string& flag) const;
     std::string getLocationState(const std::string& location) const;
@@ -19,4 +24,7 @@ struct WorldState {
     void setFactionState(const std::string& faction, const std::string& state);
     void setWorldFlag(const std::string& flag, bool value);
     void advanceDay();
+
+private:
+    void notify(StateField field, const std::string& name) const;
 };
\ No newline at end of file
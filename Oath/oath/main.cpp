@@ -186,9 +186,7 @@ int main()
     // Wait 5 hours
     TimeNode* timeSystem = dynamic_cast<TimeNode*>(controller.currentNodes["TimeSystem"]);
     if (timeSystem) {
-        for (int i = 0; i < 5; i++) {
-            timeSystem->advanceHour(&controller.gameContext);
-        }
+        timeSystem->advanceHours(&controller.gameContext, 5);
     }
 
     // Save/Load demonstration
@@ -274,7 +272,7 @@ int main()
                 // Display inventory
                 std::cout << "\nInventory:" << std::endl;
                 for (const auto& item : controller.gameContext.playerInventory.items) {
-                    std::cout << "- " << item.name << " (" << item.quantity << ")"
+                    std::cout << "- " << item.name() << " (" << item.quantity << ")"
                               << std::endl;
                 }
             } else {
@@ -333,7 +331,7 @@ int main()
                 // Display inventory
                 std::cout << "\nInventory:" << std::endl;
                 for (const auto& item : controller.gameContext.playerInventory.items) {
-                    std::cout << "- " << item.name << " (" << item.quantity << ")" << std::endl;
+                    std::cout << "- " << item.name() << " (" << item.quantity << ")" << std::endl;
                 }
             } else if (command == "j" || command == "journal") {
                 // Display quest journal
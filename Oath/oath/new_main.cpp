@@ -5,8 +5,12 @@
 #include "data/Item.hpp"
 #include "systems/crafting/CraftingNode.hpp"
 #include "systems/dialogue/NPC.hpp"
+#include "systems/economy/EconomicSystemNode.hpp"
+#include "systems/faction/FactionSystemNode.hpp"
+#include "systems/health/HealthSetup.hpp"
 #include "systems/progression/SkillNode.hpp"
 #include "systems/quest/QuestNode.hpp"
+#include "systems/relationship/RelationshipSystemController.hpp"
 #include "systems/weather/WeatherSystemNode.hpp"
 #include "systems/world/TimeNode.hpp"
 #include "utils/JSONLoader.hpp"
@@ -88,9 +92,22 @@ int main()
     // Hook weather to time system
     hookWeatherToTimeSystem(controller);
 
+    // Initialize the economy and run it as days pass
+    initializeEconomySystem(controller);
+    hookEconomyToTimeSystem(controller);
+
+    // Factions take territory output from the economy, so they hook after it
+    initializeFactionSystem(controller);
+    hookFactionsToTimeSystem(controller);
+
     // Initialize the Crime & Law System
     CrimeLawSystem crimeSystem(&controller);
 
+    // NPC epidemics follow the relationship system's schedules and social
+    // graph, so relationships hook to the clock first
+    RelationshipSystemController relationshipSystem(&controller);
+    setupDiseaseHealthSystem(controller, relationshipSystem.getRelationshipManager());
+
     std::cout << "\n___ GAME DATA LOADED SUCCESSFULLY ___\n"
               << std::endl;
 
@@ -247,9 +264,7 @@ int main()
     // Wait 5 hours
     TimeNode* timeSystem = dynamic_cast<TimeNode*>(controller.currentNodes["TimeSystem"]);
     if (timeSystem) {
-        for (int i = 0; i < 5; i++) {
-            timeSystem->advanceHour(&controller.gameContext);
-        }
+        timeSystem->advanceHours(&controller.gameContext, 5);
     }
 
     // Save/Load demonstration
@@ -335,7 +350,7 @@ int main()
                 // Display inventory
                 std::cout << "\nInventory:" << std::endl;
                 for (const auto& item : controller.gameContext.playerInventory.items) {
-                    std::cout << "- " << item.name << " (" << item.quantity << ")"
+                    std::cout << "- " << item.name() << " (" << item.quantity << ")"
                               << std::endl;
                 }
             } else {
@@ -398,7 +413,7 @@ int main()
                 // Display inventory
                 std::cout << "\nInventory:" << std::endl;
                 for (const auto& item : controller.gameContext.playerInventory.items) {
-                    std::cout << "- " << item.name << " (" << item.quantity << ")" << std::endl;
+                    std::cout << "- " << item.name() << " (" << item.quantity << ")" << std::endl;
                 }
             } else if (command == "j" || command == "journal") {
                 // Display quest journal
@@ -124,29 +124,30 @@ bool BountyPaymentNode::negotiateBounty(GameContext* context)
 {
     CrimeLawContext* lawContext = getLawContext(context);
     std::string region = getCurrentRegion(context);
-    const auto& config = crimeLawConfig["bountyNegotiationConfig"];
+    auto law = crimeLawSettings();
+    const CrimeLawSettings::BountyNegotiation& config = law->bountyNegotiation;
 
     // Negotiate based on speech/charisma skill
-    int negotiateChance = config["baseChance"].get<int>();
+    int negotiateChance = config.baseChance;
 
     if (context) {
         // Add speech skill bonus
         auto speechIt = context->playerStats.skills.find("speech");
         if (speechIt != context->playerStats.skills.end()) {
-            negotiateChance += speechIt->second * config["speechMultiplier"].get<int>();
+            negotiateChance += speechIt->second * config.speechMultiplier;
         }
 
         // Add charisma bonus
-        negotiateChance += (context->playerStats.charisma - config["charismaBaseValue"].get<int>()) * config["charismaMultiplier"].get<int>();
+        negotiateChance += (context->playerStats.charisma - config.charismaBaseValue) * config.charismaMultiplier;
     }
 
     // Criminal reputation affects negotiation
     int criminalRep = lawContext->criminalRecord.getReputation(region);
-    negotiateChance += criminalRep / config["reputationDivisor"].get<int>(); // Better reputation helps
+    negotiateChance += criminalRep / config.reputationDivisor; // Better reputation helps
 
     // Ensure reasonable bounds
-    negotiateChance = std::max(config["minChance"].get<int>(),
-        std::min(negotiateChance, config["maxChance"].get<int>()));
+    negotiateChance = std::max(config.minChance,
+        std::min(negotiateChance, config.maxChance));
 
     // Random check
     std::random_device rd;
@@ -157,7 +158,7 @@ bool BountyPaymentNode::negotiateBounty(GameContext* context)
 
     if (success) {
         int originalBounty = lawContext->criminalRecord.getBounty(region);
-        int discountPercent = config["discountPercent"].get<int>();
+        int discountPercent = config.discountPercent;
         int discountedBounty = originalBounty * (100 - discountPercent) / 100;
 
         std::cout << "Through skillful negotiation, you've reduced your bounty from "
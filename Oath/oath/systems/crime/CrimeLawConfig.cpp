@@ -3,14 +3,178 @@
 #include <fstream>
 #include <stdexcept>
 
-// Global config definition (this actually allocates memory for it)
-nlohmann::json crimeLawConfig;
+namespace {
+ConfigSnapshot<CrimeLawSettings> current;
+const std::string NO_NAME;
 
-void loadCrimeLawConfig()
+// JSON keys of each enum value, in enum order
+const char* const CRIME_KEYS[CRIME_KIND_COUNT - 1] = { "THEFT", "ASSAULT", "MURDER", "TRESPASSING", "VANDALISM", "PICKPOCKETING", "PRISON_BREAK" };
+const char* const GUARD_RESPONSE_KEYS[GUARD_RESPONSE_COUNT] = { "ARREST", "ATTACK", "FINE", "WARN", "IGNORE" };
+const char* const LOCATION_KEYS[WITNESS_LOCATION_COUNT] = { "town", "village", "city", "forest", "wilderness", "dungeon", "cave", "default" };
+
+nlohmann::json section(const nlohmann::json& config, const char* key)
+{
+    return config.value(key, nlohmann::json::object());
+}
+}
+
+CrimeLawSettings::CrimeLawSettings()
+    : crimeTypeNames { "theft", "assault", "murder", "trespassing", "vandalism", "pickpocketing", "prison break", "" }
+    , guardResponseNames { "arrest", "attack", "fine", "warn", "ignore" }
+    , baseBounty { 50, 100, 1000, 20, 30, 40, 500, 0 }
+    , jailDaysPerPoint { 3, 5, 10, 1, 1, 3, 1, 1 }
+    , witnessChance { 70, 60, 80, 30, 20, 25, 15, 50 }
+    , bountyWitnessMultiplier(2)
+    , repLossBaseFactor(5)
+    , witnessRepMultiplier(2)
+    , wantedThreshold(3)
+    , skillImprovementChance(30)
+    , guardFaction("city_guard")
+    , guardWitnessBonus(15)
+    , maxJailSentence(90)
+    , repGainPerDay(2)
+    , jailEscape { 20, 2, 3, 5, 5, 75, 5 }
+    , bountyNegotiation { 30, 3, 5, 2, 10, 10, 80, 30 }
+    , regions { "Northshire", "Westfall", "Redridge", "Duskwood" }
+    , theftTargets(nlohmann::json::array())
+    , pickpocketTargets(nlohmann::json::array())
+{
+}
+
+std::shared_ptr<const CrimeLawSettings> CrimeLawSettings::fromJson(const nlohmann::json& config)
 {
-    std::ifstream configFile("resources/config/CrimeLaw.json");
+    auto settings = std::make_shared<CrimeLawSettings>();
+    if (!config.is_object()) {
+        return settings;
+    }
+
+    const nlohmann::json types = section(config, "crimeTypes");
+    for (int k = 0; k < CRIME_KIND_COUNT - 1; k++) {
+        settings->crimeTypeNames[k] = types.value(CRIME_KEYS[k], settings->crimeTypeNames[k]);
+    }
+
+    const nlohmann::json responses = section(config, "guardResponseTypes");
+    for (int r = 0; r < GUARD_RESPONSE_COUNT; r++) {
+        settings->guardResponseNames[r] = responses.value(GUARD_RESPONSE_KEYS[r], settings->guardResponseNames[r]);
+    }
+
+    // Bounties are keyed by the type names just read
+    const nlohmann::json bounties = section(config, "baseBounties");
+    for (int k = 0; k < CRIME_KIND_COUNT - 1; k++) {
+        settings->baseBounty[k] = bounties.value(settings->crimeTypeNames[k], settings->baseBounty[k]);
+    }
+
+    const nlohmann::json chances = section(config, "witnessChances");
+    for (int l = 0; l < WITNESS_LOCATION_COUNT; l++) {
+        settings->witnessChance[l] = chances.value(LOCATION_KEYS[l], settings->witnessChance[l]);
+    }
+
+    const nlohmann::json crime = section(config, "crimeConfig");
+    settings->bountyWitnessMultiplier = crime.value("bountyWitnessMultiplier", settings->bountyWitnessMultiplier);
+    settings->repLossBaseFactor = crime.value("repLossBaseFactor", settings->repLossBaseFactor);
+    settings->witnessRepMultiplier = crime.value("witnessRepMultiplier", settings->witnessRepMultiplier);
+    settings->wantedThreshold = crime.value("wantedThreshold", settings->wantedThreshold);
+    settings->skillImprovementChance = crime.value("skillImprovementChance", settings->skillImprovementChance);
+    settings->guardFaction = crime.value("guardFaction", settings->guardFaction);
+    settings->guardWitnessBonus = crime.value("guardWitnessBonus", settings->guardWitnessBonus);
+
+    // Murder and assault have their own rates, theft covers pickpocketing, the rest are minor
+    const nlohmann::json jail = section(config, "jailConfig");
+    int minorDays = jail.value("minorCrimeDaysPerPoint", 1);
+    int theftDays = jail.value("theftDaysPerPoint", 3);
+    for (int& days : settings->jailDaysPerPoint) {
+        days = minorDays;
+    }
+    settings->jailDaysPerPoint[static_cast<int>(CrimeKind::Murder)] = jail.value("murderDaysPerPoint", 10);
+    settings->jailDaysPerPoint[static_cast<int>(CrimeKind::Assault)] = jail.value("assaultDaysPerPoint", 5);
+    settings->jailDaysPerPoint[static_cast<int>(CrimeKind::Theft)] = theftDays;
+    settings->jailDaysPerPoint[static_cast<int>(CrimeKind::Pickpocketing)] = theftDays;
+    settings->maxJailSentence = jail.value("maxJailSentence", settings->maxJailSentence);
+    settings->repGainPerDay = jail.value("repGainPerDay", settings->repGainPerDay);
+
+    const nlohmann::json escape = section(config, "jailEscapeConfig");
+    JailEscape& e = settings->jailEscape;
+    e.baseChance = escape.value("baseChance", e.baseChance);
+    e.stealthMultiplier = escape.value("stealthMultiplier", e.stealthMultiplier);
+    e.lockpickingMultiplier = escape.value("lockpickingMultiplier", e.lockpickingMultiplier);
+    e.sentencePenaltyDivisor = escape.value("sentencePenaltyDivisor", e.sentencePenaltyDivisor);
+    e.minChance = escape.value("minChance", e.minChance);
+    e.maxChance = escape.value("maxChance", e.maxChance);
+    e.sentenceIncrease = escape.value("sentenceIncrease", e.sentenceIncrease);
+
+    const nlohmann::json negotiation = section(config, "bountyNegotiationConfig");
+    BountyNegotiation& n = settings->bountyNegotiation;
+    n.baseChance = negotiation.value("baseChance", n.baseChance);
+    n.speechMultiplier = negotiation.value("speechMultiplier", n.speechMultiplier);
+    n.charismaBaseValue = negotiation.value("charismaBaseValue", n.charismaBaseValue);
+    n.charismaMultiplier = negotiation.value("charismaMultiplier", n.charismaMultiplier);
+    n.reputationDivisor = negotiation.value("reputationDivisor", n.reputationDivisor);
+    n.minChance = negotiation.value("minChance", n.minChance);
+    n.maxChance = negotiation.value("maxChance", n.maxChance);
+    n.discountPercent = negotiation.value("discountPercent", n.discountPercent);
+
+    if (config.contains("regions")) {
+        settings->regions = config["regions"].get<std::vector<std::string>>();
+    }
+    settings->theftTargets = config.value("theftTargets", settings->theftTargets);
+    settings->pickpocketTargets = config.value("pickpocketTargets", settings->pickpocketTargets);
+
+    return settings;
+}
+
+CrimeKind CrimeLawSettings::kindOf(const std::string& crimeType) const
+{
+    for (int k = 0; k < CRIME_KIND_COUNT - 1; k++) {
+        if (crimeTypeNames[k] == crimeType) {
+            return static_cast<CrimeKind>(k);
+        }
+    }
+    return CrimeKind::Other;
+}
+
+const std::string& CrimeLawSettings::crimeTypeByKey(const std::string& key) const
+{
+    for (int k = 0; k < CRIME_KIND_COUNT - 1; k++) {
+        if (key == CRIME_KEYS[k]) {
+            return crimeTypeNames[k];
+        }
+    }
+    return NO_NAME;
+}
+
+const std::string& CrimeLawSettings::guardResponseByKey(const std::string& key) const
+{
+    for (int r = 0; r < GUARD_RESPONSE_COUNT; r++) {
+        if (key == GUARD_RESPONSE_KEYS[r]) {
+            return guardResponseNames[r];
+        }
+    }
+    return NO_NAME;
+}
+
+int CrimeLawSettings::witnessChanceAt(const std::string& location) const
+{
+    for (int l = 0; l < WITNESS_LOCATION_COUNT - 1; l++) {
+        if (location.find(LOCATION_KEYS[l]) != std::string::npos) {
+            return witnessChance[l];
+        }
+    }
+    return witnessChance[static_cast<int>(WitnessLocation::Default)];
+}
+
+std::shared_ptr<const CrimeLawSettings> crimeLawSettings()
+{
+    return current.get();
+}
+
+void loadCrimeLawConfig(const std::string& filename)
+{
+    std::ifstream configFile(filename);
     if (!configFile.is_open()) {
         throw std::runtime_error("Could not open CrimeLaw.json file");
     }
-    configFile >> crimeLawConfig;
-}
\ No newline at end of file
+
+    nlohmann::json config;
+    configFile >> config;
+    current.publish(CrimeLawSettings::fromJson(config));
+}
@@ -1,10 +1,116 @@
 // CrimeLawConfig.hpp
 #pragma once
 
+#include "../../utils/ConfigSnapshot.hpp"
+#include <memory>
 #include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
 
-// Declare the global config (just the declaration, not definition)
-extern nlohmann::json crimeLawConfig;
+// Crime types in "crimeTypes" order; Other covers anything unlisted
+enum class CrimeKind {
+    Theft,
+    Assault,
+    Murder,
+    Trespassing,
+    Vandalism,
+    Pickpocketing,
+    PrisonBreak,
+    Other
+};
+constexpr int CRIME_KIND_COUNT = 8;
 
-// Function to load the config
-void loadCrimeLawConfig();
\ No newline at end of file
+enum class GuardResponse {
+    Arrest,
+    Attack,
+    Fine,
+    Warn,
+    Ignore
+};
+constexpr int GUARD_RESPONSE_COUNT = 5;
+
+// Location keywords with their own witness chance, in "witnessChances" order
+enum class WitnessLocation {
+    Town,
+    Village,
+    City,
+    Forest,
+    Wilderness,
+    Dungeon,
+    Cave,
+    Default
+};
+constexpr int WITNESS_LOCATION_COUNT = 8;
+
+// CrimeLaw.json parsed once into tables indexed by the enums above. A
+// snapshot never changes after fromJson; loadCrimeLawConfig swaps in a new one.
+struct CrimeLawSettings {
+    std::string crimeTypeNames[CRIME_KIND_COUNT]; // "theft", "assault", ...
+    std::string guardResponseNames[GUARD_RESPONSE_COUNT];
+
+    int baseBounty[CRIME_KIND_COUNT];
+    int jailDaysPerPoint[CRIME_KIND_COUNT]; // Sentence per severity point
+    int witnessChance[WITNESS_LOCATION_COUNT]; // Percent
+
+    // "crimeConfig"
+    int bountyWitnessMultiplier;
+    int repLossBaseFactor;
+    int witnessRepMultiplier;
+    int wantedThreshold;
+    int skillImprovementChance;
+    std::string guardFaction; // Faction whose members act as guards
+    int guardWitnessBonus; // Witness chance added per guard present
+
+    // "jailConfig"
+    int maxJailSentence;
+    int repGainPerDay;
+
+    struct JailEscape {
+        int baseChance;
+        int stealthMultiplier;
+        int lockpickingMultiplier;
+        int sentencePenaltyDivisor;
+        int minChance;
+        int maxChance;
+        int sentenceIncrease;
+    } jailEscape;
+
+    struct BountyNegotiation {
+        int baseChance;
+        int speechMultiplier;
+        int charismaBaseValue;
+        int charismaMultiplier;
+        int reputationDivisor;
+        int minChance;
+        int maxChance;
+        int discountPercent;
+    } bountyNegotiation;
+
+    std::vector<std::string> regions;
+
+    // Target lists stay JSON; the nodes read them as data
+    nlohmann::json theftTargets;
+    nlohmann::json pickpocketTargets;
+
+    CrimeLawSettings();
+
+    // Missing keys keep the defaults, which match the shipped CrimeLaw.json
+    static std::shared_ptr<const CrimeLawSettings> fromJson(const nlohmann::json& config);
+
+    CrimeKind kindOf(const std::string& crimeType) const;
+    const std::string& crimeTypeName(CrimeKind kind) const { return crimeTypeNames[static_cast<int>(kind)]; }
+    const std::string& guardResponseName(GuardResponse response) const { return guardResponseNames[static_cast<int>(response)]; }
+
+    // By config key ("THEFT", "ARREST", ...); empty for unknown keys
+    const std::string& crimeTypeByKey(const std::string& key) const;
+    const std::string& guardResponseByKey(const std::string& key) const;
+
+    // Witness chance for the first location keyword found in the name
+    int witnessChanceAt(const std::string& location) const;
+};
+
+// The current crime and law settings; take once per operation
+std::shared_ptr<const CrimeLawSettings> crimeLawSettings();
+
+// Parse the config and swap it in; readers keep the snapshot they hold
+void loadCrimeLawConfig(const std::string& filename = "resources/config/CrimeLaw.json");
@@ -1,10 +1,13 @@
 // CrimeLawSystem.cpp
 #include "CrimeLawSystem.hpp"
+#include "../faction/FactionSystemNode.hpp"
 
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
 
+CrimeLawSystem* CrimeLawSystem::instance = nullptr;
+
 CrimeLawSystem::CrimeLawSystem(TAController* controller)
     : controller(controller)
 {
@@ -36,6 +39,9 @@ void CrimeLawSystem::setupNodes()
 
     jailNode = dynamic_cast<JailNode*>(
         controller->createNode<JailNode>("Jail"));
+    if (controller->systemRoots.find("TimeSystem") != controller->systemRoots.end()) {
+        jailNode->timeSystem = dynamic_cast<TimeNode*>(controller->systemRoots["TimeSystem"]);
+    }
 
     bountyNode = dynamic_cast<BountyPaymentNode*>(
         controller->createNode<BountyPaymentNode>("BountyPayment"));
@@ -44,7 +50,8 @@ void CrimeLawSystem::setupNodes()
         controller->createNode<PickpocketNode>("Pickpocket"));
 
     // Create theft execution nodes from config
-    for (const auto& target : crimeLawConfig["theftTargets"]) {
+    auto law = crimeLawSettings();
+    for (const auto& target : law->theftTargets) {
         std::string id = target["id"];
         std::string name = "Theft_" + id;
 
@@ -192,6 +199,19 @@ void CrimeLawSystem::registerSystem()
 
 void CrimeLawSystem::setupGuardEncounters()
 {
+    // Guards are members of the guard faction, placed where the world puts them
+    auto it = controller->systemRoots.find("FactionSystem");
+    const oath::FactionSystemNode* factionSystem = it != controller->systemRoots.end() ? dynamic_cast<oath::FactionSystemNode*>(it->second) : nullptr;
+    std::vector<CrimeSystemNode*> nodes = { criminalStatusNode, theftNode, guardNode, jailNode, bountyNode, pickpocketNode };
+    for (const auto& [id, node] : theftExecutionNodes) {
+        nodes.push_back(node);
+    }
+    for (CrimeSystemNode* node : nodes) {
+        if (node) {
+            node->factionSystem = factionSystem;
+        }
+    }
+
     // This would integrate with your world system to trigger guard encounters
     // when the player enters certain locations and has a wanted status
 
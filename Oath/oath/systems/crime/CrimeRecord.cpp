@@ -19,15 +19,17 @@ CrimeRecord::CrimeRecord(const std::string& crimeType, const std::string& crimeR
 
 int CrimeRecord::calculateBounty() const
 {
+    auto law = crimeLawSettings();
+
     // Base bounty by crime type
-    int baseBounty = crimeLawConfig["baseBounties"].contains(type) ? crimeLawConfig["baseBounties"][type].get<int>() : 0;
+    int baseBounty = law->baseBounty[static_cast<int>(law->kindOf(type))];
 
     // Adjust by severity
     int adjustedBounty = baseBounty * severity / 5;
 
     // Adjust if witnessed
     if (witnessed)
-        adjustedBounty *= crimeLawConfig["crimeConfig"]["bountyWitnessMultiplier"].get<int>();
+        adjustedBounty *= law->bountyWitnessMultiplier;
 
     return adjustedBounty;
 }
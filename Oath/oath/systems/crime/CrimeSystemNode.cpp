@@ -1,6 +1,7 @@
 // CrimeSystemNode.cpp
 #include "CrimeSystemNode.hpp"
 #include "../../data/GameContext.hpp"
+#include "../faction/FactionSystemNode.hpp"
 #include "CrimeLawConfig.hpp"
 #include "CrimeType.hpp"
 #include <iostream>
@@ -26,7 +27,8 @@ std::string CrimeSystemNode::getCurrentRegion(GameContext* context)
     if (context) {
         return context->worldState.getFactionState("current_region");
     }
-    return crimeLawConfig["regions"][0]; // Default to first region
+    auto law = crimeLawSettings();
+    return law->regions.empty() ? std::string() : law->regions[0]; // Default to first region
 }
 
 std::string CrimeSystemNode::getCurrentLocation(GameContext* context)
@@ -43,6 +45,14 @@ std::string CrimeSystemNode::getCurrentLocation(GameContext* context)
     return "Village Center"; // Default
 }
 
+int CrimeSystemNode::countGuardsPresent(GameContext* context)
+{
+    if (!factionSystem) {
+        return -1;
+    }
+    return factionSystem->countMembersAtLocation(crimeLawSettings()->guardFaction, getCurrentLocation(context));
+}
+
 bool CrimeSystemNode::isCrimeWitnessed(GameContext* context, int stealthModifier)
 {
     // Get player stealth skill
@@ -54,20 +64,16 @@ bool CrimeSystemNode::isCrimeWitnessed(GameContext* context, int stealthModifier
         }
     }
 
-    // Determine base witness chance by location
-    std::string location = getCurrentLocation(context);
-    std::string locationType = "default";
+    // Determine base witness chance by location keyword
+    auto law = crimeLawSettings();
+    int witnessChance = law->witnessChanceAt(getCurrentLocation(context));
 
-    // Check location keywords to determine type
-    for (const auto& type : { "town", "village", "city", "forest", "wilderness", "dungeon", "cave" }) {
-        if (location.find(type) != std::string::npos) {
-            locationType = type;
-            break;
-        }
+    // Each guard on hand is another pair of eyes
+    int guards = countGuardsPresent(context);
+    if (guards > 0) {
+        witnessChance += guards * law->guardWitnessBonus;
     }
 
-    int witnessChance = crimeLawConfig["witnessChances"][locationType].get<int>();
-
     // Apply stealth skill and modifier
     witnessChance -= (stealthSkill * 2) + stealthModifier;
 
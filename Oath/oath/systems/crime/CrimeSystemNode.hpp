@@ -7,12 +7,18 @@
 
 // Forward declarations
 struct GameContext;
+namespace oath {
+class FactionSystemNode;
+}
 
 // Base node for crime system
 class CrimeSystemNode : public TANode {
 public:
     CrimeSystemNode(const std::string& name);
 
+    // Where guard faction members are; without it guard presence is unknown
+    const oath::FactionSystemNode* factionSystem = nullptr;
+
     // Extended game context
     CrimeLawContext* getLawContext(GameContext* context);
 
@@ -22,7 +28,10 @@ public:
     // Helper to get current location
     std::string getCurrentLocation(GameContext* context);
 
-    // Check if crime was witnessed based on location and stealth
+    // Guard faction members at the current location, -1 if unknown
+    int countGuardsPresent(GameContext* context);
+
+    // Check if crime was witnessed based on location, guards present and stealth
     bool isCrimeWitnessed(GameContext* context, int stealthModifier);
 
     // Commits a crime and adds it to the player's record
@@ -5,13 +5,13 @@
 
 std::string CrimeType::get(const std::string& type)
 {
-    return crimeLawConfig["crimeTypes"][type];
+    return crimeLawSettings()->crimeTypeByKey(type);
 }
 
-std::string CrimeType::THEFT() { return get("THEFT"); }
-std::string CrimeType::ASSAULT() { return get("ASSAULT"); }
-std::string CrimeType::MURDER() { return get("MURDER"); }
-std::string CrimeType::TRESPASSING() { return get("TRESPASSING"); }
-std::string CrimeType::VANDALISM() { return get("VANDALISM"); }
-std::string CrimeType::PICKPOCKETING() { return get("PICKPOCKETING"); }
-std::string CrimeType::PRISON_BREAK() { return get("PRISON_BREAK"); }
\ No newline at end of file
+std::string CrimeType::THEFT() { return crimeLawSettings()->crimeTypeName(CrimeKind::Theft); }
+std::string CrimeType::ASSAULT() { return crimeLawSettings()->crimeTypeName(CrimeKind::Assault); }
+std::string CrimeType::MURDER() { return crimeLawSettings()->crimeTypeName(CrimeKind::Murder); }
+std::string CrimeType::TRESPASSING() { return crimeLawSettings()->crimeTypeName(CrimeKind::Trespassing); }
+std::string CrimeType::VANDALISM() { return crimeLawSettings()->crimeTypeName(CrimeKind::Vandalism); }
+std::string CrimeType::PICKPOCKETING() { return crimeLawSettings()->crimeTypeName(CrimeKind::Pickpocketing); }
+std::string CrimeType::PRISON_BREAK() { return crimeLawSettings()->crimeTypeName(CrimeKind::PrisonBreak); }
\ No newline at end of file
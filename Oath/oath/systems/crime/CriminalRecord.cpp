@@ -14,9 +14,10 @@ void CriminalRecord::addCrime(const CrimeRecord& crime)
     }
 
     // Update criminal reputation
-    int repLoss = crime.severity * crimeLawConfig["crimeConfig"]["repLossBaseFactor"].get<int>();
+    auto law = crimeLawSettings();
+    int repLoss = crime.severity * law->repLossBaseFactor;
     if (crime.witnessed)
-        repLoss *= crimeLawConfig["crimeConfig"]["witnessRepMultiplier"].get<int>();
+        repLoss *= law->witnessRepMultiplier;
 
     if (reputationByRegion.find(crime.region) == reputationByRegion.end()) {
         reputationByRegion[crime.region] = 0; // Start at neutral
@@ -28,7 +29,7 @@ void CriminalRecord::addCrime(const CrimeRecord& crime)
     }
 
     // Update wanted status based on the crime
-    if (crime.witnessed && crime.severity > crimeLawConfig["crimeConfig"]["wantedThreshold"].get<int>()) {
+    if (crime.witnessed && crime.severity > law->wantedThreshold) {
         wantedStatus[crime.region] = true;
     }
 }
@@ -109,7 +110,7 @@ void CriminalRecord::serveJailSentence(const std::string& region, int days)
 
     // Improve reputation based on days served
     if (reputationByRegion.find(region) != reputationByRegion.end()) {
-        reputationByRegion[region] += days * crimeLawConfig["jailConfig"]["repGainPerDay"].get<int>();
+        reputationByRegion[region] += days * crimeLawSettings()->repGainPerDay;
         if (reputationByRegion[region] > 100) {
             reputationByRegion[region] = 100;
         }
@@ -53,6 +53,11 @@ int GuardEncounterNode::determineGuardResponse(GameContext* context)
 
     // Determine response based on bounty and reputation
     if (bounty > 1000 || criminalRep < -50) {
+        // Without backup on hand a guard tries an arrest instead
+        int guards = countGuardsPresent(context);
+        if (guards >= 0 && guards < 2) {
+            return 0;
+        }
         return 1; // ATTACK for serious criminals
     } else if (bounty > 500 || criminalRep < -30) {
         return 0; // ARREST for moderate criminals
@@ -5,11 +5,11 @@
 
 std::string GuardResponseType::get(const std::string& type)
 {
-    return crimeLawConfig["guardResponseTypes"][type];
+    return crimeLawSettings()->guardResponseByKey(type);
 }
 
-std::string GuardResponseType::ARREST() { return get("ARREST"); }
-std::string GuardResponseType::ATTACK() { return get("ATTACK"); }
-std::string GuardResponseType::FINE() { return get("FINE"); }
-std::string GuardResponseType::WARN() { return get("WARN"); }
-std::string GuardResponseType::IGNORE() { return get("IGNORE"); }
\ No newline at end of file
+std::string GuardResponseType::ARREST() { return crimeLawSettings()->guardResponseName(GuardResponse::Arrest); }
+std::string GuardResponseType::ATTACK() { return crimeLawSettings()->guardResponseName(GuardResponse::Attack); }
+std::string GuardResponseType::FINE() { return crimeLawSettings()->guardResponseName(GuardResponse::Fine); }
+std::string GuardResponseType::WARN() { return crimeLawSettings()->guardResponseName(GuardResponse::Warn); }
+std::string GuardResponseType::IGNORE() { return crimeLawSettings()->guardResponseName(GuardResponse::Ignore); }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 JailNode::JailNode(const std::string& name)
     : CrimeSystemNode(name)
+    , timeSystem(nullptr)
 {
 }
 
@@ -47,7 +48,7 @@ void JailNode::confiscateItems(GameContext* context)
     // Copy stolen items to confiscated inventory and remove from player
     std::vector<Item> stolenItems;
     for (const auto& item : context->playerInventory.items) {
-        if (item.type == "stolen") {
+        if (item.type() == "stolen") {
             lawContext->confiscatedItems.addItem(item);
             stolenItems.push_back(item);
         }
@@ -55,7 +56,7 @@ void JailNode::confiscateItems(GameContext* context)
 
     // Remove from player inventory
     for (const auto& item : stolenItems) {
-        context->playerInventory.removeItem(item.id, item.quantity);
+        context->playerInventory.removeItem(item.catalogIndex, item.quantity);
     }
 }
 
@@ -114,9 +115,15 @@ void JailNode::serveTime(GameContext* context)
 
     // Skip time forward
     if (context) {
-        // This would integrate with your time system
-        // For example, advancing the day by the jail sentence
-        // context->worldState.advanceDay(lawContext->currentJailDays);
+        // The whole sentence passes in one clock advance, so every daily system
+        // catches up once instead of once per day
+        if (timeSystem) {
+            timeSystem->advanceHours(context, lawContext->currentJailDays * 24);
+        } else {
+            for (int i = 0; i < lawContext->currentJailDays; i++) {
+                context->worldState.advanceDay();
+            }
+        }
         std::cout << "Time passes... " << lawContext->currentJailDays << " days later." << std::endl;
     }
 
@@ -135,30 +142,31 @@ void JailNode::serveTime(GameContext* context)
 bool JailNode::attemptEscape(GameContext* context)
 {
     // Chance to escape based on config and skills
-    const auto& config = crimeLawConfig["jailEscapeConfig"];
-    int escapeChance = config["baseChance"].get<int>();
+    auto law = crimeLawSettings();
+    const CrimeLawSettings::JailEscape& config = law->jailEscape;
+    int escapeChance = config.baseChance;
 
     if (context) {
         // Add stealth skill bonus
         auto stealthIt = context->playerStats.skills.find("stealth");
         if (stealthIt != context->playerStats.skills.end()) {
-            escapeChance += stealthIt->second * config["stealthMultiplier"].get<int>();
+            escapeChance += stealthIt->second * config.stealthMultiplier;
         }
 
         // Add lockpicking skill bonus
         auto lockpickIt = context->playerStats.skills.find("lockpicking");
         if (lockpickIt != context->playerStats.skills.end()) {
-            escapeChance += lockpickIt->second * config["lockpickingMultiplier"].get<int>();
+            escapeChance += lockpickIt->second * config.lockpickingMultiplier;
         }
     }
 
     // Longer sentences are harder to escape from
     CrimeLawContext* lawContext = getLawContext(context);
-    escapeChance -= lawContext->currentJailDays / config["sentencePenaltyDivisor"].get<int>();
+    escapeChance -= lawContext->currentJailDays / config.sentencePenaltyDivisor;
 
     // Ensure reasonable bounds
-    escapeChance = std::max(config["minChance"].get<int>(),
-        std::min(escapeChance, config["maxChance"].get<int>()));
+    escapeChance = std::max(config.minChance,
+        std::min(escapeChance, config.maxChance));
 
     // Random check
     std::random_device rd;
@@ -188,7 +196,7 @@ bool JailNode::attemptEscape(GameContext* context)
 
         // Increase sentence for attempted escape
         CrimeLawContext* lawContext = getLawContext(context);
-        int sentenceIncrease = config["sentenceIncrease"].get<int>();
+        int sentenceIncrease = config.sentenceIncrease;
         lawContext->currentJailDays += sentenceIncrease;
         lawContext->jailSentencesByRegion[lawContext->currentJailRegion] += sentenceIncrease;
 
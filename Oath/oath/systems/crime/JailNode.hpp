@@ -2,6 +2,7 @@
 #pragma once
 
 #include "../../core/TAAction.hpp"
+#include "../world/TimeNode.hpp"
 #include "CrimeSystemNode.hpp"
 #include <vector>
 
@@ -12,6 +13,8 @@ class TANode;
 // Jail node - handles jail sentences
 class JailNode : public CrimeSystemNode {
 public:
+    TimeNode* timeSystem; // Game clock advanced while serving a sentence, if any
+
     JailNode(const std::string& name);
 
     void onEnter(GameContext* context) override;
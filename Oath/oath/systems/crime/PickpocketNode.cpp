@@ -34,7 +34,7 @@ std::vector<nlohmann::json> PickpocketNode::getPickpocketTargets(GameContext* co
 {
     // In a real implementation, this would get NPCs from current location
     // For now, just return the targets from the config
-    return crimeLawConfig["pickpocketTargets"].get<std::vector<nlohmann::json>>();
+    return crimeLawSettings()->pickpocketTargets.get<std::vector<nlohmann::json>>();
 }
 
 std::vector<TAAction> PickpocketNode::getAvailableActions()
@@ -42,7 +42,8 @@ std::vector<TAAction> PickpocketNode::getAvailableActions()
     std::vector<TAAction> actions;
 
     // Generate actions based on the targets from the config
-    for (const auto& target : crimeLawConfig["pickpocketTargets"]) {
+    auto law = crimeLawSettings();
+    for (const auto& target : law->pickpocketTargets) {
         std::string id = target["id"];
         std::string name = target["name"];
         int difficulty = target["difficulty"];
@@ -120,8 +121,9 @@ void PickpocketNode::attemptPickpocket(GameContext* context, const std::string&
     bool success = dis(gen) <= successChance;
 
     // Find target config
+    auto law = crimeLawSettings();
     nlohmann::json targetConfig;
-    for (const auto& t : crimeLawConfig["pickpocketTargets"]) {
+    for (const auto& t : law->pickpocketTargets) {
         if (t["id"] == target) {
             targetConfig = t;
             break;
@@ -155,7 +157,7 @@ void PickpocketNode::attemptPickpocket(GameContext* context, const std::string&
 
         // Improve skill with successful pickpocketing
         if (context) {
-            if (rand() % 100 < crimeLawConfig["crimeConfig"]["skillImprovementChance"].get<int>()) {
+            if (rand() % 100 < law->skillImprovementChance) {
                 context->playerStats.improveSkill("pickpocket", 1);
                 std::cout << "Your pickpocketing skill has improved!" << std::endl;
             }
@@ -11,7 +11,8 @@ TheftExecutionNode::TheftExecutionNode(const std::string& name, const std::strin
     , theftTarget(target)
 {
     // Find target in the config
-    for (const auto& t : crimeLawConfig["theftTargets"]) {
+    auto law = crimeLawSettings();
+    for (const auto& t : law->theftTargets) {
         if (t["id"] == target) {
             theftValue = t["value"].get<int>();
             theftSeverity = t["severity"].get<int>();
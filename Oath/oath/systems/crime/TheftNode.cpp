@@ -16,8 +16,9 @@ void TheftNode::onEnter(GameContext* context)
     // Show potential theft targets based on current location
     std::cout << "Potential targets:" << std::endl;
 
-    for (size_t i = 0; i < crimeLawConfig["theftTargets"].size(); i++) {
-        const auto& target = crimeLawConfig["theftTargets"][i];
+    auto law = crimeLawSettings();
+    for (size_t i = 0; i < law->theftTargets.size(); i++) {
+        const auto& target = law->theftTargets[i];
         std::cout << i + 1 << ". " << target["name"].get<std::string>()
                   << " (" << (target["severity"].get<int>() <= 3 ? "Low" : (target["severity"].get<int>() <= 6 ? "Medium" : "High"))
                   << " risk)" << std::endl;
@@ -29,7 +30,8 @@ std::vector<TAAction> TheftNode::getAvailableActions()
     std::vector<TAAction> actions;
 
     // Generate actions for each theft target from config
-    for (const auto& target : crimeLawConfig["theftTargets"]) {
+    auto law = crimeLawSettings();
+    for (const auto& target : law->theftTargets) {
         std::string id = target["id"];
         std::string name = target["name"];
 
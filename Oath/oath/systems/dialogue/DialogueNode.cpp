@@ -2,8 +2,8 @@
 
 DialogueNode::DialogueResponse::DialogueResponse(
     const std::string& responseText, TANode* target,
-    std::function<bool(const GameContext&)> req,
-    std::function<void(GameContext*)> eff)
+    GameCondition req,
+    GameEffect eff)
     : text(responseText)
     , requirement(req)
     , targetNode(target)
@@ -21,8 +21,8 @@ DialogueNode::DialogueNode(const std::string& name, const std::string& speaker,
 
 void DialogueNode::addResponse(
     const std::string& text, TANode* target,
-    std::function<bool(const GameContext&)> requirement,
-    std::function<void(GameContext*)> effect)
+    GameCondition requirement,
+    GameEffect effect)
 {
     responses.push_back(DialogueResponse(text, target, requirement, effect));
 }
@@ -3,6 +3,7 @@
 #include "../../core/TAAction.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "../../data/GameScript.hpp"
 
 
 #include <functional>
@@ -24,15 +25,14 @@ public:
     // Response options
     struct DialogueResponse {
         std::string text;
-        std::function<bool(const GameContext&)> requirement;
+        GameCondition requirement;
         TANode* targetNode;
-        std::function<void(GameContext*)> effect;
+        GameEffect effect;
 
         DialogueResponse(
             const std::string& responseText, TANode* target,
-            std::function<bool(const GameContext&)> req =
-                [](const GameContext&) { return true; },
-            std::function<void(GameContext*)> eff = [](GameContext*) {});
+            GameCondition req = GameCondition(),
+            GameEffect eff = GameEffect());
     };
     std::vector<DialogueResponse> responses;
 
@@ -44,9 +44,8 @@ public:
 
     void addResponse(
         const std::string& text, TANode* target,
-        std::function<bool(const GameContext&)> requirement =
-            [](const GameContext&) { return true; },
-        std::function<void(GameContext*)> effect = [](GameContext*) {});
+        GameCondition requirement = GameCondition(),
+        GameEffect effect = GameEffect());
 
     void onEnter(GameContext* context) override;
 
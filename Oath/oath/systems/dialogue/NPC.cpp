@@ -33,9 +33,7 @@ bool NPC::processResponse(int responseIndex, GameContext* context)
         }
 
         // Execute effect
-        if (response.effect) {
-            response.effect(context);
-        }
+        response.effect(context);
 
         // Move to next dialogue node
         currentDialogue = dynamic_cast<DialogueNode*>(response.targetNode);
@@ -0,0 +1,318 @@
+// systems/economy/AssetLedger.cpp
+
+#include "AssetLedger.hpp"
+
+#include <algorithm>
+
+namespace {
+constexpr int UPKEEP_INTERVAL_DAYS = 7;
+}
+
+AssetLedger::AssetLedger()
+    : currentDay(0)
+    , rng(std::random_device {}())
+{
+}
+
+uint32_t AssetLedger::addProperty(const Property& property, uint32_t owner, uint32_t sourceIndex, int daysSinceUpkeep)
+{
+    uint32_t asset = static_cast<uint32_t>(propertyOwner.size());
+    propertyOwner.push_back(owner);
+    propertySource.push_back(sourceIndex);
+    propertyDailyIncome.push_back(property.weeklyIncome / 7);
+    propertyWeeklyUpkeep.push_back(property.weeklyUpkeep);
+    propertyDaysSinceUpkeep.push_back(daysSinceUpkeep);
+    propertyGeneration.push_back(property.generation);
+
+    for (size_t t = 0; t < property.tenants.size(); t++) {
+        const auto& tenant = property.tenants[t];
+        tenantProperty.push_back(asset);
+        tenantSource.push_back(static_cast<uint32_t>(t));
+        tenantRent.push_back(tenant.rentAmount);
+        tenantDaysSincePayment.push_back(tenant.daysSinceLastPayment);
+        tenantInterval.push_back(std::max(1, tenant.paymentInterval));
+        tenantReliability.push_back(std::clamp(tenant.reliability, 0.0f, 1.0f));
+    }
+
+    if (owner >= ownerBalance.size()) {
+        ownerBalance.resize(owner + 1, 0);
+        ownerAccrued.resize(owner + 1, 0);
+    }
+    return asset;
+}
+
+uint32_t AssetLedger::addInvestment(const BusinessInvestment& investment, uint32_t owner, uint32_t sourceIndex)
+{
+    uint32_t asset = static_cast<uint32_t>(investmentOwner.size());
+    investmentOwner.push_back(owner);
+    investmentSource.push_back(sourceIndex);
+    investmentAmount.push_back(investment.playerInvestment);
+    investmentReturnRate.push_back(investment.returnRate);
+    investmentSensitivity.push_back(investment.marketSensitivity);
+    investmentRisk.push_back(investment.riskLevel);
+    investmentDaysSincePayout.push_back(investment.daysSinceLastPayout);
+    investmentInterval.push_back(std::max(1, investment.payoutInterval));
+
+    if (owner >= ownerBalance.size()) {
+        ownerBalance.resize(owner + 1, 0);
+        ownerAccrued.resize(owner + 1, 0);
+    }
+    return asset;
+}
+
+void AssetLedger::clearAssets()
+{
+    propertyOwner.clear();
+    propertySource.clear();
+    propertyDailyIncome.clear();
+    propertyWeeklyUpkeep.clear();
+    propertyDaysSinceUpkeep.clear();
+    propertyGeneration.clear();
+
+    tenantProperty.clear();
+    tenantSource.clear();
+    tenantRent.clear();
+    tenantDaysSincePayment.clear();
+    tenantInterval.clear();
+    tenantReliability.clear();
+
+    investmentOwner.clear();
+    investmentSource.clear();
+    investmentAmount.clear();
+    investmentReturnRate.clear();
+    investmentSensitivity.clear();
+    investmentRisk.clear();
+    investmentDaysSincePayout.clear();
+    investmentInterval.clear();
+}
+
+void AssetLedger::setSeed(unsigned int seed)
+{
+    rng.seed(seed);
+}
+
+void AssetLedger::settleDay(float marketMultiplier)
+{
+    currentDay++;
+
+    // Property income (logged once per owner) and weekly upkeep
+    for (uint32_t p = 0; p < propertyOwner.size(); p++) {
+        ownerAccrued[propertyOwner[p]] += propertyDailyIncome[p];
+
+        if (++propertyDaysSinceUpkeep[p] >= UPKEEP_INTERVAL_DAYS) {
+            propertyDaysSinceUpkeep[p] = 0;
+            if (propertyWeeklyUpkeep[p] > 0) {
+                record(propertyOwner[p], p, NO_TENANT, LedgerEntryType::UPKEEP, -propertyWeeklyUpkeep[p], 1);
+            }
+        }
+    }
+    recordAccruedIncome(1);
+
+    // Tenant rent rolls; only tenants whose payment is due draw a random number
+    std::uniform_real_distribution<float> roll(0.0f, 1.0f);
+    for (uint32_t t = 0; t < tenantProperty.size(); t++) {
+        if (++tenantDaysSincePayment[t] < tenantInterval[t]) {
+            continue;
+        }
+        tenantDaysSincePayment[t] = 0;
+
+        uint32_t property = tenantProperty[t];
+        if (roll(rng) <= tenantReliability[t]) {
+            record(propertyOwner[property], property, t, LedgerEntryType::RENT_PAID, tenantRent[t], 1);
+        } else {
+            record(propertyOwner[property], property, t, LedgerEntryType::RENT_MISSED, 0, 1);
+        }
+    }
+
+    // Investment payouts, matching BusinessInvestment::calculateActualProfit
+    for (uint32_t i = 0; i < investmentOwner.size(); i++) {
+        if (++investmentDaysSincePayout[i] < investmentInterval[i]) {
+            continue;
+        }
+        investmentDaysSincePayout[i] = 0;
+
+        int profit = (int)(expectedProfit(i, marketMultiplier) * drawProfitFactor(i));
+        record(investmentOwner[i], i, NO_TENANT, LedgerEntryType::INVESTMENT_PROFIT, profit, 1);
+    }
+}
+
+void AssetLedger::fastForward(int days, float marketMultiplier)
+{
+    if (days <= 0) {
+        return;
+    }
+    if (days == 1) {
+        settleDay(marketMultiplier);
+        return;
+    }
+
+    currentDay += days;
+
+    // Income accrues linearly; upkeep is due once per completed week
+    for (uint32_t p = 0; p < propertyOwner.size(); p++) {
+        ownerAccrued[propertyOwner[p]] += (int64_t)propertyDailyIncome[p] * days;
+
+        int elapsed = propertyDaysSinceUpkeep[p] + days;
+        int upkeepCount = elapsed / UPKEEP_INTERVAL_DAYS;
+        propertyDaysSinceUpkeep[p] = elapsed % UPKEEP_INTERVAL_DAYS;
+        if (upkeepCount > 0 && propertyWeeklyUpkeep[p] > 0) {
+            record(propertyOwner[p], p, NO_TENANT, LedgerEntryType::UPKEEP, -propertyWeeklyUpkeep[p] * upkeepCount, upkeepCount);
+        }
+    }
+    recordAccruedIncome(days);
+
+    // The number of on-time payments over n due dates is Binomial(n, reliability)
+    for (uint32_t t = 0; t < tenantProperty.size(); t++) {
+        int elapsed = tenantDaysSincePayment[t] + days;
+        int due = elapsed / tenantInterval[t];
+        tenantDaysSincePayment[t] = elapsed % tenantInterval[t];
+        if (due == 0) {
+            continue;
+        }
+
+        std::binomial_distribution<int> payments(due, tenantReliability[t]);
+        int paid = payments(rng);
+        uint32_t property = tenantProperty[t];
+        if (paid > 0) {
+            record(propertyOwner[property], property, t, LedgerEntryType::RENT_PAID, tenantRent[t] * paid, paid);
+        }
+        if (due > paid) {
+            record(propertyOwner[property], property, t, LedgerEntryType::RENT_MISSED, 0, due - paid);
+        }
+    }
+
+    // Each payout keeps its own clamped random factor, summed into one record
+    for (uint32_t i = 0; i < investmentOwner.size(); i++) {
+        int elapsed = investmentDaysSincePayout[i] + days;
+        int payouts = elapsed / investmentInterval[i];
+        investmentDaysSincePayout[i] = elapsed % investmentInterval[i];
+        if (payouts == 0) {
+            continue;
+        }
+
+        int expected = expectedProfit(i, marketMultiplier);
+        int profit = 0;
+        for (int n = 0; n < payouts; n++) {
+            profit += (int)(expected * drawProfitFactor(i));
+        }
+        record(investmentOwner[i], i, NO_TENANT, LedgerEntryType::INVESTMENT_PROFIT, profit, payouts);
+    }
+}
+
+bool AssetLedger::isCurrent(uint32_t asset, const std::vector<Property>& properties) const
+{
+    uint32_t source = propertySource[asset];
+    return source < properties.size() && properties[source].generation == propertyGeneration[asset];
+}
+
+bool AssetLedger::isCurrent(const std::vector<Property>& properties) const
+{
+    for (uint32_t p = 0; p < propertyOwner.size(); p++) {
+        if (!isCurrent(p, properties)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssetLedger::storeCounters(std::vector<Property>& properties) const
+{
+    for (uint32_t t = 0; t < tenantProperty.size(); t++) {
+        if (!isCurrent(tenantProperty[t], properties)) {
+            continue;
+        }
+        Property& property = properties[propertySource[tenantProperty[t]]];
+        property.tenants[tenantSource[t]].daysSinceLastPayment = tenantDaysSincePayment[t];
+    }
+}
+
+void AssetLedger::storeCounters(std::vector<BusinessInvestment>& investments) const
+{
+    for (uint32_t i = 0; i < investmentOwner.size(); i++) {
+        investments[investmentSource[i]].daysSinceLastPayout = investmentDaysSincePayout[i];
+    }
+}
+
+int64_t AssetLedger::collectBalance(uint32_t owner)
+{
+    if (owner >= ownerBalance.size()) {
+        return 0;
+    }
+    int64_t balance = ownerBalance[owner];
+    ownerBalance[owner] = 0;
+    return balance;
+}
+
+int64_t AssetLedger::upkeepDue(uint32_t owner, int days) const
+{
+    int64_t upkeep = 0;
+    for (uint32_t p = 0; p < propertyOwner.size(); p++) {
+        if (propertyOwner[p] == owner) {
+            upkeep += (int64_t)propertyWeeklyUpkeep[p] * ((propertyDaysSinceUpkeep[p] + days) / UPKEEP_INTERVAL_DAYS);
+        }
+    }
+    return upkeep;
+}
+
+const std::vector<LedgerTransaction>& AssetLedger::getTransactions() const
+{
+    return transactions;
+}
+
+void AssetLedger::clearTransactions()
+{
+    transactions.clear();
+}
+
+uint32_t AssetLedger::getPropertySource(uint32_t asset) const
+{
+    return propertySource[asset];
+}
+
+uint32_t AssetLedger::getInvestmentSource(uint32_t asset) const
+{
+    return investmentSource[asset];
+}
+
+uint32_t AssetLedger::getTenantSource(uint32_t tenant) const
+{
+    return tenantSource[tenant];
+}
+
+int AssetLedger::getCurrentDay() const
+{
+    return currentDay;
+}
+
+void AssetLedger::recordAccruedIncome(int count)
+{
+    for (uint32_t owner = 0; owner < ownerAccrued.size(); owner++) {
+        if (ownerAccrued[owner] > 0) {
+            record(owner, NO_ASSET, NO_TENANT, LedgerEntryType::PROPERTY_INCOME, static_cast<int>(ownerAccrued[owner]), count);
+        }
+        ownerAccrued[owner] = 0;
+    }
+}
+
+void AssetLedger::record(uint32_t owner, uint32_t asset, uint32_t tenant, LedgerEntryType type, int amount, int count)
+{
+    transactions.push_back({ currentDay, owner, asset, tenant, type, amount, count });
+    ownerBalance[owner] += amount;
+}
+
+int AssetLedger::expectedProfit(uint32_t investment, float marketMultiplier) const
+{
+    float effectiveRate = investmentReturnRate[investment] * (1.0f + (marketMultiplier - 1.0f) * investmentSensitivity[investment]);
+    return (int)(investmentAmount[investment] * effectiveRate);
+}
+
+float AssetLedger::drawProfitFactor(uint32_t investment)
+{
+    float spread = investmentRisk[investment] * 0.5f;
+    if (spread <= 0.0f) {
+        return 1.0f;
+    }
+
+    std::normal_distribution<float> variation(1.0f, spread);
+    return std::max(0.1f, variation(rng)); // Never lose more than 90%
+}
@@ -0,0 +1,119 @@
+// systems/economy/AssetLedger.hpp
+#pragma once
+
+#include "BusinessInvestment.hpp"
+#include "Property.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Kind of ledger transaction
+enum class LedgerEntryType : uint8_t {
+    PROPERTY_INCOME,
+    RENT_PAID,
+    RENT_MISSED,
+    UPKEEP,
+    INVESTMENT_PROFIT
+};
+
+// One ledger record. Fast-forwarded spans aggregate several events into a
+// single record; count says how many.
+struct LedgerTransaction {
+    int day;
+    uint32_t owner;
+    uint32_t asset; // Ledger property or investment slot, or NO_ASSET for per-owner totals
+    uint32_t tenant; // Ledger tenant slot, or NO_TENANT
+    LedgerEntryType type;
+    int amount; // Gold, positive for income and negative for costs
+    int count;
+};
+
+// Flat-array bookkeeping for properties, tenants and investments of any owner
+// (player or NPC landlords). One settlement pass covers every asset per day.
+class AssetLedger {
+public:
+    static constexpr uint32_t NO_ASSET = 0xFFFFFFFFu;
+    static constexpr uint32_t NO_TENANT = 0xFFFFFFFFu;
+    static constexpr uint32_t PLAYER_OWNER = 0;
+
+    AssetLedger();
+
+    // Register an asset; sourceIndex is the caller's own index (e.g. into PropertyNode::properties)
+    uint32_t addProperty(const Property& property, uint32_t owner, uint32_t sourceIndex, int daysSinceUpkeep = 0);
+    uint32_t addInvestment(const BusinessInvestment& investment, uint32_t owner, uint32_t sourceIndex);
+
+    // Drop all assets (the transaction log is kept)
+    void clearAssets();
+
+    void setSeed(unsigned int seed);
+
+    // Settle one day for every asset
+    void settleDay(float marketMultiplier);
+
+    // Settle a span of days in one pass using closed-form counts per asset
+    void fastForward(int days, float marketMultiplier);
+
+    // False once a registered property was changed (tenants, upkeep) or
+    // removed since it was added; the ledger then needs rebuilding
+    bool isCurrent(uint32_t asset, const std::vector<Property>& properties) const;
+    bool isCurrent(const std::vector<Property>& properties) const;
+
+    // Copy tenant and payout counters back into the source objects. Properties
+    // that are no longer current are skipped.
+    void storeCounters(std::vector<Property>& properties) const;
+    void storeCounters(std::vector<BusinessInvestment>& investments) const;
+
+    // Take an owner's accumulated balance, resetting it to zero
+    int64_t collectBalance(uint32_t owner);
+
+    // Upkeep the owner's properties will be charged over the next days
+    int64_t upkeepDue(uint32_t owner, int days) const;
+
+    // Records since the last clearTransactions, oldest first. The log only
+    // grows between reads, so whoever reports it clears it afterwards.
+    const std::vector<LedgerTransaction>& getTransactions() const;
+    void clearTransactions();
+    uint32_t getPropertySource(uint32_t asset) const;
+    uint32_t getInvestmentSource(uint32_t asset) const;
+    uint32_t getTenantSource(uint32_t tenant) const;
+    int getCurrentDay() const;
+
+private:
+    int currentDay;
+    std::mt19937 rng;
+    std::vector<LedgerTransaction> transactions;
+    std::vector<int64_t> ownerBalance;
+    std::vector<int64_t> ownerAccrued; // Property income of the current settlement, logged per owner
+
+    // Properties
+    std::vector<uint32_t> propertyOwner;
+    std::vector<uint32_t> propertySource;
+    std::vector<int> propertyDailyIncome;
+    std::vector<int> propertyWeeklyUpkeep;
+    std::vector<int> propertyDaysSinceUpkeep;
+    std::vector<unsigned int> propertyGeneration;
+
+    // Tenants
+    std::vector<uint32_t> tenantProperty;
+    std::vector<uint32_t> tenantSource;
+    std::vector<int> tenantRent;
+    std::vector<int> tenantDaysSincePayment;
+    std::vector<int> tenantInterval;
+    std::vector<float> tenantReliability;
+
+    // Investments
+    std::vector<uint32_t> investmentOwner;
+    std::vector<uint32_t> investmentSource;
+    std::vector<int> investmentAmount;
+    std::vector<float> investmentReturnRate;
+    std::vector<float> investmentSensitivity;
+    std::vector<float> investmentRisk;
+    std::vector<int> investmentDaysSincePayout;
+    std::vector<int> investmentInterval;
+
+    void recordAccruedIncome(int count);
+    void record(uint32_t owner, uint32_t asset, uint32_t tenant, LedgerEntryType type, int amount, int count);
+    int expectedProfit(uint32_t investment, float marketMultiplier) const;
+    float drawProfitFactor(uint32_t investment);
+};
@@ -1,7 +1,11 @@
 // systems/economy/EconomicSystemNode.cpp
 
 #include "EconomicSystemNode.hpp"
+#include "../../core/TAController.hpp"
+#include "../world/TimeNode.hpp"
+#include "InvestmentNode.hpp"
 #include "MarketNode.hpp"
+#include "PropertyNode.hpp"
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -72,9 +76,20 @@ void EconomicSystemNode::loadConfigFromJson()
             }
         }
 
+        if (configData.contains("priceHistory")) {
+            priceHistory.configure(PriceHistoryConfig::fromJson(configData["priceHistory"]));
+        }
+
+        // Populate NPC traders once markets and routes are known
+        traders.initialize(markets, &tradeRoutes);
+        if (configData.contains("traderPopulation")) {
+            traders.spawnFromJson(configData["traderPopulation"]);
+        }
+
         std::cout << "Loaded " << markets.size() << " markets, "
                   << tradeRoutes.size() << " trade routes, and "
-                  << potentialEvents.size() << " potential economic events from JSON." << std::endl;
+                  << potentialEvents.size() << " potential economic events and "
+                  << traders.getAgentCount() << " NPC traders from JSON." << std::endl;
 
     } catch (const std::exception& e) {
         std::cerr << "Error loading configuration from JSON: " << e.what() << std::endl;
@@ -169,6 +184,8 @@ Market* EconomicSystemNode::createMarket(const std::string& id, const std::strin
     // Add as child node
     addChild(marketNode);
 
+    traders.initialize(markets, &tradeRoutes);
+
     return market;
 }
 
@@ -187,6 +204,7 @@ void EconomicSystemNode::addTradeRoute(const std::string& id, const std::string&
     route.travelDays = std::max(1, (int)(distance / 20.0f)); // 20 distance units per day
 
     tradeRoutes.push_back(route);
+    traders.initialize(markets, &tradeRoutes);
 }
 
 void EconomicSystemNode::addPotentialEvent(const EconomicEvent& event)
@@ -215,40 +233,6 @@ void EconomicSystemNode::processTradeRoutes()
         if (route.checkDisruption(dist(gen))) {
             std::cout << "Trade route " << route.name << " has been disrupted!" << std::endl;
             route.isActive = false;
-            continue;
-        }
-
-        // For each traded good, adjust supply and demand
-        for (const auto& goodId : route.tradedGoods) {
-            TradeCommodity* sourceCommodity = sourceMarket->findCommodity(goodId);
-            TradeCommodity* destCommodity = destMarket->findCommodity(goodId);
-
-            if (sourceCommodity && destCommodity) {
-                // Source has surplus, destination has demand
-                if (sourceCommodity->supply > sourceCommodity->baseSupply && destCommodity->supply < destCommodity->baseSupply) {
-
-                    // Calculate amount to trade (limited by route capacity)
-                    int tradeAmount = std::min(
-                        sourceCommodity->supply - sourceCommodity->baseSupply,
-                        destCommodity->baseSupply - destCommodity->supply);
-
-                    tradeAmount = std::min(tradeAmount, 10); // Limit per day
-
-                    if (tradeAmount > 0) {
-                        // Transfer goods
-                        sourceCommodity->supply -= tradeAmount;
-                        destCommodity->supply += tradeAmount;
-
-                        // Update prices
-                        sourceCommodity->updatePrice();
-                        destCommodity->updatePrice();
-
-                        std::cout << tradeAmount << "x " << sourceCommodity->name
-                                  << " traded from " << sourceMarket->name
-                                  << " to " << destMarket->name << std::endl;
-                    }
-                }
-            }
         }
     }
 }
@@ -304,6 +288,9 @@ void EconomicSystemNode::simulateEconomicDay()
     // Process trade routes
     processTradeRoutes();
 
+    // NPC merchants and caravans trade; their flows move supply and demand
+    traders.tick();
+
     // Process economic events
     processEconomicEvents();
 
@@ -312,9 +299,40 @@ void EconomicSystemNode::simulateEconomicDay()
         market->advanceDay();
     }
 
+    // Record the day's closing prices
+    priceHistory.recordMarkets(markets);
+
     std::cout << "Simulated one economic day. Markets updated, trade processed, events checked." << std::endl;
 }
 
+void EconomicSystemNode::advanceDays(int days)
+{
+    // NPC traders and economic events act on each day's prices, so while any
+    // can act in the span the days run one at a time
+    bool eventsMayStart = !potentialEvents.empty() && daysSinceLastEvent + days >= 10;
+    if (days <= 1 || traders.getAgentCount() > 0 || !activeEvents.empty() || eventsMayStart) {
+        for (int i = 0; i < days; i++) {
+            simulateEconomicDay();
+        }
+        return;
+    }
+
+    // Otherwise the markets only drift on their own and each skips the span in
+    // one step. Route disruptions are still rolled for every day.
+    for (int i = 0; i < days; i++) {
+        processTradeRoutes();
+    }
+    daysSinceLastEvent += days;
+
+    std::vector<float> closingPrices;
+    for (auto* market : markets) {
+        market->fastForward(days, &closingPrices);
+        priceHistory.recordSpan(*market, closingPrices, days);
+    }
+
+    std::cout << "Simulated " << days << " economic days. Markets updated, trade processed." << std::endl;
+}
+
 void EconomicSystemNode::displayMarkets()
 {
     std::cout << "Available Markets:" << std::endl;
@@ -412,3 +430,102 @@ Market* EconomicSystemNode::findMarketById(const std::string& marketId)
     }
     return nullptr;
 }
+
+std::map<std::string, float> EconomicSystemNode::getRegionalOutput() const
+{
+    std::map<std::string, float> output;
+    for (const auto* market : markets) {
+        float weight = market->isPrimaryMarket ? 2.0f : 1.0f;
+        output[market->region] += market->wealthLevel * weight * globalEconomicMultiplier;
+    }
+    return output;
+}
+
+void EconomicSystemNode::serialize(std::ofstream& file) const
+{
+    TANode::serialize(file);
+    priceHistory.serialize(file);
+}
+
+bool EconomicSystemNode::deserialize(std::ifstream& file)
+{
+    if (!TANode::deserialize(file)) {
+        return false;
+    }
+    return priceHistory.deserialize(file);
+}
+
+// Integration functions
+void initializeEconomySystem(TAController& controller)
+{
+    EconomicSystemNode* economicSystem = controller.createNode<EconomicSystemNode>("EconomicSystem");
+    InvestmentNode* investmentSystem = controller.createNode<InvestmentNode>("InvestmentSystem", economicSystem);
+    PropertyNode* propertySystem = controller.createNode<PropertyNode>("PropertySystem");
+
+    // Connect the systems with transitions
+    economicSystem->addTransition(
+        [](const TAInput& input) {
+            return input.type == "economy_action" && std::get<std::string>(input.parameters.at("action")) == "to_investments";
+        },
+        investmentSystem, "Go to Investments");
+
+    economicSystem->addTransition(
+        [](const TAInput& input) {
+            return input.type == "economy_action" && std::get<std::string>(input.parameters.at("action")) == "to_properties";
+        },
+        propertySystem, "Go to Properties");
+
+    investmentSystem->addTransition(
+        [](const TAInput& input) {
+            return input.type == "investment_action" && std::get<std::string>(input.parameters.at("action")) == "exit";
+        },
+        economicSystem, "Exit");
+
+    propertySystem->addTransition(
+        [](const TAInput& input) {
+            return input.type == "property_action" && std::get<std::string>(input.parameters.at("action")) == "exit";
+        },
+        economicSystem, "Exit");
+
+    controller.setSystemRoot("EconomicSystem", economicSystem);
+    controller.setSystemRoot("InvestmentSystem", investmentSystem);
+    controller.setSystemRoot("PropertySystem", propertySystem);
+}
+
+void hookEconomyToTimeSystem(TAController& controller)
+{
+    auto findSystem = [&controller](const std::string& systemName) -> TANode* {
+        auto it = controller.systemRoots.find(systemName);
+        return it != controller.systemRoots.end() ? it->second : nullptr;
+    };
+
+    TimeNode* timeNode = dynamic_cast<TimeNode*>(findSystem("TimeSystem"));
+    if (!timeNode) {
+        return;
+    }
+
+    // Markets, trade routes and events share the markets and the global multiplier
+    // that investments read, so the two run with the serial subscribers, markets first
+    EconomicSystemNode* economicSystem = dynamic_cast<EconomicSystemNode*>(findSystem("EconomicSystem"));
+    if (economicSystem) {
+        timeNode->subscribe("EconomicSystem", TimeCadence::Day, [economicSystem](GameContext*, int days) {
+            economicSystem->advanceDays(days);
+        });
+    }
+
+    InvestmentNode* investmentSystem = dynamic_cast<InvestmentNode*>(findSystem("InvestmentSystem"));
+    if (investmentSystem) {
+        timeNode->subscribe("InvestmentSystem", TimeCadence::Day, [investmentSystem](GameContext* context, int days) {
+            investmentSystem->fastForward(days, context);
+        });
+    }
+
+    // Properties settle only their own ledger and gold and report on the next visit
+    PropertyNode* propertySystem = dynamic_cast<PropertyNode*>(findSystem("PropertySystem"));
+    if (propertySystem) {
+        timeNode->subscribe("PropertySystem", TimeCadence::Day, [propertySystem](GameContext*, int days) {
+            propertySystem->fastForward(days);
+        },
+            true);
+    }
+}
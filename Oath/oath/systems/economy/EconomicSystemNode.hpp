@@ -7,13 +7,19 @@
 #include "../../data/GameContext.hpp"
 #include "EconomicEvent.hpp"
 #include "Market.hpp"
+#include "PriceHistory.hpp"
 #include "TradeRoute.hpp"
+#include "TraderSimulation.hpp"
+#include <map>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <vector>
 
 using json = nlohmann::json;
 
+// Forward declaration
+class TAController;
+
 // Economic system manager node that controls all markets and trade
 class EconomicSystemNode : public TANode {
 public:
@@ -23,6 +29,8 @@ public:
     std::vector<EconomicEvent> potentialEvents;
     int daysSinceLastEvent;
     float globalEconomicMultiplier;
+    TraderSimulation traders; // NPC merchants and caravans trading through the markets
+    PriceHistory priceHistory; // Daily commodity prices per market
     json configData; // Store the loaded JSON configuration
 
     EconomicSystemNode(const std::string& name);
@@ -44,7 +52,7 @@ public:
     // Add a potential economic event
     void addPotentialEvent(const EconomicEvent& event);
 
-    // Process market supplies based on trade routes
+    // Roll trade route disruptions (goods are moved by caravans in the trader simulation)
     void processTradeRoutes();
 
     // Process economic events
@@ -53,9 +61,27 @@ public:
     // Simulate one economic day
     void simulateEconomicDay();
 
+    // Simulate several economic days, each recording its closing prices. With
+    // no NPC traders or events to act, markets skip the span in one step.
+    void advanceDays(int days);
+
+    // Economic output per region: market wealth, doubled for a region's primary market,
+    // scaled by the global multiplier. Feeds faction territory income.
+    std::map<std::string, float> getRegionalOutput() const;
+
+    // Save and load price history along with the node state
+    void serialize(std::ofstream& file) const override;
+    bool deserialize(std::ifstream& file) override;
+
 private:
     void displayMarkets();
     void displayTradeRoutes();
     void displayEconomicEvents();
     Market* findMarketById(const std::string& marketId);
-};
\ No newline at end of file
+};
+
+// Create the economy, investment and property nodes and register them with the controller
+void initializeEconomySystem(TAController& controller);
+
+// Run the economy, investments and properties as days pass in the time system
+void hookEconomyToTimeSystem(TAController& controller);
@@ -9,6 +9,7 @@
 InvestmentNode::InvestmentNode(const std::string& name, EconomicSystemNode* econSystem)
     : TANode(name)
     , economicSystem(econSystem)
+    , ledgerDirty(true)
 {
     // Load investments from JSON if available
     loadInvestmentsFromJson();
@@ -124,24 +125,25 @@ bool InvestmentNode::evaluateTransition(const TAInput& input, TANode*& outNextNo
 void InvestmentNode::addInvestmentOpportunity(const BusinessInvestment& investment)
 {
     investments.push_back(investment);
+    ledgerDirty = true;
 }
 
 void InvestmentNode::advanceDay(GameContext* context)
 {
-    if (!context)
-        return;
+    fastForward(1, context);
+}
 
-    int totalProfit = 0;
+void InvestmentNode::fastForward(int days, GameContext* context)
+{
+    if (!context || days <= 0)
+        return;
 
-    for (auto& investment : investments) {
-        int profit = 0;
+    syncLedger();
+    ledger.fastForward(days, economicSystem->globalEconomicMultiplier);
+    ledger.storeCounters(investments);
 
-        if (investment.advanceDay(economicSystem->globalEconomicMultiplier, profit)) {
-            std::cout << "Your investment in " << investment.name << " has generated "
-                      << profit << " gold in profits!" << std::endl;
-            totalProfit += profit;
-        }
-    }
+    int64_t totalProfit = ledger.collectBalance(AssetLedger::PLAYER_OWNER);
+    reportTransactions();
 
     if (totalProfit > 0) {
         // Add gold to player inventory in a real implementation
@@ -149,6 +151,36 @@ void InvestmentNode::advanceDay(GameContext* context)
     }
 }
 
+void InvestmentNode::syncLedger()
+{
+    if (!ledgerDirty)
+        return;
+
+    ledger.clearAssets();
+
+    for (size_t i = 0; i < investments.size(); i++) {
+        if (investments[i].isActive) {
+            ledger.addInvestment(investments[i], AssetLedger::PLAYER_OWNER, static_cast<uint32_t>(i));
+        }
+    }
+
+    ledgerDirty = false;
+}
+
+void InvestmentNode::reportTransactions()
+{
+    const auto& transactions = ledger.getTransactions();
+
+    for (size_t i = 0; i < transactions.size(); i++) {
+        const LedgerTransaction& tx = transactions[i];
+        if (tx.type == LedgerEntryType::INVESTMENT_PROFIT) {
+            std::cout << "Your investment in " << investments[ledger.getInvestmentSource(tx.asset)].name
+                      << " has generated " << tx.amount << " gold in profits!" << std::endl;
+        }
+    }
+    ledger.clearTransactions();
+}
+
 void InvestmentNode::displayInvestments()
 {
     bool hasInvestments = false;
@@ -215,6 +247,7 @@ void InvestmentNode::handleInvesting()
         if (!investment.isActive) {
             investment.isActive = true;
             investment.playerInvestment = investment.initialCost;
+            ledgerDirty = true;
             break;
         }
     }
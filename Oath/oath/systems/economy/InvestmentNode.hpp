@@ -5,6 +5,7 @@
 #include "../../core/TAInput.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "AssetLedger.hpp"
 #include "BusinessInvestment.hpp"
 #include <string>
 #include <vector>
@@ -18,6 +19,7 @@ class InvestmentNode : public TANode {
 public:
     std::vector<BusinessInvestment> investments;
     EconomicSystemNode* economicSystem;
+    AssetLedger ledger;
 
     InvestmentNode(const std::string& name, EconomicSystemNode* econSystem);
 
@@ -32,7 +34,14 @@ public:
     // Process a day passing for all investments
     void advanceDay(GameContext* context);
 
+    // Process several days at once
+    void fastForward(int days, GameContext* context);
+
 private:
+    bool ledgerDirty;
+
+    void syncLedger();
+    void reportTransactions();
     void displayInvestments();
     void displayOpportunities();
     void handleInvesting();
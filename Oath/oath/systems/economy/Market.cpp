@@ -6,6 +6,7 @@
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <unordered_map>
 
 Market* Market::fromJson(const json& j, const json& commoditiesData)
 {
@@ -49,81 +50,127 @@ Market::Market(const std::string& marketId, const std::string& marketName, Marke
     , daysSinceRestock(0)
     , relationToPlayer(0.0f)
     , haggleSkillLevel(50.0f)
+    , stateGeneration(0)
+    , cachedQuoteGeneration(~0u)
+    , cachedQuoteBarterSkill(0)
 {
 }
 
 int Market::calculateBuyPrice(const Item& item, int playerBarterSkill) const
 {
-    float basePriceMultiplier = 1.0f + taxRate;
+    return applyBuyFactors(computePriceFactors(playerBarterSkill), item);
+}
+
+int Market::calculateSellPrice(const Item& item, int playerBarterSkill) const
+{
+    return applySellFactors(computePriceFactors(playerBarterSkill), item, inventory.getQuantity(item.catalogIndex));
+}
+
+const std::vector<MarketQuote>& Market::quoteAll(int playerBarterSkill) const
+{
+    if (cachedQuoteGeneration != stateGeneration || cachedQuoteBarterSkill != playerBarterSkill) {
+        buildQuotes(inventory, playerBarterSkill, cachedQuotes);
+        cachedQuoteGeneration = stateGeneration;
+        cachedQuoteBarterSkill = playerBarterSkill;
+    }
+    return cachedQuotes;
+}
+
+std::vector<MarketQuote> Market::quoteInventory(const Inventory& items, int playerBarterSkill) const
+{
+    std::vector<MarketQuote> quotes;
+    buildQuotes(items, playerBarterSkill, quotes);
+    return quotes;
+}
 
-    // Relationship affects price (better relations = better prices)
-    float relationFactor = 1.0f - (relationToPlayer / 200.0f); // 0.5 at max relation, 1.5 at min
+void Market::markStateChanged()
+{
+    stateGeneration++;
+}
 
-    // Player haggling skill vs merchant skill
-    float haggleFactor = 1.0f - (playerBarterSkill / (playerBarterSkill + haggleSkillLevel));
+Market::PriceFactors Market::computePriceFactors(int playerBarterSkill) const
+{
+    PriceFactors factors;
+
+    // Buying: tax, relationship (0.5 at max relation, 1.5 at min) and haggling vs merchant skill
+    float buyBase = 1.0f + taxRate;
+    float buyRelation = 1.0f - (relationToPlayer / 200.0f);
+    float buyHaggle = 1.0f - (playerBarterSkill / (playerBarterSkill + haggleSkillLevel));
+    factors.buyMultiplier = buyBase * buyRelation * buyHaggle;
+
+    // Selling: merchants buy at 40% of value, +33% at max relation, plus haggling
+    float sellBase = 0.4f;
+    float sellRelation = 1.0f + (relationToPlayer / 300.0f);
+    float sellHaggle = 1.0f + (playerBarterSkill / (playerBarterSkill + haggleSkillLevel + 50.0f));
+    factors.sellMultiplier = sellBase * sellRelation * sellHaggle;
+
+    factors.specializationMask = getMarketSpecializationMask(type);
+    return factors;
+}
 
-    // Discounts for selling multiple of the same item
+int Market::applyBuyFactors(const PriceFactors& factors, const Item& item) const
+{
+    // Discounts for buying multiple of the same item
     float quantityDiscount = 1.0f - std::min(0.15f, (float)(item.quantity - 1) * 0.01f);
 
-    // Final price calculation
-    float finalMultiplier = basePriceMultiplier * relationFactor * haggleFactor * quantityDiscount;
+    float finalMultiplier = factors.buyMultiplier * quantityDiscount;
 
     // Apply market type specialization
-    if (isItemSpecializedForMarket(item)) {
+    if (factors.specializationMask & item.category()) {
         finalMultiplier *= 0.85f; // 15% discount at specialized shops
     }
 
-    int price = std::max(1, (int)(item.value * finalMultiplier));
-    return price;
+    return std::max(1, (int)(item.value * finalMultiplier));
 }
 
-int Market::calculateSellPrice(const Item& item, int playerBarterSkill) const
+int Market::applySellFactors(const PriceFactors& factors, const Item& item, int existingQuantity) const
 {
-    // Base price is lower when selling to merchants
-    float basePriceMultiplier = 0.4f; // Merchants buy at 40% of value generally
+    // Merchants pay less when they have many of an item
+    float supplyFactor = 1.0f - std::min(0.5f, (float)existingQuantity * 0.05f);
 
-    // Relationship affects price
-    float relationFactor = 1.0f + (relationToPlayer / 300.0f); // +33% at max relation
+    // They pay more for items they specialize in
+    float specializationFactor = (factors.specializationMask & item.category()) ? 1.2f : 1.0f;
 
-    // Player haggling skill
-    float haggleFactor = 1.0f + (playerBarterSkill / (playerBarterSkill + haggleSkillLevel + 50.0f));
+    float finalMultiplier = factors.sellMultiplier * supplyFactor * specializationFactor;
 
-    // Merchants pay less when they have many of an item
-    int existingQuantity = getExistingQuantity(item.id);
-    float supplyFactor = 1.0f - std::min(0.5f, (float)existingQuantity * 0.05f);
+    return std::max(1, (int)(item.value * finalMultiplier));
+}
 
-    // Apply market specialization - they pay more for items they specialize in
-    float specializationFactor = isItemSpecializedForMarket(item) ? 1.2f : 1.0f;
+void Market::buildQuotes(const Inventory& items, int playerBarterSkill, std::vector<MarketQuote>& outQuotes) const
+{
+    PriceFactors factors = computePriceFactors(playerBarterSkill);
 
-    // Final price
-    float finalMultiplier = basePriceMultiplier * relationFactor * haggleFactor * supplyFactor * specializationFactor;
+    // Index this market's stock once instead of scanning it per item
+    std::unordered_map<ItemIndex, int> stockQuantities;
+    stockQuantities.reserve(inventory.items.size());
+    for (const auto& stock : inventory.items) {
+        stockQuantities[stock.catalogIndex] += stock.quantity;
+    }
+
+    outQuotes.clear();
+    outQuotes.reserve(items.items.size());
+    for (const auto& item : items.items) {
+        auto stockIt = stockQuantities.find(item.catalogIndex);
+        int existingQuantity = stockIt != stockQuantities.end() ? stockIt->second : 0;
 
-    int price = std::max(1, (int)(item.value * finalMultiplier));
-    return price;
+        outQuotes.push_back({ item.catalogIndex,
+            item.quantity,
+            applyBuyFactors(factors, item),
+            applySellFactors(factors, item, existingQuantity) });
+    }
 }
 
 void Market::restock()
 {
     daysSinceRestock = 0;
+    markStateChanged();
 
-    // Remove a portion of existing inventory to simulate sales
-    removeRandomInventory(0.3f); // Remove 30% of inventory
-
-    // Generate new stock based on market type
-    generateStock();
+    // Sell off and replace part of the inventory
+    turnOverStock(1);
 
     // Update commodity prices
     for (auto& commodity : commodities) {
-        // Random supply/demand fluctuations
-        commodity.supply += randomInt(-5, 5);
-        commodity.demand += randomInt(-3, 3);
-
-        // Ensure minimums
-        commodity.supply = std::max(1, commodity.supply);
-        commodity.demand = std::max(1, commodity.demand);
-
-        // Update prices
-        commodity.updatePrice();
+        restockCommodity(commodity);
     }
 
     std::cout << "Market " << name << " has been restocked." << std::endl;
@@ -142,19 +189,100 @@ void Market::advanceDay()
     for (auto& commodity : commodities) {
         // Small random changes
         if (randomInt(1, 100) <= 20) { // 20% chance of change
-            commodity.supply += randomInt(-2, 2);
-            commodity.demand += randomInt(-1, 1);
+            fluctuateCommodity(commodity);
+        }
+    }
+}
+
+void Market::fastForward(int days, std::vector<float>* closingPrices)
+{
+    if (days <= 0)
+        return;
+
+    // Restocks land on fixed days: once daysSinceRestock reaches restockDays,
+    // then every restockDays after
+    int interval = std::max(1, restockDays);
+    std::vector<int> restockDaysInSpan;
+    for (int day = std::max(1, interval - daysSinceRestock); day <= days; day += interval) {
+        restockDaysInSpan.push_back(day);
+    }
+    daysSinceRestock = restockDaysInSpan.empty() ? daysSinceRestock + days : days - restockDaysInSpan.back();
 
-            // Ensure minimums
-            commodity.supply = std::max(1, commodity.supply);
-            commodity.demand = std::max(1, commodity.demand);
+    // Inventory turnover does not depend on commodities, so the restocks run back to back
+    turnOverStock(static_cast<int>(restockDaysInSpan.size()));
+    if (!restockDaysInSpan.empty()) {
+        markStateChanged();
+        std::cout << "Market " << name << " has been restocked " << restockDaysInSpan.size() << " times." << std::endl;
+    }
+
+    if (closingPrices) {
+        closingPrices->resize(commodities.size() * days);
+    }
+
+    // Each commodity steps from change to change in day order, restock first as
+    // in advanceDay. The gap to the next 20% daily change is geometric.
+    for (size_t c = 0; c < commodities.size(); c++) {
+        TradeCommodity& commodity = commodities[c];
+        float* prices = closingPrices ? closingPrices->data() + c * days : nullptr;
+        int closedDays = 0;
+        size_t nextRestock = 0;
+        int nextChange = 1 + randomGeometric(0.2f);
+
+        while (true) {
+            int restockDay = nextRestock < restockDaysInSpan.size() ? restockDaysInSpan[nextRestock] : days + 1;
+            int day = std::min(restockDay, nextChange);
+            if (day > days)
+                break;
+
+            // Days before this one closed at the current price
+            if (prices) {
+                std::fill(prices + closedDays, prices + day - 1, commodity.currentPrice);
+            }
+            closedDays = day - 1;
 
-            // Update price
-            commodity.updatePrice();
+            if (day == restockDay) {
+                restockCommodity(commodity);
+                nextRestock++;
+            }
+            if (day == nextChange) {
+                fluctuateCommodity(commodity);
+                nextChange += 1 + randomGeometric(0.2f);
+            }
+        }
+
+        if (prices) {
+            std::fill(prices + closedDays, prices + days, commodity.currentPrice);
         }
     }
 }
 
+void Market::fluctuateCommodity(TradeCommodity& commodity)
+{
+    commodity.supply += randomInt(-2, 2);
+    commodity.demand += randomInt(-1, 1);
+
+    // Ensure minimums
+    commodity.supply = std::max(1, commodity.supply);
+    commodity.demand = std::max(1, commodity.demand);
+
+    // Update price
+    commodity.updatePrice();
+}
+
+void Market::restockCommodity(TradeCommodity& commodity)
+{
+    // Random supply/demand fluctuations
+    commodity.supply += randomInt(-5, 5);
+    commodity.demand += randomInt(-3, 3);
+
+    // Ensure minimums
+    commodity.supply = std::max(1, commodity.supply);
+    commodity.demand = std::max(1, commodity.demand);
+
+    // Update prices
+    commodity.updatePrice();
+}
+
 void Market::addCommodity(const TradeCommodity& commodity)
 {
     commodities.push_back(commodity);
@@ -218,47 +346,13 @@ float Market::getRelationToPlayer() const
 void Market::improveRelation(float amount)
 {
     relationToPlayer = std::min(100.0f, relationToPlayer + amount);
+    markStateChanged();
 }
 
 void Market::worsenRelation(float amount)
 {
     relationToPlayer = std::max(-100.0f, relationToPlayer - amount);
-}
-
-bool Market::isItemSpecializedForMarket(const Item& item) const
-{
-    switch (type) {
-    case MarketType::BLACKSMITH:
-        return item.type == "weapon" || item.type == "armor" || item.type == "metal";
-    case MarketType::ALCHEMIST:
-        return item.type == "potion" || item.type == "herb" || item.type == "ingredient";
-    case MarketType::CLOTHIER:
-        return item.type == "clothing" || item.type == "fabric";
-    case MarketType::JEWELER:
-        return item.type == "jewelry" || item.type == "gem";
-    case MarketType::BOOKSTORE:
-        return item.type == "book" || item.type == "scroll";
-    case MarketType::MAGIC_SUPPLIES:
-        return item.type == "magic" || item.type == "soul_gem" || item.type == "staff";
-    case MarketType::FOOD:
-        return item.type == "food" || item.type == "ingredient";
-    case MarketType::TAVERN:
-        return item.type == "food" || item.type == "drink";
-    case MarketType::GENERAL:
-        return true; // General stores buy/sell everything but at standard rates
-    default:
-        return false;
-    }
-}
-
-int Market::getExistingQuantity(const std::string& itemId) const
-{
-    for (const auto& item : inventory.items) {
-        if (item.id == itemId) {
-            return item.quantity;
-        }
-    }
-    return 0;
+    markStateChanged();
 }
 
 void Market::removeRandomInventory(float portion)
@@ -275,7 +369,42 @@ void Market::removeRandomInventory(float portion)
     inventory.items = remainingItems;
 }
 
-void Market::generateStock()
+void Market::turnOverStock(int restocks)
+{
+    if (restocks <= 0)
+        return;
+
+    // The stock data is read once for all the restocks
+    json marketData = loadStockData();
+    for (int r = 0; r < restocks; r++) {
+        // Remove a portion of existing inventory to simulate sales
+        removeRandomInventory(0.3f); // Remove 30% of inventory
+
+        // Generate new stock based on market type
+        generateStock(marketData);
+    }
+}
+
+json Market::loadStockData() const
+{
+    // Load the item data from JSON
+    std::ifstream file("resources/json/economy.json");
+    if (!file.is_open()) {
+        std::cerr << "Failed to open economy.json" << std::endl;
+        return json();
+    }
+
+    json marketData;
+    try {
+        file >> marketData;
+    } catch (const std::exception& e) {
+        std::cerr << "Error parsing JSON: " << e.what() << std::endl;
+        return json();
+    }
+    return marketData;
+}
+
+void Market::generateStock(const json& marketData)
 {
     // Get market type string for JSON access
     std::string marketTypeStr;
@@ -310,21 +439,6 @@ void Market::generateStock()
         break;
     }
 
-    // Load the item data from JSON
-    std::ifstream file("resources/json/economy.json");
-    if (!file.is_open()) {
-        std::cerr << "Failed to open economy.json" << std::endl;
-        return;
-    }
-
-    json marketData;
-    try {
-        file >> marketData;
-    } catch (const std::exception& e) {
-        std::cerr << "Error parsing JSON: " << e.what() << std::endl;
-        return;
-    }
-
     // Inventory size based on wealth and primary status
     int baseInventorySize = isPrimaryMarket ? 25 : 15;
     int inventorySize = (int)(baseInventorySize * wealthLevel);
@@ -357,9 +471,11 @@ void Market::addItemToInventory(const std::string& id, const std::string& name,
     if (quantity <= 0)
         return;
 
+    ItemIndex itemIndex = ItemCatalog::getInstance().intern(id, name, type, baseValue);
+
     // Check if we already have this item
     for (auto& item : inventory.items) {
-        if (item.id == id) {
+        if (item.catalogIndex == itemIndex) {
             item.quantity += quantity;
             return;
         }
@@ -369,30 +485,29 @@ void Market::addItemToInventory(const std::string& id, const std::string& name,
     int adjustedValue = (int)(baseValue * (0.8f + (wealthLevel * 0.4f)));
 
     // Create and add the item
-    Item item(id, name, type, adjustedValue, quantity);
+    Item item(itemIndex, adjustedValue, quantity);
 
     // Add some random properties based on item type
-    if (type == "weapon") {
-        item.properties["damage"] = 10 + randomInt(0, 5);
+    ItemCategory category = item.category();
+    if (category == ITEM_CATEGORY_WEAPON) {
+        item.setProperty("damage", 10 + randomInt(0, 5));
         if (randomInt(1, 100) <= 10) { // 10% chance for special property
-            item.properties["enchanted"] = true;
-            item.properties["enchantment"] = "fire";
-            item.properties["enchantment_power"] = 5;
+            item.setProperty("enchanted", true);
+            item.setProperty("enchantment", std::string("fire"));
+            item.setProperty("enchantment_power", 5);
             item.value = (int)(item.value * 2.5f);
         }
-    } else if (type == "armor") {
-        item.properties["defense"] = 5 + randomInt(0, 3);
+    } else if (category == ITEM_CATEGORY_ARMOR) {
+        item.setProperty("defense", 5 + randomInt(0, 3));
         if (randomInt(1, 100) <= 10) { // 10% chance for special property
-            // systems/economy/Market.cpp (continued)
-
-            item.properties["enchanted"] = true;
-            item.properties["enchantment"] = "protection";
-            item.properties["enchantment_power"] = 5;
+            item.setProperty("enchanted", true);
+            item.setProperty("enchantment", std::string("protection"));
+            item.setProperty("enchantment_power", 5);
             item.value = (int)(item.value * 2.5f);
         }
-    } else if (type == "potion") {
-        item.properties["potency"] = 25 + randomInt(0, 15);
-        item.properties["duration"] = 30 + randomInt(0, 30);
+    } else if (category == ITEM_CATEGORY_POTION) {
+        item.setProperty("potency", 25 + randomInt(0, 15));
+        item.setProperty("duration", 30 + randomInt(0, 30));
     }
 
     inventory.addItem(item);
@@ -412,4 +527,12 @@ float Market::randomFloat(float min, float max) const
     static std::mt19937 gen(rd());
     std::uniform_real_distribution<float> dist(min, max);
     return dist(gen);
-}
\ No newline at end of file
+}
+
+int Market::randomGeometric(float probability) const
+{
+    static std::random_device rd;
+    static std::mt19937 gen(rd());
+    std::geometric_distribution<> dist(probability);
+    return dist(gen);
+}
@@ -15,6 +15,14 @@
 
 using json = nlohmann::json;
 
+// Buy and sell price of one inventory stack at a market
+struct MarketQuote {
+    ItemIndex itemIndex;
+    int quantity;
+    int buyPrice; // What the player pays
+    int sellPrice; // What the merchant pays the player
+};
+
 // Market representing a shop or trading post
 class Market {
 public:
@@ -35,6 +43,7 @@ public:
     std::string ownerName;
     float relationToPlayer; // -100 to 100, affects prices
     float haggleSkillLevel; // Resistance to player's persuasion (0-100)
+    unsigned int stateGeneration; // Bumped whenever stock, relation or tax changes prices
 
     // Constructor from JSON
     static Market* fromJson(const json& j, const json& commoditiesData);
@@ -48,12 +57,28 @@ public:
     // Calculate sell price (what merchant pays player)
     int calculateSellPrice(const Item& item, int playerBarterSkill) const;
 
+    // Quote every stack in this market's inventory in one pass. The result is
+    // cached until stateGeneration or the barter skill changes.
+    const std::vector<MarketQuote>& quoteAll(int playerBarterSkill) const;
+
+    // Quote another inventory (e.g. the player's) against this market
+    std::vector<MarketQuote> quoteInventory(const Inventory& items, int playerBarterSkill) const;
+
+    // Invalidate cached quotes after editing inventory, relation or tax directly
+    void markStateChanged();
+
     // Restock inventory based on market type and wealth
     void restock();
 
     // Process a day passing
     void advanceDay();
 
+    // Process several days in one step, with the same odds as that many
+    // advanceDay calls: restocks land on their days and each commodity only
+    // draws the days it changes. When closingPrices is given it receives each
+    // day's closing price, commodity by commodity (commodities x days).
+    void fastForward(int days, std::vector<float>* closingPrices = nullptr);
+
     // Add a commodity to this market
     void addCommodity(const TradeCommodity& commodity);
 
@@ -76,17 +101,33 @@ public:
     void worsenRelation(float amount);
 
 private:
-    // Helper to check if an item is specialized for this market type
-    bool isItemSpecializedForMarket(const Item& item) const;
-
-    // Get quantity of an item already in inventory
-    int getExistingQuantity(const std::string& itemId) const;
+    // Per-market price multipliers shared by every item for a given barter skill
+    struct PriceFactors {
+        float buyMultiplier;
+        float sellMultiplier;
+        ItemCategoryMask specializationMask;
+    };
+
+    mutable std::vector<MarketQuote> cachedQuotes;
+    mutable unsigned int cachedQuoteGeneration;
+    mutable int cachedQuoteBarterSkill;
+
+    PriceFactors computePriceFactors(int playerBarterSkill) const;
+    int applyBuyFactors(const PriceFactors& factors, const Item& item) const;
+    int applySellFactors(const PriceFactors& factors, const Item& item, int existingQuantity) const;
+    void buildQuotes(const Inventory& items, int playerBarterSkill, std::vector<MarketQuote>& outQuotes) const;
 
     // Remove a portion of inventory randomly
     void removeRandomInventory(float portion);
 
+    // Remove and regenerate stock for a number of restocks in a row
+    void turnOverStock(int restocks);
+
+    // Read the stock table, or null if it cannot be loaded
+    json loadStockData() const;
+
     // Generate new stock based on market type
-    void generateStock();
+    void generateStock(const json& marketData);
 
     // Add an item to inventory with random properties based on quality
     void addItemToInventory(const std::string& id, const std::string& name, const std::string& type, int baseValue, int quantity);
@@ -94,4 +135,11 @@ private:
     // Random number helpers
     int randomInt(int min, int max) const;
     float randomFloat(float min, float max) const;
+    int randomGeometric(float probability) const;
+
+    // One daily supply/demand fluctuation of a commodity
+    void fluctuateCommodity(TradeCommodity& commodity);
+
+    // A restock's supply/demand shift of a commodity
+    void restockCommodity(TradeCommodity& commodity);
 };
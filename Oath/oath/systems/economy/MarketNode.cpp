@@ -142,12 +142,12 @@ void MarketNode::displayBuyOptions()
     std::cout << std::left << std::setw(30) << "Item" << std::setw(10) << "Price" << std::setw(10) << "Quantity" << std::endl;
     std::cout << "------------------------------------------" << std::endl;
 
-    // Show merchant inventory
-    for (size_t i = 0; i < market->inventory.items.size(); i++) {
-        const auto& item = market->inventory.items[i];
-        std::cout << std::left << std::setw(30) << item.name
-                  << std::setw(10) << market->calculateBuyPrice(item, 50) // Assuming barter skill of 50
-                  << std::setw(10) << item.quantity << std::endl;
+    // Show merchant inventory, priced in one batch
+    const auto& quotes = market->quoteAll(50); // Assuming barter skill of 50
+    for (const auto& quote : quotes) {
+        std::cout << std::left << std::setw(30) << ItemCatalog::getInstance().get(quote.itemIndex).name
+                  << std::setw(10) << quote.buyPrice
+                  << std::setw(10) << quote.quantity << std::endl;
     }
 
     std::cout << "\nTo buy an item, use the 'buy [item_name] [quantity]' command." << std::endl;
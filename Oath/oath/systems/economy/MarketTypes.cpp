@@ -51,4 +51,30 @@ const std::string marketTypeToString(MarketType type)
     default:
         return "Unknown";
     }
-}
\ No newline at end of file
+}
+
+ItemCategoryMask getMarketSpecializationMask(MarketType type)
+{
+    switch (type) {
+    case MarketType::BLACKSMITH:
+        return ITEM_CATEGORY_WEAPON | ITEM_CATEGORY_ARMOR | ITEM_CATEGORY_METAL;
+    case MarketType::ALCHEMIST:
+        return ITEM_CATEGORY_POTION | ITEM_CATEGORY_HERB | ITEM_CATEGORY_INGREDIENT;
+    case MarketType::CLOTHIER:
+        return ITEM_CATEGORY_CLOTHING | ITEM_CATEGORY_FABRIC;
+    case MarketType::JEWELER:
+        return ITEM_CATEGORY_JEWELRY | ITEM_CATEGORY_GEM;
+    case MarketType::BOOKSTORE:
+        return ITEM_CATEGORY_BOOK | ITEM_CATEGORY_SCROLL;
+    case MarketType::MAGIC_SUPPLIES:
+        return ITEM_CATEGORY_MAGIC | ITEM_CATEGORY_SOUL_GEM | ITEM_CATEGORY_STAFF;
+    case MarketType::FOOD:
+        return ITEM_CATEGORY_FOOD | ITEM_CATEGORY_INGREDIENT;
+    case MarketType::TAVERN:
+        return ITEM_CATEGORY_FOOD | ITEM_CATEGORY_DRINK;
+    case MarketType::GENERAL:
+        return ITEM_CATEGORY_ALL; // General stores buy/sell everything but at standard rates
+    default:
+        return ITEM_CATEGORY_NONE;
+    }
+}
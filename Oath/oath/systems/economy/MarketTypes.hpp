@@ -1,6 +1,8 @@
 // systems/economy/MarketTypes.hpp
 #pragma once
 
+#include "../../data/ItemCatalog.hpp"
+
 #include <string>
 
 // Market type enum
@@ -21,3 +23,6 @@ MarketType stringToMarketType(const std::string& typeStr);
 
 // String conversion for MarketType
 const std::string marketTypeToString(MarketType type);
+
+// Item categories a market type specializes in (GENERAL covers everything)
+ItemCategoryMask getMarketSpecializationMask(MarketType type);
@@ -0,0 +1,539 @@
+// systems/economy/PriceHistory.cpp
+
+#include "PriceHistory.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+constexpr int DAYS_PER_WEEK = 7;
+constexpr size_t MAX_SERIES_COUNT = 100000;
+constexpr size_t MAX_KEY_LENGTH = 1000;
+constexpr int MAX_VARINT_BYTES = 5; // 32 bits at 7 per byte
+
+int32_t toCents(float price)
+{
+    return static_cast<int32_t>(std::lround(price * 100.0f));
+}
+
+float fromCents(int64_t cents)
+{
+    return cents / 100.0f;
+}
+
+void pushRing(std::vector<PriceAggregate>& ring, size_t& head, size_t capacity, const PriceAggregate& aggregate)
+{
+    if (capacity == 0) {
+        return;
+    }
+    if (ring.size() < capacity) {
+        ring.push_back(aggregate);
+    } else {
+        ring[head] = aggregate;
+        head = (head + 1) % capacity;
+    }
+}
+
+std::vector<PriceAggregate> unrollRing(const std::vector<PriceAggregate>& ring, size_t head)
+{
+    std::vector<PriceAggregate> result;
+    result.reserve(ring.size());
+    for (size_t i = 0; i < ring.size(); i++) {
+        result.push_back(ring[(head + i) % ring.size()]);
+    }
+    return result;
+}
+
+template <typename T>
+void writeValue(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readValue(std::ifstream& file, T& value)
+{
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+}
+
+PriceHistoryConfig PriceHistoryConfig::fromJson(const json& j)
+{
+    PriceHistoryConfig config;
+    config.dailyCapacity = std::max(1, j.value("dailyDays", config.dailyCapacity));
+    config.weeklyCapacity = std::max(0, j.value("weeklyWeeks", config.weeklyCapacity));
+    config.seasonalCapacity = std::max(0, j.value("seasons", config.seasonalCapacity));
+    config.daysPerSeason = std::max(1, j.value("daysPerSeason", config.daysPerSeason));
+
+    if (j.contains("statWindows") && j["statWindows"].is_array()) {
+        config.statWindows.clear();
+        for (const auto& window : j["statWindows"]) {
+            config.statWindows.push_back(window.get<int>());
+        }
+    }
+    return config;
+}
+
+PriceSeries::PriceSeries(const PriceHistoryConfig& config)
+    : dailyCapacity(config.dailyCapacity)
+    , weeklyCapacity(config.weeklyCapacity)
+    , seasonalCapacity(config.seasonalCapacity)
+    , daysPerSeason(config.daysPerSeason)
+    , totalDays(0)
+    , retainedDays(0)
+    , anchorCents(0)
+    , lastCents(0)
+    , deltaHead(0)
+    , weeklyHead(0)
+    , seasonalHead(0)
+{
+    for (int length : config.statWindows) {
+        // A window can't reach back past the daily buffer
+        if (length > 0 && length <= dailyCapacity) {
+            StatWindow window {};
+            window.length = length;
+            windows.push_back(window);
+        }
+    }
+
+    openWeek = { INT32_MAX, INT32_MIN, 0, 0 };
+    openSeason = { INT32_MAX, INT32_MIN, 0, 0 };
+}
+
+void PriceSeries::record(float price)
+{
+    int32_t cents = toCents(price);
+
+    if (retainedDays == 0) {
+        anchorCents = cents;
+    } else {
+        appendDelta(cents - lastCents);
+    }
+    lastCents = cents;
+    retainedDays++;
+    totalDays++;
+
+    uint32_t day = static_cast<uint32_t>(totalDays - 1);
+    for (auto& window : windows) {
+        pushWindow(window, cents, day, deltaStream.size());
+    }
+
+    // Evict the oldest day once the daily buffer is full
+    if (retainedDays > dailyCapacity) {
+        anchorCents += readDelta(deltaHead);
+        retainedDays--;
+        compactStream();
+    }
+
+    // Roll up weekly and seasonal aggregates
+    for (Accumulator* acc : { &openWeek, &openSeason }) {
+        acc->minCents = std::min(acc->minCents, cents);
+        acc->maxCents = std::max(acc->maxCents, cents);
+        acc->sumCents += cents;
+        acc->days++;
+    }
+
+    if (openWeek.days == DAYS_PER_WEEK) {
+        pushRing(weekly, weeklyHead, weeklyCapacity,
+            { fromCents(openWeek.minCents), fromCents(openWeek.maxCents), fromCents(openWeek.sumCents) / openWeek.days, openWeek.days });
+        openWeek = { INT32_MAX, INT32_MIN, 0, 0 };
+    }
+
+    if (openSeason.days == daysPerSeason) {
+        pushRing(seasonal, seasonalHead, seasonalCapacity,
+            { fromCents(openSeason.minCents), fromCents(openSeason.maxCents), fromCents(openSeason.sumCents) / openSeason.days, openSeason.days });
+        openSeason = { INT32_MAX, INT32_MIN, 0, 0 };
+    }
+}
+
+PriceAggregate PriceSeries::lastDays(int days) const
+{
+    days = std::min(days, retainedDays);
+    if (days <= 0) {
+        return { 0.0f, 0.0f, 0.0f, 0 };
+    }
+
+    // Maintained windows answer directly
+    for (const auto& window : windows) {
+        if (window.filled == days) {
+            return { fromCents(window.minQueue.items[window.minQueue.head].second),
+                fromCents(window.maxQueue.items[window.maxQueue.head].second),
+                fromCents(window.sumCents) / days, days };
+        }
+    }
+
+    // Otherwise decode the tail of the daily buffer
+    int32_t cents = anchorCents;
+    size_t offset = deltaHead;
+    int32_t minCents = INT32_MAX;
+    int32_t maxCents = INT32_MIN;
+    int64_t sumCents = 0;
+
+    for (int i = 0; i < retainedDays; i++) {
+        if (i > 0) {
+            cents += readDelta(offset);
+        }
+        if (i >= retainedDays - days) {
+            minCents = std::min(minCents, cents);
+            maxCents = std::max(maxCents, cents);
+            sumCents += cents;
+        }
+    }
+
+    return { fromCents(minCents), fromCents(maxCents), fromCents(sumCents) / days, days };
+}
+
+std::vector<float> PriceSeries::getDailyPrices() const
+{
+    std::vector<float> prices;
+    prices.reserve(retainedDays);
+
+    int32_t cents = anchorCents;
+    size_t offset = deltaHead;
+    for (int i = 0; i < retainedDays; i++) {
+        if (i > 0) {
+            cents += readDelta(offset);
+        }
+        prices.push_back(fromCents(cents));
+    }
+    return prices;
+}
+
+std::vector<PriceAggregate> PriceSeries::getWeekly() const
+{
+    return unrollRing(weekly, weeklyHead);
+}
+
+std::vector<PriceAggregate> PriceSeries::getSeasonal() const
+{
+    return unrollRing(seasonal, seasonalHead);
+}
+
+int PriceSeries::getRecordedDays() const
+{
+    return totalDays;
+}
+
+size_t PriceSeries::getMemoryBytes() const
+{
+    size_t bytes = sizeof(*this);
+    bytes += deltaStream.capacity();
+    bytes += windows.capacity() * sizeof(StatWindow);
+    for (const auto& window : windows) {
+        bytes += (window.minQueue.items.capacity() + window.maxQueue.items.capacity()) * sizeof(std::pair<uint32_t, int32_t>);
+    }
+    bytes += (weekly.capacity() + seasonal.capacity()) * sizeof(PriceAggregate);
+    return bytes;
+}
+
+void PriceSeries::serialize(std::ofstream& file) const
+{
+    writeValue(file, totalDays);
+    writeValue(file, retainedDays);
+    writeValue(file, anchorCents);
+    writeValue(file, lastCents);
+
+    // Daily buffer, still compressed
+    size_t streamLength = deltaStream.size() - deltaHead;
+    writeValue(file, streamLength);
+    file.write(reinterpret_cast<const char*>(deltaStream.data() + deltaHead), streamLength);
+
+    writeValue(file, openWeek);
+    writeValue(file, openSeason);
+
+    for (const auto* ring : { &weekly, &seasonal }) {
+        std::vector<PriceAggregate> ordered = unrollRing(*ring, ring == &weekly ? weeklyHead : seasonalHead);
+        size_t count = ordered.size();
+        writeValue(file, count);
+        file.write(reinterpret_cast<const char*>(ordered.data()), count * sizeof(PriceAggregate));
+    }
+}
+
+bool PriceSeries::deserialize(std::ifstream& file)
+{
+    size_t streamLength;
+    if (!readValue(file, totalDays) || !readValue(file, retainedDays)
+        || !readValue(file, anchorCents) || !readValue(file, lastCents)
+        || !readValue(file, streamLength)) {
+        std::cerr << "Failed to read price series header" << std::endl;
+        return false;
+    }
+
+    // Each retained day after the first takes one to five bytes
+    if (retainedDays < 0 || totalDays < retainedDays || streamLength > static_cast<size_t>(retainedDays) * 5) {
+        std::cerr << "Invalid price series length: " << retainedDays << " days" << std::endl;
+        return false;
+    }
+
+    deltaStream.resize(streamLength);
+    deltaHead = 0;
+    if (!file.read(reinterpret_cast<char*>(deltaStream.data()), streamLength)) {
+        std::cerr << "Failed to read price series data" << std::endl;
+        return false;
+    }
+
+    // The stream must hold exactly one delta of at most five bytes per
+    // retained day after the first
+    size_t offset = 0;
+    bool overlong = false;
+    for (int i = 1; i < retainedDays; i++) {
+        size_t start = offset;
+        while (offset < streamLength && (deltaStream[offset] & 0x80)) {
+            offset++;
+        }
+        offset++;
+        overlong |= offset - start > static_cast<size_t>(MAX_VARINT_BYTES);
+    }
+    if (retainedDays > 0 && (offset != streamLength || overlong)) {
+        std::cerr << "Corrupt price series data" << std::endl;
+        return false;
+    }
+
+    if (!readValue(file, openWeek) || !readValue(file, openSeason)) {
+        std::cerr << "Failed to read price series aggregates" << std::endl;
+        return false;
+    }
+
+    for (auto* ring : { &weekly, &seasonal }) {
+        size_t count;
+        if (!readValue(file, count) || count > 100000) {
+            std::cerr << "Invalid price aggregate count" << std::endl;
+            return false;
+        }
+
+        std::vector<PriceAggregate> ordered(count);
+        if (!file.read(reinterpret_cast<char*>(ordered.data()), count * sizeof(PriceAggregate))) {
+            std::cerr << "Failed to read price aggregates" << std::endl;
+            return false;
+        }
+
+        size_t& head = ring == &weekly ? weeklyHead : seasonalHead;
+        size_t capacity = static_cast<size_t>(ring == &weekly ? weeklyCapacity : seasonalCapacity);
+        ring->clear();
+        head = 0;
+        for (const auto& aggregate : ordered) {
+            pushRing(*ring, head, capacity, aggregate);
+        }
+    }
+
+    // Respect the current retention if it shrank since the save
+    while (retainedDays > dailyCapacity) {
+        anchorCents += readDelta(deltaHead);
+        retainedDays--;
+    }
+    compactStream();
+
+    resetWindows();
+    return true;
+}
+
+void PriceSeries::appendDelta(int32_t delta)
+{
+    // Zigzag so small negative moves stay short, then 7 bits per byte
+    uint32_t value = (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+    while (value >= 0x80) {
+        deltaStream.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    deltaStream.push_back(static_cast<uint8_t>(value));
+}
+
+int32_t PriceSeries::readDelta(size_t& offset) const
+{
+    uint32_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+        byte = deltaStream[offset++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        shift += 7;
+    } while ((byte & 0x80) && shift < 7 * MAX_VARINT_BYTES);
+
+    return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
+
+void PriceSeries::compactStream()
+{
+    // Drop evicted bytes once they are the larger part of the buffer
+    if (deltaHead < 64 || deltaHead * 2 < deltaStream.size()) {
+        return;
+    }
+
+    deltaStream.erase(deltaStream.begin(), deltaStream.begin() + deltaHead);
+    for (auto& window : windows) {
+        window.cursorOffset -= deltaHead;
+    }
+    deltaHead = 0;
+}
+
+void PriceSeries::pushWindow(StatWindow& window, int32_t cents, uint32_t day, size_t nextOffset)
+{
+    if (window.filled == 0) {
+        window.cursorCents = cents;
+        window.cursorOffset = nextOffset;
+    }
+
+    window.sumCents += cents;
+    window.filled++;
+
+    // The oldest price leaves; step the cursor one delta forward
+    if (window.filled > window.length) {
+        window.sumCents -= window.cursorCents;
+        window.cursorCents += readDelta(window.cursorOffset);
+        window.filled--;
+    }
+
+    uint32_t firstDay = day + 1 >= static_cast<uint32_t>(window.length) ? day + 1 - window.length : 0;
+
+    for (ExtremeQueue* queue : { &window.minQueue, &window.maxQueue }) {
+        bool isMin = queue == &window.minQueue;
+        auto& items = queue->items;
+
+        while (items.size() > queue->head && (isMin ? items.back().second >= cents : items.back().second <= cents)) {
+            items.pop_back();
+        }
+        items.push_back({ day, cents });
+
+        while (items[queue->head].first < firstDay) {
+            queue->head++;
+        }
+
+        if (queue->head >= 32 && queue->head * 2 >= items.size()) {
+            items.erase(items.begin(), items.begin() + queue->head);
+            queue->head = 0;
+        }
+    }
+}
+
+void PriceSeries::resetWindows()
+{
+    for (auto& window : windows) {
+        window.filled = 0;
+        window.sumCents = 0;
+        window.minQueue = ExtremeQueue();
+        window.maxQueue = ExtremeQueue();
+    }
+
+    // Replay the retained days to rebuild the rolling windows
+    int32_t cents = anchorCents;
+    size_t offset = deltaHead;
+    uint32_t firstDay = static_cast<uint32_t>(totalDays - retainedDays);
+
+    for (int i = 0; i < retainedDays; i++) {
+        if (i > 0) {
+            cents += readDelta(offset);
+        }
+        for (auto& window : windows) {
+            pushWindow(window, cents, firstDay + i, offset);
+        }
+    }
+}
+
+PriceHistory::PriceHistory()
+{
+}
+
+void PriceHistory::configure(const PriceHistoryConfig& newConfig)
+{
+    config = newConfig;
+    series.clear();
+    seriesKeys.clear();
+    seriesIndexByKey.clear();
+}
+
+void PriceHistory::recordMarkets(const std::vector<Market*>& markets)
+{
+    for (const auto* market : markets) {
+        for (const auto& commodity : market->commodities) {
+            getSeries(market->id, commodity.id).record(commodity.currentPrice);
+        }
+    }
+}
+
+void PriceHistory::recordSpan(const Market& market, const std::vector<float>& closingPrices, int days)
+{
+    for (size_t c = 0; c < market.commodities.size(); c++) {
+        PriceSeries& prices = getSeries(market.id, market.commodities[c].id);
+        for (int day = 0; day < days; day++) {
+            prices.record(closingPrices[c * days + day]);
+        }
+    }
+}
+
+PriceSeries& PriceHistory::getSeries(const std::string& marketId, const std::string& commodityId)
+{
+    auto result = seriesIndexByKey.emplace(marketId + "/" + commodityId, static_cast<uint32_t>(series.size()));
+    if (result.second) {
+        series.emplace_back(config);
+        seriesKeys.push_back({ marketId, commodityId });
+    }
+    return series[result.first->second];
+}
+
+const PriceSeries* PriceHistory::findSeries(const std::string& marketId, const std::string& commodityId) const
+{
+    auto it = seriesIndexByKey.find(marketId + "/" + commodityId);
+    return it != seriesIndexByKey.end() ? &series[it->second] : nullptr;
+}
+
+size_t PriceHistory::getSeriesCount() const
+{
+    return series.size();
+}
+
+size_t PriceHistory::getMemoryBytes() const
+{
+    size_t bytes = 0;
+    for (const auto& entry : series) {
+        bytes += entry.getMemoryBytes();
+    }
+    return bytes;
+}
+
+void PriceHistory::serialize(std::ofstream& file) const
+{
+    size_t seriesCount = series.size();
+    writeValue(file, seriesCount);
+
+    for (size_t i = 0; i < series.size(); i++) {
+        for (const std::string* key : { &seriesKeys[i].first, &seriesKeys[i].second }) {
+            size_t keyLength = key->length();
+            writeValue(file, keyLength);
+            file.write(key->c_str(), keyLength);
+        }
+        series[i].serialize(file);
+    }
+}
+
+bool PriceHistory::deserialize(std::ifstream& file)
+{
+    size_t seriesCount;
+    if (!readValue(file, seriesCount) || seriesCount > MAX_SERIES_COUNT) {
+        std::cerr << "Invalid price history series count" << std::endl;
+        return false;
+    }
+
+    configure(config);
+
+    for (size_t i = 0; i < seriesCount; i++) {
+        std::string keys[2];
+        for (auto& key : keys) {
+            size_t keyLength;
+            if (!readValue(file, keyLength) || keyLength > MAX_KEY_LENGTH) {
+                std::cerr << "Invalid price history key length" << std::endl;
+                return false;
+            }
+            key.resize(keyLength);
+            if (keyLength > 0 && !file.read(&key[0], keyLength)) {
+                std::cerr << "Failed to read price history key" << std::endl;
+                return false;
+            }
+        }
+
+        if (!getSeries(keys[0], keys[1]).deserialize(file)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,144 @@
+// systems/economy/PriceHistory.hpp
+#pragma once
+
+#include "Market.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using json = nlohmann::json;
+
+// Lowest, highest and average price over a span of days
+struct PriceAggregate {
+    float minPrice;
+    float maxPrice;
+    float avgPrice;
+    int days;
+};
+
+// Retention and rolling-window settings shared by every price series
+struct PriceHistoryConfig {
+    int dailyCapacity = 90; // Days kept at full resolution
+    int weeklyCapacity = 52; // Weekly aggregates kept
+    int seasonalCapacity = 40; // Seasonal aggregates kept
+    int daysPerSeason = 90;
+    std::vector<int> statWindows = { 7, 30, 90 }; // Day windows answered in O(1)
+
+    // Load from JSON
+    static PriceHistoryConfig fromJson(const json& j);
+};
+
+// Price history of one commodity at one market. Daily prices are kept as whole
+// cents, delta-encoded into zigzag varints; weekly and seasonal aggregates roll
+// up as days are recorded, so memory stays bounded however long the campaign.
+class PriceSeries {
+public:
+    explicit PriceSeries(const PriceHistoryConfig& config);
+
+    // Append today's price
+    void record(float price);
+
+    // Aggregate over the most recent days. O(1) when days matches a configured
+    // stat window, otherwise the daily buffer is decoded.
+    PriceAggregate lastDays(int days) const;
+
+    // Decoded history, oldest first
+    std::vector<float> getDailyPrices() const;
+    std::vector<PriceAggregate> getWeekly() const;
+    std::vector<PriceAggregate> getSeasonal() const;
+
+    int getRecordedDays() const;
+    size_t getMemoryBytes() const;
+
+    void serialize(std::ofstream& file) const;
+    bool deserialize(std::ifstream& file);
+
+private:
+    // Min, max and sum in cents for an open week or season
+    struct Accumulator {
+        int32_t minCents;
+        int32_t maxCents;
+        int64_t sumCents;
+        int days;
+    };
+
+    // Monotonic queue of (day, cents) answering a sliding-window extreme
+    struct ExtremeQueue {
+        std::vector<std::pair<uint32_t, int32_t>> items;
+        size_t head = 0;
+    };
+
+    // Rolling window over the daily stream. The cursor decodes the stream in
+    // step with new samples to find the price leaving the window.
+    struct StatWindow {
+        int length;
+        int filled;
+        int64_t sumCents;
+        int32_t cursorCents; // Oldest price in the window
+        size_t cursorOffset; // Stream offset of the delta after cursorCents
+        ExtremeQueue minQueue;
+        ExtremeQueue maxQueue;
+    };
+
+    int dailyCapacity;
+    int weeklyCapacity;
+    int seasonalCapacity;
+    int daysPerSeason;
+
+    int totalDays;
+    int retainedDays;
+    int32_t anchorCents; // Oldest retained daily price
+    int32_t lastCents; // Newest daily price
+    std::vector<uint8_t> deltaStream;
+    size_t deltaHead; // Start of the retained stream
+
+    std::vector<StatWindow> windows;
+
+    Accumulator openWeek;
+    Accumulator openSeason;
+    std::vector<PriceAggregate> weekly; // Ring buffers, oldest at the head index
+    std::vector<PriceAggregate> seasonal;
+    size_t weeklyHead;
+    size_t seasonalHead;
+
+    void appendDelta(int32_t delta);
+    int32_t readDelta(size_t& offset) const;
+    void compactStream();
+    void pushWindow(StatWindow& window, int32_t cents, uint32_t day, size_t nextOffset);
+    void resetWindows();
+};
+
+// Price history for every (market, commodity) pair, recorded once per economic day
+class PriceHistory {
+public:
+    PriceHistory();
+
+    // Apply retention settings; existing series are discarded
+    void configure(const PriceHistoryConfig& newConfig);
+
+    // Record today's commodity prices of every market
+    void recordMarkets(const std::vector<Market*>& markets);
+
+    // Record several days of one market at once, laid out as Market::fastForward fills them
+    void recordSpan(const Market& market, const std::vector<float>& closingPrices, int days);
+
+    // Get or create the series for a market commodity
+    PriceSeries& getSeries(const std::string& marketId, const std::string& commodityId);
+    const PriceSeries* findSeries(const std::string& marketId, const std::string& commodityId) const;
+
+    size_t getSeriesCount() const;
+    size_t getMemoryBytes() const;
+
+    void serialize(std::ofstream& file) const;
+    bool deserialize(std::ifstream& file);
+
+private:
+    PriceHistoryConfig config;
+    std::vector<PriceSeries> series;
+    std::vector<std::pair<std::string, std::string>> seriesKeys; // (marketId, commodityId), parallel to series
+    std::unordered_map<std::string, uint32_t> seriesIndexByKey; // "marketId/commodityId" -> series
+};
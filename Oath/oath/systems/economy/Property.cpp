@@ -41,6 +41,7 @@ Property::Property()
     , weeklyUpkeep(50)
     , isOwned(false)
     , storageCapacity(100)
+    , generation(0)
 {
 }
 
@@ -133,6 +134,7 @@ bool Property::installUpgrade(const std::string& upgradeId, int& cost)
 
             // Apply upgrade effects
             upgrade.applyEffect(*this);
+            generation++;
 
             return true;
         }
@@ -143,6 +145,7 @@ bool Property::installUpgrade(const std::string& upgradeId, int& cost)
 void Property::addTenant(const Tenant& tenant)
 {
     tenants.push_back(tenant);
+    generation++;
 }
 
 bool Property::evictTenant(const std::string& tenantId)
@@ -150,6 +153,7 @@ bool Property::evictTenant(const std::string& tenantId)
     for (auto it = tenants.begin(); it != tenants.end(); ++it) {
         if (it->id == tenantId) {
             tenants.erase(it);
+            generation++;
             return true;
         }
     }
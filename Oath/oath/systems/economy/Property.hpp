@@ -23,6 +23,7 @@ struct Property {
     int weeklyUpkeep;
     bool isOwned;
     int storageCapacity;
+    unsigned int generation; // Bumped when tenants or upkeep change, so ledgers know to rebuild
     Inventory storage;
 
     // Upgrades
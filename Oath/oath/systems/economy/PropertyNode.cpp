@@ -9,6 +9,7 @@ PropertyNode::PropertyNode(const std::string& name)
     : TANode(name)
     , playerGold(1000)
     , daysSinceLastUpkeep(0)
+    , ledgerDirty(true)
 {
     // Load properties from JSON
     loadPropertiesFromJson();
@@ -50,6 +51,7 @@ void PropertyNode::onEnter(GameContext* context)
     displayOwnedProperties();
 
     // Show recent notifications
+    reportTransactions();
     if (!recentNotifications.empty()) {
         std::cout << "\nRecent Notifications:" << std::endl;
         for (const auto& notification : recentNotifications) {
@@ -132,44 +134,104 @@ bool PropertyNode::evaluateTransition(const TAInput& input, TANode*& outNextNode
 void PropertyNode::addProperty(const Property& property)
 {
     properties.push_back(property);
+    ledgerDirty = true;
 }
 
 void PropertyNode::advanceDay()
 {
-    int totalIncome = 0;
+    fastForward(1);
+}
+
+void PropertyNode::fastForward(int days)
+{
+    if (days <= 0)
+        return;
+
+    syncLedger();
 
-    for (auto& property : properties) {
-        property.advanceDay(totalIncome, recentNotifications);
+    // Gold is clamped at zero after every day. If the span's upkeep cannot
+    // use up the gold, the clamp never fires and one pass settles it all;
+    // otherwise settle day by day so the clamp lands where it would have.
+    if (playerGold >= ledger.upkeepDue(AssetLedger::PLAYER_OWNER, days)) {
+        settle(days);
+        return;
+    }
+    for (int day = 0; day < days; day++) {
+        settle(1);
     }
+}
 
-    if (totalIncome > 0) {
-        playerGold += totalIncome;
-        recentNotifications.push_back("Your properties generated " + std::to_string(totalIncome) + " gold today.");
+void PropertyNode::settle(int days)
+{
+    ledger.fastForward(days, 1.0f);
+    ledger.storeCounters(properties);
+    daysSinceLastUpkeep = (daysSinceLastUpkeep + days) % 7;
+
+    playerGold += static_cast<int>(ledger.collectBalance(AssetLedger::PLAYER_OWNER));
+
+    // Check if player can't afford upkeep
+    if (playerGold < 0) {
+        recentNotifications.push_back("WARNING: You couldn't afford property upkeep! Your properties may deteriorate.");
+        playerGold = 0; // Prevent negative gold in this example
     }
+}
 
-    // Process weekly upkeep
-    daysSinceLastUpkeep++;
-    if (daysSinceLastUpkeep >= 7) {
-        int totalUpkeep = 0;
+void PropertyNode::syncLedger()
+{
+    // Tenant changes and upgrades on a property also invalidate its slots
+    if (!ledgerDirty && ledger.isCurrent(properties))
+        return;
 
-        for (const auto& property : properties) {
-            if (property.isOwned) {
-                totalUpkeep += property.weeklyUpkeep;
-            }
+    // Ledger slots change on rebuild, so word the pending log entries first
+    reportTransactions();
+    ledger.clearAssets();
+
+    for (size_t i = 0; i < properties.size(); i++) {
+        if (properties[i].isOwned) {
+            ledger.addProperty(properties[i], AssetLedger::PLAYER_OWNER, static_cast<uint32_t>(i), daysSinceLastUpkeep);
         }
+    }
+
+    ledgerDirty = false;
+}
 
-        if (totalUpkeep > 0) {
-            playerGold -= totalUpkeep;
-            recentNotifications.push_back("You paid " + std::to_string(totalUpkeep) + " gold for property upkeep.");
+void PropertyNode::reportTransactions()
+{
+    const auto& transactions = ledger.getTransactions();
+    int totalIncome = 0;
+    int totalUpkeep = 0;
+
+    for (size_t i = 0; i < transactions.size(); i++) {
+        const LedgerTransaction& tx = transactions[i];
+
+        if (tx.type == LedgerEntryType::PROPERTY_INCOME) {
+            totalIncome += tx.amount;
+        } else if (tx.type == LedgerEntryType::UPKEEP) {
+            totalUpkeep -= tx.amount;
+        } else if (tx.type == LedgerEntryType::RENT_PAID || tx.type == LedgerEntryType::RENT_MISSED) {
+            // A changed property's tenant slots may no longer match its tenants
+            std::string tenantName = "A tenant";
+            if (ledger.isCurrent(tx.asset, properties)) {
+                tenantName = "Tenant " + properties[ledger.getPropertySource(tx.asset)].tenants[ledger.getTenantSource(tx.tenant)].name;
+            }
 
-            // Check if player can't afford upkeep
-            if (playerGold < 0) {
-                recentNotifications.push_back("WARNING: You couldn't afford property upkeep! Your properties may deteriorate.");
-                playerGold = 0; // Prevent negative gold in this example
+            if (tx.type == LedgerEntryType::RENT_PAID) {
+                totalIncome += tx.amount;
+                recentNotifications.push_back(tenantName + " paid " + std::to_string(tx.amount) + " gold in rent.");
+            } else if (tx.count > 1) {
+                recentNotifications.push_back(tenantName + " missed " + std::to_string(tx.count) + " rent payments!");
+            } else {
+                recentNotifications.push_back(tenantName + " missed their rent payment!");
             }
         }
+    }
+    ledger.clearTransactions();
 
-        daysSinceLastUpkeep = 0;
+    if (totalIncome > 0) {
+        recentNotifications.push_back("Your properties generated " + std::to_string(totalIncome) + " gold.");
+    }
+    if (totalUpkeep > 0) {
+        recentNotifications.push_back("You paid " + std::to_string(totalUpkeep) + " gold for property upkeep.");
     }
 }
 
@@ -260,6 +322,7 @@ void PropertyNode::handlePropertyPurchase()
         for (auto& property : properties) {
             if (!property.isOwned) {
                 property.isOwned = true;
+                ledgerDirty = true;
                 break;
             }
         }
@@ -5,6 +5,7 @@
 #include "../../core/TAInput.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "AssetLedger.hpp"
 #include "Property.hpp"
 #include <string>
 #include <vector>
@@ -16,6 +17,7 @@ public:
     int playerGold;
     int daysSinceLastUpkeep;
     std::vector<std::string> recentNotifications;
+    AssetLedger ledger;
 
     PropertyNode(const std::string& name);
 
@@ -30,7 +32,15 @@ public:
     // Process a day passing for all properties
     void advanceDay();
 
+    // Process several days at once, e.g. while travelling or resting
+    void fastForward(int days);
+
 private:
+    bool ledgerDirty;
+
+    void syncLedger();
+    void settle(int days);
+    void reportTransactions();
     void displayOwnedProperties();
     void displayAvailableProperties();
     void handlePropertyManagement();
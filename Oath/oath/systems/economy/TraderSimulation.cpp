@@ -0,0 +1,391 @@
+// systems/economy/TraderSimulation.cpp
+
+#include "TraderSimulation.hpp"
+
+#include <algorithm>
+
+namespace {
+// Spread the market's local producers and consumers quote around the current price
+constexpr float HOUSE_SPREAD = 0.05f;
+// Share of local supply/demand offered to agents each day
+constexpr int HOUSE_LIQUIDITY_DIVISOR = 10;
+// How far agents are willing to cross the current price to get filled
+constexpr float AGENT_AGGRESSION = 0.06f;
+// Daily pull of supply and demand back toward their reference levels (local production/consumption)
+constexpr int REVERSION_DIVISOR = 20;
+// Share of unfilled agent pressure that shifts local demand
+constexpr int PRESSURE_DIVISOR = 4;
+}
+
+TraderSimulation::TraderSimulation()
+    : routes(nullptr)
+    , rng(std::random_device {}())
+    , lastOrderCount(0)
+    , lastFillCount(0)
+    , lastTradedUnits(0)
+{
+}
+
+void TraderSimulation::initialize(const std::vector<Market*>& marketList, const std::vector<TradeRoute>* routeList)
+{
+    // Index books for markets we haven't seen yet
+    for (size_t m = markets.size(); m < marketList.size(); m++) {
+        Market* market = marketList[m];
+        markets.push_back(market);
+
+        for (size_t c = 0; c < market->commodities.size(); c++) {
+            uint32_t bookIndex = static_cast<uint32_t>(books.size());
+            books.push_back({ static_cast<uint32_t>(m), static_cast<uint32_t>(c), 0, 0, 0, 0 });
+            bookIndexByKey[market->id + "/" + market->commodities[c].id] = bookIndex;
+        }
+    }
+
+    routes = routeList;
+    if (!routes) {
+        return;
+    }
+
+    // Resolve new routes to source/destination book pairs
+    for (size_t r = routeLinks.size(); r < routes->size(); r++) {
+        const TradeRoute& route = (*routes)[r];
+        RouteLink link;
+        link.routeIndex = static_cast<uint32_t>(r);
+
+        for (const auto& goodId : route.tradedGoods) {
+            auto sourceIt = bookIndexByKey.find(route.sourceMarket + "/" + goodId);
+            auto destIt = bookIndexByKey.find(route.destinationMarket + "/" + goodId);
+            if (sourceIt != bookIndexByKey.end() && destIt != bookIndexByKey.end()) {
+                link.sourceBooks.push_back(sourceIt->second);
+                link.destBooks.push_back(destIt->second);
+            }
+        }
+
+        routeLinks.push_back(std::move(link));
+    }
+}
+
+void TraderSimulation::spawnFromJson(const json& j)
+{
+    if (j.contains("seed")) {
+        setSeed(j["seed"].get<unsigned int>());
+    }
+
+    float startingGold = j.value("startingGold", 500.0f);
+    spawnMerchants(j.value("merchantsPerCommodity", 0), startingGold);
+    spawnCaravans(j.value("caravansPerGood", 0), startingGold);
+}
+
+void TraderSimulation::spawnMerchants(int perCommodity, float startingGold)
+{
+    std::uniform_real_distribution<float> beliefDist(0.85f, 1.15f);
+
+    for (uint32_t b = 0; b < books.size(); b++) {
+        for (int i = 0; i < perCommodity; i++) {
+            uint32_t agent = addAgent(TraderKind::MERCHANT, startingGold, 10);
+            agentBook[agent] = b;
+            agentBelief[agent] = beliefDist(rng);
+            agentStock[agent] = agentCapacity[agent] / 2;
+        }
+    }
+}
+
+void TraderSimulation::spawnCaravans(int perGood, float startingGold)
+{
+    for (uint32_t r = 0; r < routeLinks.size(); r++) {
+        for (uint32_t g = 0; g < routeLinks[r].sourceBooks.size(); g++) {
+            for (int i = 0; i < perGood; i++) {
+                uint32_t agent = addAgent(TraderKind::CARAVAN, startingGold, 20);
+                agentRoute[agent] = r;
+                agentGood[agent] = g;
+            }
+        }
+    }
+}
+
+void TraderSimulation::setSeed(unsigned int seed)
+{
+    rng.seed(seed);
+}
+
+void TraderSimulation::tick()
+{
+    orders.clear();
+
+    postHouseOrders();
+    postMerchantOrders();
+    postCaravanOrders();
+    lastOrderCount = orders.size();
+
+    matchOrders();
+    applyMarketFlows();
+    advanceCaravans();
+}
+
+size_t TraderSimulation::getAgentCount() const
+{
+    return agentKind.size();
+}
+
+size_t TraderSimulation::getBookCount() const
+{
+    return books.size();
+}
+
+size_t TraderSimulation::getLastOrderCount() const
+{
+    return lastOrderCount;
+}
+
+size_t TraderSimulation::getLastFillCount() const
+{
+    return lastFillCount;
+}
+
+int TraderSimulation::getLastTradedUnits() const
+{
+    return lastTradedUnits;
+}
+
+TradeCommodity& TraderSimulation::commodityFor(uint32_t bookIndex)
+{
+    const OrderBook& book = books[bookIndex];
+    return markets[book.marketIndex]->commodities[book.commodityIndex];
+}
+
+uint32_t TraderSimulation::addAgent(TraderKind kind, float gold, int capacity)
+{
+    uint32_t agent = static_cast<uint32_t>(agentKind.size());
+    agentKind.push_back(kind);
+    agentGold.push_back(gold);
+    agentStock.push_back(0);
+    agentCapacity.push_back(capacity);
+    agentBelief.push_back(1.0f);
+    agentBook.push_back(0);
+    agentRoute.push_back(0);
+    agentGood.push_back(0);
+    agentState.push_back(CaravanState::BUYING);
+    agentDaysRemaining.push_back(0);
+    return agent;
+}
+
+void TraderSimulation::postHouseOrders()
+{
+    // Local producers sell from market supply, local consumers buy against demand
+    for (uint32_t b = 0; b < books.size(); b++) {
+        const TradeCommodity& commodity = commodityFor(b);
+
+        int askUnits = std::max(0, commodity.supply - 1) / HOUSE_LIQUIDITY_DIVISOR;
+        if (askUnits > 0) {
+            orders.push_back({ b, HOUSE_AGENT, commodity.currentPrice * (1.0f + HOUSE_SPREAD), askUnits, false });
+        }
+
+        int bidUnits = commodity.demand / HOUSE_LIQUIDITY_DIVISOR;
+        if (bidUnits > 0) {
+            orders.push_back({ b, HOUSE_AGENT, commodity.currentPrice * (1.0f - HOUSE_SPREAD), bidUnits, true });
+        }
+    }
+}
+
+void TraderSimulation::postMerchantOrders()
+{
+    // Merchants buy below their idea of a fair price and sell above it
+    for (uint32_t a = 0; a < agentKind.size(); a++) {
+        if (agentKind[a] != TraderKind::MERCHANT) {
+            continue;
+        }
+
+        uint32_t b = agentBook[a];
+        const TradeCommodity& commodity = commodityFor(b);
+        float fairPrice = commodity.basePrice * agentBelief[a];
+        float current = commodity.currentPrice;
+
+        if (current < fairPrice && agentStock[a] < agentCapacity[a]) {
+            float limit = std::min(fairPrice, current * (1.0f + AGENT_AGGRESSION));
+            int affordable = static_cast<int>(agentGold[a] / limit);
+            int units = std::min(agentCapacity[a] - agentStock[a], affordable);
+            if (units > 0) {
+                orders.push_back({ b, a, limit, units, true });
+            }
+        } else if (current > fairPrice && agentStock[a] > 0) {
+            float limit = std::max(fairPrice, current * (1.0f - AGENT_AGGRESSION));
+            orders.push_back({ b, a, limit, agentStock[a], false });
+        }
+    }
+}
+
+void TraderSimulation::postCaravanOrders()
+{
+    for (uint32_t a = 0; a < agentKind.size(); a++) {
+        if (agentKind[a] != TraderKind::CARAVAN) {
+            continue;
+        }
+
+        const RouteLink& link = routeLinks[agentRoute[a]];
+        const TradeRoute& route = (*routes)[link.routeIndex];
+        uint32_t sourceBook = link.sourceBooks[agentGood[a]];
+        uint32_t destBook = link.destBooks[agentGood[a]];
+
+        if (agentState[a] == CaravanState::BUYING && route.isActive) {
+            // Only load up when the destination price covers transport costs
+            float sourcePrice = commodityFor(sourceBook).currentPrice;
+            float destPrice = commodityFor(destBook).currentPrice;
+            if (destPrice > sourcePrice * route.getTransportCostMultiplier()) {
+                float limit = sourcePrice * (1.0f + AGENT_AGGRESSION);
+                int affordable = static_cast<int>(agentGold[a] / limit);
+                int units = std::min(agentCapacity[a] - agentStock[a], affordable);
+                if (units > 0) {
+                    orders.push_back({ sourceBook, a, limit, units, true });
+                }
+            }
+        } else if (agentState[a] == CaravanState::SELLING && agentStock[a] > 0) {
+            float limit = commodityFor(destBook).currentPrice * (1.0f - AGENT_AGGRESSION);
+            orders.push_back({ destBook, a, limit, agentStock[a], false });
+        }
+    }
+}
+
+void TraderSimulation::matchOrders()
+{
+    lastFillCount = 0;
+    lastTradedUnits = 0;
+
+    // One sort groups every book; asks ascend and bids descend within a book
+    std::sort(orders.begin(), orders.end(), [](const TradeOrder& lhs, const TradeOrder& rhs) {
+        if (lhs.bookIndex != rhs.bookIndex)
+            return lhs.bookIndex < rhs.bookIndex;
+        if (lhs.isBuy != rhs.isBuy)
+            return !lhs.isBuy;
+        return lhs.isBuy ? lhs.limitPrice > rhs.limitPrice : lhs.limitPrice < rhs.limitPrice;
+    });
+
+    size_t begin = 0;
+    while (begin < orders.size()) {
+        uint32_t bookIndex = orders[begin].bookIndex;
+        size_t end = begin;
+        while (end < orders.size() && orders[end].bookIndex == bookIndex) {
+            end++;
+        }
+
+        size_t bidBegin = begin;
+        while (bidBegin < end && !orders[bidBegin].isBuy) {
+            bidBegin++;
+        }
+
+        // Cross the best bid with the best ask while prices overlap
+        size_t ask = begin;
+        size_t bid = bidBegin;
+        while (ask < bidBegin && bid < end && orders[bid].limitPrice >= orders[ask].limitPrice) {
+            int quantity = std::min(orders[bid].quantity, orders[ask].quantity);
+            float price = 0.5f * (orders[bid].limitPrice + orders[ask].limitPrice);
+
+            applyFill(orders[bid], orders[ask], price, quantity);
+            orders[bid].quantity -= quantity;
+            orders[ask].quantity -= quantity;
+
+            if (orders[ask].quantity == 0)
+                ask++;
+            if (orders[bid].quantity == 0)
+                bid++;
+        }
+
+        // Whatever agents left unfilled is pressure on local demand
+        OrderBook& book = books[bookIndex];
+        for (size_t i = begin; i < end; i++) {
+            if (orders[i].agentIndex == HOUSE_AGENT)
+                continue;
+            if (orders[i].isBuy)
+                book.openBidUnits += orders[i].quantity;
+            else
+                book.openAskUnits += orders[i].quantity;
+        }
+
+        begin = end;
+    }
+}
+
+void TraderSimulation::applyFill(const TradeOrder& bid, const TradeOrder& ask, float price, int quantity)
+{
+    OrderBook& book = books[bid.bookIndex];
+    float total = price * quantity;
+
+    if (bid.agentIndex == HOUSE_AGENT) {
+        book.houseBought += quantity;
+    } else {
+        agentGold[bid.agentIndex] -= total;
+        agentStock[bid.agentIndex] += quantity;
+    }
+
+    if (ask.agentIndex == HOUSE_AGENT) {
+        book.houseSold += quantity;
+    } else {
+        agentGold[ask.agentIndex] += total;
+        agentStock[ask.agentIndex] -= quantity;
+    }
+
+    lastFillCount++;
+    lastTradedUnits += quantity;
+}
+
+void TraderSimulation::advanceCaravans()
+{
+    for (uint32_t a = 0; a < agentKind.size(); a++) {
+        if (agentKind[a] != TraderKind::CARAVAN) {
+            continue;
+        }
+
+        const TradeRoute& route = (*routes)[routeLinks[agentRoute[a]].routeIndex];
+
+        switch (agentState[a]) {
+        case CaravanState::BUYING:
+            if (agentStock[a] > 0) {
+                agentState[a] = CaravanState::HAULING;
+                agentDaysRemaining[a] = route.travelDays;
+            }
+            break;
+        case CaravanState::HAULING:
+            // Disrupted routes stall caravans on the road
+            if (route.isActive && --agentDaysRemaining[a] <= 0) {
+                agentState[a] = CaravanState::SELLING;
+            }
+            break;
+        case CaravanState::SELLING:
+            if (agentStock[a] == 0) {
+                agentState[a] = CaravanState::RETURNING;
+                agentDaysRemaining[a] = route.travelDays;
+            }
+            break;
+        case CaravanState::RETURNING:
+            if (route.isActive && --agentDaysRemaining[a] <= 0) {
+                agentState[a] = CaravanState::BUYING;
+            }
+            break;
+        }
+    }
+}
+
+void TraderSimulation::applyMarketFlows()
+{
+    for (uint32_t b = 0; b < books.size(); b++) {
+        OrderBook& book = books[b];
+        TradeCommodity& commodity = commodityFor(b);
+
+        // Goods agents sold to locals add to supply, goods they bought leave the market
+        commodity.supply += book.houseBought - book.houseSold;
+        commodity.supply += (commodity.baseSupply - commodity.supply) / REVERSION_DIVISOR;
+
+        // Unmet agent bids raise demand, unsold agent stock dampens it (at most 10% of base per day)
+        int maxShift = std::max(1, commodity.baseDemand / 10);
+        int pressure = (book.openBidUnits - book.openAskUnits) / PRESSURE_DIVISOR;
+        commodity.demand += std::clamp(pressure, -maxShift, maxShift);
+        commodity.demand += (commodity.baseDemand - commodity.demand) / REVERSION_DIVISOR;
+
+        commodity.supply = std::max(1, commodity.supply);
+        commodity.demand = std::max(1, commodity.demand);
+        commodity.updatePrice();
+
+        book.houseBought = 0;
+        book.houseSold = 0;
+        book.openBidUnits = 0;
+        book.openAskUnits = 0;
+    }
+}
@@ -0,0 +1,123 @@
+// systems/economy/TraderSimulation.hpp
+#pragma once
+
+#include "Market.hpp"
+#include "TradeRoute.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Kind of NPC trading agent
+enum class TraderKind : uint8_t {
+    MERCHANT, // Stationary trader speculating on one commodity at one market
+    CARAVAN // Buys at a route's source market, hauls goods, sells at its destination
+};
+
+// Caravan life cycle along a trade route
+enum class CaravanState : uint8_t {
+    BUYING,
+    HAULING,
+    SELLING,
+    RETURNING
+};
+
+// A limit order placed on one (market, commodity) order book
+struct TradeOrder {
+    uint32_t bookIndex;
+    uint32_t agentIndex; // HOUSE_AGENT for the market's local producers/consumers
+    float limitPrice;
+    int quantity;
+    bool isBuy;
+};
+
+// Population of NPC merchants and caravans trading through markets. Each tick
+// every agent posts limit orders, all order books are matched in one batch, and
+// the resulting flows - not fixed deltas - move commodity supply and demand.
+class TraderSimulation {
+public:
+    static constexpr uint32_t HOUSE_AGENT = 0xFFFFFFFFu;
+
+    TraderSimulation();
+
+    // Build the order book and route indices. Safe to call again after markets
+    // or routes are appended; existing agents keep their books and routes.
+    void initialize(const std::vector<Market*>& marketList, const std::vector<TradeRoute>* routeList);
+
+    // Load population settings ("merchantsPerCommodity", "caravansPerGood", "startingGold", "seed")
+    void spawnFromJson(const json& j);
+
+    // Add merchants to every market commodity book
+    void spawnMerchants(int perCommodity, float startingGold);
+
+    // Add caravans to every good of every trade route
+    void spawnCaravans(int perGood, float startingGold);
+
+    // Seed the simulation's random stream for deterministic runs
+    void setSeed(unsigned int seed);
+
+    // Simulate one economic day
+    void tick();
+
+    size_t getAgentCount() const;
+    size_t getBookCount() const;
+    size_t getLastOrderCount() const;
+    size_t getLastFillCount() const;
+    int getLastTradedUnits() const;
+
+private:
+    // Order book for one commodity at one market, plus the day's aggregate flow
+    struct OrderBook {
+        uint32_t marketIndex;
+        uint32_t commodityIndex;
+        int houseBought; // Units the market's locals bought from agents
+        int houseSold; // Units the market's locals sold to agents
+        int openBidUnits; // Unfilled agent demand left on the book
+        int openAskUnits; // Unfilled agent supply left on the book
+    };
+
+    // A trade route resolved to book indices
+    struct RouteLink {
+        uint32_t routeIndex;
+        std::vector<uint32_t> sourceBooks; // Parallel to destBooks, one entry per traded good
+        std::vector<uint32_t> destBooks;
+    };
+
+    std::vector<Market*> markets;
+    const std::vector<TradeRoute>* routes;
+    std::vector<OrderBook> books;
+    std::vector<RouteLink> routeLinks;
+    std::unordered_map<std::string, uint32_t> bookIndexByKey; // "marketId/commodityId" -> book
+
+    // Agents, stored as parallel arrays
+    std::vector<TraderKind> agentKind;
+    std::vector<float> agentGold;
+    std::vector<int> agentStock; // Units of goods held
+    std::vector<int> agentCapacity; // Max units held or hauled
+    std::vector<float> agentBelief; // Merchant's fair-price multiplier on base price
+    std::vector<uint32_t> agentBook; // Merchant's book
+    std::vector<uint32_t> agentRoute; // Caravan's route link
+    std::vector<uint32_t> agentGood; // Caravan's good slot within its route
+    std::vector<CaravanState> agentState;
+    std::vector<int> agentDaysRemaining;
+
+    std::vector<TradeOrder> orders;
+    std::mt19937 rng;
+
+    size_t lastOrderCount;
+    size_t lastFillCount;
+    int lastTradedUnits;
+
+    TradeCommodity& commodityFor(uint32_t bookIndex);
+    uint32_t addAgent(TraderKind kind, float gold, int capacity);
+
+    void postHouseOrders();
+    void postMerchantOrders();
+    void postCaravanOrders();
+    void matchOrders();
+    void applyFill(const TradeOrder& bid, const TradeOrder& ask, float price, int quantity);
+    void advanceCaravans();
+    void applyMarketFlows();
+};
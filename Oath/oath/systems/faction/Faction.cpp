@@ -157,6 +157,12 @@ Faction Faction::fromJson(const json& j)
         }
     }
 
+    if (j.contains("members") && j["members"].is_array()) {
+        for (const auto& member : j["members"]) {
+            faction.members.insert(member.get<std::string>());
+        }
+    }
+
     if (j.contains("specialLocations") && j["specialLocations"].is_array()) {
         for (const auto& location : j["specialLocations"]) {
             faction.specialLocations.push_back(location);
@@ -257,6 +263,28 @@ void Faction::changeReputation(int amount)
     updatePlayerReputationState();
 }
 
+void Faction::updateStateFromPower()
+{
+    // Average the three power indicators
+    int avgPower = (economicPower + militaryPower + politicalInfluence) / 3;
+
+    // Determine state based on average power
+    if (currentState == "at_war") {
+        // War state persists unless explicitly changed
+        return;
+    } else if (avgPower < 20) {
+        currentState = "in_crisis";
+    } else if (avgPower < 40) {
+        currentState = "declining";
+    } else if (avgPower < 60) {
+        currentState = "stable";
+    } else if (avgPower < 80) {
+        currentState = "growing";
+    } else {
+        currentState = "flourishing";
+    }
+}
+
 bool Faction::canAdvanceRank() const
 {
     if (playerRank >= 10) {
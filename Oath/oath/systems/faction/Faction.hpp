@@ -9,6 +9,8 @@
 
 using json = nlohmann::json;
 
+namespace oath {
+
 class Faction {
 public:
     std::string id;
@@ -61,6 +63,8 @@ public:
 
     void updatePlayerReputationState();
     void changeReputation(int amount);
+    // Pick the state ("in_crisis" ... "flourishing") from average power; war state persists
+    void updateStateFromPower();
     bool canAdvanceRank() const;
     bool tryAdvanceRank();
     float getTradeModifier() const;
@@ -68,3 +72,5 @@ public:
     std::string getNextRankTitle() const;
     std::string getReputationDescription() const;
 };
+
+} // namespace oath
@@ -0,0 +1,425 @@
+// systems/faction/FactionMembershipIndex.cpp
+#include "FactionMembershipIndex.hpp"
+
+#include <algorithm>
+
+namespace oath {
+
+NpcSet::NpcSet()
+    : beginWord(0)
+    , endWord(0)
+{
+}
+
+void NpcSet::resize(int npcCount)
+{
+    words.resize((npcCount + 63) / 64, 0);
+    endWord = std::min(endWord, static_cast<int>(words.size()));
+    beginWord = std::min(beginWord, endWord);
+}
+
+void NpcSet::set(int npc)
+{
+    int w = npc / 64;
+    if (beginWord == endWord) {
+        beginWord = w;
+        endWord = w + 1;
+    } else {
+        beginWord = std::min(beginWord, w);
+        endWord = std::max(endWord, w + 1);
+    }
+    words[w] |= 1ull << (npc % 64);
+}
+
+void NpcSet::reset(int npc)
+{
+    words[npc / 64] &= ~(1ull << (npc % 64));
+}
+
+bool NpcSet::test(int npc) const
+{
+    int w = npc / 64;
+    return w < static_cast<int>(words.size()) && (words[w] >> (npc % 64)) & 1;
+}
+
+void NpcSet::clear()
+{
+    std::fill(words.begin() + beginWord, words.begin() + endWord, 0);
+    beginWord = endWord = 0;
+}
+
+int NpcSet::count() const
+{
+    int total = 0;
+    for (int w = beginWord; w < endWord; w++) {
+        total += popcount64(words[w]);
+    }
+    return total;
+}
+
+bool NpcSet::empty() const
+{
+    for (int w = beginWord; w < endWord; w++) {
+        if (words[w]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+NpcSet& NpcSet::operator&=(const NpcSet& other)
+{
+    int begin = std::max(beginWord, other.beginWord);
+    int end = std::min(endWord, other.endWord);
+    if (begin >= end) {
+        clear();
+        return *this;
+    }
+
+    std::fill(words.begin() + beginWord, words.begin() + begin, 0);
+    std::fill(words.begin() + end, words.begin() + endWord, 0);
+    for (int w = begin; w < end; w++) {
+        words[w] &= other.words[w];
+    }
+    beginWord = begin;
+    endWord = end;
+    return *this;
+}
+
+NpcSet& NpcSet::operator|=(const NpcSet& other)
+{
+    int end = std::min(other.endWord, static_cast<int>(words.size()));
+    if (other.beginWord >= end) {
+        return *this;
+    }
+
+    for (int w = other.beginWord; w < end; w++) {
+        words[w] |= other.words[w];
+    }
+    if (beginWord == endWord) {
+        beginWord = other.beginWord;
+        endWord = end;
+    } else {
+        beginWord = std::min(beginWord, other.beginWord);
+        endWord = std::max(endWord, end);
+    }
+    return *this;
+}
+
+NpcSet& NpcSet::subtract(const NpcSet& other)
+{
+    int begin = std::max(beginWord, other.beginWord);
+    int end = std::min(endWord, other.endWord);
+    for (int w = begin; w < end; w++) {
+        words[w] &= ~other.words[w];
+    }
+    return *this;
+}
+
+int NpcSet::countBoth(const NpcSet& a, const NpcSet& b)
+{
+    int begin = std::max(a.beginWord, b.beginWord);
+    int end = std::min(a.endWord, b.endWord);
+    int total = 0;
+    for (int w = begin; w < end; w++) {
+        total += popcount64(a.words[w] & b.words[w]);
+    }
+    return total;
+}
+
+std::vector<int> NpcSet::toVector() const
+{
+    std::vector<int> result;
+    result.reserve(count());
+    forEach([&result](int npc) { result.push_back(npc); });
+    return result;
+}
+
+FactionMembershipIndex::FactionMembershipIndex()
+    : factionWords(1)
+    , npcCapacity(0)
+{
+}
+
+void FactionMembershipIndex::clear()
+{
+    *this = FactionMembershipIndex();
+}
+
+int FactionMembershipIndex::addFaction(const std::string& factionId)
+{
+    auto it = factionIndices.find(factionId);
+    if (it != factionIndices.end()) {
+        return it->second;
+    }
+
+    int index = static_cast<int>(factionIds.size());
+    factionIds.push_back(factionId);
+    factionIndices[factionId] = index;
+    growFactionWords((index + 64) / 64);
+
+    members.emplace_back();
+    members.back().resize(npcCapacity);
+    return index;
+}
+
+int FactionMembershipIndex::addNpc(const std::string& npcId)
+{
+    auto it = npcIndices.find(npcId);
+    if (it != npcIndices.end()) {
+        return it->second;
+    }
+
+    int index = static_cast<int>(npcIds.size());
+    npcIds.push_back(npcId);
+    npcIndices[npcId] = index;
+    growNpcs(index + 1);
+
+    npcRegion.push_back(-1);
+    npcLocation.push_back(-1);
+    npcFactions.resize(npcIds.size() * factionWords, 0);
+    return index;
+}
+
+int FactionMembershipIndex::addRegion(const std::string& regionId)
+{
+    auto it = regionIndices.find(regionId);
+    if (it != regionIndices.end()) {
+        return it->second;
+    }
+
+    int index = static_cast<int>(regionNpcs.size());
+    regionIndices[regionId] = index;
+    regionNpcs.emplace_back();
+    regionNpcs.back().resize(npcCapacity);
+    return index;
+}
+
+int FactionMembershipIndex::addLocation(const std::string& locationId)
+{
+    auto it = locationIndices.find(locationId);
+    if (it != locationIndices.end()) {
+        return it->second;
+    }
+
+    int index = static_cast<int>(locationNpcs.size());
+    locationIndices[locationId] = index;
+    locationNpcs.emplace_back();
+    locationNpcs.back().resize(npcCapacity);
+    return index;
+}
+
+int FactionMembershipIndex::factionIndex(const std::string& factionId) const
+{
+    auto it = factionIndices.find(factionId);
+    return it != factionIndices.end() ? it->second : -1;
+}
+
+int FactionMembershipIndex::npcIndex(const std::string& npcId) const
+{
+    auto it = npcIndices.find(npcId);
+    return it != npcIndices.end() ? it->second : -1;
+}
+
+int FactionMembershipIndex::regionIndex(const std::string& regionId) const
+{
+    auto it = regionIndices.find(regionId);
+    return it != regionIndices.end() ? it->second : -1;
+}
+
+int FactionMembershipIndex::locationIndex(const std::string& locationId) const
+{
+    auto it = locationIndices.find(locationId);
+    return it != locationIndices.end() ? it->second : -1;
+}
+
+const std::string& FactionMembershipIndex::factionId(int faction) const
+{
+    return factionIds[faction];
+}
+
+const std::string& FactionMembershipIndex::npcId(int npc) const
+{
+    return npcIds[npc];
+}
+
+int FactionMembershipIndex::factionCount() const
+{
+    return static_cast<int>(factionIds.size());
+}
+
+int FactionMembershipIndex::npcCount() const
+{
+    return static_cast<int>(npcIds.size());
+}
+
+void FactionMembershipIndex::loadFromFactions(const std::map<std::string, Faction>& factions)
+{
+    for (const auto& [id, faction] : factions) {
+        int index = addFaction(id);
+        for (const auto& member : faction.members) {
+            join(index, addNpc(member));
+        }
+    }
+}
+
+void FactionMembershipIndex::join(int faction, int npc)
+{
+    members[faction].set(npc);
+    npcFactions[npc * factionWords + faction / 64] |= 1ull << (faction % 64);
+}
+
+void FactionMembershipIndex::leave(int faction, int npc)
+{
+    members[faction].reset(npc);
+    npcFactions[npc * factionWords + faction / 64] &= ~(1ull << (faction % 64));
+}
+
+bool FactionMembershipIndex::isMember(int faction, int npc) const
+{
+    return (npcFactions[npc * factionWords + faction / 64] >> (faction % 64)) & 1;
+}
+
+void FactionMembershipIndex::placeNpc(int npc, int region, int location)
+{
+    if (npcRegion[npc] != region) {
+        if (npcRegion[npc] >= 0) {
+            regionNpcs[npcRegion[npc]].reset(npc);
+        }
+        if (region >= 0) {
+            regionNpcs[region].set(npc);
+        }
+        npcRegion[npc] = region;
+    }
+
+    if (npcLocation[npc] != location) {
+        if (npcLocation[npc] >= 0) {
+            locationNpcs[npcLocation[npc]].reset(npc);
+        }
+        if (location >= 0) {
+            locationNpcs[location].set(npc);
+        }
+        npcLocation[npc] = location;
+    }
+}
+
+int FactionMembershipIndex::regionOf(int npc) const
+{
+    return npcRegion[npc];
+}
+
+int FactionMembershipIndex::locationOf(int npc) const
+{
+    return npcLocation[npc];
+}
+
+const NpcSet& FactionMembershipIndex::membersOf(int faction) const
+{
+    return members[faction];
+}
+
+const NpcSet& FactionMembershipIndex::npcsInRegion(int region) const
+{
+    return regionNpcs[region];
+}
+
+const NpcSet& FactionMembershipIndex::npcsAtLocation(int location) const
+{
+    return locationNpcs[location];
+}
+
+std::vector<int> FactionMembershipIndex::factionsOf(int npc) const
+{
+    std::vector<int> result;
+    const uint64_t* row = &npcFactions[npc * factionWords];
+    for (int w = 0; w < factionWords; w++) {
+        uint64_t word = row[w];
+        while (word) {
+            result.push_back(w * 64 + lowestBit64(word));
+            word &= word - 1;
+        }
+    }
+    return result;
+}
+
+int FactionMembershipIndex::factionCountOf(int npc) const
+{
+    int total = 0;
+    const uint64_t* row = &npcFactions[npc * factionWords];
+    for (int w = 0; w < factionWords; w++) {
+        total += popcount64(row[w]);
+    }
+    return total;
+}
+
+bool FactionMembershipIndex::shareFaction(int npcA, int npcB) const
+{
+    const uint64_t* rowA = &npcFactions[npcA * factionWords];
+    const uint64_t* rowB = &npcFactions[npcB * factionWords];
+    for (int w = 0; w < factionWords; w++) {
+        if (rowA[w] & rowB[w]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+NpcSet FactionMembershipIndex::membersInRegion(int faction, int region) const
+{
+    NpcSet result = regionNpcs[region];
+    result &= members[faction];
+    return result;
+}
+
+NpcSet FactionMembershipIndex::membersAtLocation(int faction, int location) const
+{
+    NpcSet result = locationNpcs[location];
+    result &= members[faction];
+    return result;
+}
+
+int FactionMembershipIndex::countMembersInRegion(int faction, int region) const
+{
+    return NpcSet::countBoth(members[faction], regionNpcs[region]);
+}
+
+int FactionMembershipIndex::countMembersAtLocation(int faction, int location) const
+{
+    return NpcSet::countBoth(members[faction], locationNpcs[location]);
+}
+
+void FactionMembershipIndex::growNpcs(int needed)
+{
+    if (needed <= npcCapacity) {
+        return;
+    }
+
+    npcCapacity = std::max(needed, std::max(64, npcCapacity * 2));
+    for (auto& set : members) {
+        set.resize(npcCapacity);
+    }
+    for (auto& set : regionNpcs) {
+        set.resize(npcCapacity);
+    }
+    for (auto& set : locationNpcs) {
+        set.resize(npcCapacity);
+    }
+}
+
+void FactionMembershipIndex::growFactionWords(int needed)
+{
+    if (needed <= factionWords) {
+        return;
+    }
+
+    // Re-stride the reverse table
+    std::vector<uint64_t> wider(npcIds.size() * needed, 0);
+    for (size_t npc = 0; npc < npcIds.size(); npc++) {
+        std::copy(npcFactions.begin() + npc * factionWords, npcFactions.begin() + (npc + 1) * factionWords,
+            wider.begin() + npc * needed);
+    }
+    npcFactions.swap(wider);
+    factionWords = needed;
+}
+
+} // namespace oath
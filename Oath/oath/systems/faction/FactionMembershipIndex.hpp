@@ -0,0 +1,189 @@
+// systems/faction/FactionMembershipIndex.hpp
+#ifndef OATH_FACTION_MEMBERSHIP_INDEX_HPP
+#define OATH_FACTION_MEMBERSHIP_INDEX_HPP
+
+#include "Faction.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace oath {
+
+inline int popcount64(uint64_t word)
+{
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+// Index of the lowest set bit; word must be non-zero
+inline int lowestBit64(uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+// Bitset over dense NPC indices. Tracks the span of words that have ever held
+// a set bit, so sets covering one region or location only touch their own span
+// when NPCs were registered region by region.
+class NpcSet {
+public:
+    NpcSet();
+
+    void resize(int npcCount);
+    void set(int npc);
+    void reset(int npc);
+    bool test(int npc) const;
+    void clear();
+
+    int count() const;
+    bool empty() const;
+
+    // In-place set operations; the result keeps this set's size
+    NpcSet& operator&=(const NpcSet& other);
+    NpcSet& operator|=(const NpcSet& other);
+    NpcSet& subtract(const NpcSet& other);
+
+    // Size of the intersection without building it
+    static int countBoth(const NpcSet& a, const NpcSet& b);
+
+    template <typename Fn>
+    void forEach(Fn fn) const
+    {
+        for (int w = beginWord; w < endWord; w++) {
+            uint64_t word = words[w];
+            while (word) {
+                fn(w * 64 + lowestBit64(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+    // Visit the intersection without building it
+    template <typename Fn>
+    static void forEachBoth(const NpcSet& a, const NpcSet& b, Fn fn)
+    {
+        int begin = a.beginWord > b.beginWord ? a.beginWord : b.beginWord;
+        int end = a.endWord < b.endWord ? a.endWord : b.endWord;
+        for (int w = begin; w < end; w++) {
+            uint64_t word = a.words[w] & b.words[w];
+            while (word) {
+                fn(w * 64 + lowestBit64(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+    std::vector<int> toVector() const;
+
+private:
+    std::vector<uint64_t> words;
+    int beginWord; // Words outside [beginWord, endWord) are all zero
+    int endWord;
+};
+
+// Who belongs to which faction, indexed both ways over dense ids, with every
+// NPC placed in at most one region and one location. Faction::members stays
+// the saved form; FactionSystemNode keeps the two in step.
+//
+// Queries like "members of Y at location L" are a word-wise AND of two
+// bitsets restricted to the smaller span, and "which factions is X in" reads
+// one row of the reverse table instead of scanning every faction.
+class FactionMembershipIndex {
+public:
+    FactionMembershipIndex();
+
+    void clear();
+
+    // Registration; each returns the dense index, reusing it for a known id
+    int addFaction(const std::string& factionId);
+    int addNpc(const std::string& npcId);
+    int addRegion(const std::string& regionId);
+    int addLocation(const std::string& locationId);
+
+    // -1 for an unknown id
+    int factionIndex(const std::string& factionId) const;
+    int npcIndex(const std::string& npcId) const;
+    int regionIndex(const std::string& regionId) const;
+    int locationIndex(const std::string& locationId) const;
+
+    const std::string& factionId(int faction) const;
+    const std::string& npcId(int npc) const;
+    int factionCount() const;
+    int npcCount() const;
+
+    // Rebuild memberships from the factions' member sets
+    void loadFromFactions(const std::map<std::string, Faction>& factions);
+
+    void join(int faction, int npc);
+    void leave(int faction, int npc);
+    bool isMember(int faction, int npc) const;
+
+    // Move an NPC; -1 takes it out of any region or location
+    void placeNpc(int npc, int region, int location);
+    int regionOf(int npc) const;
+    int locationOf(int npc) const;
+
+    const NpcSet& membersOf(int faction) const;
+    const NpcSet& npcsInRegion(int region) const;
+    const NpcSet& npcsAtLocation(int location) const;
+
+    // Faction indices the NPC belongs to, in index order
+    std::vector<int> factionsOf(int npc) const;
+    int factionCountOf(int npc) const;
+    bool shareFaction(int npcA, int npcB) const;
+
+    NpcSet membersInRegion(int faction, int region) const;
+    NpcSet membersAtLocation(int faction, int location) const;
+    int countMembersInRegion(int faction, int region) const;
+    int countMembersAtLocation(int faction, int location) const;
+
+    // Members of the faction at the location, without allocating
+    template <typename Fn>
+    void forEachMemberAt(int faction, int location, Fn fn) const
+    {
+        NpcSet::forEachBoth(members[faction], locationNpcs[location], fn);
+    }
+
+private:
+    std::vector<std::string> factionIds;
+    std::unordered_map<std::string, int> factionIndices;
+    std::vector<std::string> npcIds;
+    std::unordered_map<std::string, int> npcIndices;
+    std::unordered_map<std::string, int> regionIndices;
+    std::unordered_map<std::string, int> locationIndices;
+
+    std::vector<NpcSet> members; // Per faction, over NPCs
+    std::vector<NpcSet> regionNpcs;
+    std::vector<NpcSet> locationNpcs;
+
+    // Per NPC, bits over factions: npcFactions[npc * factionWords + w]
+    std::vector<uint64_t> npcFactions;
+    int factionWords;
+
+    std::vector<int> npcRegion;
+    std::vector<int> npcLocation;
+
+    int npcCapacity; // Bit size of every NpcSet; grows by doubling
+
+    void growNpcs(int needed);
+    void growFactionWords(int needed);
+};
+
+} // namespace oath
+
+#endif // OATH_FACTION_MEMBERSHIP_INDEX_HPP
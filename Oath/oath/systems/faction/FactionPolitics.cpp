@@ -0,0 +1,570 @@
+// systems/faction/FactionPolitics.cpp
+#include "FactionPolitics.hpp"
+#include "systems/world/RegionNode.hpp"
+#include "utils/Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace oath {
+
+namespace {
+    float clampPower(float value)
+    {
+        return std::max(0.0f, std::min(100.0f, value));
+    }
+}
+
+FactionPoliticsSettings::FactionPoliticsSettings()
+    : baseEconomy(15.0f)
+    , economyPerOutput(15.0f)
+    , economyRate(0.01f)
+    , militaryRate(0.01f)
+    , baseInfluence(10.0f)
+    , influencePerTerritory(8.0f)
+    , influencePerAlly(3.0f)
+    , influenceRate(0.01f)
+    , warThreshold(-75)
+    , allianceThreshold(75)
+    , declareRatio(1.2f)
+    , warChance(0.05f)
+    , maxWars(2)
+    , warAttrition(0.05f)
+    , warEconomyDrain(0.03f)
+    , warScoreRate(0.02f)
+    , warNoise(1.0f)
+    , decisiveScore(25.0f)
+    , maxWarDays(365)
+    , peaceRelation(-40)
+    , solidarity(10)
+    , incidentChance(0.02f)
+    , incidentSize(15)
+    , diplomacyIntervalDays(7)
+    , relationDecayDays(30)
+    , historyYears(0)
+    , threads(std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 4))
+    , parallelMinFactions(1024)
+{
+}
+
+void FactionPoliticsSettings::loadFromJson(const json& j)
+{
+    if (!j.is_object()) {
+        return;
+    }
+
+    baseEconomy = j.value("baseEconomy", baseEconomy);
+    economyPerOutput = j.value("economyPerOutput", economyPerOutput);
+    economyRate = j.value("economyRate", economyRate);
+    militaryRate = j.value("militaryRate", militaryRate);
+    baseInfluence = j.value("baseInfluence", baseInfluence);
+    influencePerTerritory = j.value("influencePerTerritory", influencePerTerritory);
+    influencePerAlly = j.value("influencePerAlly", influencePerAlly);
+    influenceRate = j.value("influenceRate", influenceRate);
+    warThreshold = j.value("warThreshold", warThreshold);
+    allianceThreshold = j.value("allianceThreshold", allianceThreshold);
+    declareRatio = j.value("declareRatio", declareRatio);
+    warChance = j.value("warChance", warChance);
+    maxWars = j.value("maxWars", maxWars);
+    warAttrition = j.value("warAttrition", warAttrition);
+    warEconomyDrain = j.value("warEconomyDrain", warEconomyDrain);
+    warScoreRate = j.value("warScoreRate", warScoreRate);
+    warNoise = j.value("warNoise", warNoise);
+    decisiveScore = std::max(1.0f, j.value("decisiveScore", decisiveScore));
+    maxWarDays = std::max(1, j.value("maxWarDays", maxWarDays));
+    peaceRelation = j.value("peaceRelation", peaceRelation);
+    solidarity = j.value("solidarity", solidarity);
+    incidentChance = j.value("incidentChance", incidentChance);
+    incidentSize = std::max(1, j.value("incidentSize", incidentSize));
+    diplomacyIntervalDays = std::max(1, j.value("diplomacyIntervalDays", diplomacyIntervalDays));
+    relationDecayDays = std::max(0, j.value("relationDecayDays", relationDecayDays));
+    historyYears = std::max(0, j.value("historyYears", historyYears));
+    threads = std::max(1, j.value("threads", threads));
+    parallelMinFactions = std::max(1, j.value("parallelMinFactions", parallelMinFactions));
+}
+
+FactionPolitics::FactionPolitics()
+    : seed(0x0A7E5EEDull)
+    , day(0)
+    , loaded(false)
+{
+}
+
+void FactionPolitics::configure(const json& politicsConfig)
+{
+    settings.loadFromJson(politicsConfig);
+    if (politicsConfig.is_object() && politicsConfig.contains("seed")) {
+        setSeed(politicsConfig["seed"].get<uint64_t>());
+    }
+}
+
+void FactionPolitics::setSeed(uint64_t newSeed)
+{
+    seed = newSeed;
+}
+
+void FactionPolitics::bindRegion(RegionNode* region)
+{
+    if (!region) {
+        return;
+    }
+
+    territories[territoryIndex(region->nodeName)].region = region;
+    for (RegionNode* connected : region->connectedRegions) {
+        if (connected) {
+            connectTerritories(region->nodeName, connected->nodeName);
+        }
+    }
+}
+
+void FactionPolitics::setTerritoryOutput(const std::string& territoryId, float output)
+{
+    territories[territoryIndex(territoryId)].output = std::max(0.0f, output);
+}
+
+void FactionPolitics::connectTerritories(const std::string& territoryA, const std::string& territoryB)
+{
+    int a = territoryIndex(territoryA);
+    int b = territoryIndex(territoryB);
+    auto& neighbours = territories[a].neighbours;
+    if (a != b && std::find(neighbours.begin(), neighbours.end(), b) == neighbours.end()) {
+        neighbours.push_back(b);
+        territories[b].neighbours.push_back(a);
+    }
+}
+
+void FactionPolitics::load(const std::map<std::string, Faction>& factions, const FactionRelationMatrix& relations)
+{
+    int count = relations.size();
+    economic.assign(count, 0.0f);
+    military.assign(count, 0.0f);
+    influence.assign(count, 0.0f);
+    income.assign(count, 0.0f);
+    territoryCount.assign(count, 0);
+    ownedTerritories.resize(count);
+    allyCount.resize(count, 0);
+    rival.resize(count, -1);
+    warCount.assign(count, 0);
+    warTarget.assign(count, -1);
+    incidents.assign(count, { -1, 0 });
+
+    for (auto& territory : territories) {
+        territory.owner = -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        auto it = factions.find(relations.idAt(i));
+        if (it == factions.end()) {
+            continue;
+        }
+
+        const Faction& faction = it->second;
+        economic[i] = static_cast<float>(faction.economicPower);
+        military[i] = static_cast<float>(faction.militaryPower);
+        influence[i] = static_cast<float>(faction.politicalInfluence);
+        for (const auto& territoryId : faction.territories) {
+            territories[territoryIndex(territoryId)].owner = i;
+        }
+    }
+
+    // Bound regions no faction lists fall back to the region's own controller
+    for (auto& territory : territories) {
+        if (territory.owner < 0 && territory.region) {
+            territory.owner = relations.indexOf(territory.region->controllingFaction);
+        }
+    }
+
+    // Wars outlive a reload; drop any whose factions are gone
+    wars.erase(std::remove_if(wars.begin(), wars.end(), [count](const FactionWar& war) {
+        return war.attacker >= count || war.defender >= count;
+    }),
+        wars.end());
+    for (const auto& war : wars) {
+        warCount[war.attacker]++;
+        warCount[war.defender]++;
+    }
+    loaded = true;
+}
+
+void FactionPolitics::refresh(const std::map<std::string, Faction>& factions, const FactionRelationMatrix& relations)
+{
+    int count = relations.size();
+    if (!loaded || count != static_cast<int>(economic.size())) {
+        load(factions, relations);
+        return;
+    }
+
+    // store wrote the rounded floats, so a mismatch is an edit made elsewhere
+    auto pull = [](float& power, int stored) {
+        if (static_cast<int>(std::lround(power)) != stored) {
+            power = static_cast<float>(stored);
+        }
+    };
+    for (int i = 0; i < count; i++) {
+        auto it = factions.find(relations.idAt(i));
+        if (it != factions.end()) {
+            pull(economic[i], it->second.economicPower);
+            pull(military[i], it->second.militaryPower);
+            pull(influence[i], it->second.politicalInfluence);
+        }
+    }
+}
+
+void FactionPolitics::invalidate()
+{
+    loaded = false;
+}
+
+void FactionPolitics::simulateDays(int days, FactionRelationMatrix& relations)
+{
+    if (relations.size() != static_cast<int>(economic.size())) {
+        return;
+    }
+
+    for (int d = 0; d < days; d++) {
+        stepDay(relations);
+    }
+}
+
+void FactionPolitics::store(std::map<std::string, Faction>& factions, const FactionRelationMatrix& relations) const
+{
+    int count = std::min(relations.size(), static_cast<int>(economic.size()));
+    std::vector<Faction*> byIndex(count, nullptr);
+
+    for (int i = 0; i < count; i++) {
+        auto it = factions.find(relations.idAt(i));
+        if (it == factions.end()) {
+            continue;
+        }
+
+        Faction& faction = it->second;
+        byIndex[i] = &faction;
+        faction.economicPower = static_cast<int>(std::lround(economic[i]));
+        faction.militaryPower = static_cast<int>(std::lround(military[i]));
+        faction.politicalInfluence = static_cast<int>(std::lround(influence[i]));
+        faction.territories.clear();
+
+        if (warCount[i] > 0) {
+            faction.currentState = "at_war";
+        } else {
+            if (faction.currentState == "at_war") {
+                faction.currentState = "stable";
+            }
+            faction.updateStateFromPower();
+        }
+    }
+
+    for (const auto& territory : territories) {
+        if (territory.owner < 0 || territory.owner >= count) {
+            continue;
+        }
+        if (byIndex[territory.owner]) {
+            byIndex[territory.owner]->territories.push_back(territory.id);
+        }
+        if (territory.region) {
+            territory.region->controllingFaction = relations.idAt(territory.owner);
+        }
+    }
+}
+
+int FactionPolitics::getDay() const
+{
+    return day;
+}
+
+const std::vector<FactionWar>& FactionPolitics::getWars() const
+{
+    return wars;
+}
+
+const std::vector<FactionTerritory>& FactionPolitics::getTerritories() const
+{
+    return territories;
+}
+
+const std::vector<FactionHistoryEvent>& FactionPolitics::getHistory() const
+{
+    return history;
+}
+
+void FactionPolitics::clearHistory()
+{
+    history.clear();
+}
+
+std::string FactionPolitics::describe(const FactionHistoryEvent& event, const FactionRelationMatrix& relations) const
+{
+    std::string a = relations.idAt(event.factionA);
+    std::string b = relations.idAt(event.factionB);
+    std::string text = "Day " + std::to_string(event.day) + ": ";
+
+    switch (event.type) {
+    case FactionHistoryType::WarDeclared:
+        return text + a + " declared war on " + b;
+    case FactionHistoryType::TerritoryTaken:
+        return text + a + " took " + territories[event.territory].id + " from " + b;
+    case FactionHistoryType::WhitePeace:
+        return text + a + " and " + b + " made peace";
+    }
+    return text;
+}
+
+int FactionPolitics::territoryIndex(const std::string& territoryId)
+{
+    auto it = territoryIndices.find(territoryId);
+    if (it != territoryIndices.end()) {
+        return it->second;
+    }
+
+    // Its owner comes from the factions or its region on the next load
+    int index = static_cast<int>(territories.size());
+    territories.push_back({ territoryId, -1, 1.0f, {}, nullptr });
+    territoryIndices[territoryId] = index;
+    loaded = false;
+    return index;
+}
+
+float FactionPolitics::random(int faction, int stream) const
+{
+    uint64_t h = splitMix(seed ^ splitMix(static_cast<uint64_t>(day) << 32 | static_cast<uint32_t>(faction)) ^ static_cast<uint64_t>(stream) * 0xD1B54A32D192ED03ull);
+    return static_cast<float>(h >> 40) / static_cast<float>(1ull << 24);
+}
+
+void FactionPolitics::forEachFaction(int count, const std::function<void(int, int)>& work) const
+{
+    int workers = count >= settings.parallelMinFactions ? settings.threads : 1;
+    forEachSlice(count, workers, [&work](int, int begin, int end) { work(begin, end); });
+}
+
+void FactionPolitics::stepDay(FactionRelationMatrix& relations)
+{
+    day++;
+    int count = relations.size();
+
+    // Territory output becomes faction income
+    std::fill(income.begin(), income.end(), 0.0f);
+    std::fill(territoryCount.begin(), territoryCount.end(), 0);
+    for (auto& owned : ownedTerritories) {
+        owned.clear();
+    }
+    for (size_t t = 0; t < territories.size(); t++) {
+        int owner = territories[t].owner;
+        if (owner >= 0 && owner < count) {
+            income[owner] += territories[t].output;
+            territoryCount[owner]++;
+            ownedTerritories[owner].push_back(static_cast<int>(t));
+        }
+    }
+
+    // Parallel phases only write their own factions' slots
+    forEachFaction(count, [this, &relations](int begin, int end) {
+        updatePowers(begin, end);
+        reviewRelations(begin, end, relations);
+    });
+
+    // Apply proposals in faction order so the outcome never depends on threading
+    for (int i = 0; i < count; i++) {
+        const Incident& incident = incidents[i];
+        if (incident.other >= 0) {
+            relations.change(i, incident.other, incident.amount);
+            relations.change(incident.other, i, incident.amount);
+        }
+
+        int target = warTarget[i];
+        if (target >= 0 && warCount[i] < settings.maxWars && !atWar(i, target)) {
+            declareWar(i, target, relations);
+        }
+    }
+
+    resolveWars(relations);
+
+    if (settings.relationDecayDays > 0 && day % settings.relationDecayDays == 0) {
+        relations.relaxTowardNeutral(1);
+    }
+}
+
+void FactionPolitics::updatePowers(int begin, int end)
+{
+    for (int i = begin; i < end; i++) {
+        float wars = static_cast<float>(warCount[i]);
+
+        float economyTarget = clampPower(settings.baseEconomy + settings.economyPerOutput * income[i]);
+        economic[i] = clampPower(economic[i] + settings.economyRate * (economyTarget - economic[i]) - settings.warEconomyDrain * wars);
+        military[i] = clampPower(military[i] + settings.militaryRate * (economic[i] - military[i]) - settings.warAttrition * wars);
+
+        float influenceTarget = clampPower(settings.baseInfluence + settings.influencePerTerritory * territoryCount[i] + settings.influencePerAlly * allyCount[i]);
+        influence[i] += settings.influenceRate * (influenceTarget - influence[i]);
+    }
+}
+
+void FactionPolitics::reviewRelations(int begin, int end, const FactionRelationMatrix& relations)
+{
+    int count = relations.size();
+    int8_t allianceThreshold = static_cast<int8_t>(std::clamp(settings.allianceThreshold, -100, 100));
+
+    for (int i = begin; i < end; i++) {
+        warTarget[i] = -1;
+        incidents[i] = { -1, 0 };
+
+        // Incidents sour (or now and then warm) relations: half the time with an old
+        // rival, otherwise with the owner of a bordering territory, or anyone if landlocked
+        if (count > 1 && random(i, 1) < settings.incidentChance) {
+            float pick = random(i, 2);
+            bool feud = pick < 0.5f && rival[i] >= 0;
+            int other = feud ? rival[i] : borderingFaction(i, pick);
+            if (other < 0) {
+                other = std::min(count - 1, static_cast<int>(pick * count));
+            }
+            int amount = static_cast<int>(std::floor(random(i, 3) * (settings.incidentSize * 1.5f + 1.0f))) - settings.incidentSize;
+            if (feud) {
+                amount = -std::abs(amount) - 1; // Feuds only get worse
+            }
+            if (other != i && amount != 0) {
+                incidents[i] = { other, amount };
+            }
+        }
+
+        // Each faction reviews its standing on its own day of the cycle
+        if ((day + i) % settings.diplomacyIntervalDays != 0) {
+            continue;
+        }
+
+        // Two reductions over the int8 row; the diagonal is always 0
+        const int8_t* row = relations.row(i);
+        int allies = 0;
+        int8_t lowest = 100;
+        for (int j = 0; j < count; j++) {
+            allies += row[j] >= allianceThreshold ? 1 : 0;
+            lowest = std::min(lowest, row[j]);
+        }
+        allyCount[i] = allies;
+
+        rival[i] = -1;
+        if (lowest > settings.warThreshold / 2) {
+            continue;
+        }
+        rival[i] = static_cast<int>(std::find(row, row + count, lowest) - row);
+
+        // A despised rival is attacked readily when the faction can beat it, and rarely otherwise
+        if (lowest <= settings.warThreshold && warCount[i] < settings.maxWars) {
+            float confidence = military[i] / std::max(1.0f, settings.declareRatio * military[rival[i]]);
+            if (random(i, 0) < settings.warChance * std::min(1.0f, confidence)) {
+                warTarget[i] = rival[i];
+            }
+        }
+    }
+}
+
+void FactionPolitics::declareWar(int attacker, int defender, FactionRelationMatrix& relations)
+{
+    wars.push_back({ attacker, defender, day, 0.0f });
+    warCount[attacker]++;
+    warCount[defender]++;
+    history.push_back({ day, FactionHistoryType::WarDeclared, attacker, defender, -1 });
+
+    relations.set(defender, attacker, std::min(relations.get(defender, attacker), settings.warThreshold));
+
+    // The defender's allies and the attacker's enemies close ranks
+    int count = relations.size();
+    for (int k = 0; k < count; k++) {
+        if (k == attacker || k == defender) {
+            continue;
+        }
+        if (relations.get(defender, k) >= settings.allianceThreshold) {
+            relations.change(k, attacker, -settings.solidarity);
+            relations.change(attacker, k, -settings.solidarity);
+        }
+        if (relations.get(k, attacker) <= settings.warThreshold / 2) {
+            relations.change(k, defender, settings.solidarity);
+            relations.change(defender, k, settings.solidarity);
+        }
+    }
+}
+
+void FactionPolitics::resolveWars(FactionRelationMatrix& relations)
+{
+    size_t kept = 0;
+    for (size_t w = 0; w < wars.size(); w++) {
+        FactionWar& war = wars[w];
+        float advantage = military[war.attacker] - military[war.defender];
+        war.score += settings.warScoreRate * advantage + settings.warNoise * (2.0f * random(war.attacker, 16 + war.defender) - 1.0f);
+
+        int winner = -1;
+        int loser = -1;
+        if (war.score >= settings.decisiveScore) {
+            winner = war.attacker;
+            loser = war.defender;
+        } else if (war.score <= -settings.decisiveScore) {
+            winner = war.defender;
+            loser = war.attacker;
+        } else if (day - war.startDay < settings.maxWarDays) {
+            wars[kept++] = war;
+            continue;
+        }
+
+        if (winner >= 0) {
+            int spoils = pickSpoils(winner, loser);
+            if (spoils >= 0) {
+                territories[spoils].owner = winner;
+            }
+            influence[winner] = clampPower(influence[winner] + 5.0f);
+            influence[loser] = clampPower(influence[loser] - 5.0f);
+            history.push_back({ day, FactionHistoryType::TerritoryTaken, winner, loser, spoils });
+        } else {
+            history.push_back({ day, FactionHistoryType::WhitePeace, war.attacker, war.defender, -1 });
+        }
+
+        warCount[war.attacker]--;
+        warCount[war.defender]--;
+        relations.set(war.attacker, war.defender, settings.peaceRelation);
+        relations.set(war.defender, war.attacker, settings.peaceRelation);
+    }
+    wars.resize(kept);
+}
+
+int FactionPolitics::borderingFaction(int faction, float pick) const
+{
+    const auto& owned = ownedTerritories[faction];
+    if (owned.empty()) {
+        return -1;
+    }
+
+    const auto& neighbours = territories[owned[static_cast<size_t>(pick * owned.size()) % owned.size()]].neighbours;
+    if (neighbours.empty()) {
+        return -1;
+    }
+
+    int owner = territories[neighbours[static_cast<size_t>(random(faction, 5) * neighbours.size()) % neighbours.size()]].owner;
+    return owner != faction ? owner : -1;
+}
+
+int FactionPolitics::pickSpoils(int winner, int loser) const
+{
+    // Richest of the loser's territories, preferring those bordering the winner
+    int best = -1;
+    bool bestBorders = false;
+    for (size_t t = 0; t < territories.size(); t++) {
+        const FactionTerritory& territory = territories[t];
+        if (territory.owner != loser) {
+            continue;
+        }
+
+        bool borders = std::any_of(territory.neighbours.begin(), territory.neighbours.end(),
+            [this, winner](int n) { return territories[n].owner == winner; });
+        if (best < 0 || (borders && !bestBorders) || (borders == bestBorders && territory.output > territories[best].output)) {
+            best = static_cast<int>(t);
+            bestBorders = borders;
+        }
+    }
+    return best;
+}
+
+bool FactionPolitics::atWar(int a, int b) const
+{
+    return std::any_of(wars.begin(), wars.end(), [a, b](const FactionWar& war) {
+        return (war.attacker == a && war.defender == b) || (war.attacker == b && war.defender == a);
+    });
+}
+
+} // namespace oath
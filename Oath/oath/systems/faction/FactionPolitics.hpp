@@ -0,0 +1,189 @@
+// systems/faction/FactionPolitics.hpp
+#ifndef OATH_FACTION_POLITICS_HPP
+#define OATH_FACTION_POLITICS_HPP
+
+#include "Faction.hpp"
+#include "FactionRelationMatrix.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using json = nlohmann::json;
+
+class RegionNode;
+
+namespace oath {
+
+// Tuning for the daily political simulation
+struct FactionPoliticsSettings {
+    float baseEconomy; // Economic power a faction drifts to with no territory
+    float economyPerOutput; // Extra economic power per unit of territory output
+    float economyRate; // Fraction of the gap to the economic target closed per day
+    float militaryRate; // Daily pull of military power toward economic power
+    float baseInfluence;
+    float influencePerTerritory;
+    float influencePerAlly;
+    float influenceRate;
+
+    int warThreshold; // Relation at or below which a faction may declare war
+    int allianceThreshold; // Relation at or above which factions count as allies
+    float declareRatio; // Attacker wants this much of the defender's military; weaker odds make war less likely
+    float warChance; // Chance per review that a confident faction at war-level relations acts on it
+    int maxWars; // Concurrent wars a faction will start
+    float warAttrition; // Military lost per day per war
+    float warEconomyDrain; // Economic power lost per day per war
+    float warScoreRate; // Daily war score per point of military advantage
+    float warNoise; // Daily random swing in war score
+    float decisiveScore; // War score that ends a war with a territory transfer
+    int maxWarDays; // Wars end in a white peace after this long
+    int peaceRelation; // Relation both sides are set to when a war ends
+    int solidarity; // Relation shift toward the defender for its allies and the attacker's enemies
+
+    float incidentChance; // Daily chance of an incident per faction, with a rival, a neighbour or anyone
+    int incidentSize; // Largest relation change from an incident
+    int diplomacyIntervalDays; // Each faction reviews its relations this often
+    int relationDecayDays; // All relations move one point toward neutral this often
+
+    int historyYears; // Worldgen history simulated when the faction system starts
+
+    int threads;
+    int parallelMinFactions; // Below this many factions one thread does the work
+
+    FactionPoliticsSettings();
+    void loadFromJson(const json& j);
+};
+
+// Land a faction can hold; backed by a RegionNode when one is bound
+struct FactionTerritory {
+    std::string id;
+    int owner; // Dense faction index, -1 if unclaimed
+    float output; // Economic output, e.g. from the region's markets
+    std::vector<int> neighbours; // Territory indices
+    RegionNode* region;
+};
+
+enum class FactionHistoryType {
+    WarDeclared,
+    TerritoryTaken,
+    WhitePeace
+};
+
+struct FactionHistoryEvent {
+    int day;
+    FactionHistoryType type;
+    int factionA; // Attacker or winner
+    int factionB; // Defender or loser
+    int territory; // Territory that changed hands, -1 if none
+};
+
+struct FactionWar {
+    int attacker;
+    int defender;
+    int startDay;
+    float score; // Positive favours the attacker
+};
+
+// Daily faction simulation. Territories feed economic power, economy feeds
+// military power, and territory count and allies feed influence. Wars start
+// from the relation matrix when a faction despises a weaker neighbour, and
+// end with a territory transfer or a white peace. Allies of a victim and
+// enemies of an aggressor close ranks, so blocs emerge over time.
+//
+// Power updates and relation scans are data-parallel over factions and write
+// only per-faction slots; every random draw is a hash of (seed, day, faction),
+// so results are the same for any thread count. Changes to the matrix and
+// territories are then applied in faction order.
+//
+// Powers are kept as floats between calls, since a day moves them by well
+// under a point; Faction only ever sees them rounded. refresh reloads from
+// the factions only when their shape changed.
+class FactionPolitics {
+public:
+    FactionPoliticsSettings settings;
+
+    FactionPolitics();
+
+    // Load settings from the "politics" config block
+    void configure(const json& politicsConfig);
+    void setSeed(uint64_t newSeed);
+
+    // Register a region as a territory; neighbours come from connectedRegions
+    void bindRegion(RegionNode* region);
+    void setTerritoryOutput(const std::string& territoryId, float output);
+
+    // Mark two territories as bordering each other (for worldgen without region nodes)
+    void connectTerritories(const std::string& territoryA, const std::string& territoryB);
+
+    // Pull powers and territory ownership from the factions, indexed like relations
+    void load(const std::map<std::string, Faction>& factions, const FactionRelationMatrix& relations);
+
+    // Full load after invalidate, a new territory or a change in faction count;
+    // otherwise only powers edited on a faction since the last store are taken
+    void refresh(const std::map<std::string, Faction>& factions, const FactionRelationMatrix& relations);
+    void invalidate();
+
+    // Run whole days; relations are updated in place
+    void simulateDays(int days, FactionRelationMatrix& relations);
+
+    // Write powers, states and territories back to the factions and bound regions
+    void store(std::map<std::string, Faction>& factions, const FactionRelationMatrix& relations) const;
+
+    int getDay() const;
+    const std::vector<FactionWar>& getWars() const;
+    const std::vector<FactionTerritory>& getTerritories() const;
+    const std::vector<FactionHistoryEvent>& getHistory() const;
+    void clearHistory();
+
+    std::string describe(const FactionHistoryEvent& event, const FactionRelationMatrix& relations) const;
+
+private:
+    struct Incident {
+        int other;
+        int amount;
+    };
+
+    uint64_t seed;
+    int day;
+    bool loaded;
+
+    std::vector<FactionTerritory> territories;
+    std::unordered_map<std::string, int> territoryIndices;
+
+    // Per faction, by dense index
+    std::vector<float> economic;
+    std::vector<float> military;
+    std::vector<float> influence;
+    std::vector<float> income;
+    std::vector<int> territoryCount;
+    std::vector<std::vector<int>> ownedTerritories;
+    std::vector<int> allyCount;
+    std::vector<int> warCount;
+    std::vector<int> rival; // Most hated faction at the last review, -1 if none hated
+    std::vector<int> warTarget; // Proposed war this day, -1 if none
+    std::vector<Incident> incidents;
+
+    std::vector<FactionWar> wars;
+    std::vector<FactionHistoryEvent> history;
+
+    int territoryIndex(const std::string& territoryId);
+    float random(int faction, int stream) const;
+    void forEachFaction(int count, const std::function<void(int, int)>& work) const;
+
+    void stepDay(FactionRelationMatrix& relations);
+    void updatePowers(int begin, int end);
+    void reviewRelations(int begin, int end, const FactionRelationMatrix& relations);
+    void declareWar(int attacker, int defender, FactionRelationMatrix& relations);
+    void resolveWars(FactionRelationMatrix& relations);
+    int borderingFaction(int faction, float pick) const;
+    int pickSpoils(int winner, int loser) const;
+    bool atWar(int a, int b) const;
+};
+
+} // namespace oath
+
+#endif // OATH_FACTION_POLITICS_HPP
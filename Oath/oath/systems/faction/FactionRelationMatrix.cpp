@@ -0,0 +1,276 @@
+// systems/faction/FactionRelationMatrix.cpp
+#include "FactionRelationMatrix.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace oath {
+
+FactionRippleSettings::FactionRippleSettings()
+    : hops(1)
+    , decay(0.5f)
+    , minimumChange(5)
+    , relationThreshold(50)
+    , allyShare(0.5f)
+    , enemyShare(1.0f / 3.0f)
+{
+}
+
+void FactionRippleSettings::loadFromJson(const json& j)
+{
+    if (!j.is_object()) {
+        return;
+    }
+
+    hops = std::max(0, j.value("hops", hops));
+    decay = std::clamp(j.value("decay", decay), 0.0f, 1.0f);
+    minimumChange = std::max(0, j.value("minimumChange", minimumChange));
+    relationThreshold = std::clamp(j.value("relationThreshold", relationThreshold), 1, 100);
+    allyShare = j.value("allyShare", allyShare);
+    enemyShare = j.value("enemyShare", enemyShare);
+}
+
+FactionRelationMatrix::FactionRelationMatrix()
+    : capacity(0)
+    , rippleDirty(true)
+{
+    // Default thresholds if not loaded from JSON
+    loadThresholds({ { "war", -75 },
+        { "hostile", -50 },
+        { "unfriendly", -20 },
+        { "neutral", 20 },
+        { "friendly", 50 },
+        { "cordial", 75 },
+        { "allied", 100 } });
+}
+
+void FactionRelationMatrix::clear()
+{
+    ids.clear();
+    indices.clear();
+    values.clear();
+    capacity = 0;
+    rippleEdges.clear();
+    rippleDirty = true;
+}
+
+int FactionRelationMatrix::addFaction(const std::string& factionId)
+{
+    auto it = indices.find(factionId);
+    if (it != indices.end()) {
+        return it->second;
+    }
+
+    int index = static_cast<int>(ids.size());
+    if (index >= capacity) {
+        grow(index + 1);
+    }
+
+    ids.push_back(factionId);
+    indices[factionId] = index;
+    rippleDirty = true;
+    return index;
+}
+
+int FactionRelationMatrix::indexOf(const std::string& factionId) const
+{
+    auto it = indices.find(factionId);
+    return it != indices.end() ? it->second : -1;
+}
+
+const std::string& FactionRelationMatrix::idAt(int index) const
+{
+    return ids[index];
+}
+
+int FactionRelationMatrix::size() const
+{
+    return static_cast<int>(ids.size());
+}
+
+int FactionRelationMatrix::get(int a, int b) const
+{
+    return values[static_cast<size_t>(a) * capacity + b];
+}
+
+void FactionRelationMatrix::set(int a, int b, int value)
+{
+    int8_t& cell = values[static_cast<size_t>(a) * capacity + b];
+    int clamped = std::max(-100, std::min(100, value));
+
+    // Only a change in ripple weight invalidates the sparse edges
+    if (rippleWeight(cell) != rippleWeight(clamped)) {
+        rippleDirty = true;
+    }
+    cell = static_cast<int8_t>(clamped);
+}
+
+void FactionRelationMatrix::change(int a, int b, int amount)
+{
+    set(a, b, get(a, b) + amount);
+}
+
+const int8_t* FactionRelationMatrix::row(int a) const
+{
+    return &values[static_cast<size_t>(a) * capacity];
+}
+
+void FactionRelationMatrix::relaxTowardNeutral(int step)
+{
+    // Branch-free so the whole matrix is one vectorized pass
+    int8_t limit = static_cast<int8_t>(std::max(0, std::min(100, step)));
+    for (int8_t& cell : values) {
+        cell = static_cast<int8_t>(cell - std::clamp<int8_t>(cell, -limit, limit));
+    }
+    rippleDirty = true;
+}
+
+void FactionRelationMatrix::loadThresholds(const json& thresholds)
+{
+    if (!thresholds.is_object() || thresholds.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<int, std::string>> sorted;
+    for (auto& [state, value] : thresholds.items()) {
+        sorted.push_back({ value.get<int>(), state });
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    stateNames.clear();
+    for (const auto& [threshold, state] : sorted) {
+        stateNames.push_back(state);
+    }
+
+    // Highest threshold the value reaches, or the lowest state if none
+    for (int value = -100; value <= 100; value++) {
+        uint8_t state = 0;
+        for (size_t i = 0; i < sorted.size(); i++) {
+            if (value >= sorted[i].first) {
+                state = static_cast<uint8_t>(i);
+            }
+        }
+        stateByValue[value + 100] = state;
+    }
+}
+
+const std::string& FactionRelationMatrix::stateFor(int value) const
+{
+    return stateNames[stateByValue[std::max(-100, std::min(100, value)) + 100]];
+}
+
+const std::string& FactionRelationMatrix::stateOf(int a, int b) const
+{
+    return stateFor(get(a, b));
+}
+
+void FactionRelationMatrix::configureRipple(const json& rippleConfig)
+{
+    rippleSettings.loadFromJson(rippleConfig);
+    rippleDirty = true;
+}
+
+const FactionRippleSettings& FactionRelationMatrix::getRippleSettings() const
+{
+    return rippleSettings;
+}
+
+void FactionRelationMatrix::propagate(int source, int amount, std::vector<float>& out) const
+{
+    int count = size();
+    out.assign(count, 0.0f);
+    if (source < 0 || source >= count || std::abs(amount) < rippleSettings.minimumChange) {
+        return;
+    }
+
+    if (rippleDirty) {
+        rebuildRippleEdges();
+    }
+
+    std::vector<float> frontier(count, 0.0f);
+    std::vector<float> next(count, 0.0f);
+    frontier[source] = static_cast<float>(amount);
+
+    float scale = 1.0f;
+    for (int hop = 0; hop < rippleSettings.hops; hop++) {
+        std::fill(next.begin(), next.end(), 0.0f);
+
+        // Sparse mat-vec: only factions the ripple reached pass it on
+        bool reached = false;
+        for (int i = 0; i < count; i++) {
+            float carried = frontier[i];
+            if (carried == 0.0f) {
+                continue;
+            }
+            for (const RippleEdge& edge : rippleEdges[i]) {
+                next[edge.target] += edge.weight * carried;
+                reached = true;
+            }
+        }
+        if (!reached) {
+            break;
+        }
+
+        // Ripples never come back around to the faction that started them
+        next[source] = 0.0f;
+
+        // Dense passes over contiguous floats; the compiler vectorizes these
+        const float* nextData = next.data();
+        float* outData = out.data();
+        for (int i = 0; i < count; i++) {
+            outData[i] += scale * nextData[i];
+        }
+
+        frontier.swap(next);
+        scale *= rippleSettings.decay;
+    }
+}
+
+void FactionRelationMatrix::grow(int minimumCapacity)
+{
+    int newCapacity = std::max({ minimumCapacity, capacity * 2, 8 });
+    std::vector<int8_t> resized(static_cast<size_t>(newCapacity) * newCapacity, 0);
+
+    int count = size();
+    for (int row = 0; row < count; row++) {
+        std::copy_n(values.begin() + static_cast<size_t>(row) * capacity, count,
+            resized.begin() + static_cast<size_t>(row) * newCapacity);
+    }
+
+    values.swap(resized);
+    capacity = newCapacity;
+}
+
+float FactionRelationMatrix::rippleWeight(int value) const
+{
+    // Allies - smaller same-direction effect; enemies - smaller opposite-direction effect
+    if (value >= rippleSettings.relationThreshold) {
+        return rippleSettings.allyShare;
+    }
+    if (value <= -rippleSettings.relationThreshold) {
+        return -rippleSettings.enemyShare;
+    }
+    return 0.0f;
+}
+
+void FactionRelationMatrix::rebuildRippleEdges() const
+{
+    int count = size();
+    rippleEdges.assign(count, {});
+
+    for (int a = 0; a < count; a++) {
+        const int8_t* row = &values[static_cast<size_t>(a) * capacity];
+        for (int b = 0; b < count; b++) {
+            if (a == b) {
+                continue;
+            }
+            float weight = rippleWeight(row[b]);
+            if (weight != 0.0f) {
+                rippleEdges[a].push_back({ b, weight });
+            }
+        }
+    }
+
+    rippleDirty = false;
+}
+
+} // namespace oath
@@ -0,0 +1,97 @@
+// systems/faction/FactionRelationMatrix.hpp
+#ifndef OATH_FACTION_RELATION_MATRIX_HPP
+#define OATH_FACTION_RELATION_MATRIX_HPP
+
+#include <array>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace oath {
+
+// How a reputation change spreads through faction relations
+struct FactionRippleSettings {
+    int hops; // How far ripples travel; 1 = direct allies and enemies only
+    float decay; // Scale applied at each hop past the first
+    int minimumChange; // Reputation changes smaller than this do not ripple
+    int relationThreshold; // |relation| needed for a faction to pass ripples on
+    float allyShare; // Share passed to factions at or above +threshold
+    float enemyShare; // Share passed, reversed, to factions at or below -threshold
+
+    FactionRippleSettings();
+    void loadFromJson(const json& j);
+};
+
+// Relations between every pair of factions. Factions get dense indices and
+// relations live in an N x N int8 matrix (-100 to 100), so a lookup is an
+// index into one array. Relation states come from one threshold table shared
+// by all pairs. Strong relations are also kept as a sparse weight list per
+// faction, which reputation ripples walk hop by hop.
+class FactionRelationMatrix {
+public:
+    FactionRelationMatrix();
+
+    void clear();
+
+    // Returns the faction's index, adding a neutral row and column if new
+    int addFaction(const std::string& factionId);
+
+    // -1 if the faction is unknown
+    int indexOf(const std::string& factionId) const;
+    const std::string& idAt(int index) const;
+    int size() const;
+
+    int get(int a, int b) const;
+    void set(int a, int b, int value);
+    void change(int a, int b, int amount);
+
+    // Contiguous relations of faction a toward every faction, for bulk scans
+    const int8_t* row(int a) const;
+
+    // Move every relation step points toward neutral
+    void relaxTowardNeutral(int step);
+
+    // Replace the state thresholds shared by every relation
+    void loadThresholds(const json& thresholds);
+    const std::string& stateFor(int value) const;
+    const std::string& stateOf(int a, int b) const;
+
+    // Load the "reputationRipple" config block
+    void configureRipple(const json& rippleConfig);
+    const FactionRippleSettings& getRippleSettings() const;
+
+    // Spread a reputation change from source through up to hops relations.
+    // out[i] receives the change for faction i; the source itself gets 0.
+    void propagate(int source, int amount, std::vector<float>& out) const;
+
+private:
+    struct RippleEdge {
+        int target;
+        float weight;
+    };
+
+    FactionRippleSettings rippleSettings;
+    std::vector<std::string> ids;
+    std::unordered_map<std::string, int> indices;
+    std::vector<int8_t> values; // Row-major, stride == capacity
+    int capacity;
+
+    std::vector<std::string> stateNames; // Sorted by threshold
+    std::array<uint8_t, 201> stateByValue; // Relation + 100 -> index into stateNames
+
+    // Rebuilt lazily when a relation crosses the ripple threshold
+    mutable std::vector<std::vector<RippleEdge>> rippleEdges;
+    mutable bool rippleDirty;
+
+    void grow(int minimumCapacity);
+    float rippleWeight(int value) const;
+    void rebuildRippleEdges() const;
+};
+
+} // namespace oath
+
+#endif // OATH_FACTION_RELATION_MATRIX_HPP
@@ -1,9 +1,16 @@
 // systems/faction/FactionSystemNode.cpp
 #include "FactionSystemNode.hpp"
+#include "core/TAController.hpp"
+#include "systems/economy/EconomicSystemNode.hpp"
+#include "systems/world/LocationNode.hpp"
+#include "systems/world/RegionNode.hpp"
+#include "systems/world/TimeNode.hpp"
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <random>
+#include <set>
 
 namespace oath {
 
@@ -19,6 +26,7 @@ void FactionSystemNode::loadFromJson()
     // Clear existing data
     factions.clear();
     factionRelations.clear();
+    politics.invalidate();
 
     try {
         // Check if file exists
@@ -101,21 +109,35 @@ void FactionSystemNode::loadFromJson()
             }
         }
 
+        // Apply global relation thresholds and ripple settings if available
+        if (!relationStatesJson.is_null()) {
+            factionRelations.loadThresholds(relationStatesJson);
+        }
+        if (j.contains("reputationRipple")) {
+            factionRelations.configureRipple(j["reputationRipple"]);
+        }
+        if (j.contains("politics")) {
+            politics.configure(j["politics"]);
+        }
+
+        // Every faction gets a dense index, in id order
+        for (const auto& [factionId, faction] : factions) {
+            factionRelations.addFaction(factionId);
+        }
+        membership.clear();
+        membership.loadFromFactions(factions);
+
         // Load faction relations
         if (j.contains("factionRelations") && j["factionRelations"].is_object()) {
             for (auto& [factionA, relations] : j["factionRelations"].items()) {
-                if (relations.is_object()) {
-                    for (auto& [factionB, value] : relations.items()) {
-                        // Create the relationship with value from JSON
-                        FactionRelationship relationship(factionA, factionB, value);
-
-                        // Apply global relation thresholds if available
-                        if (!relationStatesJson.is_null()) {
-                            relationship.loadThresholds(relationStatesJson);
-                        }
-
-                        // Store the relationship
-                        factionRelations[factionA][factionB] = relationship;
+                int a = factionRelations.indexOf(factionA);
+                if (a < 0 || !relations.is_object()) {
+                    continue;
+                }
+                for (auto& [factionB, value] : relations.items()) {
+                    int b = factionRelations.indexOf(factionB);
+                    if (b >= 0 && b != a) {
+                        factionRelations.set(a, b, value.get<int>());
                     }
                 }
             }
@@ -147,10 +169,14 @@ bool FactionSystemNode::saveToJson(const std::string& outputPath)
 
         // Save faction relations
         j["factionRelations"] = json::object();
-        for (const auto& [factionA, relations] : factionRelations) {
-            j["factionRelations"][factionA] = json::object();
-            for (const auto& [factionB, relation] : relations) {
-                j["factionRelations"][factionA][factionB] = relation.relationValue;
+        for (int a = 0; a < factionRelations.size(); a++) {
+            json& row = j["factionRelations"][factionRelations.idAt(a)];
+            row = json::object();
+            for (int b = 0; b < factionRelations.size(); b++) {
+                int value = factionRelations.get(a, b);
+                if (b != a && value != 0) {
+                    row[factionRelations.idAt(b)] = value;
+                }
             }
         }
 
@@ -177,79 +203,111 @@ void FactionSystemNode::addFaction(const Faction& faction)
 {
     factions[faction.id] = faction;
 
-    // Initialize relationships with existing factions
-    for (const auto& [otherId, otherFaction] : factions) {
-        if (otherId != faction.id) {
-            // Default relationship is neutral (0)
-            FactionRelationship relationship(faction.id, otherId);
-
-            // Apply global relation thresholds if available from a faction that has them
-            if (!factionRelations.empty() && !factionRelations.begin()->second.empty()) {
-                auto& someRelation = factionRelations.begin()->second.begin()->second;
-                relationship.relationThresholds = someRelation.relationThresholds;
-                relationship.updateState();
-            }
+    // New row and column start neutral (0) toward every existing faction
+    factionRelations.addFaction(faction.id);
+    politics.invalidate();
 
-            factionRelations[faction.id][otherId] = relationship;
-            factionRelations[otherId][faction.id] = FactionRelationship(otherId, faction.id);
-        }
+    int index = membership.addFaction(faction.id);
+    for (const auto& member : faction.members) {
+        membership.join(index, membership.addNpc(member));
     }
 }
 
-bool FactionSystemNode::adjustFactionRelation(const std::string& factionA, const std::string& factionB, int amount)
+void FactionSystemNode::placeNpc(const std::string& npcId, const std::string& regionId, const std::string& locationId)
 {
-    if (factions.find(factionA) == factions.end() || factions.find(factionB) == factions.end()) {
-        return false;
-    }
+    int region = regionId.empty() ? -1 : membership.addRegion(regionId);
+    int location = locationId.empty() ? -1 : membership.addLocation(locationId);
+    membership.placeNpc(membership.addNpc(npcId), region, location);
+}
 
-    // Make sure the relation maps exist
-    if (factionRelations.find(factionA) == factionRelations.end()) {
-        factionRelations[factionA] = std::map<std::string, FactionRelationship>();
-    }
-    if (factionRelations[factionA].find(factionB) == factionRelations[factionA].end()) {
-        factionRelations[factionA][factionB] = FactionRelationship(factionA, factionB);
+int FactionSystemNode::countMembersAtLocation(const std::string& factionId, const std::string& locationId) const
+{
+    int faction = membership.factionIndex(factionId);
+    int location = membership.locationIndex(locationId);
+    if (faction < 0 || location < 0) {
+        return 0;
     }
+    return membership.countMembersAtLocation(faction, location);
+}
 
-    if (factionRelations.find(factionB) == factionRelations.end()) {
-        factionRelations[factionB] = std::map<std::string, FactionRelationship>();
+void FactionSystemNode::generateMinorFactions(int count, unsigned int seed)
+{
+    static const std::vector<std::string> prefixes = {
+        "Ashen", "Briar", "Copper", "Dusk", "Ember", "Gilded", "Hollow", "Iron", "Jade", "Lantern",
+        "Moss", "Night", "Oak", "Pale", "Quill", "Raven", "Salt", "Thorn", "Vale", "Willow"
+    };
+    static const std::vector<std::string> suffixes = {
+        "Brotherhood", "Circle", "Company", "Covenant", "Guild", "Hand", "League", "Lodge", "Order", "Syndicate"
+    };
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> prefixDist(0, static_cast<int>(prefixes.size()) - 1);
+    std::uniform_int_distribution<int> suffixDist(0, static_cast<int>(suffixes.size()) - 1);
+    std::uniform_int_distribution<int> relationDist(-100, 100);
+    std::uniform_int_distribution<int> powerDist(5, 40);
+
+    int firstMinor = factionRelations.size();
+    for (int n = 0; n < count; n++) {
+        std::string id = "minor_" + std::to_string(firstMinor + n);
+        if (factions.count(id)) {
+            continue;
+        }
+
+        Faction faction(id, "The " + prefixes[prefixDist(rng)] + " " + suffixes[suffixDist(rng)]);
+        faction.currentState = "growing";
+        faction.economicPower = powerDist(rng);
+        faction.militaryPower = powerDist(rng);
+        faction.politicalInfluence = powerDist(rng);
+        addFaction(faction);
+
+        // Tie the newcomer to a handful of existing factions, both ways
+        int index = factionRelations.indexOf(id);
+        if (index <= 0) {
+            continue;
+        }
+        std::uniform_int_distribution<int> neighbourDist(0, index - 1);
+        for (int k = 0; k < 4; k++) {
+            int other = neighbourDist(rng);
+            int value = relationDist(rng);
+            factionRelations.set(index, other, value);
+            factionRelations.set(other, index, value);
+        }
     }
-    if (factionRelations[factionB].find(factionA) == factionRelations[factionB].end()) {
-        factionRelations[factionB][factionA] = FactionRelationship(factionB, factionA);
+}
+
+bool FactionSystemNode::adjustFactionRelation(const std::string& factionA, const std::string& factionB, int amount)
+{
+    int a = factionRelations.indexOf(factionA);
+    int b = factionRelations.indexOf(factionB);
+    if (a < 0 || b < 0 || a == b) {
+        return false;
     }
 
-    factionRelations[factionA][factionB].changeRelation(amount);
-    factionRelations[factionB][factionA].changeRelation(amount);
+    factionRelations.change(a, b, amount);
+    factionRelations.change(b, a, amount);
     return true;
 }
 
 int FactionSystemNode::getFactionRelation(const std::string& factionA, const std::string& factionB) const
 {
-    auto factionAIt = factionRelations.find(factionA);
-    if (factionAIt == factionRelations.end()) {
+    int a = factionRelations.indexOf(factionA);
+    int b = factionRelations.indexOf(factionB);
+    if (a < 0 || b < 0) {
         return 0;
     }
 
-    auto relationIt = factionAIt->second.find(factionB);
-    if (relationIt == factionAIt->second.end()) {
-        return 0;
-    }
-
-    return relationIt->second.relationValue;
+    return factionRelations.get(a, b);
 }
 
 std::string FactionSystemNode::getFactionRelationState(const std::string& factionA, const std::string& factionB) const
 {
-    auto factionAIt = factionRelations.find(factionA);
-    if (factionAIt == factionRelations.end()) {
-        return "unknown";
-    }
-
-    auto relationIt = factionAIt->second.find(factionB);
-    if (relationIt == factionAIt->second.end()) {
+    int a = factionRelations.indexOf(factionA);
+    int b = factionRelations.indexOf(factionB);
+    if (a < 0 || b < 0 || a == b) {
         return "unknown";
     }
 
-    return relationIt->second.relationState;
+    return factionRelations.stateOf(a, b);
 }
 
 bool FactionSystemNode::changePlayerReputation(const std::string& factionId, int amount, GameContext* context)
@@ -285,51 +343,104 @@ bool FactionSystemNode::changePlayerReputation(const std::string& factionId, int
 
 void FactionSystemNode::applyReputationRippleEffects(const std::string& primaryFactionId, int primaryAmount)
 {
-    // Skip if very small change
-    if (abs(primaryAmount) < 5) {
+    int primary = factionRelations.indexOf(primaryFactionId);
+    if (primary < 0) {
         return;
     }
 
-    // Check relations with all other factions
-    for (const auto& [otherId, otherFaction] : factions) {
-        // Skip the primary faction
-        if (otherId == primaryFactionId) {
-            continue;
+    // Allies pass on a smaller same-direction change, enemies a smaller opposite one,
+    // fading with each further hop. Small changes don't ripple at all.
+    std::vector<float> ripple;
+    factionRelations.propagate(primary, primaryAmount, ripple);
+
+    const std::string& primaryName = factions[primaryFactionId].name;
+    for (int i = 0; i < static_cast<int>(ripple.size()); i++) {
+        // Truncate toward zero like integer shares, allowing for float rounding
+        float value = ripple[i];
+        int rippleAmount = static_cast<int>(value + (value > 0.0f ? 1e-4f : -1e-4f));
+
+        // Apply the ripple effect if significant
+        if (abs(rippleAmount) >= 1) {
+            auto it = factions.find(factionRelations.idAt(i));
+            if (it != factions.end()) {
+                int oldRep = it->second.playerReputation;
+                it->second.changeReputation(rippleAmount);
+
+                // Log the ripple effect
+                std::cout << "Reputation ripple effect on " << it->second.name
+                          << " due to relation with " << primaryName
+                          << ": " << oldRep << " -> " << it->second.playerReputation
+                          << " (" << (rippleAmount >= 0 ? "+" : "") << rippleAmount << ")" << std::endl;
+            }
         }
+    }
+}
 
-        int relation = getFactionRelation(primaryFactionId, otherId);
+void FactionSystemNode::advanceDays(int days)
+{
+    size_t firstEvent = politics.getHistory().size();
 
-        // For strong positive or negative relations, reputation changes ripple
-        if (abs(relation) >= 50) {
-            // Calculate ripple amount - opposite for enemies, same for allies
-            int rippleAmount = 0;
+    politics.refresh(factions, factionRelations);
+    politics.simulateDays(days, factionRelations);
+    politics.store(factions, factionRelations);
 
-            if (relation >= 50) {
-                // Allies - smaller same-direction effect
-                rippleAmount = primaryAmount / 2;
-            } else if (relation <= -50) {
-                // Enemies - smaller opposite-direction effect
-                rippleAmount = -primaryAmount / 3;
-            }
+    const auto& history = politics.getHistory();
+    for (size_t i = firstEvent; i < history.size(); i++) {
+        std::cout << politics.describe(history[i], factionRelations) << std::endl;
+    }
+}
 
-            // Apply the ripple effect if significant
-            if (abs(rippleAmount) >= 1) {
-                auto it = factions.find(otherId);
-                if (it != factions.end()) {
-                    int oldRep = it->second.playerReputation;
-                    it->second.changeReputation(rippleAmount);
-
-                    // Log the ripple effect
-                    std::cout << "Reputation ripple effect on " << it->second.name
-                              << " due to relation with " << factions[primaryFactionId].name
-                              << ": " << oldRep << " -> " << it->second.playerReputation
-                              << " (" << (rippleAmount >= 0 ? "+" : "") << rippleAmount << ")" << std::endl;
-                }
-            }
+void FactionSystemNode::simulateYears(int years)
+{
+    size_t firstEvent = politics.getHistory().size();
+
+    politics.refresh(factions, factionRelations);
+    politics.simulateDays(years * 360, factionRelations);
+    politics.store(factions, factionRelations);
+
+    int warsDeclared = 0;
+    int conquests = 0;
+    const auto& history = politics.getHistory();
+    for (size_t i = firstEvent; i < history.size(); i++) {
+        if (history[i].type == FactionHistoryType::WarDeclared) {
+            warsDeclared++;
+        } else if (history[i].type == FactionHistoryType::TerritoryTaken && history[i].territory >= 0) {
+            conquests++;
+        }
+    }
+
+    std::cout << "Simulated " << years << " years of faction history: "
+              << warsDeclared << " wars, " << conquests << " territories changed hands, "
+              << politics.getWars().size() << " wars still raging." << std::endl;
+}
+
+void FactionSystemNode::applyRegionalOutput(const std::map<std::string, float>& regionalOutput)
+{
+    // Regions no faction can hold are left out
+    for (const auto& territory : politics.getTerritories()) {
+        auto it = regionalOutput.find(territory.id);
+        if (it != regionalOutput.end()) {
+            politics.setTerritoryOutput(territory.id, it->second);
         }
     }
 }
 
+void FactionSystemNode::hookToTimeSystem(TimeNode* timeSystem, const EconomicSystemNode* economy)
+{
+    if (!timeSystem) {
+        return;
+    }
+
+    // Region control changes touch the world map, so this runs with the serial
+    // subscribers, after the economy has settled the day's market wealth
+    timeSystem->subscribe(nodeName, TimeCadence::Day, [this, economy](GameContext*, int days) {
+        if (economy) {
+            applyRegionalOutput(economy->getRegionalOutput());
+        }
+        advanceDays(days);
+    });
+}
+
 void FactionSystemNode::onEnter(GameContext* context)
 {
     std::cout << "=== Faction System ===" << std::endl;
@@ -602,4 +713,70 @@ void FactionSystemNode::advanceFactionRank(const std::string& factionId)
     }
 }
 
-} // namespace oath
\ No newline at end of file
+} // namespace oath
+
+void initializeFactionSystem(TAController& controller)
+{
+    oath::FactionSystemNode* factionSystem = controller.createNode<oath::FactionSystemNode>("FactionSystem");
+
+    // NPCs are placed by id, as faction member lists name them
+    std::map<NPC*, std::string> npcIds;
+    for (const auto& [id, npc] : controller.gameData["npcs"]) {
+        npcIds[npc] = id;
+    }
+
+    // Every region reachable from the world root is a territory factions can
+    // hold, and the NPCs at its locations are where guards and members are found
+    auto worldIt = controller.systemRoots.find("WorldSystem");
+    RegionNode* worldRoot = worldIt != controller.systemRoots.end() ? dynamic_cast<RegionNode*>(worldIt->second) : nullptr;
+    std::vector<RegionNode*> pending;
+    std::set<RegionNode*> bound;
+    if (worldRoot) {
+        pending.push_back(worldRoot);
+    }
+    while (!pending.empty()) {
+        RegionNode* region = pending.back();
+        pending.pop_back();
+        if (!bound.insert(region).second) {
+            continue;
+        }
+        factionSystem->politics.bindRegion(region);
+        for (LocationNode* location : region->locations) {
+            if (!location) {
+                continue;
+            }
+            for (NPC* npc : location->npcs) {
+                auto id = npcIds.find(npc);
+                if (id != npcIds.end()) {
+                    factionSystem->placeNpc(id->second, region->nodeName, location->nodeName);
+                }
+            }
+        }
+        for (RegionNode* connected : region->connectedRegions) {
+            if (connected) {
+                pending.push_back(connected);
+            }
+        }
+    }
+
+    // Worldgen history before play starts, if the config asks for it
+    if (factionSystem->politics.settings.historyYears > 0) {
+        factionSystem->simulateYears(factionSystem->politics.settings.historyYears);
+    }
+
+    controller.setSystemRoot("FactionSystem", factionSystem);
+}
+
+void hookFactionsToTimeSystem(TAController& controller)
+{
+    auto findSystem = [&controller](const std::string& systemName) -> TANode* {
+        auto it = controller.systemRoots.find(systemName);
+        return it != controller.systemRoots.end() ? it->second : nullptr;
+    };
+
+    TimeNode* timeNode = dynamic_cast<TimeNode*>(findSystem("TimeSystem"));
+    oath::FactionSystemNode* factionSystem = dynamic_cast<oath::FactionSystemNode*>(findSystem("FactionSystem"));
+    if (timeNode && factionSystem) {
+        factionSystem->hookToTimeSystem(timeNode, dynamic_cast<EconomicSystemNode*>(findSystem("EconomicSystem")));
+    }
+}
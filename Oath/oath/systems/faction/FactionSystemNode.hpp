@@ -3,7 +3,9 @@
 #define OATH_FACTION_SYSTEM_NODE_HPP
 
 #include "Faction.hpp"
-#include "FactionRelationship.hpp"
+#include "FactionMembershipIndex.hpp"
+#include "FactionPolitics.hpp"
+#include "FactionRelationMatrix.hpp"
 #include "core/TAAction.hpp"
 #include "core/TAInput.hpp"
 #include "core/TANode.hpp"
@@ -14,6 +16,9 @@
 #include <string>
 #include <vector>
 
+class EconomicSystemNode;
+class TAController;
+class TimeNode;
 
 namespace oath {
 
@@ -21,7 +26,9 @@ namespace oath {
 class FactionSystemNode : public TANode {
 public:
     std::map<std::string, Faction> factions;
-    std::map<std::string, std::map<std::string, FactionRelationship>> factionRelations;
+    FactionRelationMatrix factionRelations;
+    FactionPolitics politics;
+    FactionMembershipIndex membership; // Mirrors Faction::members for fast lookups
     std::string jsonFilePath;
 
     FactionSystemNode(const std::string& name, const std::string& configFile = "resources/config/FactionReputation.json");
@@ -37,12 +44,34 @@ public:
     int getFactionRelation(const std::string& factionA, const std::string& factionB) const;
     std::string getFactionRelationState(const std::string& factionA, const std::string& factionB) const;
 
+    // Add procedurally generated minor factions, each tied to a few neighbours
+    void generateMinorFactions(int count, unsigned int seed);
+
+    // Where an NPC is; an empty id takes it out of any region or location
+    void placeNpc(const std::string& npcId, const std::string& regionId, const std::string& locationId);
+
+    // Faction members at a location, e.g. guards who can respond to a crime
+    int countMembersAtLocation(const std::string& factionId, const std::string& locationId) const;
+
     // Change player reputation with a faction
     bool changePlayerReputation(const std::string& factionId, int amount, GameContext* context = nullptr);
 
-    // Apply reputation changes to other factions based on their relationships
+    // Apply reputation changes to other factions, rippling out along strong relations
     void applyReputationRippleEffects(const std::string& primaryFactionId, int primaryAmount);
 
+    // Run the political simulation day by day, announcing wars and conquests
+    void advanceDays(int days);
+
+    // Worldgen history: simulate whole years quietly and summarise the result
+    void simulateYears(int years);
+
+    // Feed per-region economic output (e.g. EconomicSystemNode::getRegionalOutput) into territories
+    void applyRegionalOutput(const std::map<std::string, float>& regionalOutput);
+
+    // Advance faction politics once per day of game time, with territory
+    // output taken from the economy's regional wealth when one is given
+    void hookToTimeSystem(TimeNode* timeSystem, const EconomicSystemNode* economy = nullptr);
+
     void onEnter(GameContext* context) override;
     std::vector<TAAction> getAvailableActions() override;
     bool evaluateTransition(const TAInput& input, TANode*& outNextNode) override;
@@ -54,4 +83,12 @@ public:
 
 } // namespace oath
 
+// Integration functions
+// Creates "FactionSystem" with every world region as a territory and every
+// NPC placed at its world location, running the configured worldgen history
+void initializeFactionSystem(TAController& controller);
+
+// Runs faction politics daily, after the economy when it is hooked first
+void hookFactionsToTimeSystem(TAController& controller);
+
 #endif // OATH_FACTION_SYSTEM_NODE_HPP
\ No newline at end of file
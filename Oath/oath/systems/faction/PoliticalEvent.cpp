@@ -10,8 +10,6 @@ PoliticalEvent::PoliticalEvent(const std::string& eventName, const std::string&
     , hasOccurred(false)
     , daysTillNextCheck(0)
 {
-    // Default condition always returns true
-    condition = [](const GameContext&) { return true; };
 }
 
 PoliticalEvent PoliticalEvent::fromJson(const json& j)
@@ -39,6 +37,11 @@ PoliticalEvent PoliticalEvent::fromJson(const json& j)
         }
     }
 
+    // Optional script condition, e.g. "faction.iron_crown == 'Crisis' && day > 30"
+    if (j.contains("condition")) {
+        event.condition = GameCondition::fromJson(j["condition"]);
+    }
+
     return event;
 }
 
@@ -126,24 +129,7 @@ bool PoliticalEvent::checkAndExecute(GameContext* context, FactionSystemNode* fa
 
 void PoliticalEvent::updateFactionState(Faction& faction)
 {
-    // Average the three power indicators
-    int avgPower = (faction.economicPower + faction.militaryPower + faction.politicalInfluence) / 3;
-
-    // Determine state based on average power
-    if (faction.currentState == "at_war") {
-        // War state persists unless explicitly changed
-        return;
-    } else if (avgPower < 20) {
-        faction.currentState = "in_crisis";
-    } else if (avgPower < 40) {
-        faction.currentState = "declining";
-    } else if (avgPower < 60) {
-        faction.currentState = "stable";
-    } else if (avgPower < 80) {
-        faction.currentState = "growing";
-    } else {
-        faction.currentState = "flourishing";
-    }
+    faction.updateStateFromPower();
 }
 
 } // namespace oath
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "FactionSystemNode.hpp"
 #include "data/GameContext.hpp"
+#include "data/GameScript.hpp"
 
 
 #include <functional>
@@ -25,7 +26,7 @@ public:
     std::string description;
     std::map<std::string, int> factionPowerShifts; // Changes to economic/military/political power
     std::vector<std::tuple<std::string, std::string, int>> relationShifts; // Changes to relations (factionA, factionB, amount)
-    std::function<bool(const GameContext&)> condition;
+    GameCondition condition; // Always true unless set
     bool hasOccurred;
     int daysTillNextCheck;
 
@@ -0,0 +1,84 @@
+// /oath/systems/health/DiseaseIndex.cpp
+#include "DiseaseIndex.hpp"
+#include <atomic>
+
+namespace {
+std::atomic<int> builds { 0 };
+
+int intern(std::unordered_map<std::string, int>& indices, const std::string& name)
+{
+    return indices.emplace(name, static_cast<int>(indices.size())).first->second;
+}
+}
+
+DiseaseIndex::DiseaseIndex()
+    : offsets(1, 0)
+    , buildVersion(0)
+{
+}
+
+void DiseaseIndex::build(const std::map<std::string, Disease>& diseases)
+{
+    slots.clear();
+    diseaseIndices.clear();
+    regionIndices.clear();
+    vectorIndices.clear();
+
+    for (const auto& [id, disease] : diseases) {
+        diseaseIndices[id] = static_cast<int>(slots.size());
+        slots.push_back(&disease);
+        for (const std::string& region : disease.regions) {
+            intern(regionIndices, region);
+        }
+        for (const std::string& vector : disease.vectors) {
+            intern(vectorIndices, vector);
+        }
+    }
+
+    // Count each cell, then fill in disease order
+    int vectorCount = static_cast<int>(vectorIndices.size());
+    int cells = static_cast<int>(regionIndices.size()) * vectorCount;
+    offsets.assign(cells + 1, 0);
+    for (const Disease* disease : slots) {
+        for (const std::string& region : disease->regions) {
+            int row = regionIndices[region] * vectorCount;
+            for (const std::string& vector : disease->vectors) {
+                offsets[row + vectorIndices[vector] + 1]++;
+            }
+        }
+    }
+    for (int c = 0; c < cells; c++) {
+        offsets[c + 1] += offsets[c];
+    }
+
+    entries.resize(offsets[cells]);
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (int slot = 0; slot < diseaseCount(); slot++) {
+        for (const std::string& region : slots[slot]->regions) {
+            int row = regionIndices[region] * vectorCount;
+            for (const std::string& vector : slots[slot]->vectors) {
+                entries[next[row + vectorIndices[vector]]++] = slot;
+            }
+        }
+    }
+
+    buildVersion = ++builds;
+}
+
+int DiseaseIndex::diseaseSlot(const std::string& diseaseId) const
+{
+    auto it = diseaseIndices.find(diseaseId);
+    return it != diseaseIndices.end() ? it->second : -1;
+}
+
+DiseaseList DiseaseIndex::find(const std::string& region, const std::string& vector) const
+{
+    auto r = regionIndices.find(region);
+    auto v = vectorIndices.find(vector);
+    if (r == regionIndices.end() || v == vectorIndices.end()) {
+        return { entries.data(), entries.data() };
+    }
+
+    int cell = r->second * static_cast<int>(vectorIndices.size()) + v->second;
+    return { entries.data() + offsets[cell], entries.data() + offsets[cell + 1] };
+}
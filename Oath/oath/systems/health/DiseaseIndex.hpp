@@ -0,0 +1,51 @@
+// /oath/systems/health/DiseaseIndex.hpp
+#pragma once
+
+#include "Disease.hpp"
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Disease slots from a DiseaseIndex lookup; points into the index
+struct DiseaseList {
+    const int* first;
+    const int* last;
+
+    const int* begin() const { return first; }
+    const int* end() const { return last; }
+    bool empty() const { return first == last; }
+    int size() const { return static_cast<int>(last - first); }
+};
+
+// Diseases by region and vector, for exposure checks. Disease, region and
+// vector names are interned to dense slots, and the diseases of each
+// (region, vector) cell sit in one flat array in disease id order, so a lookup
+// is two hash probes and a slice. Rebuilt in one pass when diseases change.
+class DiseaseIndex {
+public:
+    DiseaseIndex();
+
+    void build(const std::map<std::string, Disease>& diseases);
+
+    // Changes with every build; 0 before the first
+    int version() const { return buildVersion; }
+
+    int diseaseCount() const { return static_cast<int>(slots.size()); }
+    int diseaseSlot(const std::string& diseaseId) const; // -1 for an unknown id
+    const Disease& disease(int slot) const { return *slots[slot]; }
+
+    // Diseases common in the region that spread by the vector
+    DiseaseList find(const std::string& region, const std::string& vector) const;
+
+private:
+    std::vector<const Disease*> slots; // Into the manager's map, by slot
+    std::unordered_map<std::string, int> diseaseIndices;
+    std::unordered_map<std::string, int> regionIndices;
+    std::unordered_map<std::string, int> vectorIndices;
+
+    // Diseases of cell (region * vectorCount + vector) are [offsets[c], offsets[c + 1])
+    std::vector<int> offsets;
+    std::vector<int> entries;
+    int buildVersion;
+};
@@ -1,8 +1,18 @@
 // /oath/systems/health/DiseaseManager.cpp
 #include "DiseaseManager.hpp"
+#include "../relationship/NPCRelationshipManager.hpp"
+#include "../world/LocationNode.hpp"
+#include "../world/RegionNode.hpp"
+#include "../world/TimeNode.hpp"
 #include "HealthState.hpp"
 #include <fstream>
 #include <iostream>
+#include <set>
+
+namespace {
+// NPCs meet where their schedules put them at this hour
+const int EPIDEMIC_HOUR = 12;
+}
 
 
 bool DiseaseManager::loadFromJson(const std::string& filename)
@@ -24,6 +34,7 @@ bool DiseaseManager::loadFromJson(const std::string& filename)
             Disease disease(diseaseJson);
             diseases[disease.id] = disease;
         }
+        exposureIndexStale = true;
 
         // Load healing methods
         for (const auto& methodJson : j["healingMethods"]) {
@@ -33,7 +44,11 @@ bool DiseaseManager::loadFromJson(const std::string& filename)
 
         // Load region risks
         for (auto& [region, risk] : j["regionDiseaseRisks"].items()) {
-            regionDiseaseRisk[region] = risk;
+            setRegionRisk(region, risk);
+        }
+
+        if (j.contains("epidemics")) {
+            epidemics.settings.loadFromJson(j["epidemics"]);
         }
 
         std::cout << "Successfully loaded " << diseases.size() << " diseases, "
@@ -50,6 +65,7 @@ bool DiseaseManager::loadFromJson(const std::string& filename)
 void DiseaseManager::registerDisease(const Disease& disease)
 {
     diseases[disease.id] = disease;
+    exposureIndexStale = true;
 }
 
 void DiseaseManager::registerHealingMethod(const HealingMethod& method)
@@ -59,6 +75,7 @@ void DiseaseManager::registerHealingMethod(const HealingMethod& method)
 
 void DiseaseManager::setRegionRisk(const std::string& region, float risk)
 {
+    baseRegionRisk[region] = risk;
     regionDiseaseRisk[region] = risk;
 }
 
@@ -100,16 +117,20 @@ bool DiseaseManager::checkExposure(GameContext* context, const std::string& regi
     if (!health)
         return false;
 
+    if (exposureIndexStale) {
+        exposureIndex.build(diseases);
+        exposureIndexStale = false;
+    }
+    if (!health->immunitySlotsCurrent(exposureIndex)) {
+        health->indexImmunities(exposureIndex);
+    }
+
     // Get region risk factor
     float regionRisk = getRegionRisk(regionName);
 
-    // Check each disease that could be present in this region
-    std::vector<const Disease*> regionalDiseases = getDiseasesInRegion(regionName);
-
-    for (const Disease* disease : regionalDiseases) {
-        // Skip if not transmitted by this vector
-        if (!disease->transmitsVia(vector))
-            continue;
+    // Only diseases common in this region that spread this way
+    for (int slot : exposureIndex.find(regionName, vector)) {
+        const Disease* disease = &exposureIndex.disease(slot);
 
         // Skip if already infected
         if (health->hasDisease(disease->id))
@@ -119,7 +140,7 @@ bool DiseaseManager::checkExposure(GameContext* context, const std::string& regi
         float baseChance = disease->contagiousness * regionRisk;
 
         // Adjust for immunity
-        float immunity = health->getImmunityStrength(disease->id, context->worldState.daysPassed);
+        float immunity = health->getImmunityStrength(slot, context->worldState.daysPassed);
         baseChance *= (1.0f - immunity);
 
         // Random roll
@@ -221,4 +242,80 @@ void DiseaseManager::applySymptomEffects(GameContext* context)
             symptom.update(context);
         }
     }
-}
\ No newline at end of file
+}
+
+void DiseaseManager::advanceEpidemics(int currentDay, const SocialGraph* graph)
+{
+    for (const auto& [id, disease] : diseases) {
+        for (const std::string& region : disease.regions) {
+            auto base = baseRegionRisk.find(region);
+            float risk = base != baseRegionRisk.end() ? base->second : 1.0f;
+            epidemics.seedOutbreak(disease, region, currentDay, epidemics.settings.outbreakChance * risk);
+        }
+    }
+
+    epidemics.advanceDay(currentDay, graph);
+
+    for (const std::string& region : epidemics.getRegions()) {
+        if (region.empty()) {
+            continue;
+        }
+        auto base = baseRegionRisk.find(region);
+        float risk = base != baseRegionRisk.end() ? base->second : 1.0f;
+        regionDiseaseRisk[region] = risk * (1.0f + epidemics.settings.outbreakRisk * epidemics.regionInfectiousFraction(region));
+    }
+}
+
+bool DiseaseManager::startOutbreak(const std::string& diseaseId, int npc)
+{
+    const Disease* disease = getDiseaseById(diseaseId);
+    return disease && epidemics.infect(*disease, npc);
+}
+
+void DiseaseManager::setLocationRegions(RegionNode* worldRoot)
+{
+    std::vector<RegionNode*> pending;
+    std::set<RegionNode*> visited;
+    if (worldRoot) {
+        pending.push_back(worldRoot);
+    }
+    while (!pending.empty()) {
+        RegionNode* region = pending.back();
+        pending.pop_back();
+        if (!visited.insert(region).second) {
+            continue;
+        }
+        for (LocationNode* location : region->locations) {
+            if (location) {
+                epidemics.setLocationRegion(location->locationName, region->regionName);
+            }
+        }
+        for (RegionNode* connected : region->connectedRegions) {
+            if (connected) {
+                pending.push_back(connected);
+            }
+        }
+    }
+}
+
+void DiseaseManager::hookToTimeSystem(TimeNode* timeSystem, NPCRelationshipManager* relationships)
+{
+    if (!timeSystem) {
+        return;
+    }
+    if (!relationships) {
+        std::cerr << "No relationship manager; NPC epidemics will not advance" << std::endl;
+        return;
+    }
+
+    // Reads the schedules and social graph the relationship system owns, so
+    // this runs with the serial subscribers, after relationships have moved on
+    timeSystem->subscribe("EpidemicSystem", TimeCadence::Day, [this, timeSystem, relationships](GameContext*, int days) {
+        const SocialGraph& graph = relationships->getSocialGraph();
+        epidemics.setPopulation(graph.npcCount());
+        for (int day = timeSystem->day - days + 1; day <= timeSystem->day; day++) {
+            epidemics.setLocations(relationships->getScheduledLocations(day, EPIDEMIC_HOUR));
+            advanceEpidemics(day, &graph);
+        }
+    });
+}
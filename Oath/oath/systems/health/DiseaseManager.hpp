@@ -3,17 +3,27 @@
 
 #include "../../data/GameContext.hpp"
 #include "Disease.hpp"
+#include "DiseaseIndex.hpp"
+#include "EpidemicModel.hpp"
 #include "HealingMethod.hpp"
 #include <map>
 #include <string>
 #include <vector>
 
+class NPCRelationshipManager;
+class RegionNode;
+class TimeNode;
+
 // Disease Manager class to handle disease-related logic
 class DiseaseManager {
 public:
     std::map<std::string, Disease> diseases;
     std::map<std::string, HealingMethod> healingMethods;
     std::map<std::string, float> regionDiseaseRisk; // Risk multiplier for each region
+    std::map<std::string, float> baseRegionRisk; // Before outbreaks, as configured
+    EpidemicModel epidemics; // Disease among NPCs
+    DiseaseIndex exposureIndex; // Built from diseases on the next exposure check
+    bool exposureIndexStale = true; // Set after changing diseases directly
 
     // Load all data from JSON file
     bool loadFromJson(const std::string& filename);
@@ -27,4 +37,18 @@ public:
     bool checkExposure(GameContext* context, const std::string& regionName, const std::string& vector);
     void updateDiseases(GameContext* context, int currentDay);
     void applySymptomEffects(GameContext* context);
+
+    // A day of disease among NPCs: new outbreaks where diseases are common,
+    // spread, then each region's risk raised by its infectious share
+    void advanceEpidemics(int currentDay, const SocialGraph* graph = nullptr);
+    bool startOutbreak(const std::string& diseaseId, int npc);
+
+    // Tells the NPC model which region each location of the world is in,
+    // walking every region reachable from worldRoot
+    void setLocationRegions(RegionNode* worldRoot);
+
+    // Runs advanceEpidemics each day over the relationship manager's NPCs:
+    // where each spends the middle of the day comes from its schedule, and
+    // close contact follows its social graph
+    void hookToTimeSystem(TimeNode* timeSystem, NPCRelationshipManager* relationships);
 };
\ No newline at end of file
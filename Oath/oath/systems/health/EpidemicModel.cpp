@@ -0,0 +1,508 @@
+// /oath/systems/health/EpidemicModel.cpp
+#include "EpidemicModel.hpp"
+#include "../../utils/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+// Stable across platforms, unlike std::hash
+uint64_t nameHash(const std::string& name)
+{
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (unsigned char c : name) {
+        h = (h ^ c) * 0x100000001B3ull;
+    }
+    return h;
+}
+
+// Uniform in [0, 1) from the top 24 bits
+float unitRoll(uint64_t seed, uint64_t salt, int day, int npc)
+{
+    uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(day)) << 32) | static_cast<uint32_t>(npc);
+    return static_cast<float>(splitMix(seed ^ salt ^ splitMix(key)) >> 40) * (1.0f / 16777216.0f);
+}
+
+const int SUSCEPTIBLE = static_cast<int>(Compartment::Susceptible);
+const int EXPOSED = static_cast<int>(Compartment::Exposed);
+const int INFECTIOUS = static_cast<int>(Compartment::Infectious);
+const int RECOVERED = static_cast<int>(Compartment::Recovered);
+}
+
+EpidemicSettings::EpidemicSettings()
+    : dailyContacts(8.0f)
+    , closeContacts(1.0f)
+    , minContactValue(20)
+    , immunityDays(120)
+    , outbreakChance(0.002f)
+    , outbreakRisk(4.0f)
+    , threads(std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 4))
+    , parallelMinNpcs(20000)
+{
+}
+
+void EpidemicSettings::loadFromJson(const nlohmann::json& j)
+{
+    dailyContacts = j.value("dailyContacts", dailyContacts);
+    closeContacts = j.value("closeContacts", closeContacts);
+    minContactValue = j.value("minContactValue", minContactValue);
+    immunityDays = j.value("immunityDays", immunityDays);
+    outbreakChance = j.value("outbreakChance", outbreakChance);
+    outbreakRisk = j.value("outbreakRisk", outbreakRisk);
+    threads = j.value("threads", threads);
+    parallelMinNpcs = j.value("parallelMinNpcs", parallelMinNpcs);
+}
+
+EpidemicCounts::EpidemicCounts()
+    : people { 0, 0, 0, 0 }
+    , newInfections(0)
+{
+}
+
+int EpidemicCounts::total() const
+{
+    return people[SUSCEPTIBLE] + people[EXPOSED] + people[INFECTIOUS] + people[RECOVERED];
+}
+
+float EpidemicCounts::infectiousFraction() const
+{
+    int all = total();
+    return all > 0 ? static_cast<float>(people[INFECTIOUS]) / all : 0.0f;
+}
+
+EpidemicModel::EpidemicModel()
+    : seed(0x0A7E91DEull)
+{
+    clear();
+}
+
+void EpidemicModel::clear()
+{
+    outbreaks.clear();
+    outbreakIndex.clear();
+    locationOf.clear();
+    resistance.clear();
+
+    locationNames.assign(1, "");
+    locationIndices.clear();
+    locationIndices[""] = 0;
+    locationRegion.assign(1, 0);
+    population.assign(1, 0);
+    regionNames.assign(1, "");
+    regionIndices.clear();
+    regionIndices[""] = 0;
+}
+
+void EpidemicModel::setPopulation(int npcCount)
+{
+    int old = this->npcCount();
+    if (npcCount < old) {
+        // Shrinking drops NPCs off the end; recount what is left
+        for (int npc = npcCount; npc < old; npc++) {
+            population[locationOf[npc]]--;
+        }
+    } else {
+        population[0] += npcCount - old;
+    }
+
+    locationOf.resize(npcCount, 0);
+    resistance.resize(npcCount, 0.0f);
+    for (Outbreak& outbreak : outbreaks) {
+        outbreak.state.resize(npcCount, static_cast<uint8_t>(Compartment::Susceptible));
+        outbreak.days.resize(npcCount, 0);
+        recountRegions(outbreak);
+    }
+}
+
+int EpidemicModel::locationId(const std::string& location)
+{
+    auto it = locationIndices.find(location);
+    if (it != locationIndices.end()) {
+        return it->second;
+    }
+
+    int id = static_cast<int>(locationNames.size());
+    locationNames.push_back(location);
+    locationIndices[location] = id;
+    locationRegion.push_back(0);
+    population.push_back(0);
+    return id;
+}
+
+void EpidemicModel::setLocation(int npc, int location)
+{
+    int old = locationOf[npc];
+    if (old == location) {
+        return;
+    }
+
+    population[old]--;
+    population[location]++;
+    locationOf[npc] = location;
+
+    int from = locationRegion[old];
+    int to = locationRegion[location];
+    if (from == to) {
+        return;
+    }
+    for (Outbreak& outbreak : outbreaks) {
+        int compartment = outbreak.state[npc];
+        outbreak.regionCounts[from * COMPARTMENT_COUNT + compartment]--;
+        outbreak.regionCounts[to * COMPARTMENT_COUNT + compartment]++;
+    }
+}
+
+void EpidemicModel::setLocations(const std::vector<std::string>& locations)
+{
+    int count = std::min(npcCount(), static_cast<int>(locations.size()));
+    for (int npc = 0; npc < count; npc++) {
+        setLocation(npc, locationId(locations[npc]));
+    }
+}
+
+void EpidemicModel::setLocationRegion(const std::string& location, const std::string& region)
+{
+    int id = locationId(location);
+    int r = regionId(region);
+    if (id == 0 || locationRegion[id] == r) {
+        return;
+    }
+
+    locationRegion[id] = r;
+    if (population[id] > 0) {
+        for (Outbreak& outbreak : outbreaks) {
+            recountRegions(outbreak);
+        }
+    }
+}
+
+void EpidemicModel::setResistance(int npc, float value)
+{
+    resistance[npc] = std::clamp(value, 0.0f, 1.0f);
+}
+
+int EpidemicModel::regionId(const std::string& region)
+{
+    auto it = regionIndices.find(region);
+    if (it != regionIndices.end()) {
+        return it->second;
+    }
+
+    int id = static_cast<int>(regionNames.size());
+    regionNames.push_back(region);
+    regionIndices[region] = id;
+    for (Outbreak& outbreak : outbreaks) {
+        outbreak.regionCounts.resize(regionNames.size() * COMPARTMENT_COUNT, 0);
+    }
+    return id;
+}
+
+int EpidemicModel::findRegion(const std::string& region) const
+{
+    auto it = regionIndices.find(region);
+    return it != regionIndices.end() ? it->second : -1;
+}
+
+EpidemicModel::Outbreak& EpidemicModel::track(const Disease& disease)
+{
+    auto it = outbreakIndex.find(disease.id);
+    int index;
+    if (it != outbreakIndex.end()) {
+        index = it->second;
+    } else {
+        index = static_cast<int>(outbreaks.size());
+        outbreakIndex[disease.id] = index;
+        outbreaks.emplace_back();
+
+        Outbreak& outbreak = outbreaks.back();
+        outbreak.diseaseId = disease.id;
+        outbreak.salt = nameHash(disease.id);
+        outbreak.state.assign(npcCount(), static_cast<uint8_t>(Compartment::Susceptible));
+        outbreak.days.assign(npcCount(), 0);
+        recountRegions(outbreak);
+    }
+
+    // Parameters follow the disease, so a reloaded config applies at once
+    Outbreak& outbreak = outbreaks[index];
+    outbreak.transmission = disease.contagiousness;
+    outbreak.incubationDays = disease.incubationPeriod;
+    outbreak.infectiousDays = disease.naturalDuration;
+    outbreak.chronic = disease.isChronic;
+    outbreak.byContact = disease.transmitsVia("contact");
+    outbreak.byLocation = disease.vectors.empty() || disease.vectors.size() > (outbreak.byContact ? 1u : 0u);
+    return outbreak;
+}
+
+void EpidemicModel::setCompartment(Outbreak& outbreak, int npc, Compartment compartment)
+{
+    int region = locationRegion[locationOf[npc]];
+    int from = outbreak.state[npc];
+    int to = static_cast<int>(compartment);
+
+    outbreak.counts.people[from]--;
+    outbreak.counts.people[to]++;
+    outbreak.regionCounts[region * COMPARTMENT_COUNT + from]--;
+    outbreak.regionCounts[region * COMPARTMENT_COUNT + to]++;
+    outbreak.state[npc] = static_cast<uint8_t>(compartment);
+    outbreak.days[npc] = 0;
+}
+
+void EpidemicModel::recountRegions(Outbreak& outbreak)
+{
+    outbreak.counts = EpidemicCounts();
+    outbreak.regionCounts.assign(regionNames.size() * COMPARTMENT_COUNT, 0);
+    for (int npc = 0; npc < npcCount(); npc++) {
+        int compartment = outbreak.state[npc];
+        outbreak.counts.people[compartment]++;
+        outbreak.regionCounts[locationRegion[locationOf[npc]] * COMPARTMENT_COUNT + compartment]++;
+    }
+}
+
+bool EpidemicModel::infect(const Disease& disease, int npc)
+{
+    if (npc < 0 || npc >= npcCount()) {
+        return false;
+    }
+
+    Outbreak& outbreak = track(disease);
+    if (outbreak.state[npc] != static_cast<uint8_t>(Compartment::Susceptible)) {
+        return false;
+    }
+    setCompartment(outbreak, npc, Compartment::Exposed);
+    outbreak.counts.newInfections++;
+    return true;
+}
+
+int EpidemicModel::seedOutbreak(const Disease& disease, const std::string& region, int day, float chance)
+{
+    int r = findRegion(region);
+    if (r <= 0 || unitRoll(seed, nameHash(disease.id) ^ nameHash(region), day, -1) >= chance) {
+        return -1;
+    }
+
+    // Pick among the region's NPCs who are still susceptible
+    auto it = outbreakIndex.find(disease.id);
+    const Outbreak* outbreak = it != outbreakIndex.end() ? &outbreaks[it->second] : nullptr;
+    std::vector<int> candidates;
+    for (int npc = 0; npc < npcCount(); npc++) {
+        if (locationRegion[locationOf[npc]] == r
+            && (!outbreak || outbreak->state[npc] == static_cast<uint8_t>(Compartment::Susceptible))) {
+            candidates.push_back(npc);
+        }
+    }
+    if (candidates.empty()) {
+        return -1;
+    }
+
+    int npc = candidates[splitMix(seed ^ nameHash(disease.id) ^ static_cast<uint64_t>(day)) % candidates.size()];
+    infect(disease, npc);
+    return npc;
+}
+
+void EpidemicModel::advanceDay(int day, const SocialGraph* graph)
+{
+    for (Outbreak& outbreak : outbreaks) {
+        // Nothing moves once the disease is gone and immunity lasts
+        bool spreading = outbreak.counts.people[EXPOSED] + outbreak.counts.people[INFECTIOUS] > 0;
+        bool waning = settings.immunityDays > 0 && outbreak.counts.people[RECOVERED] > 0;
+        if (spreading || waning) {
+            step(outbreak, day, graph);
+        } else {
+            outbreak.counts.newInfections = 0;
+        }
+    }
+}
+
+void EpidemicModel::step(Outbreak& outbreak, int day, const SocialGraph* graph)
+{
+    const int npcs = npcCount();
+    const int locations = static_cast<int>(locationNames.size());
+    const uint8_t* state = outbreak.state.data();
+    const int* where = locationOf.data();
+
+    // Infectious at each location, and who can pass it on by contact
+    infectiousAt.assign(locations, 0);
+    spreaders.clear();
+    for (int npc = 0; npc < npcs; npc++) {
+        int sick = state[npc] == INFECTIOUS;
+        infectiousAt[where[npc]] += sick;
+        if (sick && outbreak.byContact) {
+            spreaders.push_back(npc);
+        }
+    }
+
+    // Rate of infection for a susceptible NPC at each location: its meetings
+    // times the infectious share there times the chance a meeting passes it on
+    locationRate.assign(locations, 0.0f);
+    if (outbreak.byLocation) {
+        float perMeeting = outbreak.transmission * settings.dailyContacts;
+        for (int l = 1; l < locations; l++) {
+            if (infectiousAt[l] > 0) {
+                locationRate[l] = perMeeting * infectiousAt[l] / population[l];
+            }
+        }
+    }
+
+    // Close contacts: infectious NPCs visit the NPCs they regard warmly
+    contacts.assign(npcs, 0.0f);
+    if (graph && !spreaders.empty()) {
+        int graphNpcs = graph->npcCount();
+        for (int npc : spreaders) {
+            if (npc >= graphNpcs) {
+                continue;
+            }
+            graph->forEachNeighbor(npc, [&](int target, int edge) {
+                if (target < npcs && graph->edgeValue(edge) >= settings.minContactValue) {
+                    contacts[target] += 1.0f;
+                }
+            });
+        }
+    }
+    const float contactRate = outbreak.transmission * settings.closeContacts;
+
+    const int incubation = outbreak.incubationDays;
+    const int duration = outbreak.chronic ? INT32_MAX : outbreak.infectiousDays;
+    const int immunity = settings.immunityDays > 0 ? settings.immunityDays : INT32_MAX;
+    const int regions = static_cast<int>(regionNames.size());
+    const int slotsPerWorker = regions * COMPARTMENT_COUNT + 1; // Last slot: new infections
+
+    int workers = std::max(settings.threads, 1);
+    workerCounts.resize(workers);
+    for (auto& counts : workerCounts) {
+        counts.assign(slotsPerWorker, 0);
+    }
+
+    // Every NPC moves a day on. Each writes only its own slots, and the rates
+    // above are fixed for the day, so slices run independently.
+    forEachSlice(npcs, [&](int worker, int begin, int end) {
+        uint8_t* states = outbreak.state.data();
+        uint16_t* days = outbreak.days.data();
+        int* counts = workerCounts[worker].data();
+
+        for (int npc = begin; npc < end; npc++) {
+            int compartment = states[npc];
+            int held = days[npc] < UINT16_MAX ? days[npc] + 1 : UINT16_MAX;
+
+            if (compartment == SUSCEPTIBLE) {
+                float rate = locationRate[where[npc]] + contactRate * contacts[npc];
+                if (rate > 0.0f) {
+                    float chance = (1.0f - std::exp(-rate)) * (1.0f - resistance[npc]);
+                    if (unitRoll(seed, outbreak.salt, day, npc) < chance) {
+                        compartment = EXPOSED;
+                        held = 0;
+                        counts[slotsPerWorker - 1]++;
+                    }
+                }
+            } else if (compartment == EXPOSED && held >= incubation) {
+                compartment = INFECTIOUS;
+                held = 0;
+            } else if (compartment == INFECTIOUS && held >= duration) {
+                compartment = RECOVERED;
+                held = 0;
+            } else if (compartment == RECOVERED && held >= immunity) {
+                compartment = SUSCEPTIBLE;
+                held = 0;
+            }
+
+            states[npc] = static_cast<uint8_t>(compartment);
+            days[npc] = static_cast<uint16_t>(held);
+            counts[locationRegion[where[npc]] * COMPARTMENT_COUNT + compartment]++;
+        }
+    });
+
+    // Merge the workers' tallies into the region and overall counts
+    outbreak.regionCounts.assign(regions * COMPARTMENT_COUNT, 0);
+    outbreak.counts = EpidemicCounts();
+    for (const auto& counts : workerCounts) {
+        for (int slot = 0; slot < regions * COMPARTMENT_COUNT; slot++) {
+            outbreak.regionCounts[slot] += counts[slot];
+            outbreak.counts.people[slot % COMPARTMENT_COUNT] += counts[slot];
+        }
+        outbreak.counts.newInfections += counts[slotsPerWorker - 1];
+    }
+}
+
+Compartment EpidemicModel::compartmentOf(const std::string& diseaseId, int npc) const
+{
+    auto it = outbreakIndex.find(diseaseId);
+    if (it == outbreakIndex.end() || npc < 0 || npc >= npcCount()) {
+        return Compartment::Susceptible;
+    }
+    return static_cast<Compartment>(outbreaks[it->second].state[npc]);
+}
+
+EpidemicCounts EpidemicModel::totals(const std::string& diseaseId) const
+{
+    auto it = outbreakIndex.find(diseaseId);
+    if (it == outbreakIndex.end()) {
+        EpidemicCounts counts;
+        counts.people[SUSCEPTIBLE] = npcCount();
+        return counts;
+    }
+    return outbreaks[it->second].counts;
+}
+
+EpidemicCounts EpidemicModel::regionTotals(const std::string& diseaseId, const std::string& region) const
+{
+    EpidemicCounts counts;
+    int r = findRegion(region);
+    if (r < 0) {
+        return counts;
+    }
+
+    auto it = outbreakIndex.find(diseaseId);
+    if (it == outbreakIndex.end()) {
+        for (int l = 0; l < static_cast<int>(locationNames.size()); l++) {
+            if (locationRegion[l] == r) {
+                counts.people[SUSCEPTIBLE] += population[l];
+            }
+        }
+        return counts;
+    }
+
+    const Outbreak& outbreak = outbreaks[it->second];
+    for (int c = 0; c < COMPARTMENT_COUNT; c++) {
+        counts.people[c] = outbreak.regionCounts[r * COMPARTMENT_COUNT + c];
+    }
+    return counts;
+}
+
+float EpidemicModel::regionInfectiousFraction(const std::string& region) const
+{
+    int r = findRegion(region);
+    if (r < 0) {
+        return 0.0f;
+    }
+
+    int people = 0;
+    for (int l = 0; l < static_cast<int>(locationNames.size()); l++) {
+        if (locationRegion[l] == r) {
+            people += population[l];
+        }
+    }
+    if (people == 0) {
+        return 0.0f;
+    }
+
+    int infectious = 0;
+    for (const Outbreak& outbreak : outbreaks) {
+        infectious += outbreak.regionCounts[r * COMPARTMENT_COUNT + INFECTIOUS];
+    }
+    return static_cast<float>(infectious) / people;
+}
+
+std::vector<std::string> EpidemicModel::getActiveDiseases() const
+{
+    std::vector<std::string> active;
+    for (const Outbreak& outbreak : outbreaks) {
+        if (outbreak.counts.people[EXPOSED] + outbreak.counts.people[INFECTIOUS] > 0) {
+            active.push_back(outbreak.diseaseId);
+        }
+    }
+    return active;
+}
+
+void EpidemicModel::forEachSlice(int count, const std::function<void(int, int, int)>& work) const
+{
+    ::forEachSlice(count, count >= settings.parallelMinNpcs ? settings.threads : 1, work);
+}
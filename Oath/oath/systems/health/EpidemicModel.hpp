@@ -0,0 +1,142 @@
+// /oath/systems/health/EpidemicModel.hpp
+#pragma once
+
+#include "../relationship/SocialGraph.hpp"
+#include "Disease.hpp"
+#include <cstdint>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// SEIR compartments, in the order an infection moves through them
+enum class Compartment : uint8_t {
+    Susceptible,
+    Exposed, // Infected, not yet contagious
+    Infectious,
+    Recovered // Immune until immunityDays pass
+};
+constexpr int COMPARTMENT_COUNT = 4;
+
+// Tuning for NPC outbreaks, from the "epidemics" section of the disease config
+struct EpidemicSettings {
+    float dailyContacts; // Meetings per day with others at the same location
+    float closeContacts; // Meetings per day with each friend, for "contact" diseases
+    int minContactValue; // Friends are NPCs regarded at least this well
+    int immunityDays; // After recovery; 0 keeps the immunity for good
+    float outbreakChance; // Daily chance per region a common disease breaks out, times the region risk
+    float outbreakRisk; // Region risk added per unit of infectious fraction
+
+    int threads;
+    int parallelMinNpcs; // Below this one thread steps the population
+
+    EpidemicSettings();
+    void loadFromJson(const nlohmann::json& j);
+};
+
+struct EpidemicCounts {
+    int people[COMPARTMENT_COUNT];
+    int newInfections; // Moved to Exposed by the last step
+
+    EpidemicCounts();
+    int in(Compartment compartment) const { return people[static_cast<int>(compartment)]; }
+    int total() const;
+    float infectiousFraction() const;
+};
+
+// Disease spread through the NPC population, by the NPC indices of the
+// SocialGraph. Each disease with an outbreak keeps a compartment and a day
+// counter per NPC in dense arrays. A day's step counts the infectious at every
+// location, turns that into an infection rate per location, adds close
+// contact along warm social edges, then moves every NPC a day on in one pass
+// over the arrays, split between threads. Rolls hash (seed, day, disease, NPC)
+// so the outcome does not depend on the thread count.
+class EpidemicModel {
+public:
+    EpidemicSettings settings;
+    uint64_t seed;
+
+    EpidemicModel();
+
+    void clear();
+
+    // New NPCs start susceptible and nowhere
+    void setPopulation(int npcCount);
+    int npcCount() const { return static_cast<int>(locationOf.size()); }
+
+    // Where each NPC spends the day. Location ids are interned names; "" is
+    // nowhere, where no one meets anyone.
+    int locationId(const std::string& location);
+    void setLocation(int npc, int location);
+    void setLocations(const std::vector<std::string>& locations); // By NPC index
+    void setLocationRegion(const std::string& location, const std::string& region);
+
+    // 0 to 1, the share of exposures the NPC shrugs off
+    void setResistance(int npc, float resistance);
+
+    // Patient zero; false if the NPC is not susceptible
+    bool infect(const Disease& disease, int npc);
+
+    // Roll once for an outbreak of the disease in the region; on a hit a
+    // susceptible NPC there catches it. Returns that NPC, -1 for none.
+    int seedOutbreak(const Disease& disease, const std::string& region, int day, float chance);
+
+    void advanceDay(int day, const SocialGraph* graph = nullptr);
+
+    Compartment compartmentOf(const std::string& diseaseId, int npc) const;
+    EpidemicCounts totals(const std::string& diseaseId) const;
+    EpidemicCounts regionTotals(const std::string& diseaseId, const std::string& region) const;
+
+    // Infectious share of the region's NPCs, summed over diseases
+    float regionInfectiousFraction(const std::string& region) const;
+    const std::vector<std::string>& getRegions() const { return regionNames; }
+    std::vector<std::string> getActiveDiseases() const;
+
+private:
+    struct Outbreak {
+        std::string diseaseId;
+        uint64_t salt;
+        float transmission;
+        int incubationDays;
+        int infectiousDays;
+        bool chronic;
+        bool byLocation; // Any vector but contact: everyone at a location mixes
+        bool byContact;
+
+        std::vector<uint8_t> state; // Compartment per NPC
+        std::vector<uint16_t> days; // Days in it
+        std::vector<int> regionCounts; // [region * COMPARTMENT_COUNT + compartment]
+        EpidemicCounts counts;
+    };
+
+    std::vector<Outbreak> outbreaks;
+    std::unordered_map<std::string, int> outbreakIndex;
+
+    // Per NPC
+    std::vector<int> locationOf;
+    std::vector<float> resistance;
+
+    // Per location; location 0 is nowhere, region 0 is none
+    std::vector<std::string> locationNames;
+    std::unordered_map<std::string, int> locationIndices;
+    std::vector<int> locationRegion;
+    std::vector<int> population;
+    std::vector<std::string> regionNames;
+    std::unordered_map<std::string, int> regionIndices;
+
+    // Scratch for the step
+    std::vector<int> infectiousAt;
+    std::vector<float> locationRate;
+    std::vector<float> contacts;
+    std::vector<int> spreaders;
+    std::vector<std::vector<int>> workerCounts;
+
+    int regionId(const std::string& region);
+    int findRegion(const std::string& region) const;
+    Outbreak& track(const Disease& disease);
+    void setCompartment(Outbreak& outbreak, int npc, Compartment compartment);
+    void recountRegions(Outbreak& outbreak);
+    void step(Outbreak& outbreak, int day, const SocialGraph* graph);
+    void forEachSlice(int count, const std::function<void(int, int, int)>& work) const;
+};
@@ -1,18 +1,41 @@
 // /oath/systems/health/HealthContext.hpp
 #pragma once
 
+#include "../../data/VitalsTable.hpp"
 #include "Disease.hpp"
 #include "HealingMethod.hpp"
 #include "HealthState.hpp"
 #include "NutritionState.hpp"
 #include <map>
 #include <string>
+#include <vector>
 
 // Add HealthState to the GameContext
 struct HealthContext {
+    VitalsTable vitals; // The player's row; NPCs and mounts can add their own
+    int playerVitals;
+    std::vector<VitalEvent> vitalEvents; // Band crossings of the last advanceVitals
     HealthState playerHealth;
     NutritionState playerNutrition;
     std::map<std::string, Disease> knownDiseases;
     std::map<std::string, HealingMethod> healingMethods;
     std::map<std::string, float> regionDiseaseRisk; // Region name to disease risk multiplier
-};
\ No newline at end of file
+
+    HealthContext()
+        : playerVitals(vitals.add())
+        , playerHealth(vitals, playerVitals)
+        , playerNutrition(vitals, playerVitals)
+    {
+    }
+
+    // The player's states refer to this context's table
+    HealthContext(const HealthContext&) = delete;
+    HealthContext& operator=(const HealthContext&) = delete;
+
+    // Every row's vitals move hours on in one pass
+    void advanceVitals(float hours)
+    {
+        vitalEvents.clear();
+        vitals.advance(hours, vitalEvents);
+    }
+};
@@ -24,8 +24,8 @@ void HealthStateNode::onEnter(GameContext* context) override
         return;
 
     std::cout << "==== Health Status ====" << std::endl;
-    std::cout << "Health: " << health->currentHealth << "/" << health->maxHealth << std::endl;
-    std::cout << "Stamina: " << health->stamina << "/" << health->maxStamina << std::endl;
+    std::cout << "Health: " << health->getHealth() << "/" << health->getMaxHealth() << std::endl;
+    std::cout << "Stamina: " << health->getStamina() << "/" << health->getMaxStamina() << std::endl;
 
     if (!health->activeDiseaseDays.empty()) {
         std::cout << "\nActive Diseases:" << std::endl;
@@ -502,17 +502,7 @@ void RestNode::applyRest(int hours, GameContext* context)
     // Calculate how many game hours have passed
     int gameHours = hours;
 
-    // Update nutrition based on time passed
-    nutrition->update(static_cast<float>(gameHours));
-
-    // Apply nutrition effects (could affect healing rates)
-    nutrition->applyEffects(context);
-
-    // Update health based on the rest duration
-    float healthRecovery = health->naturalHealRate * gameHours;
-    float staminaRecovery = (health->maxStamina * 0.1f) * gameHours;
-
-    // Reduce recovery if sick or hungry/thirsty
+    // Reduce recovery if sick or hungry/thirsty as the rest begins
     float recoveryModifier = 1.0f;
 
     // Check for sickness
@@ -529,15 +519,22 @@ void RestNode::applyRest(int hours, GameContext* context)
         recoveryModifier *= 0.6f; // Dehydration severely reduces recovery
     }
 
-    healthRecovery *= recoveryModifier;
-    staminaRecovery *= recoveryModifier;
-
-    health->heal(healthRecovery);
-    health->restoreStamina(staminaRecovery);
+    // Health, stamina, hunger and thirst move through the whole rest in one
+    // step of the vitals table
+    float healthBefore = health->getHealth();
+    float staminaBefore = health->getStamina();
+    health->setRecoveryRates(health->naturalHealRate * recoveryModifier, health->getMaxStamina() * 0.1f * recoveryModifier);
+    context->healthContext.advanceVitals(static_cast<float>(gameHours));
+    health->setRecoveryRates(0.0f, 0.0f);
+    float healthRecovery = health->getHealth() - healthBefore;
+    float staminaRecovery = health->getStamina() - staminaBefore;
+
+    // Apply nutrition effects
+    nutrition->reportLevels();
+    nutrition->applyEffects(context);
 
     // Update diseases based on how many days have passed
     int daysPassed = gameHours / 24;
-    int hoursLeftover = gameHours % 24;
 
     // Process each full day
     for (int i = 0; i < daysPassed; i++) {
@@ -546,14 +543,6 @@ void RestNode::applyRest(int hours, GameContext* context)
 
         // Update diseases
         manager->updateDiseases(context, context->worldState.daysPassed);
-
-        // For each day, apply a full day's worth of nutrition updates
-        nutrition->update(24.0f);
-    }
-
-    // Apply leftover hours
-    if (hoursLeftover > 0) {
-        nutrition->update(static_cast<float>(hoursLeftover));
     }
 
     // Show the results
@@ -561,8 +550,8 @@ void RestNode::applyRest(int hours, GameContext* context)
     std::cout << "Recovered " << healthRecovery << " health and " << staminaRecovery << " stamina." << std::endl;
 
     // Show nutrition status changes
-    std::cout << "Hunger: " << nutrition->hunger << "/100 (" << nutrition->getHungerLevelString() << ")" << std::endl;
-    std::cout << "Thirst: " << nutrition->thirst << "/100 (" << nutrition->getThirstLevelString() << ")" << std::endl;
+    std::cout << "Hunger: " << nutrition->getHunger() << "/100 (" << nutrition->getHungerLevelString() << ")" << std::endl;
+    std::cout << "Thirst: " << nutrition->getThirst() << "/100 (" << nutrition->getThirstLevelString() << ")" << std::endl;
 
     if (daysPassed > 0) {
         std::cout << daysPassed << " days have passed." << std::endl;
@@ -636,14 +625,14 @@ void EpidemicNode::onEnter(GameContext* context)
         return;
 
     std::cout << "==== Health Status ====" << std::endl;
-    std::cout << "Health: " << health->currentHealth << "/" << health->maxHealth << std::endl;
-    std::cout << "Stamina: " << health->stamina << "/" << health->maxStamina << std::endl;
+    std::cout << "Health: " << health->getHealth() << "/" << health->getMaxHealth() << std::endl;
+    std::cout << "Stamina: " << health->getStamina() << "/" << health->getMaxStamina() << std::endl;
 
     // Add nutrition status
     NutritionState* nutrition = &context->healthContext.playerNutrition;
     if (nutrition) {
-        std::cout << "Hunger: " << nutrition->hunger << "/100 (" << nutrition->getHungerLevelString() << ")" << std::endl;
-        std::cout << "Thirst: " << nutrition->thirst << "/100 (" << nutrition->getThirstLevelString() << ")" << std::endl;
+        std::cout << "Hunger: " << nutrition->getHunger() << "/100 (" << nutrition->getHungerLevelString() << ")" << std::endl;
+        std::cout << "Thirst: " << nutrition->getThirst() << "/100 (" << nutrition->getThirstLevelString() << ")" << std::endl;
     }
 
     DiseaseManager* manager = getDiseaseManager(context);
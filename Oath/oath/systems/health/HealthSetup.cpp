@@ -1,13 +1,17 @@
 // /oath/systems/health/HealthSetup.cpp
 #include "../../core/TAController.hpp"
+#include "../world/RegionNode.hpp"
+#include "../world/TimeNode.hpp"
 #include "DiseaseManager.hpp"
+#include "HealthSetup.hpp"
 #include "HealthNodes.hpp"
 #include "NutritionNode.hpp"
 #include "NutritionState.hpp"
 #include <iostream>
 
-// Main function to set up the disease and health system
-void setupDiseaseHealthSystem(TAController& controller)
+// Main function to set up the disease and health system. Disease also
+// spreads among the relationship manager's NPCs as days pass.
+void setupDiseaseHealthSystem(TAController& controller, NPCRelationshipManager* relationships)
 {
     std::cout << "Setting up Disease and Health System..." << std::endl;
 
@@ -137,27 +141,36 @@ void setupDiseaseHealthSystem(TAController& controller)
             file.close();
 
             controller.gameContext.healthContext.playerNutrition.initFromJson(j["defaultNutritionState"]);
-        } else {
-            // Use default values if file can't be loaded
-            controller.gameContext.healthContext.playerNutrition = NutritionState();
         }
+        // Otherwise the state keeps the defaults it was built with
     }
 
     // Add disease manager to game context
     controller.gameContext.diseaseManager = diseaseManager;
 
+    // NPC epidemics step with the clock, over the world's locations
+    DiseaseManager& npcDiseases = controller.gameContext.diseaseManager;
+    auto worldIt = controller.systemRoots.find("WorldSystem");
+    if (worldIt != controller.systemRoots.end()) {
+        npcDiseases.setLocationRegions(dynamic_cast<RegionNode*>(worldIt->second));
+    }
+    auto timeIt = controller.systemRoots.find("TimeSystem");
+    if (timeIt != controller.systemRoots.end()) {
+        npcDiseases.hookToTimeSystem(dynamic_cast<TimeNode*>(timeIt->second), relationships);
+    }
+
     std::cout << "Disease, Health, and Nutrition System initialized with "
               << diseaseManager.diseases.size() << " diseases and "
               << diseaseManager.healingMethods.size() << " healing methods." << std::endl;
 }
 
 // Example usage of the disease system in a game loop
-void exampleDiseaseSystemUsage(TAController& controller)
+void exampleDiseaseSystemUsage(TAController& controller, NPCRelationshipManager* relationships)
 {
     GameContext* context = &controller.gameContext;
 
     // Initialize your health context and disease manager in your game context
-    setupDiseaseHealthSystem(controller);
+    setupDiseaseHealthSystem(controller, relationships);
 
     // Example of checking for disease exposure during travel
     std::cout << "\n=== TRAVELING TO A NEW REGION ===\n"
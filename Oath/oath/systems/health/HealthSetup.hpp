@@ -0,0 +1,14 @@
+// /oath/systems/health/HealthSetup.hpp
+#pragma once
+
+#include "../../core/TAController.hpp"
+
+class NPCRelationshipManager;
+
+// Create the health, treatment, rest and nutrition nodes and the disease
+// manager. NPC epidemics step with the clock over the relationship manager's
+// NPCs, so set up the relationship system first and pass its manager.
+void setupDiseaseHealthSystem(TAController& controller, NPCRelationshipManager* relationships);
+
+// Walk through exposure, rest and treatment on a fresh health system
+void exampleDiseaseSystemUsage(TAController& controller, NPCRelationshipManager* relationships);
@@ -1,51 +1,68 @@
 // /oath/systems/health/HealthState.cpp
 #include "HealthState.hpp"
+#include "DiseaseIndex.hpp"
 #include "DiseaseManager.hpp"
 #include <algorithm>
 #include <iostream>
 
 
-HealthState::HealthState()
-    : currentHealth(100.0f)
-    , maxHealth(100.0f)
-    , stamina(100.0f)
-    , maxStamina(100.0f)
-    , naturalHealRate(1.0f)
+HealthState::HealthState(VitalsTable& table, int entity)
+    : naturalHealRate(1.0f)
     , diseaseResistance(0.0f)
+    , immunityIndexVersion(-1)
+    , vitals(table)
+    , entity(entity)
 {
+    vitals.setMax(entity, Vital::Health, 100.0f);
+    vitals.set(entity, Vital::Health, 100.0f);
+    vitals.setMax(entity, Vital::Stamina, 100.0f);
+    vitals.set(entity, Vital::Stamina, 100.0f);
 }
 
 void HealthState::initFromJson(const nlohmann::json& healthJson)
 {
-    maxHealth = healthJson["maxHealth"];
-    currentHealth = maxHealth;
-    maxStamina = healthJson["maxStamina"];
-    stamina = maxStamina;
+    float maxHealth = healthJson["maxHealth"];
+    vitals.setMax(entity, Vital::Health, maxHealth);
+    vitals.set(entity, Vital::Health, maxHealth);
+    float maxStamina = healthJson["maxStamina"];
+    vitals.setMax(entity, Vital::Stamina, maxStamina);
+    vitals.set(entity, Vital::Stamina, maxStamina);
     naturalHealRate = healthJson["naturalHealRate"];
     diseaseResistance = healthJson["diseaseResistance"];
 }
 
+void HealthState::setMaxStamina(float max)
+{
+    vitals.setMax(entity, Vital::Stamina, max);
+}
+
+void HealthState::setRecoveryRates(float healthPerHour, float staminaPerHour)
+{
+    vitals.setRate(entity, Vital::Health, healthPerHour);
+    vitals.setRate(entity, Vital::Stamina, staminaPerHour);
+}
+
 void HealthState::takeDamage(float amount)
 {
-    currentHealth = std::max(0.0f, currentHealth - amount);
-    if (currentHealth <= 0) {
+    vitals.change(entity, Vital::Health, -amount);
+    if (getHealth() <= 0) {
         std::cout << "You have fallen unconscious due to your injuries!" << std::endl;
     }
 }
 
 void HealthState::heal(float amount)
 {
-    currentHealth = std::min(maxHealth, currentHealth + amount);
+    vitals.change(entity, Vital::Health, amount);
 }
 
 void HealthState::useStamina(float amount)
 {
-    stamina = std::max(0.0f, stamina - amount);
+    vitals.change(entity, Vital::Stamina, -amount);
 }
 
 void HealthState::restoreStamina(float amount)
 {
-    stamina = std::min(maxStamina, stamina + amount);
+    vitals.change(entity, Vital::Stamina, amount);
 }
 
 void HealthState::contractDisease(const std::string& diseaseId, DiseaseManager* manager)
@@ -143,9 +160,47 @@ float HealthState::getImmunityStrength(const std::string& diseaseId, int current
     return strongest;
 }
 
+float HealthState::getImmunityStrength(int diseaseSlot, int currentDay) const
+{
+    float strongest = 0.0f;
+
+    for (int i = immunityHeads[diseaseSlot]; i >= 0; i = immunityNext[i]) {
+        float strength = immunities[i].getEffectiveStrength(currentDay);
+        if (strength > strongest) {
+            strongest = strength;
+        }
+    }
+
+    return strongest;
+}
+
+bool HealthState::immunitySlotsCurrent(const DiseaseIndex& index) const
+{
+    // The size check catches immunities added without addImmunity
+    return immunityIndexVersion == index.version() && immunityNext.size() == immunities.size();
+}
+
+void HealthState::indexImmunities(const DiseaseIndex& index)
+{
+    immunityHeads.assign(index.diseaseCount(), -1);
+    immunityNext.assign(immunities.size(), -1);
+
+    // Backwards, so each chain runs in the order the immunities were gained
+    for (int i = static_cast<int>(immunities.size()) - 1; i >= 0; i--) {
+        int slot = index.diseaseSlot(immunities[i].diseaseId);
+        if (slot >= 0) {
+            immunityNext[i] = immunityHeads[slot];
+            immunityHeads[slot] = i;
+        }
+    }
+
+    immunityIndexVersion = index.version();
+}
+
 void HealthState::addImmunity(const std::string& diseaseId, float strength, int duration, int currentDay)
 {
     immunities.push_back(Immunity(diseaseId, strength, duration, currentDay));
+    immunityIndexVersion = -1;
     std::cout << "Gained " << (duration == -1 ? "permanent" : "temporary")
               << " immunity to " << diseaseId
               << " (Strength: " << strength << ")" << std::endl;
@@ -160,4 +215,5 @@ void HealthState::updateImmunities(int currentDay)
                 return !immunity.isActive(currentDay);
             }),
         immunities.end());
+    immunityIndexVersion = -1;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 // /oath/systems/health/HealthState.hpp
 #pragma once
 
+#include "../../data/VitalsTable.hpp"
 #include "Immunity.hpp"
 #include <map>
 #include <nlohmann/json.hpp>
@@ -9,25 +10,39 @@
 
 // Forward declaration
 class DiseaseManager;
+class DiseaseIndex;
 
-// Class to represent the player's health state
+// Class to represent the player's health state. Health and stamina are a row
+// of a VitalsTable, so resting moves them with every other vital in one pass.
 class HealthState {
 public:
-    float currentHealth;
-    float maxHealth;
-    float stamina;
-    float maxStamina;
-    float naturalHealRate;
+    float naturalHealRate; // Health per hour of rest
     float diseaseResistance;
     std::map<std::string, int> activeDiseaseDays; // Disease ID to days infected
     std::map<std::string, bool> pastDiseases; // Diseases the player has recovered from
     std::vector<Immunity> immunities; // Immunities player has developed
 
-    HealthState();
+    // Immunities by DiseaseIndex slot: the first position in immunities, then
+    // a chain through immunityNext. Rebuilt by indexImmunities when stale.
+    std::vector<int> immunityHeads;
+    std::vector<int> immunityNext;
+    int immunityIndexVersion; // Index version the heads match, -1 after a change
+
+    // Full health and stamina of 100, on the entity's row of the table
+    HealthState(VitalsTable& table, int entity);
 
     // Initialize from JSON
     void initFromJson(const nlohmann::json& healthJson);
 
+    float getHealth() const { return vitals.get(entity, Vital::Health); }
+    float getMaxHealth() const { return vitals.getMax(entity, Vital::Health); }
+    float getStamina() const { return vitals.get(entity, Vital::Stamina); }
+    float getMaxStamina() const { return vitals.getMax(entity, Vital::Stamina); }
+    void setMaxStamina(float max);
+
+    // Health and stamina regained per hour as the table advances; 0 when not resting
+    void setRecoveryRates(float healthPerHour, float staminaPerHour);
+
     void takeDamage(float amount);
     void heal(float amount);
     void useStamina(float amount);
@@ -37,6 +52,13 @@ public:
     bool hasDisease(const std::string& diseaseId) const;
     bool hadDisease(const std::string& diseaseId) const;
     float getImmunityStrength(const std::string& diseaseId, int currentDay) const;
+    float getImmunityStrength(int diseaseSlot, int currentDay) const; // Needs current slots
+    bool immunitySlotsCurrent(const DiseaseIndex& index) const;
+    void indexImmunities(const DiseaseIndex& index);
     void addImmunity(const std::string& diseaseId, float strength, int duration, int currentDay);
     void updateImmunities(int currentDay);
+
+private:
+    VitalsTable& vitals;
+    int entity;
 };
\ No newline at end of file
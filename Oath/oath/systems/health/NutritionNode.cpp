@@ -19,8 +19,8 @@ void NutritionNode::onEnter(GameContext* context)
         return;
 
     std::cout << "==== Nutrition Status ====" << std::endl;
-    std::cout << "Hunger: " << nutrition->hunger << "/100 (" << nutrition->getHungerLevelString() << ")" << std::endl;
-    std::cout << "Thirst: " << nutrition->thirst << "/100 (" << nutrition->getThirstLevelString() << ")" << std::endl;
+    std::cout << "Hunger: " << nutrition->getHunger() << "/100 (" << nutrition->getHungerLevelString() << ")" << std::endl;
+    std::cout << "Thirst: " << nutrition->getThirst() << "/100 (" << nutrition->getThirstLevelString() << ")" << std::endl;
 
     // Check for items in inventory that can be consumed
     std::cout << "\nFood Items Available:" << std::endl;
@@ -1,43 +1,42 @@
 // /oath/systems/health/NutritionState.cpp
+#include "../../data/GameContext.hpp"
 #include "HealthState.hpp"
 #include "NutritionState.hpp"
 #include <algorithm>
 #include <iostream>
 
 
-NutritionState::NutritionState()
-    : hunger(75.0f)
-    , thirst(75.0f)
-    , maxHunger(100.0f)
-    , maxThirst(100.0f)
-    , hungerRate(2.0f) // Default: lose 2% hunger per hour
-    , thirstRate(3.0f) // Default: lose 3% thirst per hour (faster than hunger)
+NutritionState::NutritionState(VitalsTable& table, int entity)
+    : vitals(table)
+    , entity(entity)
 {
+    vitals.set(entity, Vital::Hunger, 75.0f);
+    vitals.set(entity, Vital::Thirst, 75.0f);
+    vitals.setRate(entity, Vital::Hunger, -2.0f); // Default: lose 2% hunger per hour
+    vitals.setRate(entity, Vital::Thirst, -3.0f); // Default: lose 3% thirst per hour (faster than hunger)
 }
 
 void NutritionState::initFromJson(const nlohmann::json& nutritionJson)
 {
-    maxHunger = nutritionJson.value("maxHunger", 100.0f);
-    maxThirst = nutritionJson.value("maxThirst", 100.0f);
-    hunger = nutritionJson.value("initialHunger", 75.0f);
-    thirst = nutritionJson.value("initialThirst", 75.0f);
-    hungerRate = nutritionJson.value("hungerRate", 2.0f);
-    thirstRate = nutritionJson.value("thirstRate", 3.0f);
+    vitals.setMax(entity, Vital::Hunger, nutritionJson.value("maxHunger", 100.0f));
+    vitals.setMax(entity, Vital::Thirst, nutritionJson.value("maxThirst", 100.0f));
+    vitals.set(entity, Vital::Hunger, nutritionJson.value("initialHunger", 75.0f));
+    vitals.set(entity, Vital::Thirst, nutritionJson.value("initialThirst", 75.0f));
+    vitals.setRate(entity, Vital::Hunger, -nutritionJson.value("hungerRate", 2.0f));
+    vitals.setRate(entity, Vital::Thirst, -nutritionJson.value("thirstRate", 3.0f));
 }
 
-void NutritionState::update(float hoursPassed)
+void NutritionState::reportLevels() const
 {
-    // Reduce hunger and thirst based on time passed
-    hunger = std::max(0.0f, hunger - (hungerRate * hoursPassed));
-    thirst = std::max(0.0f, thirst - (thirstRate * hoursPassed));
-
     // Show warnings for critical levels
+    float hunger = getHunger();
     if (hunger <= criticalThreshold) {
         std::cout << "You are critically hungry and need food immediately!" << std::endl;
     } else if (hunger <= lowThreshold) {
         std::cout << "Your stomach growls painfully. You need to eat soon." << std::endl;
     }
 
+    float thirst = getThirst();
     if (thirst <= criticalThreshold) {
         std::cout << "You are severely dehydrated and need water immediately!" << std::endl;
     } else if (thirst <= lowThreshold) {
@@ -47,9 +46,10 @@ void NutritionState::update(float hoursPassed)
 
 void NutritionState::consumeFood(float nutritionValue)
 {
-    hunger = std::min(maxHunger, hunger + nutritionValue);
+    vitals.change(entity, Vital::Hunger, nutritionValue);
 
     // Feedback based on new hunger level
+    float hunger = getHunger();
     if (hunger >= highThreshold) {
         std::cout << "You feel completely full." << std::endl;
     } else if (hunger >= normalThreshold) {
@@ -61,9 +61,10 @@ void NutritionState::consumeFood(float nutritionValue)
 
 void NutritionState::consumeWater(float hydrationValue)
 {
-    thirst = std::min(maxThirst, thirst + hydrationValue);
+    vitals.change(entity, Vital::Thirst, hydrationValue);
 
     // Feedback based on new thirst level
+    float thirst = getThirst();
     if (thirst >= highThreshold) {
         std::cout << "You feel completely hydrated." << std::endl;
     } else if (thirst >= normalThreshold) {
@@ -73,34 +74,16 @@ void NutritionState::consumeWater(float hydrationValue)
     }
 }
 
+// The table's Hunger and Thirst bands count the thresholds passed, the
+// same order as the levels
 NutritionLevel NutritionState::getHungerLevel() const
 {
-    if (hunger >= highThreshold)
-        return NutritionLevel::OVERFED;
-    if (hunger >= normalThreshold)
-        return NutritionLevel::SATISFIED;
-    if (hunger >= lowThreshold)
-        return NutritionLevel::NORMAL;
-    if (hunger >= criticalThreshold)
-        return NutritionLevel::HUNGRY;
-    if (hunger > 0)
-        return NutritionLevel::STARVING;
-    return NutritionLevel::CRITICAL;
+    return static_cast<NutritionLevel>(vitals.getBand(entity, Vital::Hunger));
 }
 
 HydrationLevel NutritionState::getThirstLevel() const
 {
-    if (thirst >= highThreshold)
-        return HydrationLevel::OVERHYDRATED;
-    if (thirst >= normalThreshold)
-        return HydrationLevel::HYDRATED;
-    if (thirst >= lowThreshold)
-        return HydrationLevel::NORMAL;
-    if (thirst >= criticalThreshold)
-        return HydrationLevel::THIRSTY;
-    if (thirst > 0)
-        return HydrationLevel::DEHYDRATED;
-    return HydrationLevel::CRITICAL;
+    return static_cast<HydrationLevel>(vitals.getBand(entity, Vital::Thirst));
 }
 
 std::string NutritionState::getHungerLevelString() const
@@ -162,7 +145,7 @@ void NutritionState::applyEffects(GameContext* context) const
         context->playerStats.modifiers["dexterity"] -= 5.0f;
         context->playerStats.modifiers["constitution"] -= 5.0f;
         // Stamina reduction
-        health->maxStamina = health->maxStamina * 0.5f;
+        health->setMaxStamina(health->getMaxStamina() * 0.5f);
         break;
 
     case NutritionLevel::STARVING:
@@ -171,7 +154,7 @@ void NutritionState::applyEffects(GameContext* context) const
         context->playerStats.modifiers["dexterity"] -= 2.0f;
         context->playerStats.modifiers["constitution"] -= 2.0f;
         // Stamina reduction
-        health->maxStamina = health->maxStamina * 0.7f;
+        health->setMaxStamina(health->getMaxStamina() * 0.7f);
         break;
 
     case NutritionLevel::HUNGRY:
@@ -179,7 +162,7 @@ void NutritionState::applyEffects(GameContext* context) const
         context->playerStats.modifiers["strength"] -= 1.0f;
         context->playerStats.modifiers["dexterity"] -= 1.0f;
         // Stamina reduction
-        health->maxStamina = health->maxStamina * 0.9f;
+        health->setMaxStamina(health->getMaxStamina() * 0.9f);
         break;
 
     case NutritionLevel::OVERFED:
@@ -203,7 +186,7 @@ void NutritionState::applyEffects(GameContext* context) const
         context->playerStats.modifiers["constitution"] -= 6.0f;
         context->playerStats.modifiers["intelligence"] -= 3.0f;
         // Stamina reduction
-        health->maxStamina = health->maxStamina * 0.4f;
+        health->setMaxStamina(health->getMaxStamina() * 0.4f);
         break;
 
     case HydrationLevel::DEHYDRATED:
@@ -213,7 +196,7 @@ void NutritionState::applyEffects(GameContext* context) const
         context->playerStats.modifiers["constitution"] -= 3.0f;
         context->playerStats.modifiers["intelligence"] -= 2.0f;
         // Stamina reduction
-        health->maxStamina = health->maxStamina * 0.6f;
+        health->setMaxStamina(health->getMaxStamina() * 0.6f);
         break;
 
     case HydrationLevel::THIRSTY:
@@ -222,7 +205,7 @@ void NutritionState::applyEffects(GameContext* context) const
         context->playerStats.modifiers["constitution"] -= 1.0f;
         context->playerStats.modifiers["intelligence"] -= 1.0f;
         // Stamina reduction
-        health->maxStamina = health->maxStamina * 0.8f;
+        health->setMaxStamina(health->getMaxStamina() * 0.8f);
         break;
 
     case HydrationLevel::OVERHYDRATED:
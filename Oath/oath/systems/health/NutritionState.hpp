@@ -1,9 +1,12 @@
 // /oath/systems/health/NutritionState.hpp
 #pragma once
 
+#include "../../data/VitalsTable.hpp"
 #include <nlohmann/json.hpp>
 #include <string>
 
+struct GameContext;
+
 enum class NutritionLevel {
     OVERFED,
     SATISFIED,
@@ -22,33 +25,33 @@ enum class HydrationLevel {
     CRITICAL
 };
 
-// Class to represent player's nutrition and hydration state
+// Class to represent player's nutrition and hydration state. Hunger and
+// thirst are a row of a VitalsTable, whose bands are the levels below.
 class NutritionState {
 public:
-    float hunger; // 0-100 scale, 0 = critical, 100 = overfed
-    float thirst; // 0-100 scale, 0 = critical, 100 = overhydrated
-    float maxHunger; // Default 100
-    float maxThirst; // Default 100
-
-    float hungerRate; // How fast hunger decreases (per hour)
-    float thirstRate; // How fast thirst decreases (per hour)
-
     // Thresholds for different levels
     const float criticalThreshold = 10.0f;
     const float lowThreshold = 25.0f;
     const float normalThreshold = 50.0f;
     const float highThreshold = 75.0f;
 
-    NutritionState();
+    // Hunger and thirst at 75 of 100, falling 2 and 3 an hour, on the
+    // entity's row of the table
+    NutritionState(VitalsTable& table, int entity);
 
     // Initialize from JSON
     void initFromJson(const nlohmann::json& nutritionJson);
 
+    float getHunger() const { return vitals.get(entity, Vital::Hunger); } // 0-100 scale, 0 = critical, 100 = overfed
+    float getThirst() const { return vitals.get(entity, Vital::Thirst); } // 0-100 scale, 0 = critical, 100 = overhydrated
+
     // Core functions
-    void update(float hoursPassed);
     void consumeFood(float nutritionValue);
     void consumeWater(float hydrationValue);
 
+    // Warn once time has passed and the levels are low
+    void reportLevels() const;
+
     // Status getters
     NutritionLevel getHungerLevel() const;
     HydrationLevel getThirstLevel() const;
@@ -57,4 +60,8 @@ public:
 
     // Apply effects based on current levels
     void applyEffects(GameContext* context) const;
+
+private:
+    VitalsTable& vitals;
+    int entity;
 };
\ No newline at end of file
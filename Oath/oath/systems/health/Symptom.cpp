@@ -144,7 +144,8 @@ void Symptom::applyStatEffects(GameContext* context) const
         if (statName == "strength") {
             context->playerStats.modifiers["strength"] -= actualEffect;
         } else if (statName == "stamina") {
-            context->healthContext.playerHealth.maxStamina -= actualEffect;
+            float maxStamina = context->healthContext.playerHealth.getMaxStamina();
+            context->healthContext.playerHealth.setMaxStamina(maxStamina - actualEffect);
         } else if (statName == "constitution") {
             context->playerStats.modifiers["constitution"] -= actualEffect;
         } else if (statName == "dexterity") {
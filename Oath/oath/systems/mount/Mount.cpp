@@ -4,6 +4,7 @@
 #include "MountStats.hpp"
 #include "MountSystemConfig.hpp"
 #include <cstdlib>
+#include <iostream>
 #include <nlohmann/json.hpp>
 #include <sstream>
 
@@ -23,7 +24,7 @@ Mount::Mount(const std::string& mountId, const std::string& mountName, MountBree
     }
 }
 
-Mount* Mount::createFromTemplate(const nlohmann::json& templateJson, MountBreed* breed, MountSystemConfig& config)
+Mount* Mount::createFromTemplate(const nlohmann::json& templateJson, MountBreed* breed, const MountSystemConfig& config)
 {
     if (!breed) {
         std::cerr << "Cannot create mount: no breed specified" << std::endl;
@@ -183,12 +184,13 @@ float Mount::getTravelTimeModifier() const
 bool Mount::useSpecialAbility(const std::string& ability, const MountSystemConfig& config)
 {
     // Check if ability exists in the system
-    if (config.specialAbilities.find(ability) == config.specialAbilities.end()) {
+    const SpecialAbilityInfo* found = config.findAbility(ability);
+    if (!found) {
         return false;
     }
 
     // Get ability info
-    const SpecialAbilityInfo& abilityInfo = config.specialAbilities.at(ability);
+    const SpecialAbilityInfo& abilityInfo = *found;
 
     // Check if mount can use this ability
     bool canPerform = config.canUseAbility(stats, ability);
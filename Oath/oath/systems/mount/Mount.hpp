@@ -3,8 +3,11 @@
 #include <map>
 #include <string>
 
+#include <nlohmann/json.hpp>
+
+#include "MountStats.hpp"
+
 enum class MountEquipmentSlot;
-struct MountStats;
 struct MountBreed;
 struct MountEquipment;
 struct MountSystemConfig;
@@ -29,7 +32,7 @@ public:
     std::map<MountEquipmentSlot, MountEquipment*> equippedItems;
 
     Mount(const std::string& mountId, const std::string& mountName, MountBreed* mountBreed);
-    static Mount* createFromTemplate(const nlohmann::json& templateJson, MountBreed* breed, MountSystemConfig& config);
+    static Mount* createFromTemplate(const nlohmann::json& templateJson, MountBreed* breed, const MountSystemConfig& config);
     MountStats getEffectiveStats() const;
     bool equipItem(MountEquipment* equipment);
     MountEquipment* unequipItem(MountEquipmentSlot slot);
@@ -10,7 +10,7 @@
 #include <random>
 
 
-MountBreedingNode::MountBreedingNode(const std::string& name, const std::string& center, int fee, MountSystemConfig* cfg)
+MountBreedingNode::MountBreedingNode(const std::string& name, const std::string& center, int fee, const ConfigSnapshot<MountSystemConfig>* cfg)
     : TANode(name)
     , centerName(center)
     , breedingFee(fee)
@@ -18,18 +18,19 @@ MountBreedingNode::MountBreedingNode(const std::string& name, const std::string&
 {
 }
 
-void MountBreedingNode::setConfig(MountSystemConfig* cfg)
+void MountBreedingNode::setConfig(const ConfigSnapshot<MountSystemConfig>* cfg)
 {
     config = cfg;
 }
 
 MountBreedingNode* MountBreedingNode::createFromJson(const std::string& name, const nlohmann::json& j,
-    std::map<std::string, MountBreed*>& breedTypes, MountSystemConfig& config)
+    std::map<std::string, MountBreed*>& breedTypes, const ConfigSnapshot<MountSystemConfig>& config)
 {
     std::string centerName = j["name"];
     int fee = j["fee"];
 
     MountBreedingNode* node = new MountBreedingNode(name, centerName, fee, &config);
+    auto settings = config.get();
 
     // Create breeding stock from templates
     if (j.contains("breedingStock") && j["breedingStock"].is_array()) {
@@ -39,7 +40,7 @@ MountBreedingNode* MountBreedingNode::createFromJson(const std::string& name, co
             // Find the breed
             if (breedTypes.find(breedId) != breedTypes.end()) {
                 MountBreed* breed = breedTypes[breedId];
-                Mount* mount = Mount::createFromTemplate(mountTemplate, breed, config);
+                Mount* mount = Mount::createFromTemplate(mountTemplate, breed, *settings);
 
                 if (mount) {
                     node->availableForBreeding.push_back(mount);
@@ -163,7 +164,7 @@ Mount* MountBreedingNode::breedMounts(Mount* playerMount, Mount* centerMount, co
     }
 
     // Assign a color to the foal - use from config if available
-    foal->color = config->getRandomColor();
+    foal->color = config->get()->getRandomColor();
 
     return foal;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../core/TANode.hpp"
+#include "../../utils/ConfigSnapshot.hpp"
 #include <map>
 #include <nlohmann/json.hpp>
 #include <string>
@@ -19,12 +20,12 @@ public:
     std::string centerName;
     std::vector<Mount*> availableForBreeding;
     int breedingFee;
-    MountSystemConfig* config;
+    const ConfigSnapshot<MountSystemConfig>* config; // Read once per action
 
-    MountBreedingNode(const std::string& name, const std::string& center, int fee = 200, MountSystemConfig* cfg = nullptr);
-    void setConfig(MountSystemConfig* cfg);
+    MountBreedingNode(const std::string& name, const std::string& center, int fee = 200, const ConfigSnapshot<MountSystemConfig>* cfg = nullptr);
+    void setConfig(const ConfigSnapshot<MountSystemConfig>* cfg);
     static MountBreedingNode* createFromJson(const std::string& name, const nlohmann::json& j,
-        std::map<std::string, MountBreed*>& breedTypes, MountSystemConfig& config);
+        std::map<std::string, MountBreed*>& breedTypes, const ConfigSnapshot<MountSystemConfig>& config);
     void onEnter(GameContext* context) override;
     Mount* breedMounts(Mount* playerMount, Mount* centerMount, const std::string& foalName);
     std::vector<TAAction> getAvailableActions() override;
@@ -9,7 +9,7 @@
 #include <iostream>
 
 
-MountInteractionNode::MountInteractionNode(const std::string& name, Mount* mount, MountSystemConfig* cfg)
+MountInteractionNode::MountInteractionNode(const std::string& name, Mount* mount, const ConfigSnapshot<MountSystemConfig>* cfg)
     : TANode(name)
     , activeMount(mount)
     , config(cfg)
@@ -21,7 +21,7 @@ void MountInteractionNode::setActiveMount(Mount* mount)
     activeMount = mount;
 }
 
-void MountInteractionNode::setConfig(MountSystemConfig* cfg)
+void MountInteractionNode::setConfig(const ConfigSnapshot<MountSystemConfig>* cfg)
 {
     config = cfg;
 }
@@ -129,10 +129,11 @@ std::vector<TAAction> MountInteractionNode::getAvailableActions()
     // Special abilities (if mounted)
     if (activeMount->isMounted && config) {
         MountStats effectiveStats = activeMount->getEffectiveStats();
+        auto settings = config->get();
 
         // Add actions for abilities the mount can use
-        for (const auto& [abilityId, abilityInfo] : config->specialAbilities) {
-            bool canUse = config->canUseAbility(effectiveStats, abilityId);
+        for (const auto& [abilityId, abilityInfo] : settings->specialAbilities) {
+            bool canUse = settings->canUseAbility(effectiveStats, abilityId);
 
             if (canUse) {
                 actions.push_back({ abilityId, abilityInfo.name,
@@ -177,15 +178,18 @@ bool MountInteractionNode::evaluateTransition(const TAInput& input, TANode*& out
         } else if (action == "ability" && activeMount && config) {
             // Handle special abilities
             std::string ability = std::get<std::string>(input.parameters.at("ability"));
+            auto settings = config->get();
 
-            bool success = activeMount->useSpecialAbility(ability, *config);
+            bool success = activeMount->useSpecialAbility(ability, *settings);
 
+            const SpecialAbilityInfo* abilityInfo = settings->findAbility(ability);
+            std::string abilityName = abilityInfo ? abilityInfo->name : ability;
             if (success) {
                 std::cout << activeMount->name << " successfully performs "
-                          << config->specialAbilities[ability].name << "!" << std::endl;
+                          << abilityName << "!" << std::endl;
             } else {
                 std::cout << activeMount->name << " is unable to perform "
-                          << config->specialAbilities[ability].name << " right now." << std::endl;
+                          << abilityName << " right now." << std::endl;
             }
 
             outNextNode = this;
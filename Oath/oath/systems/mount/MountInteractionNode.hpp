@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../core/TANode.hpp"
+#include "../../utils/ConfigSnapshot.hpp"
 #include <string>
 
 class Mount;
@@ -13,11 +14,11 @@ struct TAAction;
 class MountInteractionNode : public TANode {
 public:
     Mount* activeMount;
-    MountSystemConfig* config;
+    const ConfigSnapshot<MountSystemConfig>* config; // Read once per action
 
-    MountInteractionNode(const std::string& name, Mount* mount = nullptr, MountSystemConfig* cfg = nullptr);
+    MountInteractionNode(const std::string& name, Mount* mount = nullptr, const ConfigSnapshot<MountSystemConfig>* cfg = nullptr);
     void setActiveMount(Mount* mount);
-    void setConfig(MountSystemConfig* cfg);
+    void setConfig(const ConfigSnapshot<MountSystemConfig>* cfg);
     void onEnter(GameContext* context) override;
     std::vector<TAAction> getAvailableActions() override;
     bool evaluateTransition(const TAInput& input, TANode*& outNextNode) override;
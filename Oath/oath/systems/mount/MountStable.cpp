@@ -1,6 +1,7 @@
 #include "MountStable.hpp"
 #include "Mount.hpp"
 #include "MountBreed.hpp"
+#include "MountEquipment.hpp"
 #include "MountSystemConfig.hpp"
 #include <algorithm>
 #include <iostream>
@@ -17,7 +18,7 @@ MountStable::MountStable(const std::string& stableId, const std::string& stableN
 {
 }
 
-MountStable* MountStable::createFromJson(const nlohmann::json& j, std::map<std::string, MountBreed*>& breedTypes, MountSystemConfig& config)
+MountStable* MountStable::createFromJson(const nlohmann::json& j, std::map<std::string, MountBreed*>& breedTypes, const MountSystemConfig& config)
 {
     std::string id = j["id"];
     std::string name = j["name"];
@@ -24,7 +24,7 @@ public:
     std::vector<Mount*> availableForPurchase;
 
     MountStable(const std::string& stableId, const std::string& stableName, const std::string& stableLocation, int stableCapacity = 5);
-    static MountStable* createFromJson(const nlohmann::json& j, std::map<std::string, MountBreed*>& breedTypes, MountSystemConfig& config);
+    static MountStable* createFromJson(const nlohmann::json& j, std::map<std::string, MountBreed*>& breedTypes, const MountSystemConfig& config);
     bool hasSpace() const;
     bool stableMount(Mount* mount);
     Mount* retrieveMount(const std::string& mountId);
@@ -3,6 +3,7 @@
 #include "../../core/TAInput.hpp"
 #include "../../data/GameContext.hpp"
 #include "Mount.hpp"
+#include "MountBreed.hpp"
 #include "MountStable.hpp"
 #include <iostream>
 
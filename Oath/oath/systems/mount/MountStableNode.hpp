@@ -3,6 +3,7 @@
 #include "../../core/TANode.hpp"
 #include <string>
 
+class Mount;
 class MountStable;
 struct GameContext;
 struct TAInput;
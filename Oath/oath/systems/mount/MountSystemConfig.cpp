@@ -16,13 +16,20 @@ SpecialAbilityInfo SpecialAbilityInfo::fromJson(const nlohmann::json& j)
     return info;
 }
 
-bool MountSystemConfig::canUnlockAbility(const MountStats& stats, const std::string& abilityId)
+const SpecialAbilityInfo* MountSystemConfig::findAbility(const std::string& abilityId) const
 {
-    if (specialAbilities.find(abilityId) == specialAbilities.end()) {
+    auto it = specialAbilities.find(abilityId);
+    return it != specialAbilities.end() ? &it->second : nullptr;
+}
+
+bool MountSystemConfig::canUnlockAbility(const MountStats& stats, const std::string& abilityId) const
+{
+    const SpecialAbilityInfo* found = findAbility(abilityId);
+    if (!found) {
         return false;
     }
 
-    const SpecialAbilityInfo& ability = specialAbilities[abilityId];
+    const SpecialAbilityInfo& ability = *found;
 
     // Check if the mount has the required training level in the appropriate skill
     if (stats.specialTraining.find(ability.trainingType) != stats.specialTraining.end()) {
@@ -33,13 +40,14 @@ bool MountSystemConfig::canUnlockAbility(const MountStats& stats, const std::str
     return false;
 }
 
-bool MountSystemConfig::canUseAbility(const MountStats& stats, const std::string& abilityId)
+bool MountSystemConfig::canUseAbility(const MountStats& stats, const std::string& abilityId) const
 {
-    if (specialAbilities.find(abilityId) == specialAbilities.end()) {
+    const SpecialAbilityInfo* found = findAbility(abilityId);
+    if (!found) {
         return false;
     }
 
-    const SpecialAbilityInfo& ability = specialAbilities[abilityId];
+    const SpecialAbilityInfo& ability = *found;
 
     // Check specific ability flags
     if (abilityId == "jump" && !stats.canJump)
@@ -61,7 +69,7 @@ bool MountSystemConfig::canUseAbility(const MountStats& stats, const std::string
     return false;
 }
 
-std::string MountSystemConfig::getRandomColor()
+std::string MountSystemConfig::getRandomColor() const
 {
     if (colors.empty()) {
         return "Brown"; // Default fallback
@@ -73,10 +81,8 @@ std::string MountSystemConfig::getRandomColor()
     return colors[dist(gen)];
 }
 
-int MountSystemConfig::getAbilityStaminaCost(const std::string& abilityId)
+int MountSystemConfig::getAbilityStaminaCost(const std::string& abilityId) const
 {
-    if (specialAbilities.find(abilityId) != specialAbilities.end()) {
-        return specialAbilities[abilityId].staminaCost;
-    }
-    return 0; // Default if ability not found
+    const SpecialAbilityInfo* ability = findAbility(abilityId);
+    return ability ? ability->staminaCost : 0; // Default if ability not found
 }
\ No newline at end of file
@@ -1,28 +1,11 @@
 #pragma once
 
 #include <map>
+#include <nlohmann/json.hpp>
 #include <string>
 #include <vector>
 
 struct MountStats;
-struct SpecialAbilityInfo;
-
-// Struct to hold global mount system configuration
-struct MountSystemConfig {
-    // Map of all special abilities by ID
-    std::map<std::string, SpecialAbilityInfo> specialAbilities;
-
-    // Training types
-    std::vector<std::pair<std::string, std::string>> trainingTypes;
-
-    // Available mount colors
-    std::vector<std::string> colors;
-
-    bool canUnlockAbility(const MountStats& stats, const std::string& abilityId);
-    bool canUseAbility(const MountStats& stats, const std::string& abilityId);
-    std::string getRandomColor();
-    int getAbilityStaminaCost(const std::string& abilityId);
-};
 
 // Structure to hold special ability information
 struct SpecialAbilityInfo {
@@ -35,4 +18,23 @@ struct SpecialAbilityInfo {
     int unlockThreshold;
 
     static SpecialAbilityInfo fromJson(const nlohmann::json& j);
-};
\ No newline at end of file
+};
+
+// Struct to hold global mount system configuration. The controller publishes
+// it as an immutable snapshot; nodes take the current one per action.
+struct MountSystemConfig {
+    // Map of all special abilities by ID
+    std::map<std::string, SpecialAbilityInfo> specialAbilities;
+
+    // Training types
+    std::vector<std::pair<std::string, std::string>> trainingTypes;
+
+    // Available mount colors
+    std::vector<std::string> colors;
+
+    const SpecialAbilityInfo* findAbility(const std::string& abilityId) const; // nullptr if unknown
+    bool canUnlockAbility(const MountStats& stats, const std::string& abilityId) const;
+    bool canUseAbility(const MountStats& stats, const std::string& abilityId) const;
+    std::string getRandomColor() const;
+    int getAbilityStaminaCost(const std::string& abilityId) const;
+};
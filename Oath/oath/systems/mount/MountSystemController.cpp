@@ -23,12 +23,16 @@ MountSystemController::MountSystemController(const std::string& name, const std:
 
 void MountSystemController::loadConfig()
 {
+    // Built in full, then published in one step
+    auto settings = std::make_shared<MountSystemConfig>();
+
     try {
         // Check if file exists
         if (!std::filesystem::exists(configPath)) {
             std::cerr << "Config file not found: " << configPath << std::endl;
             // Initialize with basic defaults
-            initializeBasicDefaults();
+            initializeBasicDefaults(*settings);
+            config.publish(std::move(settings));
             return;
         }
 
@@ -56,7 +60,7 @@ void MountSystemController::loadConfig()
         // Load stables
         if (mountConfig.contains("stables") && mountConfig["stables"].is_object()) {
             for (auto& [id, stableJson] : mountConfig["stables"].items()) {
-                MountStable* stable = MountStable::createFromJson(stableJson, breedTypes, config);
+                MountStable* stable = MountStable::createFromJson(stableJson, breedTypes, *settings);
                 stables.push_back(stable);
             }
         }
@@ -65,7 +69,7 @@ void MountSystemController::loadConfig()
         if (mountConfig.contains("specialAbilities") && mountConfig["specialAbilities"].is_object()) {
             for (auto& [id, abilityJson] : mountConfig["specialAbilities"].items()) {
                 SpecialAbilityInfo ability = SpecialAbilityInfo::fromJson(abilityJson);
-                config.specialAbilities[id] = ability;
+                settings->specialAbilities[id] = ability;
             }
         }
 
@@ -74,14 +78,14 @@ void MountSystemController::loadConfig()
             for (const auto& trainingJson : mountConfig["trainingTypes"]) {
                 std::string id = trainingJson["id"];
                 std::string description = trainingJson["description"];
-                config.trainingTypes.push_back({ id, description });
+                settings->trainingTypes.push_back({ id, description });
             }
         }
 
         // Load mount colors
         if (mountConfig.contains("colors") && mountConfig["colors"].is_array()) {
             for (const auto& color : mountConfig["colors"]) {
-                config.colors.push_back(color);
+                settings->colors.push_back(color);
             }
         }
 
@@ -90,11 +94,13 @@ void MountSystemController::loadConfig()
     } catch (const std::exception& e) {
         std::cerr << "Error loading mount configuration: " << e.what() << std::endl;
         // Initialize with basic defaults
-        initializeBasicDefaults();
+        initializeBasicDefaults(*settings);
     }
+
+    config.publish(std::move(settings));
 }
 
-void MountSystemController::initializeBasicDefaults()
+void MountSystemController::initializeBasicDefaults(MountSystemConfig& settings)
 {
     std::cout << "Initializing mount system with default values" << std::endl;
 
@@ -107,7 +113,7 @@ void MountSystemController::initializeBasicDefaults()
     breedTypes["standard_horse"] = standardHorse;
 
     // Set default training types
-    config.trainingTypes = {
+    settings.trainingTypes = {
         { "combat", "Fighting from mountback and defensive maneuvers" },
         { "endurance", "Long-distance travel and stamina management" },
         { "agility", "Jumping, balance, and difficult terrain navigation" },
@@ -115,7 +121,7 @@ void MountSystemController::initializeBasicDefaults()
     };
 
     // Default colors
-    config.colors = { "Bay", "Chestnut", "Black", "Gray", "White" };
+    settings.colors = { "Bay", "Chestnut", "Black", "Gray", "White" };
 
     // Default special abilities
     SpecialAbilityInfo jump;
@@ -126,7 +132,7 @@ void MountSystemController::initializeBasicDefaults()
     jump.skillRequired = 30;
     jump.trainingType = "agility";
     jump.unlockThreshold = 50;
-    config.specialAbilities["jump"] = jump;
+    settings.specialAbilities["jump"] = jump;
 
     SpecialAbilityInfo swim;
     swim.id = "swim";
@@ -136,7 +142,7 @@ void MountSystemController::initializeBasicDefaults()
     swim.skillRequired = 30;
     swim.trainingType = "endurance";
     swim.unlockThreshold = 60;
-    config.specialAbilities["swim"] = swim;
+    settings.specialAbilities["swim"] = swim;
 }
 
 void MountSystemController::registerStable(MountStable* stable)
@@ -156,7 +162,7 @@ Mount* MountSystemController::createMount(const std::string& name, const std::st
     Mount* newMount = new Mount(mountId, name, breedTypes[breedId]);
 
     // Set a random color from the config
-    newMount->color = config.getRandomColor();
+    newMount->color = config.get()->getRandomColor();
 
     return newMount;
 }
@@ -394,5 +400,5 @@ bool MountSystemController::canPerformSpecialMovement(const std::string& movemen
     if (!activeMount || !activeMount->isMounted)
         return false;
 
-    return config.canUseAbility(activeMount->stats, movementType);
+    return config.get()->canUseAbility(activeMount->stats, movementType);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../core/TANode.hpp"
+#include "../../utils/ConfigSnapshot.hpp"
 #include <map>
 #include <string>
 #include <vector>
@@ -32,15 +33,15 @@ public:
     // Available mount equipment
     std::vector<MountEquipment*> knownEquipment;
 
-    // Global configuration
-    MountSystemConfig config;
+    // Global configuration; loadConfig swaps in a new snapshot
+    ConfigSnapshot<MountSystemConfig> config;
 
     // Path to the config file
     std::string configPath;
 
     MountSystemController(const std::string& name, const std::string& jsonPath = "resources/json/mount.json");
     void loadConfig();
-    void initializeBasicDefaults();
+    void initializeBasicDefaults(MountSystemConfig& settings);
     void registerStable(MountStable* stable);
     Mount* createMount(const std::string& name, const std::string& breedId);
     bool addMount(Mount* mount);
@@ -8,7 +8,7 @@
 #include "MountTrainingSession.hpp"
 #include <iostream>
 
-MountTrainingNode::MountTrainingNode(const std::string& name, Mount* mount, MountSystemConfig* cfg)
+MountTrainingNode::MountTrainingNode(const std::string& name, Mount* mount, const ConfigSnapshot<MountSystemConfig>* cfg)
     : TANode(name)
     , trainingMount(mount)
     , config(cfg)
@@ -20,14 +20,14 @@ void MountTrainingNode::setTrainingMount(Mount* mount)
     trainingMount = mount;
 }
 
-void MountTrainingNode::setConfig(MountSystemConfig* cfg)
+void MountTrainingNode::setConfig(const ConfigSnapshot<MountSystemConfig>* cfg)
 {
     config = cfg;
 
     // Update training types from config
     trainingTypes.clear();
     if (config) {
-        for (const auto& [id, _] : config->trainingTypes) {
+        for (const auto& [id, _] : config->get()->trainingTypes) {
             trainingTypes.push_back(id);
         }
     }
@@ -65,7 +65,8 @@ void MountTrainingNode::onEnter(GameContext* context)
 
     std::cout << "\nAvailable Training Types:" << std::endl;
     if (config) {
-        for (const auto& [typeId, typeDesc] : config->trainingTypes) {
+        auto settings = config->get();
+        for (const auto& [typeId, typeDesc] : settings->trainingTypes) {
             std::cout << "- " << typeId << ": " << typeDesc << std::endl;
         }
     } else {
@@ -133,7 +134,7 @@ bool MountTrainingNode::evaluateTransition(const TAInput& input, TANode*& outNex
             std::string trainingType = std::get<std::string>(input.parameters.at("type"));
 
             // Create and run a training session
-            MountTrainingSession session(trainingMount, trainingType, 60, 50, *config);
+            MountTrainingSession session(trainingMount, trainingType, 60, 50, config->get());
             bool success = session.conductTraining();
 
             if (success) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../core/TANode.hpp"
+#include "../../utils/ConfigSnapshot.hpp"
 #include <string>
 #include <vector>
 
@@ -15,11 +16,11 @@ class MountTrainingNode : public TANode {
 public:
     Mount* trainingMount;
     std::vector<std::string> trainingTypes;
-    MountSystemConfig* config;
+    const ConfigSnapshot<MountSystemConfig>* config; // Read once per action
 
-    MountTrainingNode(const std::string& name, Mount* mount = nullptr, MountSystemConfig* cfg = nullptr);
+    MountTrainingNode(const std::string& name, Mount* mount = nullptr, const ConfigSnapshot<MountSystemConfig>* cfg = nullptr);
     void setTrainingMount(Mount* mount);
-    void setConfig(MountSystemConfig* cfg);
+    void setConfig(const ConfigSnapshot<MountSystemConfig>* cfg);
     void onEnter(GameContext* context) override;
     std::vector<TAAction> getAvailableActions() override;
     bool evaluateTransition(const TAInput& input, TANode*& outNextNode) override;
@@ -5,14 +5,14 @@
 #include <iostream>
 #include <random>
 
-MountTrainingSession::MountTrainingSession(Mount* targetMount, const std::string& type, int sessionDuration, int sessionDifficulty, MountSystemConfig& cfg)
+MountTrainingSession::MountTrainingSession(Mount* targetMount, const std::string& type, int sessionDuration, int sessionDifficulty, std::shared_ptr<const MountSystemConfig> cfg)
     : mount(targetMount)
     , trainingType(type)
     , duration(sessionDuration)
     , difficulty(sessionDifficulty)
     , successChance(70)
     , experienceGain(5)
-    , config(cfg)
+    , config(std::move(cfg))
 {
     if (mount) {
         // Adjust success chance based on mount's current training and condition
@@ -73,11 +73,11 @@ bool MountTrainingSession::conductTraining()
         mount->stats.train(trainingType, experienceGain);
 
         // Check for ability unlocks based on the config system
-        for (const auto& [abilityId, abilityInfo] : config.specialAbilities) {
+        for (const auto& [abilityId, abilityInfo] : config->specialAbilities) {
             // Only check abilities related to this training type
             if (abilityInfo.trainingType == trainingType) {
                 // Check if ability should be unlocked
-                bool canUnlock = config.canUnlockAbility(mount->stats, abilityId);
+                bool canUnlock = config->canUnlockAbility(mount->stats, abilityId);
                 bool alreadyUnlocked = false;
 
                 // Check if ability is already unlocked
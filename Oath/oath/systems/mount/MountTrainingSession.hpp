@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 class Mount;
@@ -14,8 +15,8 @@ public:
     int difficulty;
     int successChance;
     int experienceGain;
-    MountSystemConfig& config;
+    std::shared_ptr<const MountSystemConfig> config; // The tuning when the session began
 
-    MountTrainingSession(Mount* targetMount, const std::string& type, int sessionDuration, int sessionDifficulty, MountSystemConfig& cfg);
+    MountTrainingSession(Mount* targetMount, const std::string& type, int sessionDuration, int sessionDifficulty, std::shared_ptr<const MountSystemConfig> cfg);
     bool conductTraining();
 };
\ No newline at end of file
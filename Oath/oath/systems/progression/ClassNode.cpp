@@ -16,18 +16,7 @@ void ClassNode::onEnter(GameContext* context)
     if (context) {
         // Apply stat bonuses
         for (const auto& [stat, bonus] : statBonuses) {
-            if (stat == "strength")
-                context->playerStats.strength += bonus;
-            else if (stat == "dexterity")
-                context->playerStats.dexterity += bonus;
-            else if (stat == "constitution")
-                context->playerStats.constitution += bonus;
-            else if (stat == "intelligence")
-                context->playerStats.intelligence += bonus;
-            else if (stat == "wisdom")
-                context->playerStats.wisdom += bonus;
-            else if (stat == "charisma")
-                context->playerStats.charisma += bonus;
+            context->playerStats.changeStat(stat, bonus);
         }
 
         // Grant starting abilities
@@ -12,24 +12,27 @@ bool SkillNode::SkillRequirement::check(const GameContext& context) const
     return false;
 }
 
+bool SkillNode::SkillRequirement::read(StateRead& out) const
+{
+    if (type == "skill") {
+        out = { StateField::Skill, target };
+    } else if (type == "item") {
+        out = { StateField::Item, target };
+    } else if (type == "knowledge") {
+        out = { StateField::Fact, target };
+    } else {
+        return false;
+    }
+    return true;
+}
+
 void SkillNode::SkillEffect::apply(GameContext* context) const
 {
     if (!context)
         return;
 
     if (type == "stat") {
-        if (target == "strength")
-            context->playerStats.strength += value;
-        else if (target == "dexterity")
-            context->playerStats.dexterity += value;
-        else if (target == "constitution")
-            context->playerStats.constitution += value;
-        else if (target == "intelligence")
-            context->playerStats.intelligence += value;
-        else if (target == "wisdom")
-            context->playerStats.wisdom += value;
-        else if (target == "charisma")
-            context->playerStats.charisma += value;
+        context->playerStats.changeStat(target, value);
     } else if (type == "skill") {
         context->playerStats.improveSkill(target, value);
     } else if (type == "ability") {
@@ -68,6 +71,33 @@ SkillNode::SkillNode(const std::string& name, const std::string& skill,
 }
 
 bool SkillNode::canLearn(const GameContext& context) const
+{
+    if (unlocked.isWatched() ? !unlocked(context) : !meetsRequirements(context)) {
+        return false;
+    }
+    return level < maxLevel;
+}
+
+void SkillNode::watchRequirements(TriggerEngine& engine)
+{
+    std::vector<StateRead> reads;
+    for (const auto& req : requirements) {
+        StateRead read;
+        if (req.read(read)) {
+            reads.push_back(read);
+        }
+    }
+    for (const auto& cost : costs) {
+        if (cost.type == "item") {
+            reads.push_back({ StateField::Item, cost.itemId });
+        }
+    }
+
+    unlocked = GameCondition([this](const GameContext& context) { return meetsRequirements(context); });
+    unlocked.watch(engine, reads);
+}
+
+bool SkillNode::meetsRequirements(const GameContext& context) const
 {
     // Check all requirements
     for (const auto& req : requirements) {
@@ -83,7 +113,7 @@ bool SkillNode::canLearn(const GameContext& context) const
         }
     }
 
-    return level < maxLevel;
+    return true;
 }
 
 void SkillNode::learnSkill(GameContext* context)
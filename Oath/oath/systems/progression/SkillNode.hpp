@@ -4,6 +4,7 @@
 #include "../../core/TAInput.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "../../data/GameScript.hpp"
 
 #include <functional>
 #include <string>
@@ -30,6 +31,9 @@ public:
         int level;
 
         bool check(const GameContext& context) const;
+
+        // What check reads; false for a type it does not know
+        bool read(StateRead& out) const;
     };
     std::vector<SkillRequirement> requirements;
 
@@ -58,8 +62,17 @@ public:
         int initialLevel = 0, int max = 5);
 
     bool canLearn(const GameContext& context) const;
+
+    // Track requirements and item costs in a trigger engine so canLearn only
+    // re-checks them after one changes
+    void watchRequirements(TriggerEngine& engine);
     void learnSkill(GameContext* context);
     void onEnter(GameContext* context) override;
     std::vector<TAAction> getAvailableActions() override;
     bool evaluateTransition(const TAInput& input, TANode*& outNextNode) override;
-};
\ No newline at end of file
+
+private:
+    GameCondition unlocked;
+
+    bool meetsRequirements(const GameContext& context) const;
+};
@@ -18,6 +18,24 @@ bool QuestNode::QuestRequirement::check(const GameContext& context) const
     return false;
 }
 
+bool QuestNode::QuestRequirement::read(StateRead& out) const
+{
+    if (type == "skill") {
+        out = { StateField::Skill, target };
+    } else if (type == "item") {
+        out = { StateField::Item, target };
+    } else if (type == "faction") {
+        out = { StateField::Reputation, target };
+    } else if (type == "knowledge") {
+        out = { StateField::Fact, target };
+    } else if (type == "worldflag") {
+        out = { StateField::Flag, target };
+    } else {
+        return false;
+    }
+    return true;
+}
+
 QuestNode::QuestNode(const std::string& name)
     : TANode(name)
     , questState("Available")
@@ -31,6 +49,29 @@ bool QuestNode::processAction(const std::string& playerAction, TANode*& outNextN
 }
 
 bool QuestNode::canAccess(const GameContext& context) const
+{
+    return access.isWatched() ? access(context) : meetsRequirements(context);
+}
+
+void QuestNode::watchRequirements(TriggerEngine& engine)
+{
+    std::vector<StateRead> reads;
+    for (const auto& req : requirements) {
+        StateRead read;
+        if (req.read(read)) {
+            reads.push_back(read);
+        }
+    }
+
+    access = GameCondition([this](const GameContext& context) { return meetsRequirements(context); });
+    access.watch(engine, reads, [this](GameContext*, bool met) {
+        if (met && questState == "Available") {
+            std::cout << "New quest available: " << questTitle << std::endl;
+        }
+    });
+}
+
+bool QuestNode::meetsRequirements(const GameContext& context) const
 {
     for (const auto& req : requirements) {
         if (!req.check(context)) {
@@ -54,7 +95,7 @@ void QuestNode::onEnter(GameContext* context)
 
     // Update quest journal
     if (context) {
-        context->questJournal[nodeName] = "Active";
+        context->setQuestState(nodeName, "Active");
     }
 
     std::cout << "Quest activated: " << questTitle << std::endl;
@@ -68,7 +109,7 @@ void QuestNode::onExit(GameContext* context)
         questState = "Completed";
 
         if (context) {
-            context->questJournal[nodeName] = "Completed";
+            context->setQuestState(nodeName, "Completed");
 
             // Award rewards to player
             std::cout << "Quest completed: " << questTitle << std::endl;
@@ -99,7 +140,7 @@ void QuestNode::onExit(GameContext* context)
         }
     } else if (questState == "Failed") {
         if (context) {
-            context->questJournal[nodeName] = "Failed";
+            context->setQuestState(nodeName, "Failed");
         }
         std::cout << "Quest failed: " << questTitle << std::endl;
     }
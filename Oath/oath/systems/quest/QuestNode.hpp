@@ -3,6 +3,7 @@
 #include "../../core/TAAction.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "../../data/GameScript.hpp"
 
 #include <functional>
 #include <string>
@@ -38,6 +39,9 @@ public:
         int value; // required value
 
         bool check(const GameContext& context) const;
+
+        // What check reads; false for a type it does not know
+        bool read(StateRead& out) const;
     };
     std::vector<QuestRequirement> requirements;
 
@@ -49,6 +53,10 @@ public:
     // Check if player can access this quest
     bool canAccess(const GameContext& context) const;
 
+    // Track the requirements in a trigger engine so canAccess is only re-checked
+    // after one of them changes; announces the quest when they become met
+    void watchRequirements(TriggerEngine& engine);
+
     // Activate child quests when this node is entered
     void onEnter(GameContext* context) override;
 
@@ -57,4 +65,9 @@ public:
 
     // Get available actions specific to quests
     std::vector<TAAction> getAvailableActions() override;
-};
\ No newline at end of file
+
+private:
+    GameCondition access;
+
+    bool meetsRequirements(const GameContext& context) const;
+};
@@ -30,7 +30,8 @@ void NPCInfoNode::onEnter(GameContext* context)
         return;
     }
 
-    RelationshipConfig& config = RelationshipConfig::getInstance();
+    auto settings = RelationshipConfig::getInstance().settings();
+    const RelationshipThresholds& thresholds = settings->thresholds;
 
     // Display basic NPC info
     std::cout << "===== NPC Information =====" << std::endl;
@@ -48,27 +49,27 @@ void NPCInfoNode::onEnter(GameContext* context)
     std::cout << "\nRelationship: " << relationshipDesc << " (" << relationshipValue << ")" << std::endl;
 
     // Only show personality traits if relationship is good enough
-    if (relationshipValue >= config.getFriendlyThreshold()) {
+    if (relationshipValue >= thresholds.friendly) {
         std::cout << "\nPersonality traits:" << std::endl;
-        for (const auto& trait : npc->personalityTraits) {
-            std::cout << " - " << config.getPersonalityTraitString(trait) << std::endl;
+        for (PersonalityTrait trait : traitList(npc->personalityTraits)) {
+            std::cout << " - " << settings->traitName(trait) << std::endl;
         }
     }
 
     // Show gift preferences if relationship is good
-    if (relationshipValue >= config.getCloseThreshold()) {
+    if (relationshipValue >= thresholds.close) {
         std::cout << "\nGift preferences:" << std::endl;
         for (const auto& [category, preference] : npc->giftPreferences) {
             if (preference > 0.5f) {
-                std::cout << " - Likes " << config.getGiftCategoryString(category) << std::endl;
+                std::cout << " - Likes " << settings->giftCategoryName(category) << std::endl;
             } else if (preference < -0.5f) {
-                std::cout << " - Dislikes " << config.getGiftCategoryString(category) << std::endl;
+                std::cout << " - Dislikes " << settings->giftCategoryName(category) << std::endl;
             }
         }
     }
 
     // Show favorite items only to very close friends/partners
-    if (relationshipValue >= config.getIntimateThreshold()) {
+    if (relationshipValue >= thresholds.intimate) {
         if (!npc->favoriteItems.empty()) {
             std::cout << "\nFavorite items:" << std::endl;
             for (const auto& item : npc->favoriteItems) {
@@ -78,7 +79,7 @@ void NPCInfoNode::onEnter(GameContext* context)
     }
 
     // Show daily schedule if friends or better
-    if (relationshipValue >= config.getFriendlyThreshold()) {
+    if (relationshipValue >= thresholds.friendly) {
         std::cout << "\nTypical daily schedule:" << std::endl;
         for (const auto& entry : npc->weekdaySchedule) {
             std::cout << " - " << entry.startHour << ":00 to " << entry.endHour
@@ -51,7 +51,8 @@ std::vector<TAAction> NPCInteractionNode::getAvailableActions()
         return actions;
     }
 
-    RelationshipConfig& config = RelationshipConfig::getInstance();
+    auto settings = RelationshipConfig::getInstance().settings();
+    const RelationshipThresholds& thresholds = settings->thresholds;
 
     // Get relationship value to determine available actions
     int value = relationshipManager->getRelationshipValue(currentNPCId);
@@ -69,7 +70,7 @@ std::vector<TAAction> NPCInteractionNode::getAvailableActions()
         } });
 
     // Only available for neutral+ relationships
-    if (value >= config.getNeutralThreshold()) {
+    if (value >= thresholds.neutral) {
         actions.push_back({ "ask_about_self", "Ask about " + npc->name,
             [this]() -> TAInput {
                 return { "npc_action", { { "action", std::string("ask_about") } } };
@@ -77,7 +78,7 @@ std::vector<TAAction> NPCInteractionNode::getAvailableActions()
     }
 
     // Only available for friendly+ relationships
-    if (value >= config.getFriendlyThreshold()) {
+    if (value >= thresholds.friendly) {
         actions.push_back({ "request_help", "Ask for help",
             [this]() -> TAInput {
                 return { "npc_action", { { "action", std::string("request_help") } } };
@@ -85,7 +86,7 @@ std::vector<TAAction> NPCInteractionNode::getAvailableActions()
     }
 
     // Only available for close friends or better
-    if (value >= config.getCloseThreshold()) {
+    if (value >= thresholds.close) {
         actions.push_back({ "personal_request", "Make personal request",
             [this]() -> TAInput {
                 return { "npc_action", { { "action", std::string("personal_request") } } };
@@ -93,7 +94,7 @@ std::vector<TAAction> NPCInteractionNode::getAvailableActions()
     }
 
     // Romantic options only available if not enemies/rivals and not already in a relationship
-    if (value >= config.getFriendlyThreshold() && type != RelationshipType::Enemy && type != RelationshipType::Rival && type != RelationshipType::Spouse && type != RelationshipType::Partner) {
+    if (value >= thresholds.friendly && type != RelationshipType::Enemy && type != RelationshipType::Rival && type != RelationshipType::Spouse && type != RelationshipType::Partner) {
 
         actions.push_back({ "flirt", "Flirt with " + npc->name,
             [this]() -> TAInput {
@@ -125,7 +126,8 @@ bool NPCInteractionNode::evaluateTransition(const TAInput& input, TANode*& outNe
         return false;
     }
 
-    RelationshipConfig& config = RelationshipConfig::getInstance();
+    auto settings = RelationshipConfig::getInstance().settings();
+    const RelationshipThresholds& thresholds = settings->thresholds;
 
     // Process different interaction types
     if (action == "talk") {
@@ -169,15 +171,15 @@ bool NPCInteractionNode::evaluateTransition(const TAInput& input, TANode*& outNe
         bool giftAccepted = relationshipManager->giveGift(currentNPCId, itemId, category, itemValue);
 
         if (giftAccepted) {
-            float reaction = npc->getGiftReaction(itemId, category);
+            float reaction = npc->getGiftReaction(itemId, category, *settings);
 
-            if (reaction >= config.getFavoriteGiftMultiplier()) {
+            if (reaction >= settings->favoriteGiftMultiplier) {
                 std::cout << npc->name << " loves this gift!" << std::endl;
-            } else if (reaction >= config.getLikedGiftMultiplier()) {
+            } else if (reaction >= settings->likedGiftMultiplier) {
                 std::cout << npc->name << " likes this gift." << std::endl;
-            } else if (reaction <= config.getHatedGiftMultiplier()) {
+            } else if (reaction <= settings->hatedGiftMultiplier) {
                 std::cout << npc->name << " hates this gift!" << std::endl;
-            } else if (reaction <= config.getDislikedGiftMultiplier()) {
+            } else if (reaction <= settings->dislikedGiftMultiplier) {
                 std::cout << npc->name << " doesn't like this gift much." << std::endl;
             } else {
                 std::cout << npc->name << " accepts your gift politely." << std::endl;
@@ -191,10 +193,10 @@ bool NPCInteractionNode::evaluateTransition(const TAInput& input, TANode*& outNe
 
         // Share some personal details based on relationship level
         int value = relationshipManager->getRelationshipValue(currentNPCId);
-        if (value >= config.getCloseThreshold()) {
+        if (value >= thresholds.close) {
             std::cout << "They share some personal details about their past and aspirations." << std::endl;
             relationshipManager->changeRelationship(currentNPCId, 2);
-        } else if (value >= config.getFriendlyThreshold()) {
+        } else if (value >= thresholds.friendly) {
             std::cout << "They tell you about their current projects and interests." << std::endl;
             relationshipManager->changeRelationship(currentNPCId, 1);
         } else {
@@ -205,11 +207,11 @@ bool NPCInteractionNode::evaluateTransition(const TAInput& input, TANode*& outNe
         bool receptive = false;
 
         // Check if NPC is receptive to romance (based on relationship and personality)
-        if (value >= config.getCloseThreshold()) {
+        if (value >= thresholds.close) {
             receptive = true;
-        } else if (value >= config.getFriendlyThreshold()) {
+        } else if (value >= thresholds.friendly) {
             // More likely if the NPC has romantic personality trait
-            receptive = npc->personalityTraits.find(PersonalityTrait::Romantic) != npc->personalityTraits.end();
+            receptive = npc->hasTrait(PersonalityTrait::Romantic);
         }
 
         if (receptive) {
@@ -217,13 +219,13 @@ bool NPCInteractionNode::evaluateTransition(const TAInput& input, TANode*& outNe
             relationshipManager->changeRelationship(currentNPCId, 3);
 
             // If relationship is already strong, potentially advance to romantic interest
-            if (value >= config.getIntimateThreshold()) {
+            if (value >= thresholds.intimate) {
                 relationshipManager->changeRelationshipType(currentNPCId, RelationshipType::RomanticInterest);
                 std::cout << npc->name << " seems to be developing romantic feelings for you." << std::endl;
             }
         } else {
             std::cout << npc->name << " politely deflects your advances." << std::endl;
-            if (value < config.getFriendlyThreshold()) {
+            if (value < thresholds.friendly) {
                 relationshipManager->changeRelationship(currentNPCId, -1);
             }
         }
@@ -231,7 +233,7 @@ bool NPCInteractionNode::evaluateTransition(const TAInput& input, TANode*& outNe
         int value = relationshipManager->getRelationshipValue(currentNPCId);
 
         // NPC will accept if relationship is very high
-        if (value >= config.getIntimateThreshold()) {
+        if (value >= thresholds.intimate) {
             bool accepted = relationshipManager->changeRelationshipType(currentNPCId, RelationshipType::Spouse);
 
             if (accepted) {
@@ -247,13 +249,13 @@ bool NPCInteractionNode::evaluateTransition(const TAInput& input, TANode*& outNe
     } else if (action == "request_help") {
         int value = relationshipManager->getRelationshipValue(currentNPCId);
 
-        if (value >= config.getFriendlyThreshold()) {
+        if (value >= thresholds.friendly) {
             std::cout << npc->name << " agrees to help you." << std::endl;
 
             // The level of help would depend on relationship strength
-            if (value >= config.getIntimateThreshold()) {
+            if (value >= thresholds.intimate) {
                 std::cout << "They are willing to go to great lengths to assist you." << std::endl;
-            } else if (value >= config.getCloseThreshold()) {
+            } else if (value >= thresholds.close) {
                 std::cout << "They offer significant assistance." << std::endl;
             } else {
                 std::cout << "They provide basic help." << std::endl;
@@ -1,7 +1,7 @@
 #include "NPCRelationshipManager.hpp"
 #include "RelationshipConfig.hpp"
 #include <algorithm>
-#include <cstdlib>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 
@@ -14,41 +14,79 @@ NPCRelationshipManager::NPCRelationshipManager()
 void NPCRelationshipManager::loadNPCsFromConfig()
 {
     RelationshipConfig& config = RelationshipConfig::getInstance();
+    refreshSettings();
 
     // Load NPC definitions
     const nlohmann::json& npcsData = config.getNPCs();
     for (const auto& npcData : npcsData) {
         RelationshipNPC npc(npcData);
         registerNPC(npc);
+        if (npcData.contains("relationships")) {
+            socialGraph.edgesFromJson(socialGraph.addNpc(npc.id), npcData["relationships"]);
+        }
     }
+    socialGraph.commit();
 
     // Set up default relationships
     const nlohmann::json& defaultRelationships = config.getDefaultRelationships();
     for (const auto& rel : defaultRelationships) {
         std::string npcId = rel["npcId"];
         int value = rel["value"];
-        RelationshipType type = config.getRelationshipTypeFromString(rel["type"]);
+        RelationshipType type = settings->typeFromString(rel["type"].get<std::string>());
 
-        playerRelationships[npcId] = value;
-        playerRelationshipTypes[npcId] = type;
+        int slot = playerSlot(npcId);
+        player.values[slot] = value;
+        player.setType(slot, type);
     }
 }
 
 void NPCRelationshipManager::registerNPC(const RelationshipNPC& npc)
 {
-    npcs[npc.id] = npc;
-    if (playerRelationships.find(npc.id) == playerRelationships.end()) {
-        playerRelationships[npc.id] = 0; // Start neutral
-        playerRelationshipTypes[npc.id] = RelationshipType::None;
-        playerRelationshipStates[npc.id] = RelationshipState::Neutral;
-        lastGiftDay[npc.id] = -RelationshipConfig::getInstance().getMinDaysBetweenGifts(); // Allow immediate gift
+    npcs.insert_or_assign(npc.id, npc);
+    indexNPC(npc);
+    int slot = socialGraph.npcIndex(npc.id);
+    if (!player.isTracked(slot)) {
+        player.track(slot);
+        player.values[slot] = 0; // Start neutral
+        player.setType(slot, RelationshipType::None);
+        player.setState(slot, RelationshipState::Neutral);
+        player.lastGiftDay[slot] = -settings->thresholds.minDaysBetweenGifts; // Allow immediate gift
+    }
+}
+
+void NPCRelationshipManager::refreshSettings()
+{
+    auto latest = RelationshipConfig::getInstance().settings();
+    if (latest == settings)
+        return;
+
+    settings = latest;
+    rumors.settings = settings->rumors;
+
+    // The opposing pairs may have changed
+    for (const auto& [npcId, npc] : npcs) {
+        indexNPC(npc);
     }
 }
 
+void NPCRelationshipManager::indexNPC(const RelationshipNPC& npc)
+{
+    int index = socialGraph.addNpc(npc.id);
+    rumors.setTraits(index, npc.personalityTraits);
+    traitProfiles.set(index, settings->traitCompatibility.profile(npc.personalityTraits));
+}
+
+int NPCRelationshipManager::playerSlot(const std::string& npcId)
+{
+    int slot = socialGraph.addNpc(npcId);
+    player.track(slot);
+    return slot;
+}
+
 RelationshipNPC* NPCRelationshipManager::getNPC(const std::string& npcId)
 {
     if (npcs.find(npcId) != npcs.end()) {
-        return &npcs[npcId];
+        return &npcs.at(npcId);
     }
     return nullptr;
 }
@@ -58,25 +96,24 @@ void NPCRelationshipManager::changeRelationship(const std::string& npcId, int am
     if (npcs.find(npcId) == npcs.end())
         return;
 
-    RelationshipConfig& config = RelationshipConfig::getInstance();
-
     // Apply personality trait modifiers
-    const RelationshipNPC& npc = npcs[npcId];
+    const RelationshipNPC& npc = npcs.at(npcId);
 
     // Vengeful NPCs remember negative actions more
-    if (amount < 0 && npc.personalityTraits.find(PersonalityTrait::Vengeful) != npc.personalityTraits.end()) {
+    if (amount < 0 && npc.hasTrait(PersonalityTrait::Vengeful)) {
         amount = static_cast<int>(amount * 1.5f);
     }
 
     // Forgiving NPCs are less affected by negative actions
-    if (amount < 0 && npc.personalityTraits.find(PersonalityTrait::Merciful) != npc.personalityTraits.end()) {
+    if (amount < 0 && npc.hasTrait(PersonalityTrait::Merciful)) {
         amount = static_cast<int>(amount * 0.5f);
     }
 
     // Update relationship value with limits
-    playerRelationships[npcId] = std::max(
-        config.getMinRelationship(),
-        std::min(config.getMaxRelationship(), playerRelationships[npcId] + amount));
+    int slot = playerSlot(npcId);
+    player.values[slot] = std::max(
+        settings->thresholds.minRelationship,
+        std::min(settings->thresholds.maxRelationship, player.values[slot] + amount));
 
     // Update relationship type based on new value
     updateRelationshipType(npcId);
@@ -84,25 +121,9 @@ void NPCRelationshipManager::changeRelationship(const std::string& npcId, int am
 
 void NPCRelationshipManager::updateRelationshipType(const std::string& npcId)
 {
-    RelationshipConfig& config = RelationshipConfig::getInstance();
-    int value = playerRelationships[npcId];
-
     // Update type based on value thresholds
-    if (value <= config.getHatredThreshold()) {
-        playerRelationshipTypes[npcId] = RelationshipType::Enemy;
-    } else if (value <= config.getDislikeThreshold()) {
-        playerRelationshipTypes[npcId] = RelationshipType::Rival;
-    } else if (value <= config.getNeutralThreshold()) {
-        playerRelationshipTypes[npcId] = RelationshipType::None;
-    } else if (value <= config.getFriendlyThreshold()) {
-        playerRelationshipTypes[npcId] = RelationshipType::Acquaintance;
-    } else if (value <= config.getCloseThreshold()) {
-        playerRelationshipTypes[npcId] = RelationshipType::Friend;
-    } else if (value <= config.getIntimateThreshold()) {
-        playerRelationshipTypes[npcId] = RelationshipType::CloseFriend;
-    } else {
-        playerRelationshipTypes[npcId] = RelationshipType::BestFriend;
-    }
+    int slot = playerSlot(npcId);
+    player.setType(slot, settings->thresholds.classify(player.values[slot]));
 }
 
 bool NPCRelationshipManager::giveGift(const std::string& npcId, const std::string& itemId, GiftCategory category, int itemValue)
@@ -110,34 +131,33 @@ bool NPCRelationshipManager::giveGift(const std::string& npcId, const std::strin
     if (npcs.find(npcId) == npcs.end())
         return false;
 
-    RelationshipConfig& config = RelationshipConfig::getInstance();
-
     // Check if enough time has passed since last gift
-    if (currentGameDay - lastGiftDay[npcId] < config.getMinDaysBetweenGifts()) {
+    int slot = playerSlot(npcId);
+    if (currentGameDay - player.lastGiftDay[slot] < settings->thresholds.minDaysBetweenGifts) {
         return false; // Too soon for another gift
     }
 
-    RelationshipNPC& npc = npcs[npcId];
+    RelationshipNPC& npc = npcs.at(npcId);
 
     // Calculate gift impact based on NPC preferences and item value
-    float reactionMultiplier = npc.getGiftReaction(itemId, category);
+    float reactionMultiplier = npc.getGiftReaction(itemId, category, *settings);
     int relationshipChange = static_cast<int>(itemValue * reactionMultiplier * 0.1f);
 
     // Update relationship
     changeRelationship(npcId, relationshipChange);
 
     // Update gift timestamp
-    lastGiftDay[npcId] = currentGameDay;
+    player.lastGiftDay[slot] = currentGameDay;
 
     // Update state based on gift reaction
-    if (reactionMultiplier >= config.getFavoriteGiftMultiplier()) {
-        playerRelationshipStates[npcId] = RelationshipState::Happy;
-    } else if (reactionMultiplier <= config.getHatedGiftMultiplier()) {
-        playerRelationshipStates[npcId] = RelationshipState::Disappointed;
-    } else if (reactionMultiplier >= config.getLikedGiftMultiplier()) {
-        playerRelationshipStates[npcId] = RelationshipState::Grateful;
-    } else if (reactionMultiplier <= config.getDislikedGiftMultiplier()) {
-        playerRelationshipStates[npcId] = RelationshipState::Disappointed;
+    if (reactionMultiplier >= settings->favoriteGiftMultiplier) {
+        player.setState(slot, RelationshipState::Happy);
+    } else if (reactionMultiplier <= settings->hatedGiftMultiplier) {
+        player.setState(slot, RelationshipState::Disappointed);
+    } else if (reactionMultiplier >= settings->likedGiftMultiplier) {
+        player.setState(slot, RelationshipState::Grateful);
+    } else if (reactionMultiplier <= settings->dislikedGiftMultiplier) {
+        player.setState(slot, RelationshipState::Disappointed);
     }
 
     return true;
@@ -148,7 +168,7 @@ void NPCRelationshipManager::handleConversation(const std::string& npcId, const
     if (npcs.find(npcId) == npcs.end())
         return;
 
-    RelationshipNPC& npc = npcs[npcId];
+    RelationshipNPC& npc = npcs.at(npcId);
     int relationshipChange = 0;
 
     // Check if topic is liked or disliked
@@ -164,49 +184,61 @@ void NPCRelationshipManager::handleConversation(const std::string& npcId, const
     changeRelationship(npcId, relationshipChange);
 
     // Update state based on conversation
+    int slot = playerSlot(npcId);
     if (isPositive) {
         if (npc.conversationTopics.find(topic) != npc.conversationTopics.end()) {
-            playerRelationshipStates[npcId] = RelationshipState::Happy;
+            player.setState(slot, RelationshipState::Happy);
         } else {
-            playerRelationshipStates[npcId] = RelationshipState::Neutral;
+            player.setState(slot, RelationshipState::Neutral);
         }
     } else {
         if (npc.tabooTopics.find(topic) != npc.tabooTopics.end()) {
-            playerRelationshipStates[npcId] = RelationshipState::Angry;
+            player.setState(slot, RelationshipState::Angry);
         } else {
-            playerRelationshipStates[npcId] = RelationshipState::Disappointed;
+            player.setState(slot, RelationshipState::Disappointed);
         }
     }
 }
 
 void NPCRelationshipManager::advanceDay()
 {
-    RelationshipConfig& config = RelationshipConfig::getInstance();
+    refreshSettings();
     currentGameDay++;
 
-    // Natural decay in relationships over time if not maintained
-    for (auto& [npcId, relationshipValue] : playerRelationships) {
-        // Skip decay for close relationships
-        if (relationshipValue > config.getCloseThreshold())
-            continue;
+    // Decay, reclassification and temporary state resets in one pass
+    dailyChanges.clear();
+    player.advanceDays(settings->thresholds, currentGameDay, 1, dailyChanges);
 
-        // Apply small decay
-        relationshipValue += config.getDailyDecayAmount();
+    spreadRumors();
+}
 
-        // Ensure it doesn't fall below a minimum
-        if (relationshipValue < config.getMinRelationship()) {
-            relationshipValue = config.getMinRelationship();
-        }
+void NPCRelationshipManager::fastForward(int days)
+{
+    if (days <= 0)
+        return;
 
-        // Update type if needed
-        updateRelationshipType(npcId);
+    refreshSettings();
+    dailyChanges.clear();
+
+    // Arriving rumors change relationships, so while any are in flight each
+    // day's decay runs before that day's rumors, as in advanceDay
+    int day = 0;
+    while (day < days && rumors.activeCount() > 0) {
+        currentGameDay++;
+        player.advanceDays(settings->thresholds, currentGameDay, 1, dailyChanges);
+        spreadRumors();
+        day++;
+    }
+    if (day == days) {
+        return;
     }
 
-    // Reset temporary states back to neutral after a few days
-    for (auto& [npcId, state] : playerRelationshipStates) {
-        if (state != RelationshipState::Neutral && std::rand() % 3 == 0) {
-            state = RelationshipState::Neutral;
-        }
+    // No rumor can start mid-span, so the rest decays in one pass; the
+    // rumor days only age crime awareness now
+    player.advanceDays(settings->thresholds, currentGameDay + 1, days - day, dailyChanges);
+    for (; day < days; day++) {
+        currentGameDay++;
+        spreadRumors();
     }
 }
 
@@ -219,13 +251,23 @@ void NPCRelationshipManager::handleTaskCompletion(const std::string& npcId, int
     int relationshipChange = importance * 2;
     changeRelationship(npcId, relationshipChange);
 
+    // Word of bigger favors gets around
+    if (importance >= 5) {
+        Rumor rumor;
+        rumor.kind = RumorKind::GoodDeed;
+        rumor.severity = importance;
+        rumor.relationshipChange = importance / 2;
+        spreadRumor(npcId, rumor);
+    }
+
     // Update state
+    int slot = playerSlot(npcId);
     if (importance >= 8) {
-        playerRelationshipStates[npcId] = RelationshipState::Grateful;
+        player.setState(slot, RelationshipState::Grateful);
     } else if (importance >= 4) {
-        playerRelationshipStates[npcId] = RelationshipState::Happy;
+        player.setState(slot, RelationshipState::Happy);
     } else {
-        playerRelationshipStates[npcId] = RelationshipState::Impressed;
+        player.setState(slot, RelationshipState::Impressed);
     }
 }
 
@@ -238,13 +280,83 @@ void NPCRelationshipManager::handleBetrayal(const std::string& npcId, int severi
     int relationshipChange = -severity * 3;
     changeRelationship(npcId, relationshipChange);
 
+    // The betrayed NPC tells their friends
+    Rumor rumor;
+    rumor.kind = RumorKind::Betrayal;
+    rumor.severity = severity;
+    rumor.relationshipChange = -severity;
+    spreadRumor(npcId, rumor);
+
     // Update state
+    int slot = playerSlot(npcId);
     if (severity >= 8) {
-        playerRelationshipStates[npcId] = RelationshipState::Angry;
+        player.setState(slot, RelationshipState::Angry);
     } else if (severity >= 4) {
-        playerRelationshipStates[npcId] = RelationshipState::Disappointed;
+        player.setState(slot, RelationshipState::Disappointed);
     } else {
-        playerRelationshipStates[npcId] = RelationshipState::Sad;
+        player.setState(slot, RelationshipState::Sad);
+    }
+}
+
+int NPCRelationshipManager::spreadRumor(const std::string& originNpcId, const Rumor& rumor)
+{
+    int origin = socialGraph.npcIndex(originNpcId);
+    if (origin < 0)
+        return -1;
+
+    return rumors.start(rumor, origin, currentGameDay);
+}
+
+int NPCRelationshipManager::reportCrime(const std::string& witnessNpcId, const CrimeRecord& crime)
+{
+    Rumor rumor;
+    rumor.kind = RumorKind::Crime;
+    rumor.detail = crime.type;
+    rumor.region = crime.region;
+    rumor.severity = crime.severity;
+    rumor.relationshipChange = -crime.severity;
+    return spreadRumor(witnessNpcId, rumor);
+}
+
+float NPCRelationshipManager::getCrimeAwareness(const std::string& npcId) const
+{
+    return rumors.getCrimeAwareness(socialGraph.npcIndex(npcId));
+}
+
+std::vector<float> NPCRelationshipManager::getCompatibilityScores(const std::string& npcId) const
+{
+    int index = socialGraph.npcIndex(npcId);
+    if (index < 0 || index >= traitProfiles.size())
+        return {};
+
+    TraitProfile profile { traitProfiles.traits[index], traitProfiles.firstOfPair[index], traitProfiles.secondOfPair[index] };
+
+    // NPCs known only from the graph have no traits and score 0
+    std::vector<float> scores(std::max(socialGraph.npcCount(), traitProfiles.size()), 0.0f);
+    settings->traitCompatibility.scoreAgainst(profile, traitProfiles, scores.data());
+    return scores;
+}
+
+void NPCRelationshipManager::spreadRumors()
+{
+    const std::vector<RumorArrival>& arrivals = rumors.stepDay(socialGraph, currentGameDay);
+    for (const RumorArrival& arrival : arrivals) {
+        const Rumor* rumor = rumors.getRumor(arrival.rumor);
+        int change = static_cast<int>(std::lround(rumor->relationshipChange * arrival.strength));
+        if (change == 0)
+            continue;
+
+        // Hearers think differently of the subject: the player, or another NPC
+        const std::string& hearerId = socialGraph.npcId(arrival.npc);
+        if (rumor->subject == "player") {
+            changeRelationship(hearerId, change);
+            continue;
+        }
+        int subject = socialGraph.npcIndex(rumor->subject);
+        int edge = subject >= 0 ? socialGraph.findEdge(arrival.npc, subject) : SocialGraph::NO_EDGE;
+        if (edge != SocialGraph::NO_EDGE) {
+            socialGraph.setEdgeValue(edge, std::max(-100, std::min(100, socialGraph.edgeValue(edge) + change)));
+        }
     }
 }
 
@@ -253,19 +365,18 @@ std::string NPCRelationshipManager::getRelationshipDescription(const std::string
     if (npcs.find(npcId) == npcs.end())
         return "Unknown";
 
-    RelationshipConfig& config = RelationshipConfig::getInstance();
-    int value = playerRelationships[npcId];
-    RelationshipType type = playerRelationshipTypes[npcId];
-    RelationshipState state = playerRelationshipStates[npcId];
+    int slot = playerSlot(npcId);
+    RelationshipType type = player.type(slot);
+    RelationshipState state = player.state(slot);
 
     std::string description;
 
     // Base description on relationship type
-    description = config.getRelationshipTypeString(type);
+    description = settings->typeName(type);
 
     // Add current state as modifier
     if (state != RelationshipState::Neutral) {
-        description += " (" + config.getRelationshipStateString(state) + ")";
+        description += " (" + settings->stateName(state) + ")";
     }
 
     return description;
@@ -285,39 +396,53 @@ std::vector<std::string> NPCRelationshipManager::getNPCsAtLocation(const std::st
     return presentNPCs;
 }
 
+std::vector<std::string> NPCRelationshipManager::getScheduledLocations(int day, int hour)
+{
+    std::vector<std::string> locations(socialGraph.npcCount());
+
+    for (auto& [npcId, npc] : npcs) {
+        int slot = socialGraph.npcIndex(npcId);
+        if (slot >= 0) {
+            locations[slot] = npc.getCurrentSchedule(day, hour).location;
+        }
+    }
+
+    return locations;
+}
+
 bool NPCRelationshipManager::changeRelationshipType(const std::string& npcId, RelationshipType newType, bool force)
 {
     if (npcs.find(npcId) == npcs.end())
         return false;
 
-    RelationshipConfig& config = RelationshipConfig::getInstance();
-    int value = playerRelationships[npcId];
+    int slot = playerSlot(npcId);
+    int value = player.values[slot];
 
     // Check requirements for each type, unless forcing
     if (!force) {
         switch (newType) {
         case RelationshipType::Friend:
-            if (value < config.getFriendlyThreshold())
+            if (value < settings->thresholds.friendly)
                 return false;
             break;
         case RelationshipType::CloseFriend:
-            if (value < config.getCloseThreshold())
+            if (value < settings->thresholds.close)
                 return false;
             break;
         case RelationshipType::BestFriend:
-            if (value < config.getIntimateThreshold())
+            if (value < settings->thresholds.intimate)
                 return false;
             break;
         case RelationshipType::Partner:
-            if (value < config.getIntimateThreshold())
+            if (value < settings->thresholds.intimate)
                 return false;
             break;
         case RelationshipType::Spouse:
-            if (value < config.getIntimateThreshold())
+            if (value < settings->thresholds.intimate)
                 return false;
             // Check if already married to someone else
-            for (auto& [id, type] : playerRelationshipTypes) {
-                if (type == RelationshipType::Spouse && id != npcId)
+            for (int other = 0; other < player.size(); other++) {
+                if (player.tracked[other] && player.type(other) == RelationshipType::Spouse && other != slot)
                     return false;
             }
             break;
@@ -327,11 +452,11 @@ bool NPCRelationshipManager::changeRelationshipType(const std::string& npcId, Re
     }
 
     // Apply the change
-    playerRelationshipTypes[npcId] = newType;
+    player.setType(slot, newType);
 
     // Boost relationship value for positive type changes
     if (newType == RelationshipType::Partner || newType == RelationshipType::Spouse || newType == RelationshipType::BestFriend) {
-        playerRelationships[npcId] = config.getMaxRelationship();
+        player.values[slot] = settings->thresholds.maxRelationship;
     }
 
     return true;
@@ -339,28 +464,42 @@ bool NPCRelationshipManager::changeRelationshipType(const std::string& npcId, Re
 
 int NPCRelationshipManager::getRelationshipValue(const std::string& npcId)
 {
-    if (playerRelationships.find(npcId) != playerRelationships.end()) {
-        return playerRelationships[npcId];
+    int slot = socialGraph.npcIndex(npcId);
+    if (player.isTracked(slot)) {
+        return player.values[slot];
     }
     return 0;
 }
 
 RelationshipType NPCRelationshipManager::getRelationshipType(const std::string& npcId)
 {
-    if (playerRelationshipTypes.find(npcId) != playerRelationshipTypes.end()) {
-        return playerRelationshipTypes[npcId];
+    int slot = socialGraph.npcIndex(npcId);
+    if (player.isTracked(slot)) {
+        return player.type(slot);
     }
     return RelationshipType::None;
 }
 
 RelationshipState NPCRelationshipManager::getRelationshipState(const std::string& npcId)
 {
-    if (playerRelationshipStates.find(npcId) != playerRelationshipStates.end()) {
-        return playerRelationshipStates[npcId];
+    int slot = socialGraph.npcIndex(npcId);
+    if (player.isTracked(slot)) {
+        return player.state(slot);
     }
     return RelationshipState::Neutral;
 }
 
+std::map<std::string, int> NPCRelationshipManager::getPlayerRelationships() const
+{
+    std::map<std::string, int> result;
+    for (int slot = 0; slot < player.size(); slot++) {
+        if (player.tracked[slot]) {
+            result[socialGraph.npcId(slot)] = player.values[slot];
+        }
+    }
+    return result;
+}
+
 bool NPCRelationshipManager::saveRelationships(const std::string& filename)
 {
     try {
@@ -373,21 +512,24 @@ bool NPCRelationshipManager::saveRelationships(const std::string& filename)
         // Save NPCs
         nlohmann::json npcsData = nlohmann::json::array();
         for (const auto& [npcId, npc] : npcs) {
-            npcsData.push_back(npc.toJson());
+            nlohmann::json npcData = npc.toJson();
+            npcData["relationships"] = socialGraph.edgesToJson(socialGraph.npcIndex(npcId));
+            npcsData.push_back(npcData);
         }
         saveData["npcs"] = npcsData;
 
         // Save player relationships
         nlohmann::json relationships = nlohmann::json::array();
-        for (const auto& [npcId, value] : playerRelationships) {
-            RelationshipConfig& config = RelationshipConfig::getInstance();
+        for (int slot = 0; slot < player.size(); slot++) {
+            if (!player.tracked[slot])
+                continue;
 
             nlohmann::json rel;
-            rel["npcId"] = npcId;
-            rel["value"] = value;
-            rel["type"] = config.getRelationshipTypeString(playerRelationshipTypes[npcId]);
-            rel["state"] = config.getRelationshipStateString(playerRelationshipStates[npcId]);
-            rel["lastGiftDay"] = lastGiftDay[npcId];
+            rel["npcId"] = socialGraph.npcId(slot);
+            rel["value"] = player.values[slot];
+            rel["type"] = settings->typeName(player.type(slot));
+            rel["state"] = settings->stateName(player.state(slot));
+            rel["lastGiftDay"] = player.lastGiftDay[slot];
             relationships.push_back(rel);
         }
         saveData["playerRelationships"] = relationships;
@@ -423,30 +565,36 @@ bool NPCRelationshipManager::loadRelationships(const std::string& filename)
 
         // Clear current data
         npcs.clear();
-        playerRelationships.clear();
-        playerRelationshipTypes.clear();
-        playerRelationshipStates.clear();
-        lastGiftDay.clear();
+        player.clear();
+        dailyChanges.clear();
+        socialGraph.clear();
+        rumors.clear(); // Rumors in flight are not saved
+        traitProfiles = TraitProfileTable();
 
         // Load NPCs
         for (const auto& npcData : saveData["npcs"]) {
             RelationshipNPC npc(npcData);
-            npcs[npc.id] = npc;
+            npcs.insert_or_assign(npc.id, npc);
+            indexNPC(npc);
+            if (npcData.contains("relationships")) {
+                socialGraph.edgesFromJson(socialGraph.addNpc(npc.id), npcData["relationships"]);
+            }
         }
+        socialGraph.commit();
 
         // Load player relationships
-        RelationshipConfig& config = RelationshipConfig::getInstance();
         for (const auto& rel : saveData["playerRelationships"]) {
             std::string npcId = rel["npcId"];
             int value = rel["value"];
-            RelationshipType type = config.getRelationshipTypeFromString(rel["type"]);
-            RelationshipState state = config.getRelationshipStateFromString(rel["state"]);
+            RelationshipType type = settings->typeFromString(rel["type"].get<std::string>());
+            RelationshipState state = settings->stateFromString(rel["state"].get<std::string>());
             int lastGift = rel["lastGiftDay"];
 
-            playerRelationships[npcId] = value;
-            playerRelationshipTypes[npcId] = type;
-            playerRelationshipStates[npcId] = state;
-            lastGiftDay[npcId] = lastGift;
+            int slot = playerSlot(npcId);
+            player.values[slot] = value;
+            player.setType(slot, type);
+            player.setState(slot, state);
+            player.lastGiftDay[slot] = lastGift;
         }
 
         return true;
@@ -1,8 +1,14 @@
 #pragma once
 
+#include "../crime/CrimeRecord.hpp"
+#include "PlayerRelationTable.hpp"
 #include "RelationshipNPC.hpp"
+#include "RelationshipSettings.hpp"
 #include "RelationshipTypes.hpp"
+#include "RumorMill.hpp"
+#include "SocialGraph.hpp"
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -10,12 +16,20 @@
 class NPCRelationshipManager {
 private:
     std::map<std::string, RelationshipNPC> npcs;
-    std::map<std::string, int> playerRelationships; // NPC ID -> relationship value
-    std::map<std::string, RelationshipType> playerRelationshipTypes;
-    std::map<std::string, RelationshipState> playerRelationshipStates;
-    std::map<std::string, int> lastGiftDay; // NPC ID -> game day when last gift was given
+    PlayerRelationTable player; // The player's standing with each NPC, by social graph index
+    std::shared_ptr<const RelationshipSettings> settings; // Tuning in use until the next day
+    std::vector<RelationshipChange> dailyChanges;
+    SocialGraph socialGraph; // NPC-to-NPC relationships
+    RumorMill rumors;
+    TraitProfileTable traitProfiles; // By social graph index
     int currentGameDay;
 
+    void refreshSettings(); // Adopts a reloaded config, re-profiling NPC traits
+    void indexNPC(const RelationshipNPC& npc);
+    int playerSlot(const std::string& npcId); // Starts tracking the NPC if needed
+
+    void spreadRumors();
+
 public:
     NPCRelationshipManager();
 
@@ -27,10 +41,22 @@ public:
     bool giveGift(const std::string& npcId, const std::string& itemId, GiftCategory category, int itemValue);
     void handleConversation(const std::string& npcId, const std::string& topic, bool isPositive);
     void advanceDay();
+    void fastForward(int days); // Same outcome as days calls to advanceDay; decay is batched once no rumor is in flight
     void handleTaskCompletion(const std::string& npcId, int importance);
     void handleBetrayal(const std::string& npcId, int severity);
+
+    // Start a rumor known to the origin NPC; returns its id, -1 for an unknown NPC
+    int spreadRumor(const std::string& originNpcId, const Rumor& rumor);
+    int reportCrime(const std::string& witnessNpcId, const CrimeRecord& crime);
+    float getCrimeAwareness(const std::string& npcId) const;
+    const RumorMill& getRumors() const { return rumors; }
+
+    // Trait compatibility of one NPC with every NPC, by social graph index
+    std::vector<float> getCompatibilityScores(const std::string& npcId) const;
+
     std::string getRelationshipDescription(const std::string& npcId);
     std::vector<std::string> getNPCsAtLocation(const std::string& location, int day, int hour);
+    std::vector<std::string> getScheduledLocations(int day, int hour); // By social graph index, "" if unknown
     bool changeRelationshipType(const std::string& npcId, RelationshipType newType, bool force = false);
     int getRelationshipValue(const std::string& npcId);
     RelationshipType getRelationshipType(const std::string& npcId);
@@ -38,9 +64,13 @@ public:
     bool saveRelationships(const std::string& filename);
     bool loadRelationships(const std::string& filename);
 
-    // Getter for player relationships map
-    const std::map<std::string, int>& getPlayerRelationships() const
-    {
-        return playerRelationships;
-    }
+    // NPC-to-NPC relationships; structural edits need a commit()
+    SocialGraph& getSocialGraph() { return socialGraph; }
+    const SocialGraph& getSocialGraph() const { return socialGraph; }
+
+    // Player relationship values by NPC ID
+    std::map<std::string, int> getPlayerRelationships() const;
+
+    // Entries the last advanceDay or fastForward changed, by social graph index
+    const std::vector<RelationshipChange>& getDailyChanges() const { return dailyChanges; }
 };
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "PlayerRelationTable.hpp"
+#include "../../utils/Parallel.hpp"
+#include <algorithm>
+
+namespace {
+const int BLOCK = 256;
+
+const RelationshipType LEVEL_TYPES[] = {
+    RelationshipType::Enemy,
+    RelationshipType::Rival,
+    RelationshipType::None,
+    RelationshipType::Acquaintance,
+    RelationshipType::Friend,
+    RelationshipType::CloseFriend,
+    RelationshipType::BestFriend
+};
+}
+
+RelationshipThresholds::RelationshipThresholds()
+    : minRelationship(-100)
+    , maxRelationship(100)
+    , hatred(-75)
+    , dislike(-30)
+    , neutral(-10)
+    , friendly(30)
+    , close(60)
+    , intimate(80)
+    , dailyDecay(-1)
+    , minDaysBetweenGifts(3)
+{
+}
+
+RelationshipType RelationshipThresholds::classify(int value) const
+{
+    return LEVEL_TYPES[level(value)];
+}
+
+PlayerRelationTable::PlayerRelationTable()
+    : seed(0x5EED)
+{
+}
+
+void PlayerRelationTable::clear()
+{
+    values.clear();
+    types.clear();
+    states.clear();
+    lastGiftDay.clear();
+    tracked.clear();
+}
+
+void PlayerRelationTable::resize(int count)
+{
+    values.resize(count, 0);
+    types.resize(count, static_cast<uint8_t>(RelationshipType::None));
+    states.resize(count, static_cast<uint8_t>(RelationshipState::Neutral));
+    lastGiftDay.resize(count, 0);
+    tracked.resize(count, 0);
+}
+
+void PlayerRelationTable::track(int slot)
+{
+    if (slot >= size()) {
+        resize(slot + 1);
+    }
+    tracked[slot] = 1;
+}
+
+bool PlayerRelationTable::stateWearsOff(int slot, int firstDay, int days) const
+{
+    for (int day = firstDay; day < firstDay + days; day++) {
+        uint64_t h = splitMix(seed ^ splitMix(static_cast<uint64_t>(static_cast<uint32_t>(day)) << 32 | static_cast<uint32_t>(slot)));
+        if (h % 3 == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PlayerRelationTable::advanceDays(const RelationshipThresholds& thresholds, int firstDay, int days, std::vector<RelationshipChange>& changes)
+{
+    if (days <= 0) {
+        return;
+    }
+
+    const int close = thresholds.close;
+    const int decay = thresholds.dailyDecay;
+    const int minValue = thresholds.minRelationship;
+    // A rising decay can carry a value out of the decaying range part way through
+    const bool capSteps = decay > 0 && days > 1;
+    const uint8_t neutral = static_cast<uint8_t>(RelationshipState::Neutral);
+
+    int newValues[BLOCK];
+    int newLevels[BLOCK]; // -1 keeps the current type
+
+    int count = size();
+    for (int base = 0; base < count; base += BLOCK) {
+        int end = std::min(count, base + BLOCK);
+        const int* value = values.data() + base;
+
+        // Straight-line integer work the compiler can keep in vector lanes
+        if (!capSteps) {
+            for (int i = 0; i < end - base; i++) {
+                int v = value[i];
+                bool decays = v <= close;
+                int decayed = std::max(minValue, v + decay * days);
+                newValues[i] = decays ? decayed : v;
+                newLevels[i] = decays ? thresholds.level(newValues[i]) : -1;
+            }
+        } else {
+            for (int i = 0; i < end - base; i++) {
+                int v = value[i];
+                bool decays = v <= close;
+                int steps = decays ? std::min(days, (close - v) / decay + 1) : 0;
+                newValues[i] = std::max(minValue, v + decay * steps);
+                newLevels[i] = decays ? thresholds.level(newValues[i]) : -1;
+            }
+        }
+
+        // Write back and report only what changed
+        for (int slot = base; slot < end; slot++) {
+            if (!tracked[slot]) {
+                continue;
+            }
+
+            int i = slot - base;
+            uint8_t newType = newLevels[i] >= 0 ? static_cast<uint8_t>(LEVEL_TYPES[newLevels[i]]) : types[slot];
+            uint8_t newState = states[slot];
+            if (newState != neutral && stateWearsOff(slot, firstDay, days)) {
+                newState = neutral;
+            }
+            if (newValues[i] == values[slot] && newType == types[slot] && newState == states[slot]) {
+                continue;
+            }
+
+            changes.push_back({ slot, values[slot], newValues[i], type(slot), static_cast<RelationshipType>(newType),
+                state(slot), static_cast<RelationshipState>(newState) });
+            values[slot] = newValues[i];
+            types[slot] = newType;
+            states[slot] = newState;
+        }
+    }
+}
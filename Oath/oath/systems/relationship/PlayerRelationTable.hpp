@@ -0,0 +1,74 @@
+#pragma once
+
+#include "RelationshipTypes.hpp"
+#include <cstdint>
+#include <vector>
+
+// Relationship constants, part of RelationshipSettings
+struct RelationshipThresholds {
+    int minRelationship;
+    int maxRelationship;
+    int hatred;
+    int dislike;
+    int neutral;
+    int friendly;
+    int close;
+    int intimate;
+    int dailyDecay;
+    int minDaysBetweenGifts;
+
+    RelationshipThresholds();
+
+    // 0 (Enemy) to 6 (BestFriend): how many thresholds the value is above
+    int level(int value) const
+    {
+        return (value > hatred) + (value > dislike) + (value > neutral) + (value > friendly) + (value > close) + (value > intimate);
+    }
+    RelationshipType classify(int value) const;
+};
+
+// One entry the daily pass changed
+struct RelationshipChange {
+    int slot;
+    int oldValue;
+    int newValue;
+    RelationshipType oldType;
+    RelationshipType newType;
+    RelationshipState oldState;
+    RelationshipState newState;
+};
+
+// The player's standing with each NPC in parallel arrays, by social graph
+// index. Slots that were never tracked stay at their defaults and are skipped.
+class PlayerRelationTable {
+public:
+    std::vector<int> values;
+    std::vector<uint8_t> types;
+    std::vector<uint8_t> states;
+    std::vector<int> lastGiftDay;
+    std::vector<uint8_t> tracked;
+
+    uint64_t seed; // State resets roll hash(seed, day, slot)
+
+    PlayerRelationTable();
+
+    void clear();
+    int size() const { return static_cast<int>(values.size()); }
+    void resize(int count);
+
+    bool isTracked(int slot) const { return slot >= 0 && slot < size() && tracked[slot]; }
+    void track(int slot); // Grows the table; keeps existing values
+
+    RelationshipType type(int slot) const { return static_cast<RelationshipType>(types[slot]); }
+    RelationshipState state(int slot) const { return static_cast<RelationshipState>(states[slot]); }
+    void setType(int slot, RelationshipType type) { types[slot] = static_cast<uint8_t>(type); }
+    void setState(int slot, RelationshipState state) { states[slot] = static_cast<uint8_t>(state); }
+
+    // Days firstDay .. firstDay + days - 1 in one pass: values at or below the
+    // close threshold decay and are reclassified, and each day a temporary
+    // state has a 1 in 3 chance to wear off. Appends an entry per changed slot.
+    void advanceDays(const RelationshipThresholds& thresholds, int firstDay, int days, std::vector<RelationshipChange>& changes);
+
+private:
+    bool stateWearsOff(int slot, int firstDay, int days) const;
+};
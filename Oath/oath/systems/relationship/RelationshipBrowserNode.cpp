@@ -1,5 +1,6 @@
 #include "RelationshipBrowserNode.hpp"
 #include "../../data/GameContext.hpp"
+#include "RelationshipConfig.hpp"
 #include <iostream>
 
 
@@ -2,12 +2,19 @@
 #include <fstream>
 #include <iostream>
 
+namespace {
+nlohmann::json section(const nlohmann::json& data, const char* key, nlohmann::json fallback)
+{
+    return data.is_object() ? data.value(key, fallback) : fallback;
+}
+}
+
 // Initialize the static instance pointer
 RelationshipConfig* RelationshipConfig::instance = nullptr;
 
 RelationshipConfig::RelationshipConfig()
 {
-    loadConfig("resources/config/NPCRelationships.json");
+    loadConfig("resources/json/NPCRelationships.json");
 }
 
 RelationshipConfig& RelationshipConfig::getInstance()
@@ -26,7 +33,10 @@ bool RelationshipConfig::loadConfig(const std::string& filename)
             std::cerr << "Error: Could not open config file: " << filename << std::endl;
             return false;
         }
-        file >> configData;
+        auto data = std::make_shared<nlohmann::json>();
+        file >> *data;
+        current.publish(RelationshipSettings::fromJson(*data));
+        configData.publish(std::move(data));
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Error loading config: " << e.what() << std::endl;
@@ -36,181 +46,130 @@ bool RelationshipConfig::loadConfig(const std::string& filename)
 
 int RelationshipConfig::getMinRelationship() const
 {
-    return configData["relationshipConstants"]["minRelationship"];
+    return settings()->thresholds.minRelationship;
 }
 
 int RelationshipConfig::getMaxRelationship() const
 {
-    return configData["relationshipConstants"]["maxRelationship"];
+    return settings()->thresholds.maxRelationship;
 }
 
 int RelationshipConfig::getHatredThreshold() const
 {
-    return configData["relationshipConstants"]["thresholds"]["hatred"];
+    return settings()->thresholds.hatred;
 }
 
 int RelationshipConfig::getDislikeThreshold() const
 {
-    return configData["relationshipConstants"]["thresholds"]["dislike"];
+    return settings()->thresholds.dislike;
 }
 
 int RelationshipConfig::getNeutralThreshold() const
 {
-    return configData["relationshipConstants"]["thresholds"]["neutral"];
+    return settings()->thresholds.neutral;
 }
 
 int RelationshipConfig::getFriendlyThreshold() const
 {
-    return configData["relationshipConstants"]["thresholds"]["friendly"];
+    return settings()->thresholds.friendly;
 }
 
 int RelationshipConfig::getCloseThreshold() const
 {
-    return configData["relationshipConstants"]["thresholds"]["close"];
+    return settings()->thresholds.close;
 }
 
 int RelationshipConfig::getIntimateThreshold() const
 {
-    return configData["relationshipConstants"]["thresholds"]["intimate"];
+    return settings()->thresholds.intimate;
 }
 
 float RelationshipConfig::getSharedTraitBonus() const
 {
-    return configData["relationshipConstants"]["traitInfluence"]["sharedTraitBonus"];
+    return settings()->traitCompatibility.sharedBonus;
 }
 
 float RelationshipConfig::getOpposingTraitPenalty() const
 {
-    return configData["relationshipConstants"]["traitInfluence"]["opposingTraitPenalty"];
+    return settings()->traitCompatibility.opposingPenalty;
 }
 
 float RelationshipConfig::getFavoriteGiftMultiplier() const
 {
-    return configData["relationshipConstants"]["giftMultipliers"]["favorite"];
+    return settings()->favoriteGiftMultiplier;
 }
 
 float RelationshipConfig::getLikedGiftMultiplier() const
 {
-    return configData["relationshipConstants"]["giftMultipliers"]["liked"];
+    return settings()->likedGiftMultiplier;
 }
 
 float RelationshipConfig::getDislikedGiftMultiplier() const
 {
-    return configData["relationshipConstants"]["giftMultipliers"]["disliked"];
+    return settings()->dislikedGiftMultiplier;
 }
 
 float RelationshipConfig::getHatedGiftMultiplier() const
 {
-    return configData["relationshipConstants"]["giftMultipliers"]["hated"];
+    return settings()->hatedGiftMultiplier;
 }
 
 int RelationshipConfig::getDailyDecayAmount() const
 {
-    return configData["relationshipConstants"]["timeConstants"]["dailyDecayAmount"];
+    return settings()->thresholds.dailyDecay;
 }
 
 int RelationshipConfig::getMinDaysBetweenGifts() const
 {
-    return configData["relationshipConstants"]["timeConstants"]["minDaysBetweenGifts"];
-}
-
-std::map<PersonalityTrait, PersonalityTrait> RelationshipConfig::getOpposingTraits() const
-{
-    std::map<PersonalityTrait, PersonalityTrait> result;
-
-    for (const auto& pair : configData["opposingTraits"]) {
-        std::string trait1 = pair["trait1"];
-        std::string trait2 = pair["trait2"];
-
-        result[getPersonalityTraitFromString(trait1)] = getPersonalityTraitFromString(trait2);
-    }
-
-    return result;
+    return settings()->thresholds.minDaysBetweenGifts;
 }
 
 nlohmann::json RelationshipConfig::getNPCs() const
 {
-    return configData["npcs"];
+    return section(*configData.get(), "npcs", nlohmann::json::array());
 }
 
 nlohmann::json RelationshipConfig::getDefaultRelationships() const
 {
-    return configData["defaultRelationships"];
+    return section(*configData.get(), "defaultRelationships", nlohmann::json::array());
 }
 
 PersonalityTrait RelationshipConfig::getPersonalityTraitFromString(const std::string& traitName) const
 {
-    for (size_t i = 0; i < configData["personalityTraits"].size(); i++) {
-        if (configData["personalityTraits"][i] == traitName) {
-            return static_cast<PersonalityTrait>(i);
-        }
-    }
-    // Default if not found
-    return PersonalityTrait::Agreeable;
+    return settings()->traitFromString(traitName);
 }
 
 std::string RelationshipConfig::getPersonalityTraitString(PersonalityTrait trait) const
 {
-    int index = static_cast<int>(trait);
-    if (index >= 0 && index < static_cast<int>(configData["personalityTraits"].size())) {
-        return configData["personalityTraits"][index];
-    }
-    return "Unknown";
+    return settings()->traitName(trait);
 }
 
 RelationshipType RelationshipConfig::getRelationshipTypeFromString(const std::string& typeName) const
 {
-    for (size_t i = 0; i < configData["relationshipTypes"].size(); i++) {
-        if (configData["relationshipTypes"][i] == typeName) {
-            return static_cast<RelationshipType>(i);
-        }
-    }
-    return RelationshipType::None;
+    return settings()->typeFromString(typeName);
 }
 
 std::string RelationshipConfig::getRelationshipTypeString(RelationshipType type) const
 {
-    int index = static_cast<int>(type);
-    if (index >= 0 && index < static_cast<int>(configData["relationshipTypes"].size())) {
-        return configData["relationshipTypes"][index];
-    }
-    return "Unknown";
+    return settings()->typeName(type);
 }
 
 RelationshipState RelationshipConfig::getRelationshipStateFromString(const std::string& stateName) const
 {
-    for (size_t i = 0; i < configData["relationshipStates"].size(); i++) {
-        if (configData["relationshipStates"][i] == stateName) {
-            return static_cast<RelationshipState>(i);
-        }
-    }
-    return RelationshipState::Neutral;
+    return settings()->stateFromString(stateName);
 }
 
 std::string RelationshipConfig::getRelationshipStateString(RelationshipState state) const
 {
-    int index = static_cast<int>(state);
-    if (index >= 0 && index < static_cast<int>(configData["relationshipStates"].size())) {
-        return configData["relationshipStates"][index];
-    }
-    return "Unknown";
+    return settings()->stateName(state);
 }
 
 GiftCategory RelationshipConfig::getGiftCategoryFromString(const std::string& categoryName) const
 {
-    for (size_t i = 0; i < configData["giftCategories"].size(); i++) {
-        if (configData["giftCategories"][i] == categoryName) {
-            return static_cast<GiftCategory>(i);
-        }
-    }
-    return GiftCategory::Weapon; // Default
+    return settings()->giftCategoryFromString(categoryName);
 }
 
 std::string RelationshipConfig::getGiftCategoryString(GiftCategory category) const
 {
-    int index = static_cast<int>(category);
-    if (index >= 0 && index < static_cast<int>(configData["giftCategories"].size())) {
-        return configData["giftCategories"][index];
-    }
-    return "Unknown";
+    return settings()->giftCategoryName(category);
 }
\ No newline at end of file
@@ -1,13 +1,17 @@
 #pragma once
 
+#include "../../utils/ConfigSnapshot.hpp"
+#include "RelationshipSettings.hpp"
 #include "RelationshipTypes.hpp"
 #include <map>
+#include <memory>
 #include <nlohmann/json.hpp>
 
 
 class RelationshipConfig {
 private:
-    nlohmann::json configData;
+    ConfigSnapshot<nlohmann::json> configData; // NPCs and default relationships
+    ConfigSnapshot<RelationshipSettings> current;
     static RelationshipConfig* instance;
 
     // Private constructor for singleton
@@ -20,9 +24,16 @@ public:
 
     // Singleton access
     static RelationshipConfig& getInstance();
+
+    // Parses the file and swaps in new settings; safe while other threads
+    // read, and callers holding the previous snapshot keep it until done
     bool loadConfig(const std::string& filename);
 
-    // Getter methods for constants
+    // The current tuning. Hot paths take this once per call and pass the
+    // snapshot on by reference instead of going through the getters below.
+    std::shared_ptr<const RelationshipSettings> settings() const { return current.get(); }
+
+    // Getter methods for constants, each reading the current snapshot
     int getMinRelationship() const;
     int getMaxRelationship() const;
     int getHatredThreshold() const;
@@ -40,9 +51,6 @@ public:
     int getDailyDecayAmount() const;
     int getMinDaysBetweenGifts() const;
 
-    // Get all opposing traits pairs
-    std::map<PersonalityTrait, PersonalityTrait> getOpposingTraits() const;
-
     // Get all NPCs from config
     nlohmann::json getNPCs() const;
 
@@ -11,6 +11,7 @@ RelationshipNPC::RelationshipNPC(const std::string& npcId, const std::string& np
     , race("Human")
     , faction("Neutral")
     , homeLocation("Nowhere")
+    , personalityTraits(0)
 {
 }
 
@@ -26,15 +27,16 @@ RelationshipNPC::RelationshipNPC(const nlohmann::json& npcData)
     homeLocation = npcData["homeLocation"];
 
     // Load personality traits
-    RelationshipConfig& config = RelationshipConfig::getInstance();
+    auto settings = RelationshipConfig::getInstance().settings();
+    personalityTraits = 0;
     for (const auto& traitStr : npcData["personalityTraits"]) {
-        personalityTraits.insert(config.getPersonalityTraitFromString(traitStr));
+        addTrait(settings->traitFromString(traitStr.get<std::string>()));
     }
 
     // Load gift preferences
     if (npcData.contains("giftPreferences")) {
         for (const auto& [categoryStr, value] : npcData["giftPreferences"].items()) {
-            giftPreferences[config.getGiftCategoryFromString(categoryStr)] = value;
+            giftPreferences[settings->giftCategoryFromString(categoryStr)] = value;
         }
     }
 
@@ -84,45 +86,18 @@ RelationshipNPC::RelationshipNPC(const nlohmann::json& npcData)
 
 void RelationshipNPC::addTrait(PersonalityTrait trait)
 {
-    personalityTraits.insert(trait);
+    personalityTraits |= traitBit(trait);
 }
 
-float RelationshipNPC::calculateTraitCompatibility(const RelationshipNPC& other) const
+bool RelationshipNPC::hasTrait(PersonalityTrait trait) const
 {
-    float compatibilityScore = 0.0f;
-    RelationshipConfig& config = RelationshipConfig::getInstance();
-
-    // Bonus for shared traits
-    for (const auto& trait : personalityTraits) {
-        if (other.personalityTraits.find(trait) != other.personalityTraits.end()) {
-            compatibilityScore += config.getSharedTraitBonus();
-        }
-    }
-
-    // Penalty for opposing traits
-    auto opposingTraits = config.getOpposingTraits();
-    for (const auto& [trait1, trait2] : opposingTraits) {
-        bool hasTrait1 = personalityTraits.find(trait1) != personalityTraits.end();
-        bool hasTrait2 = personalityTraits.find(trait2) != personalityTraits.end();
-        bool otherHasTrait1 = other.personalityTraits.find(trait1) != other.personalityTraits.end();
-        bool otherHasTrait2 = other.personalityTraits.find(trait2) != other.personalityTraits.end();
-
-        if ((hasTrait1 && otherHasTrait2) || (hasTrait2 && otherHasTrait1)) {
-            compatibilityScore -= config.getOpposingTraitPenalty();
-        }
-    }
-
-    return compatibilityScore;
+    return (personalityTraits & traitBit(trait)) != 0;
 }
 
-RelationshipNPC::NPCRelationship* RelationshipNPC::findRelationship(const std::string& npcId)
+float RelationshipNPC::calculateTraitCompatibility(const RelationshipNPC& other, const RelationshipSettings& settings) const
 {
-    for (auto& rel : relationships) {
-        if (rel.npcId == npcId) {
-            return &rel;
-        }
-    }
-    return nullptr;
+    // Shared traits earn the bonus, opposing pairs split between us the penalty
+    return settings.traitCompatibility.score(personalityTraits, other.personalityTraits);
 }
 
 RelationshipNPC::ScheduleEntry RelationshipNPC::getCurrentSchedule(int day, int hour)
@@ -140,26 +115,24 @@ RelationshipNPC::ScheduleEntry RelationshipNPC::getCurrentSchedule(int day, int
     return { 0, 24, homeLocation, "resting" };
 }
 
-float RelationshipNPC::getGiftReaction(const std::string& itemId, GiftCategory category)
+float RelationshipNPC::getGiftReaction(const std::string& itemId, GiftCategory category, const RelationshipSettings& settings)
 {
-    RelationshipConfig& config = RelationshipConfig::getInstance();
-
     // Check specific item preferences first
     if (favoriteItems.find(itemId) != favoriteItems.end()) {
-        return config.getFavoriteGiftMultiplier();
+        return settings.favoriteGiftMultiplier;
     }
 
     if (dislikedItems.find(itemId) != dislikedItems.end()) {
-        return config.getHatedGiftMultiplier();
+        return settings.hatedGiftMultiplier;
     }
 
     // Otherwise check category preferences
     if (giftPreferences.find(category) != giftPreferences.end()) {
         float preference = giftPreferences[category];
         if (preference > 0.5f) {
-            return config.getLikedGiftMultiplier();
+            return settings.likedGiftMultiplier;
         } else if (preference < -0.5f) {
-            return config.getDislikedGiftMultiplier();
+            return settings.dislikedGiftMultiplier;
         }
     }
 
@@ -186,7 +159,7 @@ void RelationshipNPC::setGiftPreference(GiftCategory category, float preference)
 
 nlohmann::json RelationshipNPC::toJson() const
 {
-    RelationshipConfig& config = RelationshipConfig::getInstance();
+    auto settings = RelationshipConfig::getInstance().settings();
     nlohmann::json j;
 
     j["id"] = id;
@@ -200,15 +173,15 @@ nlohmann::json RelationshipNPC::toJson() const
 
     // Personality traits
     nlohmann::json traits = nlohmann::json::array();
-    for (const auto& trait : personalityTraits) {
-        traits.push_back(config.getPersonalityTraitString(trait));
+    for (PersonalityTrait trait : traitList(personalityTraits)) {
+        traits.push_back(settings->traitName(trait));
     }
     j["personalityTraits"] = traits;
 
     // Gift preferences
     nlohmann::json giftPrefs;
     for (const auto& [category, value] : giftPreferences) {
-        giftPrefs[config.getGiftCategoryString(category)] = value;
+        giftPrefs[settings->giftCategoryName(category)] = value;
     }
     j["giftPreferences"] = giftPrefs;
 
@@ -247,18 +220,5 @@ nlohmann::json RelationshipNPC::toJson() const
 
     j["schedule"] = schedule;
 
-    // Relationships with other NPCs
-    nlohmann::json npcRelationships = nlohmann::json::array();
-    for (const auto& rel : relationships) {
-        nlohmann::json r;
-        r["npcId"] = rel.npcId;
-        r["type"] = config.getRelationshipTypeString(rel.type);
-        r["value"] = rel.value;
-        r["state"] = config.getRelationshipStateString(rel.currentState);
-        r["historyNotes"] = rel.historyNotes;
-        npcRelationships.push_back(r);
-    }
-    j["relationships"] = npcRelationships;
-
     return j;
 }
\ No newline at end of file
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "RelationshipTypes.hpp"
+#include "TraitCompatibility.hpp"
 #include <map>
 #include <nlohmann/json.hpp>
 #include <set>
 #include <string>
 #include <vector>
 
+struct RelationshipSettings;
+
 
 class RelationshipNPC {
 public:
@@ -20,7 +23,7 @@ public:
     std::string homeLocation;
 
     // Personality traits influence relationship dynamics
-    std::set<PersonalityTrait> personalityTraits;
+    TraitMask personalityTraits;
 
     // Daily schedule tracking
     struct ScheduleEntry {
@@ -41,24 +44,16 @@ public:
     std::set<std::string> conversationTopics;
     std::set<std::string> tabooTopics;
 
-    // Relationship network with other NPCs
-    struct NPCRelationship {
-        std::string npcId;
-        RelationshipType type;
-        int value; // -100 to 100
-        RelationshipState currentState;
-        std::string historyNotes;
-    };
-    std::vector<NPCRelationship> relationships;
+    // Relationships with other NPCs live in NPCRelationshipManager's SocialGraph
 
     RelationshipNPC(const std::string& npcId, const std::string& npcName);
     RelationshipNPC(const nlohmann::json& npcData);
 
     void addTrait(PersonalityTrait trait);
-    float calculateTraitCompatibility(const RelationshipNPC& other) const;
-    NPCRelationship* findRelationship(const std::string& npcId);
+    bool hasTrait(PersonalityTrait trait) const;
+    float calculateTraitCompatibility(const RelationshipNPC& other, const RelationshipSettings& settings) const;
     ScheduleEntry getCurrentSchedule(int day, int hour);
-    float getGiftReaction(const std::string& itemId, GiftCategory category);
+    float getGiftReaction(const std::string& itemId, GiftCategory category, const RelationshipSettings& settings);
     void addScheduleEntry(bool weekend, int start, int end, const std::string& location, const std::string& activity);
     void setGiftPreference(GiftCategory category, float preference);
     nlohmann::json toJson() const;
@@ -0,0 +1,144 @@
+#include "RelationshipSettings.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+const std::string UNKNOWN = "Unknown";
+
+void loadNames(const nlohmann::json& config, const char* key, std::vector<std::string>& names)
+{
+    auto it = config.find(key);
+    if (it == config.end() || !it->is_array()) {
+        return;
+    }
+    for (const auto& name : *it) {
+        names.push_back(name.get<std::string>());
+    }
+}
+
+int nameIndex(const std::vector<std::string>& names, const std::string& name)
+{
+    for (size_t i = 0; i < names.size(); i++) {
+        if (names[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+const std::string& nameAt(const std::vector<std::string>& names, int index)
+{
+    return index >= 0 && index < static_cast<int>(names.size()) ? names[index] : UNKNOWN;
+}
+}
+
+RelationshipSettings::RelationshipSettings()
+    : favoriteGiftMultiplier(2.0f)
+    , likedGiftMultiplier(1.5f)
+    , dislikedGiftMultiplier(0.5f)
+    , hatedGiftMultiplier(-1.0f)
+{
+    std::fill(std::begin(opposingTraits), std::end(opposingTraits), -1);
+}
+
+std::shared_ptr<const RelationshipSettings> RelationshipSettings::fromJson(const nlohmann::json& config)
+{
+    auto settings = std::make_shared<RelationshipSettings>();
+    if (!config.is_object()) {
+        return settings;
+    }
+
+    // Names first: the sections below refer to traits by name
+    loadNames(config, "personalityTraits", settings->traitNames);
+    loadNames(config, "relationshipTypes", settings->typeNames);
+    loadNames(config, "relationshipStates", settings->stateNames);
+    loadNames(config, "giftCategories", settings->giftCategoryNames);
+
+    const nlohmann::json constants = config.value("relationshipConstants", nlohmann::json::object());
+    RelationshipThresholds& t = settings->thresholds;
+    t.minRelationship = constants.value("minRelationship", t.minRelationship);
+    t.maxRelationship = constants.value("maxRelationship", t.maxRelationship);
+
+    const nlohmann::json levels = constants.value("thresholds", nlohmann::json::object());
+    t.hatred = levels.value("hatred", t.hatred);
+    t.dislike = levels.value("dislike", t.dislike);
+    t.neutral = levels.value("neutral", t.neutral);
+    t.friendly = levels.value("friendly", t.friendly);
+    t.close = levels.value("close", t.close);
+    t.intimate = levels.value("intimate", t.intimate);
+
+    const nlohmann::json time = constants.value("timeConstants", nlohmann::json::object());
+    t.dailyDecay = time.value("dailyDecayAmount", t.dailyDecay);
+    t.minDaysBetweenGifts = time.value("minDaysBetweenGifts", t.minDaysBetweenGifts);
+
+    const nlohmann::json gifts = constants.value("giftMultipliers", nlohmann::json::object());
+    settings->favoriteGiftMultiplier = gifts.value("favorite", settings->favoriteGiftMultiplier);
+    settings->likedGiftMultiplier = gifts.value("liked", settings->likedGiftMultiplier);
+    settings->dislikedGiftMultiplier = gifts.value("disliked", settings->dislikedGiftMultiplier);
+    settings->hatedGiftMultiplier = gifts.value("hated", settings->hatedGiftMultiplier);
+
+    const nlohmann::json traits = constants.value("traitInfluence", nlohmann::json::object());
+    settings->traitCompatibility.sharedBonus = traits.value("sharedTraitBonus", 0.0f);
+    settings->traitCompatibility.opposingPenalty = traits.value("opposingTraitPenalty", 0.0f);
+
+    if (config.contains("opposingTraits")) {
+        for (const auto& pair : config["opposingTraits"]) {
+            PersonalityTrait trait1 = settings->traitFromString(pair["trait1"].get<std::string>());
+            PersonalityTrait trait2 = settings->traitFromString(pair["trait2"].get<std::string>());
+            if (isPersonalityTrait(trait1) && isPersonalityTrait(trait2)) {
+                settings->opposingTraits[static_cast<int>(trait1)] = static_cast<int>(trait2);
+            }
+        }
+    }
+    settings->traitCompatibility.setPairs(settings->opposingTraits);
+
+    if (config.contains("rumors")) {
+        settings->rumors.loadFromJson(config["rumors"], *settings);
+    }
+
+    return settings;
+}
+
+PersonalityTrait RelationshipSettings::traitFromString(const std::string& name) const
+{
+    int index = nameIndex(traitNames, name);
+    return index >= 0 ? static_cast<PersonalityTrait>(index) : PersonalityTrait::Agreeable;
+}
+
+RelationshipType RelationshipSettings::typeFromString(const std::string& name) const
+{
+    int index = nameIndex(typeNames, name);
+    return index >= 0 ? static_cast<RelationshipType>(index) : RelationshipType::None;
+}
+
+RelationshipState RelationshipSettings::stateFromString(const std::string& name) const
+{
+    int index = nameIndex(stateNames, name);
+    return index >= 0 ? static_cast<RelationshipState>(index) : RelationshipState::Neutral;
+}
+
+GiftCategory RelationshipSettings::giftCategoryFromString(const std::string& name) const
+{
+    int index = nameIndex(giftCategoryNames, name);
+    return index >= 0 ? static_cast<GiftCategory>(index) : GiftCategory::Weapon;
+}
+
+const std::string& RelationshipSettings::traitName(PersonalityTrait trait) const
+{
+    return nameAt(traitNames, static_cast<int>(trait));
+}
+
+const std::string& RelationshipSettings::typeName(RelationshipType type) const
+{
+    return nameAt(typeNames, static_cast<int>(type));
+}
+
+const std::string& RelationshipSettings::stateName(RelationshipState state) const
+{
+    return nameAt(stateNames, static_cast<int>(state));
+}
+
+const std::string& RelationshipSettings::giftCategoryName(GiftCategory category) const
+{
+    return nameAt(giftCategoryNames, static_cast<int>(category));
+}
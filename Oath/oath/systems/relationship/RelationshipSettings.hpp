@@ -0,0 +1,48 @@
+#pragma once
+
+#include "PlayerRelationTable.hpp"
+#include "RelationshipTypes.hpp"
+#include "RumorMill.hpp"
+#include "TraitCompatibility.hpp"
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+// Everything NPCRelationships.json tunes, parsed once. A snapshot never
+// changes after fromJson; a reload builds a new one (see RelationshipConfig).
+struct RelationshipSettings {
+    RelationshipThresholds thresholds;
+
+    float favoriteGiftMultiplier;
+    float likedGiftMultiplier;
+    float dislikedGiftMultiplier;
+    float hatedGiftMultiplier;
+
+    int opposingTraits[PERSONALITY_TRAIT_COUNT]; // By trait: the trait it opposes, -1 for none
+    TraitCompatibility traitCompatibility; // Bonus, penalty and opposingTraits as masks
+
+    RumorSettings rumors;
+
+    // Names by enum value, in config order
+    std::vector<std::string> traitNames;
+    std::vector<std::string> typeNames;
+    std::vector<std::string> stateNames;
+    std::vector<std::string> giftCategoryNames;
+
+    RelationshipSettings();
+
+    // Missing sections keep the defaults
+    static std::shared_ptr<const RelationshipSettings> fromJson(const nlohmann::json& config);
+
+    PersonalityTrait traitFromString(const std::string& name) const;
+    RelationshipType typeFromString(const std::string& name) const;
+    RelationshipState stateFromString(const std::string& name) const;
+    GiftCategory giftCategoryFromString(const std::string& name) const;
+
+    // "Unknown" past the end of the config's list
+    const std::string& traitName(PersonalityTrait trait) const;
+    const std::string& typeName(RelationshipType type) const;
+    const std::string& stateName(RelationshipState state) const;
+    const std::string& giftCategoryName(GiftCategory category) const;
+};
@@ -1,4 +1,5 @@
 #include "RelationshipSystemController.hpp"
+#include "../world/TimeNode.hpp"
 #include <functional>
 
 RelationshipSystemController::RelationshipSystemController(TAController* gameController)
@@ -36,6 +37,17 @@ RelationshipSystemController::RelationshipSystemController(TAController* gameCon
 
     // Register the relationship system root node
     controller->setSystemRoot("RelationshipSystem", browserNode);
+
+    // NPC epidemics read the schedules and social graph after relationships
+    // move on, so this runs with the serial subscribers
+    if (controller->systemRoots.find("TimeSystem") != controller->systemRoots.end()) {
+        TimeNode* timeNode = dynamic_cast<TimeNode*>(controller->systemRoots["TimeSystem"]);
+        if (timeNode) {
+            timeNode->subscribe("RelationshipSystem", TimeCadence::Day, [this](GameContext*, int days) {
+                relationshipManager.fastForward(days);
+            });
+        }
+    }
 }
 
 NPCRelationshipManager* RelationshipSystemController::getRelationshipManager()
@@ -50,7 +62,7 @@ void RelationshipSystemController::updateTimeOfDay(int day, int hour)
     // Check for daily relationship decay
     static int lastProcessedDay = -1;
     if (day > lastProcessedDay) {
-        relationshipManager.advanceDay();
+        relationshipManager.fastForward(lastProcessedDay < 0 ? 1 : day - lastProcessedDay);
         lastProcessedDay = day;
     }
 }
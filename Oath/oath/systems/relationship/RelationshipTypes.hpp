@@ -36,6 +36,13 @@ enum class PersonalityTrait {
     Suspicious
 };
 
+constexpr int PERSONALITY_TRAIT_COUNT = static_cast<int>(PersonalityTrait::Suspicious) + 1;
+
+inline bool isPersonalityTrait(PersonalityTrait trait)
+{
+    return static_cast<int>(trait) >= 0 && static_cast<int>(trait) < PERSONALITY_TRAIT_COUNT;
+}
+
 // Relationship types
 enum class RelationshipType {
     None,
@@ -0,0 +1,254 @@
+#include "RumorMill.hpp"
+#include "RelationshipSettings.hpp"
+#include "../../utils/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+void loadModifiers(const nlohmann::json& j, const RelationshipSettings& names, float (&modifiers)[PERSONALITY_TRAIT_COUNT])
+{
+    if (!j.is_object()) {
+        return;
+    }
+
+    for (const auto& [traitName, value] : j.items()) {
+        PersonalityTrait trait = names.traitFromString(traitName);
+        if (isPersonalityTrait(trait)) {
+            modifiers[static_cast<int>(trait)] = value.get<float>();
+        }
+    }
+}
+}
+
+RumorSettings::RumorSettings()
+    : spreadChance(0.6f)
+    , minEdgeValue(0)
+    , hopDecay(0.8f)
+    , minStrength(0.15f)
+    , maxAgeDays(14)
+    , awarenessDecay(0.97f)
+    , threads(std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 4))
+    , parallelMinRumors(64)
+{
+    std::fill(std::begin(talkModifiers), std::end(talkModifiers), 1.0f);
+    talkModifiers[static_cast<int>(PersonalityTrait::Extroverted)] = 1.5f;
+    talkModifiers[static_cast<int>(PersonalityTrait::Introverted)] = 0.5f;
+    talkModifiers[static_cast<int>(PersonalityTrait::Cheerful)] = 1.2f;
+    talkModifiers[static_cast<int>(PersonalityTrait::Modest)] = 0.8f;
+    talkModifiers[static_cast<int>(PersonalityTrait::Loyal)] = 0.8f;
+    talkModifiers[static_cast<int>(PersonalityTrait::Diplomatic)] = 0.8f;
+    talkModifiers[static_cast<int>(PersonalityTrait::Vengeful)] = 1.2f;
+
+    std::fill(std::begin(beliefModifiers), std::end(beliefModifiers), 1.0f);
+    beliefModifiers[static_cast<int>(PersonalityTrait::Suspicious)] = 0.6f;
+    beliefModifiers[static_cast<int>(PersonalityTrait::Rational)] = 0.7f;
+    beliefModifiers[static_cast<int>(PersonalityTrait::Wise)] = 0.8f;
+    beliefModifiers[static_cast<int>(PersonalityTrait::Curious)] = 1.3f;
+    beliefModifiers[static_cast<int>(PersonalityTrait::Agreeable)] = 1.1f;
+}
+
+void RumorSettings::loadFromJson(const nlohmann::json& j, const RelationshipSettings& names)
+{
+    if (!j.is_object()) {
+        return;
+    }
+
+    spreadChance = j.value("spreadChance", spreadChance);
+    minEdgeValue = j.value("minEdgeValue", minEdgeValue);
+    hopDecay = j.value("hopDecay", hopDecay);
+    minStrength = j.value("minStrength", minStrength);
+    maxAgeDays = j.value("maxAgeDays", maxAgeDays);
+    awarenessDecay = j.value("awarenessDecay", awarenessDecay);
+    if (j.contains("talkModifiers")) {
+        loadModifiers(j["talkModifiers"], names, talkModifiers);
+    }
+    if (j.contains("beliefModifiers")) {
+        loadModifiers(j["beliefModifiers"], names, beliefModifiers);
+    }
+    threads = j.value("threads", threads);
+    parallelMinRumors = j.value("parallelMinRumors", parallelMinRumors);
+}
+
+Rumor::Rumor()
+    : id(-1)
+    , kind(RumorKind::GoodDeed)
+    , subject("player")
+    , severity(1)
+    , relationshipChange(0)
+    , strength(1.0f)
+    , startDay(0)
+{
+}
+
+RumorMill::RumorMill()
+    : seed(0x5EED)
+    , nextId(0)
+{
+}
+
+void RumorMill::clear()
+{
+    active.clear();
+    activeIndex.clear();
+    std::fill(crimeAwareness.begin(), crimeAwareness.end(), 0.0f);
+}
+
+void RumorMill::setTraits(int npc, TraitMask traits)
+{
+    resize(npc + 1);
+
+    float talkFactor = 1.0f;
+    float beliefFactor = 1.0f;
+    for (int trait = 0; trait < PERSONALITY_TRAIT_COUNT; trait++) {
+        if (traits & traitBit(static_cast<PersonalityTrait>(trait))) {
+            talkFactor *= settings.talkModifiers[trait];
+            beliefFactor *= settings.beliefModifiers[trait];
+        }
+    }
+    talk[npc] = talkFactor;
+    belief[npc] = beliefFactor;
+}
+
+int RumorMill::start(Rumor rumor, int origin, int day)
+{
+    rumor.id = nextId++;
+    rumor.startDay = day;
+
+    ActiveRumor entry;
+    entry.rumor = rumor;
+    entry.hops = 0;
+    entry.heard.assign(origin / 64 + 1, 0);
+    entry.heard[origin / 64] |= 1ull << (origin % 64);
+    entry.frontier.push_back(origin);
+
+    activeIndex[rumor.id] = static_cast<int>(active.size());
+    active.push_back(std::move(entry));
+    return rumor.id;
+}
+
+const std::vector<RumorArrival>& RumorMill::stepDay(const SocialGraph& graph, int day)
+{
+    resize(graph.npcCount());
+    for (float& awareness : crimeAwareness) {
+        awareness *= settings.awarenessDecay;
+    }
+
+    arrivals.clear();
+    workerArrivals.resize(std::max(settings.threads, 1));
+    forEachSlice(static_cast<int>(active.size()), [&](int worker, int begin, int end) {
+        std::vector<RumorArrival>& heard = workerArrivals[worker];
+        heard.clear();
+        for (int r = begin; r < end; r++) {
+            spread(active[r], graph, day, heard);
+        }
+    });
+
+    for (auto& heard : workerArrivals) {
+        for (const RumorArrival& arrival : heard) {
+            const Rumor& rumor = active[activeIndex[arrival.rumor]].rumor;
+            if (rumor.kind == RumorKind::Crime) {
+                crimeAwareness[arrival.npc] += rumor.severity * arrival.strength;
+            }
+        }
+        arrivals.insert(arrivals.end(), heard.begin(), heard.end());
+    }
+
+    // Drop rumors that reached no one new
+    size_t kept = 0;
+    for (size_t r = 0; r < active.size(); r++) {
+        if (active[r].frontier.empty()) {
+            activeIndex.erase(active[r].rumor.id);
+            continue;
+        }
+        if (kept != r) {
+            active[kept] = std::move(active[r]);
+        }
+        activeIndex[active[kept].rumor.id] = static_cast<int>(kept);
+        kept++;
+    }
+    active.resize(kept);
+    return arrivals;
+}
+
+const Rumor* RumorMill::getRumor(int id) const
+{
+    auto it = activeIndex.find(id);
+    return it != activeIndex.end() ? &active[it->second].rumor : nullptr;
+}
+
+bool RumorMill::hasHeard(int rumorId, int npc) const
+{
+    auto it = activeIndex.find(rumorId);
+    if (it == activeIndex.end()) {
+        return false;
+    }
+    const std::vector<uint64_t>& heard = active[it->second].heard;
+    return npc / 64 < static_cast<int>(heard.size()) && (heard[npc / 64] >> (npc % 64)) & 1;
+}
+
+int RumorMill::activeCount() const
+{
+    return static_cast<int>(active.size());
+}
+
+float RumorMill::getCrimeAwareness(int npc) const
+{
+    return npc >= 0 && npc < static_cast<int>(crimeAwareness.size()) ? crimeAwareness[npc] : 0.0f;
+}
+
+void RumorMill::resize(int npcCount)
+{
+    if (npcCount > static_cast<int>(talk.size())) {
+        talk.resize(npcCount, 1.0f);
+        belief.resize(npcCount, 1.0f);
+        crimeAwareness.resize(npcCount, 0.0f);
+    }
+}
+
+float RumorMill::roll(int day, int rumor, int teller, int hearer) const
+{
+    uint64_t h = splitMix(seed ^ splitMix(static_cast<uint64_t>(day) << 32 | static_cast<uint32_t>(rumor)));
+    h = splitMix(h ^ (static_cast<uint64_t>(static_cast<uint32_t>(teller)) << 32 | static_cast<uint32_t>(hearer)));
+    return static_cast<float>(h >> 40) / static_cast<float>(1ull << 24);
+}
+
+void RumorMill::spread(ActiveRumor& entry, const SocialGraph& graph, int day, std::vector<RumorArrival>& heard) const
+{
+    const Rumor& rumor = entry.rumor;
+    int hop = entry.hops + 1;
+    float strength = rumor.strength * std::pow(settings.hopDecay, static_cast<float>(hop));
+    if (strength < settings.minStrength || day - rumor.startDay >= settings.maxAgeDays) {
+        entry.frontier.clear();
+        return;
+    }
+
+    entry.heard.resize((graph.npcCount() + 63) / 64, 0);
+    std::vector<int> next;
+    for (int teller : entry.frontier) {
+        float tellChance = settings.spreadChance * talk[teller];
+        for (int e = graph.rowBegin(teller); e < graph.rowEnd(teller); e++) {
+            int value = graph.edgeValue(e);
+            int hearer = graph.edgeTarget(e);
+            uint64_t bit = 1ull << (hearer % 64);
+            if (value < settings.minEdgeValue || (entry.heard[hearer / 64] & bit)) {
+                continue;
+            }
+
+            // Closer friends hear more; -100 never, 100 at the full chance
+            float chance = tellChance * belief[hearer] * static_cast<float>(value + 100) / 200.0f;
+            if (roll(day, rumor.id, teller, hearer) < chance) {
+                entry.heard[hearer / 64] |= bit;
+                next.push_back(hearer);
+                heard.push_back({ rumor.id, hearer, hop, strength });
+            }
+        }
+    }
+    entry.frontier.swap(next);
+    entry.hops = hop;
+}
+
+void RumorMill::forEachSlice(int count, const std::function<void(int, int, int)>& work) const
+{
+    ::forEachSlice(count, count >= settings.parallelMinRumors ? settings.threads : 1, work);
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "RelationshipTypes.hpp"
+#include "SocialGraph.hpp"
+#include "TraitCompatibility.hpp"
+#include <cstdint>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct RelationshipSettings;
+
+enum class RumorKind {
+    Crime,
+    Betrayal,
+    GoodDeed
+};
+
+// Tuning for rumor spread, from the "rumors" section of the relationship config
+struct RumorSettings {
+    float spreadChance; // Daily chance a teller passes a rumor to a friend of value 100
+    int minEdgeValue; // Tellers only talk to NPCs they regard at least this well
+    float hopDecay; // Strength kept per hop
+    float minStrength; // Weaker rumors stop spreading
+    int maxAgeDays; // Rumors older than this stop spreading
+    float awarenessDecay; // Daily fraction of crime awareness kept
+
+    // Multipliers from personality: how readily an NPC repeats a rumor, and
+    // how readily it believes and passes on what it hears
+    float talkModifiers[PERSONALITY_TRAIT_COUNT];
+    float beliefModifiers[PERSONALITY_TRAIT_COUNT];
+
+    int threads;
+    int parallelMinRumors; // Below this many active rumors one thread does the work
+
+    RumorSettings();
+    void loadFromJson(const nlohmann::json& j, const RelationshipSettings& names); // Trait names from names
+};
+
+struct Rumor {
+    int id;
+    RumorKind kind;
+    std::string subject; // Who it is about, "player" unless set
+    std::string detail; // Crime type or deed
+    std::string region;
+    int severity; // 1-10
+    int relationshipChange; // Change to the hearer's regard for the subject, at full strength
+    float strength; // At the origin; each hop keeps hopDecay of it
+    int startDay;
+
+    Rumor();
+};
+
+struct RumorArrival {
+    int rumor;
+    int npc;
+    int hops;
+    float strength;
+};
+
+// Rumors spreading over a SocialGraph, one hop per day. Each rumor keeps the
+// set of NPCs who have heard it and the frontier who heard it yesterday; a
+// day's step lets every frontier NPC try each neighbor once. Rumors are
+// independent, so a day's step shares them out between threads, and the
+// chance rolls hash (seed, day, rumor, teller, hearer) so the outcome does not
+// depend on the thread count.
+class RumorMill {
+public:
+    RumorSettings settings;
+    uint64_t seed;
+
+    RumorMill();
+
+    void clear();
+
+    // Personality of a graph NPC; NPCs never set talk and believe at 1
+    void setTraits(int npc, TraitMask traits);
+
+    // Start a rumor known to origin; returns its id
+    int start(Rumor rumor, int origin, int day);
+
+    // Spread every active rumor by one hop. Returns everyone who heard a rumor
+    // today; crime awareness is already updated for them.
+    const std::vector<RumorArrival>& stepDay(const SocialGraph& graph, int day);
+
+    // Null once the rumor has stopped spreading
+    const Rumor* getRumor(int id) const;
+    bool hasHeard(int rumorId, int npc) const;
+    int activeCount() const;
+
+    // Sum of severity times strength of crime rumors heard, fading daily
+    float getCrimeAwareness(int npc) const;
+
+private:
+    struct ActiveRumor {
+        Rumor rumor;
+        std::vector<uint64_t> heard; // Bit per graph NPC
+        std::vector<int> frontier;
+        int hops;
+    };
+
+    std::vector<ActiveRumor> active;
+    std::unordered_map<int, int> activeIndex; // Rumor id -> slot in active
+    int nextId;
+
+    std::vector<float> talk;
+    std::vector<float> belief;
+    std::vector<float> crimeAwareness;
+
+    std::vector<RumorArrival> arrivals;
+    std::vector<std::vector<RumorArrival>> workerArrivals;
+
+    void resize(int npcCount);
+    float roll(int day, int rumor, int teller, int hearer) const;
+    void spread(ActiveRumor& entry, const SocialGraph& graph, int day, std::vector<RumorArrival>& heard) const;
+    void forEachSlice(int count, const std::function<void(int, int, int)>& work) const;
+};
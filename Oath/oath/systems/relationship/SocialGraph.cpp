@@ -0,0 +1,433 @@
+#include "SocialGraph.hpp"
+#include "RelationshipConfig.hpp"
+#include "../../utils/Parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace {
+const std::string NO_HISTORY;
+}
+
+SocialGraph::SocialGraph()
+    : threads(std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 4))
+    , parallelMinNpcs(4096)
+    , offsets(1, 0)
+    , inOffsets(1, 0)
+{
+}
+
+void SocialGraph::clear()
+{
+    int keepThreads = threads;
+    int keepMin = parallelMinNpcs;
+    *this = SocialGraph();
+    threads = keepThreads;
+    parallelMinNpcs = keepMin;
+}
+
+int SocialGraph::addNpc(const std::string& npcId)
+{
+    auto it = npcIndices.find(npcId);
+    if (it != npcIndices.end()) {
+        return it->second;
+    }
+
+    int index = static_cast<int>(npcIds.size());
+    npcIds.push_back(npcId);
+    npcIndices[npcId] = index;
+    offsets.push_back(offsets.back());
+    inOffsets.push_back(inOffsets.back());
+    return index;
+}
+
+int SocialGraph::npcIndex(const std::string& npcId) const
+{
+    auto it = npcIndices.find(npcId);
+    return it != npcIndices.end() ? it->second : -1;
+}
+
+const std::string& SocialGraph::npcId(int npc) const
+{
+    return npcIds[npc];
+}
+
+int SocialGraph::npcCount() const
+{
+    return static_cast<int>(npcIds.size());
+}
+
+int SocialGraph::edgeCount() const
+{
+    return static_cast<int>(targets.size());
+}
+
+void SocialGraph::setEdge(int from, int to, RelationshipType type, int value, RelationshipState state)
+{
+    pending.push_back({ from, to, static_cast<uint8_t>(type), static_cast<uint8_t>(state), false, value });
+
+    int edge = findEdge(from, to);
+    if (edge != NO_EDGE) {
+        types[edge] = static_cast<uint8_t>(type);
+        values[edge] = value;
+        states[edge] = static_cast<uint8_t>(state);
+    }
+}
+
+void SocialGraph::removeEdge(int from, int to)
+{
+    pending.push_back({ from, to, 0, 0, true, 0 });
+}
+
+bool SocialGraph::hasPendingChanges() const
+{
+    return !pending.empty();
+}
+
+void SocialGraph::commit()
+{
+    if (pending.empty()) {
+        return;
+    }
+
+    // Last change per pair wins
+    std::stable_sort(pending.begin(), pending.end(), [](const PendingEdge& a, const PendingEdge& b) {
+        return a.from != b.from ? a.from < b.from : a.to < b.to;
+    });
+    size_t unique = 0;
+    for (size_t i = 0; i < pending.size(); i++) {
+        if (unique > 0 && pending[unique - 1].from == pending[i].from && pending[unique - 1].to == pending[i].to) {
+            pending[unique - 1] = pending[i];
+        } else {
+            pending[unique++] = pending[i];
+        }
+    }
+    pending.resize(unique);
+
+    int count = npcCount();
+    std::vector<int> newOffsets(count + 1, 0);
+    std::vector<int> newTargets;
+    std::vector<int> newValues;
+    std::vector<uint8_t> newTypes;
+    std::vector<uint8_t> newStates;
+    size_t reserve = targets.size() + pending.size();
+    newTargets.reserve(reserve);
+    newValues.reserve(reserve);
+    newTypes.reserve(reserve);
+    newStates.reserve(reserve);
+
+    // Merge each sorted row with its sorted changes
+    size_t p = 0;
+    for (int npc = 0; npc < count; npc++) {
+        int e = offsets[npc];
+        int end = offsets[npc + 1];
+        while (e < end || (p < pending.size() && pending[p].from == npc)) {
+            bool takeChange = p < pending.size() && pending[p].from == npc && (e >= end || pending[p].to <= targets[e]);
+            if (!takeChange) {
+                newTargets.push_back(targets[e]);
+                newValues.push_back(values[e]);
+                newTypes.push_back(types[e]);
+                newStates.push_back(states[e]);
+                e++;
+                continue;
+            }
+
+            const PendingEdge& change = pending[p++];
+            if (e < end && targets[e] == change.to) {
+                e++; // Replaced or removed
+            }
+            if (change.remove) {
+                history.erase(pairKey(change.from, change.to));
+                continue;
+            }
+            newTargets.push_back(change.to);
+            newValues.push_back(change.value);
+            newTypes.push_back(change.type);
+            newStates.push_back(change.state);
+        }
+        newOffsets[npc + 1] = static_cast<int>(newTargets.size());
+    }
+
+    offsets.swap(newOffsets);
+    targets.swap(newTargets);
+    values.swap(newValues);
+    types.swap(newTypes);
+    states.swap(newStates);
+    pending.clear();
+    buildReverse();
+}
+
+int SocialGraph::findEdge(int from, int to) const
+{
+    auto begin = targets.begin() + offsets[from];
+    auto end = targets.begin() + offsets[from + 1];
+    auto it = std::lower_bound(begin, end, to);
+    return it != end && *it == to ? static_cast<int>(it - targets.begin()) : NO_EDGE;
+}
+
+int SocialGraph::edgeSource(int edge) const
+{
+    return static_cast<int>(std::upper_bound(offsets.begin(), offsets.end(), edge) - offsets.begin()) - 1;
+}
+
+void SocialGraph::appendHistory(int from, int to, const std::string& note)
+{
+    std::string& notes = history[pairKey(from, to)];
+    if (!notes.empty()) {
+        notes += "\n";
+    }
+    notes += note;
+}
+
+void SocialGraph::setHistory(int from, int to, const std::string& notes)
+{
+    if (notes.empty()) {
+        history.erase(pairKey(from, to));
+    } else {
+        history[pairKey(from, to)] = notes;
+    }
+}
+
+const std::string& SocialGraph::getHistory(int from, int to) const
+{
+    auto it = history.find(pairKey(from, to));
+    return it != history.end() ? it->second : NO_HISTORY;
+}
+
+nlohmann::json SocialGraph::edgesToJson(int npc) const
+{
+    auto settings = RelationshipConfig::getInstance().settings();
+    nlohmann::json edges = nlohmann::json::array();
+
+    for (int e = offsets[npc]; e < offsets[npc + 1]; e++) {
+        nlohmann::json r;
+        r["npcId"] = npcIds[targets[e]];
+        r["type"] = settings->typeName(edgeType(e));
+        r["value"] = values[e];
+        r["state"] = settings->stateName(edgeState(e));
+        r["historyNotes"] = getHistory(npc, targets[e]);
+        edges.push_back(r);
+    }
+    return edges;
+}
+
+void SocialGraph::edgesFromJson(int npc, const nlohmann::json& j)
+{
+    if (!j.is_array()) {
+        return;
+    }
+
+    auto settings = RelationshipConfig::getInstance().settings();
+    for (const auto& r : j) {
+        int target = addNpc(r["npcId"]);
+        setEdge(npc, target,
+            settings->typeFromString(r.value("type", "None")),
+            r.value("value", 0),
+            settings->stateFromString(r.value("state", "Neutral")));
+        setHistory(npc, target, r.value("historyNotes", ""));
+    }
+}
+
+std::vector<int> SocialGraph::spreadFrom(int source, int minValue, int maxHops) const
+{
+    int count = npcCount();
+    std::vector<int> hops(count, -1);
+    if (source < 0 || source >= count) {
+        return hops;
+    }
+
+    std::vector<std::atomic<uint8_t>> reached(count);
+    reached[source].store(1, std::memory_order_relaxed);
+    hops[source] = 0;
+
+    std::vector<int> frontier { source };
+    std::vector<std::vector<int>> found(std::max(threads, 1));
+    for (int hop = 1; hop <= maxHops && !frontier.empty(); hop++) {
+        // Workers claim unreached targets, so each NPC joins one next frontier
+        forEachSlice(static_cast<int>(frontier.size()), [&](int worker, int begin, int end) {
+            std::vector<int>& next = found[worker];
+            next.clear();
+            for (int f = begin; f < end; f++) {
+                int npc = frontier[f];
+                for (int e = offsets[npc]; e < offsets[npc + 1]; e++) {
+                    if (values[e] >= minValue && !reached[targets[e]].exchange(1, std::memory_order_relaxed)) {
+                        next.push_back(targets[e]);
+                    }
+                }
+            }
+        });
+
+        frontier.clear();
+        for (auto& next : found) {
+            for (int npc : next) {
+                hops[npc] = hop;
+            }
+            frontier.insert(frontier.end(), next.begin(), next.end());
+            next.clear();
+        }
+    }
+    return hops;
+}
+
+std::vector<int> SocialGraph::findCircles(int minValue, int maxRounds) const
+{
+    int count = npcCount();
+    std::vector<int> labels(count);
+    for (int npc = 0; npc < count; npc++) {
+        labels[npc] = npc;
+    }
+    std::vector<int> next(labels);
+    std::vector<std::vector<std::pair<int, int>>> votes(std::max(threads, 1));
+
+    for (int round = 0; round < maxRounds; round++) {
+        std::atomic<bool> changed(false);
+        forEachSlice(count, [&](int worker, int begin, int end) {
+            std::vector<std::pair<int, int>>& vote = votes[worker];
+            bool sliceChanged = false;
+            for (int npc = begin; npc < end; npc++) {
+                vote.clear();
+                int strongest = 0;
+                for (int e = offsets[npc]; e < offsets[npc + 1]; e++) {
+                    if (values[e] >= minValue) {
+                        vote.emplace_back(labels[targets[e]], values[e]);
+                        strongest = std::max(strongest, values[e]);
+                    }
+                }
+                for (int i = inOffsets[npc]; i < inOffsets[npc + 1]; i++) {
+                    if (values[inEdges[i]] >= minValue) {
+                        vote.emplace_back(labels[inSources[i]], values[inEdges[i]]);
+                        strongest = std::max(strongest, values[inEdges[i]]);
+                    }
+                }
+                if (vote.empty()) {
+                    next[npc] = labels[npc];
+                    continue;
+                }
+
+                // The current label votes as strongly as the strongest tie,
+                // which stops synchronous rounds from flip-flopping
+                vote.emplace_back(labels[npc], std::max(strongest, 1));
+                std::sort(vote.begin(), vote.end());
+
+                int best = labels[npc];
+                long long bestWeight = 0;
+                for (size_t i = 0; i < vote.size();) {
+                    int label = vote[i].first;
+                    long long weight = 0;
+                    for (; i < vote.size() && vote[i].first == label; i++) {
+                        weight += vote[i].second;
+                    }
+                    if (weight > bestWeight) { // Ascending labels, so ties keep the lowest
+                        best = label;
+                        bestWeight = weight;
+                    }
+                }
+                next[npc] = best;
+                sliceChanged |= best != labels[npc];
+            }
+            if (sliceChanged) {
+                changed.store(true, std::memory_order_relaxed);
+            }
+        });
+
+        labels.swap(next);
+        if (!changed.load()) {
+            break;
+        }
+    }
+
+    // Name each circle after its lowest member
+    std::vector<int> lowest(count, -1);
+    for (int npc = 0; npc < count; npc++) {
+        if (lowest[labels[npc]] < 0) {
+            lowest[labels[npc]] = npc;
+        }
+    }
+    for (int npc = 0; npc < count; npc++) {
+        labels[npc] = lowest[labels[npc]];
+    }
+    return labels;
+}
+
+std::vector<float> SocialGraph::influence(int rounds, float damping) const
+{
+    int count = npcCount();
+    if (count == 0) {
+        return {};
+    }
+
+    std::vector<float> outWeight(count, 0.0f);
+    for (int npc = 0; npc < count; npc++) {
+        for (int e = offsets[npc]; e < offsets[npc + 1]; e++) {
+            if (values[e] > 0) {
+                outWeight[npc] += static_cast<float>(values[e]);
+            }
+        }
+    }
+
+    std::vector<float> rank(count, 1.0f / count);
+    std::vector<float> next(count);
+    std::vector<float> share(count); // Rank passed per point of regard
+    for (int round = 0; round < rounds; round++) {
+        // NPCs who regard no one spread their share evenly
+        double dangling = 0.0;
+        for (int npc = 0; npc < count; npc++) {
+            if (outWeight[npc] == 0.0f) {
+                dangling += rank[npc];
+                share[npc] = 0.0f;
+            } else {
+                share[npc] = rank[npc] / outWeight[npc];
+            }
+        }
+        float base = static_cast<float>((1.0 - damping + damping * dangling) / count);
+
+        forEachSlice(count, [&](int, int begin, int end) {
+            for (int npc = begin; npc < end; npc++) {
+                float sum = 0.0f;
+                for (int i = inOffsets[npc]; i < inOffsets[npc + 1]; i++) {
+                    int value = values[inEdges[i]];
+                    if (value > 0) {
+                        sum += share[inSources[i]] * value;
+                    }
+                }
+                next[npc] = base + damping * sum;
+            }
+        });
+        rank.swap(next);
+    }
+    return rank;
+}
+
+uint64_t SocialGraph::pairKey(int from, int to)
+{
+    return static_cast<uint64_t>(static_cast<uint32_t>(from)) << 32 | static_cast<uint32_t>(to);
+}
+
+void SocialGraph::buildReverse()
+{
+    int count = npcCount();
+    inOffsets.assign(count + 1, 0);
+    for (int target : targets) {
+        inOffsets[target + 1]++;
+    }
+    for (int npc = 0; npc < count; npc++) {
+        inOffsets[npc + 1] += inOffsets[npc];
+    }
+
+    // Walking sources in order keeps each incoming list sorted by source
+    inSources.resize(targets.size());
+    inEdges.resize(targets.size());
+    std::vector<int> fill(inOffsets.begin(), inOffsets.end() - 1);
+    for (int npc = 0; npc < count; npc++) {
+        for (int e = offsets[npc]; e < offsets[npc + 1]; e++) {
+            int slot = fill[targets[e]]++;
+            inSources[slot] = npc;
+            inEdges[slot] = e;
+        }
+    }
+}
+
+void SocialGraph::forEachSlice(int count, const std::function<void(int, int, int)>& work) const
+{
+    ::forEachSlice(count, count >= parallelMinNpcs ? threads : 1, work);
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "RelationshipTypes.hpp"
+#include <cstdint>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+// Directed NPC-to-NPC relationships over dense NPC ids, stored as CSR: the
+// edges leaving NPC i are [rowBegin(i), rowEnd(i)), sorted by target, with
+// type, value and state in parallel arrays. A reverse index lists each NPC's
+// incoming edges. History notes live in a side table keyed by the NPC pair so
+// the hot arrays stay small.
+//
+// Edge values and states can be changed in place at any time. Adding and
+// removing edges is queued and applied together by commit(), which rebuilds
+// the rows in one merge pass.
+class SocialGraph {
+public:
+    static const int NO_EDGE = -1;
+
+    SocialGraph();
+
+    void clear();
+
+    // Registration; returns the dense index, reusing it for a known id
+    int addNpc(const std::string& npcId);
+    int npcIndex(const std::string& npcId) const; // -1 for an unknown id
+    const std::string& npcId(int npc) const;
+    int npcCount() const;
+    int edgeCount() const;
+
+    // Queue an insert or overwrite; an existing edge also changes at once
+    void setEdge(int from, int to, RelationshipType type, int value, RelationshipState state);
+    void removeEdge(int from, int to);
+    void commit();
+    bool hasPendingChanges() const;
+
+    // Binary search in the source row; NO_EDGE when absent
+    int findEdge(int from, int to) const;
+
+    int rowBegin(int npc) const { return offsets[npc]; }
+    int rowEnd(int npc) const { return offsets[npc + 1]; }
+    int outDegree(int npc) const { return offsets[npc + 1] - offsets[npc]; }
+    int inDegree(int npc) const { return inOffsets[npc + 1] - inOffsets[npc]; }
+
+    int edgeSource(int edge) const;
+    int edgeTarget(int edge) const { return targets[edge]; }
+    RelationshipType edgeType(int edge) const { return static_cast<RelationshipType>(types[edge]); }
+    int edgeValue(int edge) const { return values[edge]; }
+    RelationshipState edgeState(int edge) const { return static_cast<RelationshipState>(states[edge]); }
+
+    void setEdgeType(int edge, RelationshipType type) { types[edge] = static_cast<uint8_t>(type); }
+    void setEdgeValue(int edge, int value) { values[edge] = value; }
+    void setEdgeState(int edge, RelationshipState state) { states[edge] = static_cast<uint8_t>(state); }
+
+    // fn(target, edge) for each outgoing edge, in target order
+    template <typename Fn>
+    void forEachNeighbor(int npc, Fn fn) const
+    {
+        for (int e = offsets[npc]; e < offsets[npc + 1]; e++) {
+            fn(targets[e], e);
+        }
+    }
+
+    // fn(source, edge) for each incoming edge, in source order
+    template <typename Fn>
+    void forEachIncoming(int npc, Fn fn) const
+    {
+        for (int i = inOffsets[npc]; i < inOffsets[npc + 1]; i++) {
+            fn(inSources[i], inEdges[i]);
+        }
+    }
+
+    // Out-of-line notes; kept across commits while the edge exists
+    void appendHistory(int from, int to, const std::string& note);
+    void setHistory(int from, int to, const std::string& notes);
+    const std::string& getHistory(int from, int to) const;
+
+    // Outgoing edges in the save format of RelationshipNPC::toJson
+    nlohmann::json edgesToJson(int npc) const;
+    void edgesFromJson(int npc, const nlohmann::json& j);
+
+    // Hops from source along edges with value >= minValue, -1 if not reached
+    // within maxHops. Each level of the frontier is expanded in parallel.
+    std::vector<int> spreadFrom(int source, int minValue, int maxHops) const;
+
+    // Social circles by weighted label propagation over edges with value >=
+    // minValue, treated as undirected. Returns a circle label per NPC (the
+    // lowest NPC index in it).
+    std::vector<int> findCircles(int minValue, int maxRounds = 20) const;
+
+    // Weighted PageRank over positive edges: how much regard flows to each NPC.
+    // Scores sum to 1.
+    std::vector<float> influence(int rounds = 30, float damping = 0.85f) const;
+
+    int threads; // Workers for the graph algorithms
+    int parallelMinNpcs; // Below this the algorithms stay on one thread
+
+private:
+    struct PendingEdge {
+        int from;
+        int to;
+        uint8_t type;
+        uint8_t state;
+        bool remove;
+        int value;
+    };
+
+    std::vector<std::string> npcIds;
+    std::unordered_map<std::string, int> npcIndices;
+
+    std::vector<int> offsets; // npcCount + 1 entries
+    std::vector<int> targets;
+    std::vector<int> values;
+    std::vector<uint8_t> types;
+    std::vector<uint8_t> states;
+
+    // Reverse index: incoming edges of NPC i are [inOffsets[i], inOffsets[i + 1])
+    std::vector<int> inOffsets;
+    std::vector<int> inSources;
+    std::vector<int> inEdges;
+
+    std::vector<PendingEdge> pending;
+    std::unordered_map<uint64_t, std::string> history;
+
+    static uint64_t pairKey(int from, int to);
+    void buildReverse();
+    void forEachSlice(int count, const std::function<void(int, int, int)>& work) const;
+};
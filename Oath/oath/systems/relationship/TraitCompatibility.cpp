@@ -0,0 +1,143 @@
+#include "TraitCompatibility.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OATH_TRAIT_SSE2 1
+#endif
+
+namespace {
+// Bit-twiddling popcount, the same in scalar and vector lanes
+inline uint32_t laneCount(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    x = (x + (x >> 4)) & 0x0F0F0F0Fu;
+    x = x + (x >> 8);
+    x = x + (x >> 16);
+    return x & 0x3Fu;
+}
+
+#if defined(OATH_TRAIT_SSE2)
+inline __m128i laneCount(__m128i x)
+{
+    const __m128i m1 = _mm_set1_epi32(0x55555555);
+    const __m128i m2 = _mm_set1_epi32(0x33333333);
+    const __m128i m4 = _mm_set1_epi32(0x0F0F0F0F);
+    x = _mm_sub_epi32(x, _mm_and_si128(_mm_srli_epi32(x, 1), m1));
+    x = _mm_add_epi32(_mm_and_si128(x, m2), _mm_and_si128(_mm_srli_epi32(x, 2), m2));
+    x = _mm_and_si128(_mm_add_epi32(x, _mm_srli_epi32(x, 4)), m4);
+    x = _mm_add_epi32(x, _mm_srli_epi32(x, 8));
+    x = _mm_add_epi32(x, _mm_srli_epi32(x, 16));
+    return _mm_and_si128(x, _mm_set1_epi32(0x3F));
+}
+#endif
+}
+
+std::vector<PersonalityTrait> traitList(TraitMask mask)
+{
+    std::vector<PersonalityTrait> result;
+    for (int bit = 0; bit < 32; bit++) {
+        if ((mask >> bit) & 1u) {
+            result.push_back(static_cast<PersonalityTrait>(bit));
+        }
+    }
+    return result;
+}
+
+void TraitProfileTable::resize(int count)
+{
+    traits.resize(count, 0);
+    firstOfPair.resize(count, 0);
+    secondOfPair.resize(count, 0);
+}
+
+void TraitProfileTable::set(int index, const TraitProfile& profile)
+{
+    if (index >= size()) {
+        resize(index + 1);
+    }
+    traits[index] = profile.traits;
+    firstOfPair[index] = profile.firstOfPair;
+    secondOfPair[index] = profile.secondOfPair;
+}
+
+TraitCompatibility::TraitCompatibility()
+    : sharedBonus(0.0f)
+    , opposingPenalty(0.0f)
+{
+}
+
+void TraitCompatibility::setPairs(const int (&opposingTraits)[PERSONALITY_TRAIT_COUNT])
+{
+    pairFirst.clear();
+    pairSecond.clear();
+    for (int trait = 0; trait < PERSONALITY_TRAIT_COUNT; trait++) {
+        if (opposingTraits[trait] < 0) {
+            continue;
+        }
+        if (pairFirst.size() == 32) {
+            break; // One bit per pair
+        }
+        pairFirst.push_back(traitBit(static_cast<PersonalityTrait>(trait)));
+        pairSecond.push_back(traitBit(static_cast<PersonalityTrait>(opposingTraits[trait])));
+    }
+}
+
+TraitProfile TraitCompatibility::profile(TraitMask traits) const
+{
+    TraitProfile result { traits, 0, 0 };
+    for (size_t k = 0; k < pairFirst.size(); k++) {
+        if (traits & pairFirst[k]) {
+            result.firstOfPair |= 1u << k;
+        }
+        if (traits & pairSecond[k]) {
+            result.secondOfPair |= 1u << k;
+        }
+    }
+    return result;
+}
+
+float TraitCompatibility::score(const TraitProfile& a, const TraitProfile& b) const
+{
+    int shared = traitCount(a.traits & b.traits);
+    int opposed = traitCount((a.firstOfPair & b.secondOfPair) | (a.secondOfPair & b.firstOfPair));
+    return shared * sharedBonus - opposed * opposingPenalty;
+}
+
+float TraitCompatibility::score(TraitMask a, TraitMask b) const
+{
+    return score(profile(a), profile(b));
+}
+
+void TraitCompatibility::scoreAgainst(const TraitProfile& a, const TraitProfileTable& table, float* out) const
+{
+    const uint32_t* traits = table.traits.data();
+    const uint32_t* first = table.firstOfPair.data();
+    const uint32_t* second = table.secondOfPair.data();
+    int count = table.size();
+    int i = 0;
+
+#if defined(OATH_TRAIT_SSE2)
+    // Four NPCs per step
+    const __m128i traitsA = _mm_set1_epi32(static_cast<int>(a.traits));
+    const __m128i firstA = _mm_set1_epi32(static_cast<int>(a.firstOfPair));
+    const __m128i secondA = _mm_set1_epi32(static_cast<int>(a.secondOfPair));
+    const __m128 bonus = _mm_set1_ps(sharedBonus);
+    const __m128 penalty = _mm_set1_ps(opposingPenalty);
+    for (; i + 4 <= count; i += 4) {
+        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(traits + i));
+        __m128i f = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + i));
+        __m128i shared = laneCount(_mm_and_si128(traitsA, t));
+        __m128i opposed = laneCount(_mm_or_si128(_mm_and_si128(firstA, s), _mm_and_si128(secondA, f)));
+        __m128 score = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(shared), bonus), _mm_mul_ps(_mm_cvtepi32_ps(opposed), penalty));
+        _mm_storeu_ps(out + i, score);
+    }
+#endif
+
+    for (; i < count; i++) {
+        uint32_t shared = laneCount(a.traits & traits[i]);
+        uint32_t opposed = laneCount((a.firstOfPair & second[i]) | (a.secondOfPair & first[i]));
+        out[i] = static_cast<float>(shared) * sharedBonus - static_cast<float>(opposed) * opposingPenalty;
+    }
+}
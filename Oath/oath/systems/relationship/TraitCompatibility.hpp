@@ -0,0 +1,73 @@
+#pragma once
+
+#include "RelationshipTypes.hpp"
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Personality traits as one bit per PersonalityTrait value
+using TraitMask = uint32_t;
+
+inline TraitMask traitBit(PersonalityTrait trait)
+{
+    return 1u << static_cast<int>(trait);
+}
+
+inline int traitCount(TraitMask mask)
+{
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt(mask));
+#else
+    return __builtin_popcount(mask);
+#endif
+}
+
+// Traits in enum order
+std::vector<PersonalityTrait> traitList(TraitMask mask);
+
+// An NPC's traits plus, for each opposing pair k in the config, bit k of
+// firstOfPair / secondOfPair when the NPC has that pair's first / second trait
+struct TraitProfile {
+    TraitMask traits;
+    uint32_t firstOfPair;
+    uint32_t secondOfPair;
+};
+
+// Profiles in parallel arrays for scoring one NPC against many
+struct TraitProfileTable {
+    std::vector<uint32_t> traits;
+    std::vector<uint32_t> firstOfPair;
+    std::vector<uint32_t> secondOfPair;
+
+    int size() const { return static_cast<int>(traits.size()); }
+    void resize(int count);
+    void set(int index, const TraitProfile& profile);
+};
+
+// RelationshipNPC::calculateTraitCompatibility as popcount arithmetic:
+//   shared traits * sharedTraitBonus - opposing pairs split between the two * opposingTraitPenalty
+class TraitCompatibility {
+public:
+    TraitCompatibility();
+
+    // opposingTraits[t] is the trait opposing t, or -1; one bit per pair, in
+    // trait order, up to 32 pairs
+    void setPairs(const int (&opposingTraits)[PERSONALITY_TRAIT_COUNT]);
+
+    TraitProfile profile(TraitMask traits) const;
+    float score(const TraitProfile& a, const TraitProfile& b) const;
+    float score(TraitMask a, TraitMask b) const;
+
+    // out[i] = score(a, table entry i); four entries per step with SSE2
+    void scoreAgainst(const TraitProfile& a, const TraitProfileTable& table, float* out) const;
+
+    float sharedBonus;
+    float opposingPenalty;
+
+private:
+    std::vector<TraitMask> pairFirst; // Bit of each pair's first trait
+    std::vector<TraitMask> pairSecond;
+};
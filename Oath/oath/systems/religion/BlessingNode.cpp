@@ -72,7 +72,7 @@ void BlessingNode::onEnter(ReligiousGameContext* context)
         int currentFavor = context->religiousStats.deityFavor[deityId];
 
         if (hasBlessing) {
-            int remainingDuration = context->religiousStats.blessingDuration[blessingId];
+            int remainingDuration = context->religiousStats.getBlessingDaysLeft(blessingId);
             std::cout << "\nThis blessing is currently active. " << remainingDuration << " days remaining." << std::endl;
         }
 
@@ -140,18 +140,7 @@ bool BlessingNode::grantBlessing(ReligiousGameContext* context)
     // Apply immediate effects
     for (const auto& effect : effects) {
         if (effect.type == "stat") {
-            if (effect.target == "strength")
-                context->playerStats.strength += effect.magnitude;
-            else if (effect.target == "dexterity")
-                context->playerStats.dexterity += effect.magnitude;
-            else if (effect.target == "constitution")
-                context->playerStats.constitution += effect.magnitude;
-            else if (effect.target == "intelligence")
-                context->playerStats.intelligence += effect.magnitude;
-            else if (effect.target == "wisdom")
-                context->playerStats.wisdom += effect.magnitude;
-            else if (effect.target == "charisma")
-                context->playerStats.charisma += effect.magnitude;
+            context->playerStats.changeStat(effect.target, effect.magnitude);
         } else if (effect.type == "skill") {
             context->playerStats.improveSkill(effect.target, effect.magnitude);
         }
@@ -151,18 +151,7 @@ void PrayerNode::performPrayer(ReligiousGameContext* context, PrayerType type)
 
     // Apply stat effects
     for (const auto& [stat, value] : result.statEffects) {
-        if (stat == "strength")
-            context->playerStats.strength += value;
-        else if (stat == "dexterity")
-            context->playerStats.dexterity += value;
-        else if (stat == "constitution")
-            context->playerStats.constitution += value;
-        else if (stat == "intelligence")
-            context->playerStats.intelligence += value;
-        else if (stat == "wisdom")
-            context->playerStats.wisdom += value;
-        else if (stat == "charisma")
-            context->playerStats.charisma += value;
+        context->playerStats.changeStat(stat, value);
 
         if (value != 0) {
             std::cout << "Your " << stat << " has " << (value > 0 ? "increased" : "decreased")
@@ -5,6 +5,7 @@
 #include "systems/religion/ReligiousQuestNode.hpp"
 #include "systems/religion/RitualNode.hpp"
 #include "systems/religion/TempleNode.hpp"
+#include "systems/world/TimeNode.hpp"
 #include <fstream>
 #include <iostream>
 #include <nlohmann/json.hpp>
@@ -76,6 +77,20 @@ void ReligionController::initializeReligionSystem(const std::string& jsonFilePat
     // Register the religion system root
     setSystemRoot("ReligionSystem", religionRoot);
 
+    // Blessings run out as days pass; they change player stats, so this runs
+    // with the serial subscribers
+    if (systemRoots.find("TimeSystem") != systemRoots.end()) {
+        TimeNode* timeNode = dynamic_cast<TimeNode*>(systemRoots["TimeSystem"]);
+        if (timeNode) {
+            timeNode->subscribe("ReligionSystem", TimeCadence::Day, [this](GameContext*, int days) {
+                ReligiousGameContext* religiousContext = getReligiousContext();
+                if (religiousContext) {
+                    religiousContext->religiousStats.updateBlessings(days);
+                }
+            });
+        }
+    }
+
     std::cout << "Religion System initialization complete." << std::endl;
 }
 
@@ -38,32 +38,31 @@ bool ReligiousStats::hasBlessingActive(const std::string& blessing) const
 
 void ReligiousStats::addBlessing(const std::string& blessing, int duration)
 {
+    // A blessing always sees out the day it was granted
     activeBlessing.insert(blessing);
-    blessingDuration[blessing] = duration;
+    blessings.apply(PLAYER, blessings.kindId(blessing), blessings.now() + std::max(duration, 1));
 }
 
 void ReligiousStats::removeBlessing(const std::string& blessing)
 {
     activeBlessing.erase(blessing);
-    blessingDuration.erase(blessing);
+    blessings.remove(PLAYER, blessings.findKind(blessing));
 }
 
-void ReligiousStats::updateBlessings()
+void ReligiousStats::updateBlessings(int days)
 {
-    std::set<std::string> expiredBlessings;
-
-    // Decrement duration and identify expired blessings
-    for (auto& [blessing, duration] : blessingDuration) {
-        duration--;
-        if (duration <= 0) {
-            expiredBlessings.insert(blessing);
-        }
+    // Only the blessings that ran out come off the timeline
+    expiredBlessings.clear();
+    blessings.advanceTo(blessings.now() + days, &expiredBlessings);
+    for (const EffectRecord& expired : expiredBlessings) {
+        activeBlessing.erase(blessings.kindName(expired.kind));
     }
+}
 
-    // Remove expired blessings
-    for (const auto& blessing : expiredBlessings) {
-        removeBlessing(blessing);
-    }
+int ReligiousStats::getBlessingDaysLeft(const std::string& blessing) const
+{
+    int64_t expiresAt = blessings.expiresAt(PLAYER, blessings.findKind(blessing));
+    return expiresAt >= 0 ? static_cast<int>(expiresAt - blessings.now()) : 0;
 }
 
 void ReligiousStats::setPrimaryDeity(const std::string& deity)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "data/EffectTimeline.hpp"
 #include <map>
 #include <set>
 #include <string>
@@ -13,18 +14,24 @@ public:
     std::string primaryDeity; // Current primary deity
     std::set<std::string> completedRituals; // Completed ritual IDs
     std::set<std::string> activeBlessing; // Active blessing effects
-    std::map<std::string, int> blessingDuration; // Remaining time on blessings
+    EffectTimeline blessings; // Blessing expiries, in days
 
     ReligiousStats();
     void changeFavor(const std::string& deity, int amount);
     void addDevotion(const std::string& deity, int points);
     bool hasMinimumFavor(const std::string& deity, int minimumFavor) const;
     bool hasBlessingActive(const std::string& blessing) const;
+    // Lasts at least until the next updateBlessings, even with duration <= 0
     void addBlessing(const std::string& blessing, int duration);
     void removeBlessing(const std::string& blessing);
-    void updateBlessings();
+    void updateBlessings(int days = 1);
+    int getBlessingDaysLeft(const std::string& blessing) const; // 0 when not active
     void setPrimaryDeity(const std::string& deity);
     bool hasCompletedRitual(const std::string& ritualId) const;
     void markRitualCompleted(const std::string& ritualId);
     void initializeDeities(const std::vector<std::string>& deityIds);
+
+private:
+    static const int PLAYER = 0;
+    std::vector<EffectRecord> expiredBlessings; // Scratch for updateBlessings
 };
\ No newline at end of file
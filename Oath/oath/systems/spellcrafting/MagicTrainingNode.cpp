@@ -106,7 +106,7 @@ void MagicTrainingNode::trainSchool(const std::string& school, int hours, GameCo
 
     // Training fatigue (reduce player stamina/energy)
     int fatigueAmount = hours * 5;
-    context->playerStats.stamina = std::max(0, context->playerStats.stamina - fatigueAmount);
+    context->playerStats.setStat("stamina", std::max(0, context->playerStats.stamina - fatigueAmount));
 
     if (context->playerStats.stamina <= 10) {
         std::cout << "\nYou feel exhausted from the intense magical training." << std::endl;
@@ -399,7 +399,7 @@ SpellResearchResult SpellCraftingNode::conductResearch(const std::string& resear
 
         // Apply some negative effect
         // Damage or temporary skill reduction
-        context->playerStats.health -= 10;
+        context->playerStats.changeStat("health", -10);
     }
 
     // Discover a new component or modifier if we've reached enough research points
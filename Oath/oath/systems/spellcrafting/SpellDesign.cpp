@@ -210,7 +210,7 @@ bool SpellDesign::cast(GameContext* context)
     }
 
     // Deduct mana cost
-    context->playerStats.mana -= totalManaCost;
+    context->playerStats.changeStat("mana", -totalManaCost);
 
     // Calculate success chance based on complexity and skills
     int successChance = 100 - (complexityRating * 2);
@@ -261,7 +261,7 @@ bool SpellDesign::cast(GameContext* context)
             int backfireEffect = std::min(100, complexityRating * 5);
             std::cout << "The spell backfires with " << backfireEffect << " points of damage!" << std::endl;
             // Apply backfire damage
-            context->playerStats.health -= backfireEffect;
+            context->playerStats.changeStat("health", -backfireEffect);
         }
 
         return false;
@@ -15,6 +15,46 @@ bool WeatherCondition::hasEffect(WeatherEffect effect) const
     return std::find(activeEffects.begin(), activeEffects.end(), effect) != activeEffects.end();
 }
 
+void WeatherCondition::deriveEffects()
+{
+    activeEffects.clear();
+
+    if (type == WeatherType::Foggy && intensity >= WeatherIntensity::Moderate) {
+        activeEffects.push_back(WeatherEffect::ReducedVisibility);
+    }
+
+    if ((type == WeatherType::Rainy && intensity >= WeatherIntensity::Heavy) || (type == WeatherType::Stormy) || (type == WeatherType::Snowy && intensity >= WeatherIntensity::Moderate) || (type == WeatherType::Blizzard) || (type == WeatherType::SandStorm)) {
+        activeEffects.push_back(WeatherEffect::SlowMovement);
+    }
+
+    if ((type == WeatherType::Blizzard && intensity == WeatherIntensity::Severe) || (type == WeatherType::SandStorm && intensity == WeatherIntensity::Severe)) {
+        activeEffects.push_back(WeatherEffect::DamageOverTime);
+    }
+
+    // Perception bonus
+    if (type == WeatherType::Clear) {
+        activeEffects.push_back(WeatherEffect::BonusToSkill);
+    }
+
+    // Archery penalty
+    if (type == WeatherType::Stormy || type == WeatherType::Blizzard || type == WeatherType::SandStorm) {
+        activeEffects.push_back(WeatherEffect::PenaltyToSkill);
+    }
+
+    modifiers.effects = 0;
+    for (WeatherEffect effect : activeEffects) {
+        modifiers.effects |= weatherEffectBit(effect);
+    }
+}
+
+void WeatherCondition::resolveModifiers(const WeatherTables& tables)
+{
+    modifiers = tables.getModifiers(type, intensity);
+    for (WeatherEffect effect : activeEffects) {
+        modifiers.effects |= weatherEffectBit(effect);
+    }
+}
+
 void WeatherCondition::applyEffects(GameContext* context)
 {
     if (!context)
@@ -74,10 +114,10 @@ void WeatherCondition::applyEffects(GameContext* context)
     // Apply skill modifiers based on weather
     if (type == WeatherType::Clear) {
         // Bonus to perception in clear weather
-        context->playerStats.skills["perception"] += 5;
+        context->playerStats.improveSkill("perception", 5);
     } else if (type == WeatherType::Stormy || type == WeatherType::Blizzard || type == WeatherType::SandStorm) {
         // Penalty to ranged combat in bad weather
-        context->playerStats.skills["archery"] -= 10;
+        context->playerStats.improveSkill("archery", -10);
     }
 }
 
@@ -10,6 +10,8 @@
 #include <nlohmann/json.hpp>
 
 #include "../../data/GameContext.hpp"
+#include "../../data/GameScript.hpp"
+#include "WeatherTables.hpp"
 #include "WeatherTypes.hpp"
 
 // Weather condition specific data
@@ -20,12 +22,15 @@ public:
     std::vector<WeatherEffect> activeEffects;
     std::string description;
 
+    // Numeric modifiers and effect bits for travel and combat; read these on hot paths
+    WeatherModifiers modifiers;
+
     // Special events that can occur in this weather
     struct WeatherEvent {
         std::string name;
         std::string description;
         double probability;
-        std::function<void(GameContext*)> effect;
+        GameEffect effect;
     };
     std::vector<WeatherEvent> possibleEvents;
 
@@ -37,6 +42,12 @@ public:
     // Check if a specific effect is active
     bool hasEffect(WeatherEffect effect) const;
 
+    // Rebuild activeEffects from type and intensity
+    void deriveEffects();
+
+    // Fill modifiers from the compiled tables and the current activeEffects
+    void resolveModifiers(const WeatherTables& tables);
+
     // Apply weather effects to game context
     void applyEffects(GameContext* context);
 
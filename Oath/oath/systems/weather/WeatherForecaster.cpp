@@ -0,0 +1,156 @@
+// WeatherForecaster.cpp
+#include "WeatherForecaster.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
+
+namespace {
+const int ROLLOUT_BATCH = 64; // Rollouts between time budget checks
+const size_t MAX_CACHED_STATES = 256;
+
+using ForecastClock = std::chrono::steady_clock;
+
+// Run up to count rollouts, tallying [day][type][intensity]; returns rollouts finished
+int runRollouts(const WeatherTables& tables, int season, WeatherType currentType, WeatherIntensity currentIntensity,
+    int hoursUntilChange, int days, int count, unsigned int seed, ForecastClock::time_point deadline, std::vector<int>& tally)
+{
+    std::mt19937 rng(seed);
+    tally.assign(static_cast<size_t>(days) * WEATHER_TYPE_COUNT * WEATHER_INTENSITY_COUNT, 0);
+
+    int done = 0;
+    while (done < count) {
+        int batchEnd = std::min(count, done + ROLLOUT_BATCH);
+        for (; done < batchEnd; done++) {
+            WeatherType type = currentType;
+            WeatherIntensity intensity = currentIntensity;
+            int changeAt = hoursUntilChange;
+
+            for (int day = 0; day < days; day++) {
+                // Walk every change up to the same hour on that day
+                int target = (day + 1) * 24;
+                while (changeAt <= target) {
+                    type = tables.sampleTransition(season, type, rng);
+                    intensity = tables.sampleIntensity(type, rng);
+                    changeAt += tables.rollChangeInterval(rng);
+                }
+
+                size_t slot = (static_cast<size_t>(day) * WEATHER_TYPE_COUNT + static_cast<int>(type)) * WEATHER_INTENSITY_COUNT + static_cast<int>(intensity);
+                tally[slot]++;
+            }
+        }
+
+        if (ForecastClock::now() >= deadline) {
+            break;
+        }
+    }
+
+    return done;
+}
+}
+
+WeatherForecaster::WeatherForecaster()
+    : forecastDays(3)
+    , rollouts(4000)
+    , timeBudgetMicros(5000)
+    , threads(std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 4))
+    , lastRolloutCount(0)
+{
+}
+
+void WeatherForecaster::configure(const nlohmann::json& forecastConfig)
+{
+    forecastDays = std::max(1, forecastConfig.value("days", forecastDays));
+    rollouts = std::max(1, forecastConfig.value("rollouts", rollouts));
+    timeBudgetMicros = std::max(1, forecastConfig.value("timeBudgetMicros", timeBudgetMicros));
+    threads = std::max(1, forecastConfig.value("threads", threads));
+    invalidate();
+}
+
+const std::vector<WeatherForecast>& WeatherForecaster::forecast(const WeatherTables& tables, int season,
+    WeatherType currentType, WeatherIntensity currentIntensity, int hoursUntilChange, unsigned int seed)
+{
+    StateKey key { season, static_cast<int>(currentType), static_cast<int>(currentIntensity), hoursUntilChange };
+    auto cached = cache.find(key);
+    if (cached != cache.end()) {
+        return cached->second;
+    }
+
+    if (cache.size() >= MAX_CACHED_STATES) {
+        cache.clear();
+    }
+
+    ForecastClock::time_point deadline = ForecastClock::now() + std::chrono::microseconds(timeBudgetMicros);
+    int days = forecastDays;
+    int workers = std::min(threads, rollouts);
+
+    // One share of the rollouts per worker; this thread runs the first share itself
+    std::vector<std::vector<int>> tallies(workers);
+    std::vector<std::future<int>> running;
+    for (int w = 1; w < workers; w++) {
+        int share = rollouts / workers;
+        running.push_back(std::async(std::launch::async, runRollouts, std::cref(tables), season, currentType, currentIntensity,
+            hoursUntilChange, days, share, seed + w, deadline, std::ref(tallies[w])));
+    }
+
+    int finished = runRollouts(tables, season, currentType, currentIntensity, hoursUntilChange, days,
+        rollouts - (rollouts / workers) * (workers - 1), seed, deadline, tallies[0]);
+    for (auto& task : running) {
+        finished += task.get();
+    }
+    lastRolloutCount = finished;
+
+    // Merge the tallies and report each day's most likely weather
+    std::vector<WeatherForecast>& result = cache[key];
+    for (int day = 0; day < days; day++) {
+        WeatherForecast dayForecast;
+        dayForecast.dayOffset = day + 1;
+        dayForecast.predictedType = currentType;
+        dayForecast.predictedIntensity = currentIntensity;
+        dayForecast.accuracy = 0.0f;
+
+        int intensityCounts[WEATHER_TYPE_COUNT][WEATHER_INTENSITY_COUNT] = {};
+        for (const auto& tally : tallies) {
+            for (int type = 0; type < WEATHER_TYPE_COUNT; type++) {
+                for (int intensity = 0; intensity < WEATHER_INTENSITY_COUNT; intensity++) {
+                    intensityCounts[type][intensity] += tally[(static_cast<size_t>(day) * WEATHER_TYPE_COUNT + type) * WEATHER_INTENSITY_COUNT + intensity];
+                }
+            }
+        }
+
+        int bestCount = -1;
+        for (int type = 0; type < WEATHER_TYPE_COUNT; type++) {
+            int typeCount = 0;
+            int bestIntensity = 0;
+            for (int intensity = 0; intensity < WEATHER_INTENSITY_COUNT; intensity++) {
+                typeCount += intensityCounts[type][intensity];
+                if (intensityCounts[type][intensity] > intensityCounts[type][bestIntensity]) {
+                    bestIntensity = intensity;
+                }
+            }
+
+            dayForecast.typeProbability[type] = finished > 0 ? static_cast<float>(typeCount) / finished : 0.0f;
+            if (typeCount > bestCount) {
+                bestCount = typeCount;
+                dayForecast.predictedType = static_cast<WeatherType>(type);
+                dayForecast.predictedIntensity = static_cast<WeatherIntensity>(bestIntensity);
+            }
+        }
+        dayForecast.accuracy = dayForecast.typeProbability[static_cast<int>(dayForecast.predictedType)];
+
+        result.push_back(dayForecast);
+    }
+
+    return result;
+}
+
+void WeatherForecaster::invalidate()
+{
+    cache.clear();
+}
+
+int WeatherForecaster::getLastRolloutCount() const
+{
+    return lastRolloutCount;
+}
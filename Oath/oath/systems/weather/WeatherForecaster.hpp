@@ -0,0 +1,53 @@
+// WeatherForecaster.hpp
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "WeatherTables.hpp"
+
+// Prediction for one day ahead
+struct WeatherForecast {
+    int dayOffset;
+    WeatherType predictedType;
+    WeatherIntensity predictedIntensity;
+    float accuracy; // 0.0 to 1.0, how likely this forecast is correct
+    float typeProbability[WEATHER_TYPE_COUNT]; // Chance of each weather type that day
+};
+
+// Forecasts by Monte Carlo: many rollouts of the compiled weather Markov chain
+// are split across worker threads, and each day reports its most likely
+// weather with that likelihood as the accuracy. Rollouts stop early when the
+// time budget runs out. Results are cached per starting state, so repeated
+// queries (forecast screens, NPC small talk) cost a map lookup.
+class WeatherForecaster {
+public:
+    int forecastDays;
+    int rollouts; // Target rollouts per forecast
+    int timeBudgetMicros; // Wall-clock cap per forecast
+    int threads;
+
+    WeatherForecaster();
+
+    // Load settings from the "forecast" config block
+    void configure(const nlohmann::json& forecastConfig);
+
+    // Forecast from the given weather and hours until it next changes
+    const std::vector<WeatherForecast>& forecast(const WeatherTables& tables, int season,
+        WeatherType currentType, WeatherIntensity currentIntensity, int hoursUntilChange, unsigned int seed);
+
+    // Drop cached forecasts, e.g. after the tables are recompiled
+    void invalidate();
+
+    // Rollouts that finished for the most recent uncached forecast
+    int getLastRolloutCount() const;
+
+private:
+    // Season, type, intensity, hours until change
+    using StateKey = std::tuple<int, int, int, int>;
+    std::map<StateKey, std::vector<WeatherForecast>> cache;
+    int lastRolloutCount;
+};
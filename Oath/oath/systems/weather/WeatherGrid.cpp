@@ -0,0 +1,524 @@
+// WeatherGrid.cpp
+#include "WeatherGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+
+#if (defined(__SSE2__) || defined(_M_X64)) && !defined(OATH_WEATHER_NO_SIMD)
+#include <emmintrin.h>
+#define OATH_WEATHER_SSE 1
+#endif
+
+namespace {
+// Spring, summer, autumn, winter
+const float SEASON_BASE_TEMPERATURE[4] = { 12.0f, 24.0f, 10.0f, -4.0f };
+const float LATITUDE_SPREAD = 12.0f; // Degrees between the north and south edges
+
+// Upwind advection is stable while wind stays under half a cell per hour per axis
+const float MAX_WIND = 0.45f;
+
+// Saturation humidity rises with temperature
+const float SATURATION_BASE = 0.64f;
+const float SATURATION_SLOPE = 0.01f;
+const float SATURATION_MIN = 0.35f;
+const float SATURATION_MAX = 0.98f;
+const float RAIN_PER_EXCESS = 40.0f; // mm per hour per unit of excess humidity
+const float CONDENSED_FRACTION = 0.5f; // Share of the excess that falls each hour
+
+const float FRONT_STEERING = 3.0f; // Front speed as a multiple of the prevailing wind
+
+const float DEFAULT_MOISTURE = 0.6f;
+const int DEFAULT_REGION_SIZE = 6;
+
+// Advection needs at least one interior row and column
+const int MIN_GRID_SIZE = 3;
+
+void regionClimate(const std::string& regionType, float& temperatureOffset, float& moisture)
+{
+    temperatureOffset = 0.0f;
+    moisture = DEFAULT_MOISTURE;
+
+    if (regionType == "mountain") {
+        temperatureOffset = -10.0f;
+        moisture = 0.65f;
+    } else if (regionType == "desert") {
+        temperatureOffset = 10.0f;
+        moisture = 0.15f;
+    } else if (regionType == "forest") {
+        temperatureOffset = -1.0f;
+        moisture = 0.7f;
+    } else if (regionType == "coastal") {
+        moisture = 0.78f;
+    }
+}
+
+WeatherIntensity intensityFor(float value, float light, float moderate, float heavy)
+{
+    if (value < light)
+        return WeatherIntensity::Light;
+    if (value < moderate)
+        return WeatherIntensity::Moderate;
+    if (value < heavy)
+        return WeatherIntensity::Heavy;
+    return WeatherIntensity::Severe;
+}
+}
+
+WeatherGrid::WeatherGrid()
+    : width(0)
+    , height(0)
+    , climateSeason(-1)
+    , prevailingU(0.2f)
+    , prevailingV(0.05f)
+    , frontChancePerHour(0.03f)
+    , climateRelaxation(0.05f)
+    , evaporation(0.03f)
+    , detailedHours(24)
+    , rng(std::random_device {}())
+{
+    resize(128, 96);
+}
+
+void WeatherGrid::configure(const nlohmann::json& gridConfig)
+{
+    frontChancePerHour = gridConfig.value("frontChancePerHour", frontChancePerHour);
+    climateRelaxation = gridConfig.value("climateRelaxation", climateRelaxation);
+    evaporation = gridConfig.value("evaporation", evaporation);
+    detailedHours = std::max(1, gridConfig.value("detailedHours", detailedHours));
+
+    resize(gridConfig.value("width", width), gridConfig.value("height", height));
+
+    regionAreas.clear();
+    if (gridConfig.contains("regions")) {
+        for (auto& [regionName, areaData] : gridConfig["regions"].items()) {
+            setRegionArea(regionName,
+                { areaData.value("x", 0), areaData.value("y", 0),
+                    areaData.value("width", DEFAULT_REGION_SIZE), areaData.value("height", DEFAULT_REGION_SIZE),
+                    areaData.value("type", std::string("plains")) });
+        }
+    }
+
+    resetToClimate(0);
+}
+
+bool WeatherGrid::resize(int newWidth, int newHeight)
+{
+    if (newWidth < MIN_GRID_SIZE || newHeight < MIN_GRID_SIZE) {
+        std::cerr << "Error: weather grid " << newWidth << "x" << newHeight << " is smaller than "
+                  << MIN_GRID_SIZE << "x" << MIN_GRID_SIZE << ", keeping " << width << "x" << height << std::endl;
+        return false;
+    }
+
+    width = newWidth;
+    height = newHeight;
+    size_t cells = static_cast<size_t>(width) * height;
+
+    for (auto* field : { &temperature, &humidity, &windU, &windV, &precipitation, &climateTemperature, &moistureSource, &scratch }) {
+        field->assign(cells, 0.0f);
+    }
+    fronts.clear();
+    climateSeason = -1;
+    return true;
+}
+
+void WeatherGrid::setSeed(unsigned int seed)
+{
+    rng.seed(seed);
+}
+
+void WeatherGrid::setRegionArea(const std::string& regionName, const WeatherRegionArea& area)
+{
+    WeatherRegionArea clamped = area;
+    clamped.x = std::clamp(area.x, 0, width - 1);
+    clamped.y = std::clamp(area.y, 0, height - 1);
+    clamped.width = std::clamp(area.width, 1, width - clamped.x);
+    clamped.height = std::clamp(area.height, 1, height - clamped.y);
+
+    regionAreas[regionName] = clamped;
+    climateSeason = -1;
+}
+
+const WeatherRegionArea& WeatherGrid::getRegionArea(const std::string& regionName, const std::string& fallbackType)
+{
+    auto it = regionAreas.find(regionName);
+    if (it != regionAreas.end()) {
+        return it->second;
+    }
+
+    // Same name, same spot, so unplaced regions stay put between sessions
+    size_t hash = std::hash<std::string> {}(regionName);
+    int size = std::min({ DEFAULT_REGION_SIZE, width, height });
+    WeatherRegionArea area {
+        static_cast<int>(hash % (width - size + 1)),
+        static_cast<int>((hash / width) % (height - size + 1)),
+        size, size, fallbackType
+    };
+    setRegionArea(regionName, area);
+    return regionAreas[regionName];
+}
+
+void WeatherGrid::resetToClimate(int season)
+{
+    rebuildClimate(season);
+    temperature = climateTemperature;
+    humidity = moistureSource;
+    std::fill(precipitation.begin(), precipitation.end(), 0.0f);
+    fronts.clear();
+}
+
+void WeatherGrid::advance(int hours, int season, WeatherType globalType)
+{
+    if (season != climateSeason) {
+        rebuildClimate(season);
+    }
+
+    if (hours > detailedHours) {
+        skipHours(hours - detailedHours, globalType);
+        hours = detailedHours;
+    }
+
+    for (int hour = 0; hour < hours; hour++) {
+        stepHour(globalType);
+    }
+}
+
+WeatherSample WeatherGrid::sampleRegion(const std::string& regionName)
+{
+    const WeatherRegionArea& area = getRegionArea(regionName);
+    WeatherSample sample { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for (int y = area.y; y < area.y + area.height; y++) {
+        for (int x = area.x; x < area.x + area.width; x++) {
+            size_t i = static_cast<size_t>(y) * width + x;
+            sample.temperature += temperature[i];
+            sample.humidity += humidity[i];
+            sample.precipitation += precipitation[i];
+            sample.windSpeed += std::sqrt(windU[i] * windU[i] + windV[i] * windV[i]);
+        }
+    }
+
+    float cells = static_cast<float>(area.width * area.height);
+    sample.temperature /= cells;
+    sample.humidity /= cells;
+    sample.precipitation /= cells;
+    sample.windSpeed /= cells;
+    return sample;
+}
+
+WeatherCondition WeatherGrid::deriveCondition(const WeatherSample& sample, const std::string& regionType) const
+{
+    WeatherCondition condition(WeatherType::Clear, WeatherIntensity::Light);
+    bool windy = sample.windSpeed >= 0.3f;
+
+    // Cloud and fog depend on how close the air is to saturation
+    float saturation = std::clamp(SATURATION_BASE + SATURATION_SLOPE * sample.temperature, SATURATION_MIN, SATURATION_MAX);
+    float relativeHumidity = sample.humidity / saturation;
+
+    if (sample.precipitation >= 0.2f) {
+        bool frozen = sample.temperature <= 0.0f;
+        bool violent = windy && sample.precipitation >= 2.0f;
+        condition.type = frozen ? (violent ? WeatherType::Blizzard : WeatherType::Snowy)
+                                : (violent ? WeatherType::Stormy : WeatherType::Rainy);
+        condition.intensity = intensityFor(sample.precipitation, 0.5f, 2.0f, 5.0f);
+    } else if (regionType == "desert" && windy && sample.humidity < 0.3f) {
+        condition.type = WeatherType::SandStorm;
+        condition.intensity = intensityFor(sample.windSpeed, 0.35f, 0.45f, 0.55f);
+    } else if (relativeHumidity >= 0.97f && sample.windSpeed < 0.15f) {
+        condition.type = WeatherType::Foggy;
+        condition.intensity = intensityFor(relativeHumidity, 0.98f, 0.99f, 1.0f);
+    } else if (relativeHumidity >= 0.85f) {
+        condition.type = WeatherType::Cloudy;
+        condition.intensity = intensityFor(relativeHumidity, 0.9f, 0.95f, 1.01f);
+    }
+
+    condition.deriveEffects();
+    return condition;
+}
+
+int WeatherGrid::getWidth() const
+{
+    return width;
+}
+
+int WeatherGrid::getHeight() const
+{
+    return height;
+}
+
+const std::vector<WeatherFront>& WeatherGrid::getFronts() const
+{
+    return fronts;
+}
+
+void WeatherGrid::rebuildClimate(int season)
+{
+    float base = SEASON_BASE_TEMPERATURE[std::clamp(season, 0, 3)];
+
+    // Colder to the north (row 0), warmer to the south
+    for (int y = 0; y < height; y++) {
+        float latitude = height > 1 ? static_cast<float>(y) / (height - 1) - 0.5f : 0.0f;
+        float rowTemperature = base + latitude * LATITUDE_SPREAD;
+        std::fill(climateTemperature.begin() + static_cast<size_t>(y) * width,
+            climateTemperature.begin() + static_cast<size_t>(y + 1) * width, rowTemperature);
+    }
+    std::fill(moistureSource.begin(), moistureSource.end(), DEFAULT_MOISTURE);
+
+    for (const auto& [regionName, area] : regionAreas) {
+        float temperatureOffset;
+        float moisture;
+        regionClimate(area.regionType, temperatureOffset, moisture);
+
+        for (int y = area.y; y < area.y + area.height; y++) {
+            for (int x = area.x; x < area.x + area.width; x++) {
+                size_t i = static_cast<size_t>(y) * width + x;
+                climateTemperature[i] += temperatureOffset;
+                moistureSource[i] = moisture;
+            }
+        }
+    }
+
+    climateSeason = season;
+}
+
+void WeatherGrid::stepHour(WeatherType globalType)
+{
+    // Prevailing wind wanders slowly
+    std::normal_distribution<float> drift(0.0f, 0.01f);
+    prevailingU = std::clamp(prevailingU + drift(rng), -0.3f, 0.3f);
+    prevailingV = std::clamp(prevailingV + drift(rng), -0.3f, 0.3f);
+    std::fill(windU.begin(), windU.end(), prevailingU);
+    std::fill(windV.begin(), windV.end(), prevailingV);
+
+    applyFronts();
+    advect(temperature);
+    advect(humidity);
+    relaxAndPrecipitate();
+
+    // Fronts are steered by the prevailing wind, faster than it blows at ground level
+    for (auto& front : fronts) {
+        front.x += prevailingU * FRONT_STEERING;
+        front.y += prevailingV * FRONT_STEERING;
+        front.hoursRemaining--;
+    }
+    pruneFronts();
+
+    bool stormy = globalType == WeatherType::Rainy || globalType == WeatherType::Stormy
+        || globalType == WeatherType::Snowy || globalType == WeatherType::Blizzard;
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    if (chance(rng) < frontChancePerHour * (stormy ? 4.0f : 1.0f)) {
+        spawnFront(stormy);
+    }
+}
+
+void WeatherGrid::skipHours(int hours, WeatherType globalType)
+{
+    // Nobody sees these hours, so only their net effect matters: the fields decay
+    // toward climate geometrically and fronts keep drifting, ageing and forming.
+    float temperatureKeep = std::pow(1.0f - climateRelaxation, static_cast<float>(hours));
+    float humidityKeep = std::pow(1.0f - evaporation, static_cast<float>(hours));
+
+    for (size_t i = 0; i < temperature.size(); i++) {
+        temperature[i] = climateTemperature[i] + (temperature[i] - climateTemperature[i]) * temperatureKeep;
+        humidity[i] = moistureSource[i] + (humidity[i] - moistureSource[i]) * humidityKeep;
+
+        // Whatever the air could not hold has rained out by now
+        float saturation = std::clamp(SATURATION_BASE + SATURATION_SLOPE * temperature[i], SATURATION_MIN, SATURATION_MAX);
+        humidity[i] = std::clamp(humidity[i], 0.0f, std::max(saturation, moistureSource[i]));
+    }
+    std::fill(precipitation.begin(), precipitation.end(), 0.0f);
+
+    // Sum of the hourly wind drift
+    std::normal_distribution<float> drift(0.0f, 0.01f * std::sqrt(static_cast<float>(hours)));
+    prevailingU = std::clamp(prevailingU + drift(rng), -0.3f, 0.3f);
+    prevailingV = std::clamp(prevailingV + drift(rng), -0.3f, 0.3f);
+
+    for (auto& front : fronts) {
+        front.x += prevailingU * FRONT_STEERING * hours;
+        front.y += prevailingV * FRONT_STEERING * hours;
+        front.hoursRemaining -= hours;
+    }
+
+    // Fronts that formed during the skip, aged by the hours they have already travelled
+    bool stormy = globalType == WeatherType::Rainy || globalType == WeatherType::Stormy
+        || globalType == WeatherType::Snowy || globalType == WeatherType::Blizzard;
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    for (int hour = 0; hour < hours; hour++) {
+        if (chance(rng) < frontChancePerHour * (stormy ? 4.0f : 1.0f)) {
+            spawnFront(stormy);
+
+            int age = hours - hour - 1;
+            WeatherFront& front = fronts.back();
+            front.x += prevailingU * FRONT_STEERING * age;
+            front.y += prevailingV * FRONT_STEERING * age;
+            front.hoursRemaining -= age;
+        }
+    }
+
+    pruneFronts();
+}
+
+void WeatherGrid::spawnFront(bool stormy)
+{
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    WeatherFront front;
+    front.radius = 6.0f + unit(rng) * 8.0f;
+    front.moisture = (stormy ? 0.06f : 0.04f) * (0.5f + unit(rng));
+    front.cooling = 0.2f + unit(rng) * 0.3f;
+    front.spin = (stormy ? 0.25f : 0.15f) * (unit(rng) < 0.5f ? -1.0f : 1.0f);
+    front.hoursRemaining = 48 + static_cast<int>(unit(rng) * 72.0f);
+
+    // Form anywhere; the steering wind carries it across the map from there
+    front.x = unit(rng) * (width - 1);
+    front.y = unit(rng) * (height - 1);
+
+    fronts.push_back(front);
+}
+
+void WeatherGrid::applyFronts()
+{
+    for (const auto& front : fronts) {
+        int minX = std::max(0, static_cast<int>(front.x - front.radius));
+        int maxX = std::min(width - 1, static_cast<int>(front.x + front.radius));
+        int minY = std::max(0, static_cast<int>(front.y - front.radius));
+        int maxY = std::min(height - 1, static_cast<int>(front.y + front.radius));
+        float radiusSquared = front.radius * front.radius;
+
+        for (int y = minY; y <= maxY; y++) {
+            float dy = y - front.y;
+            for (int x = minX; x <= maxX; x++) {
+                float dx = x - front.x;
+                float falloff = 1.0f - (dx * dx + dy * dy) / radiusSquared;
+                if (falloff <= 0.0f) {
+                    continue;
+                }
+
+                size_t i = static_cast<size_t>(y) * width + x;
+                humidity[i] += front.moisture * falloff;
+                temperature[i] -= front.cooling * falloff;
+
+                // Rotate around the centre
+                windU[i] -= dy / front.radius * front.spin * falloff;
+                windV[i] += dx / front.radius * front.spin * falloff;
+            }
+        }
+    }
+}
+
+void WeatherGrid::pruneFronts()
+{
+    fronts.erase(std::remove_if(fronts.begin(), fronts.end(),
+                     [this](const WeatherFront& front) {
+                         return front.hoursRemaining <= 0
+                             || front.x < -front.radius || front.x > width + front.radius
+                             || front.y < -front.radius || front.y > height + front.radius;
+                     }),
+        fronts.end());
+}
+
+void WeatherGrid::advect(std::vector<float>& field)
+{
+    const float* src = field.data();
+    const float* u = windU.data();
+    const float* v = windV.data();
+    float* dst = scratch.data();
+
+    // Edges are inflow boundaries: they keep their value and relax toward climate
+    std::copy(field.begin(), field.begin() + width, scratch.begin());
+    std::copy(field.end() - width, field.end(), scratch.end() - width);
+
+    for (int y = 1; y < height - 1; y++) {
+        size_t row = static_cast<size_t>(y) * width;
+        dst[row] = src[row];
+        dst[row + width - 1] = src[row + width - 1];
+
+        int x = 1;
+#ifdef OATH_WEATHER_SSE
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 maxWind = _mm_set1_ps(MAX_WIND);
+        const __m128 minWind = _mm_set1_ps(-MAX_WIND);
+
+        for (; x + 4 <= width - 1; x += 4) {
+            size_t i = row + x;
+            __m128 center = _mm_loadu_ps(src + i);
+            __m128 west = _mm_loadu_ps(src + i - 1);
+            __m128 east = _mm_loadu_ps(src + i + 1);
+            __m128 north = _mm_loadu_ps(src + i - width);
+            __m128 south = _mm_loadu_ps(src + i + width);
+            __m128 windX = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(u + i), minWind), maxWind);
+            __m128 windY = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(v + i), minWind), maxWind);
+
+            // Upwind differences, selected per lane by the sign of the wind
+            __m128 flux = _mm_mul_ps(_mm_max_ps(windX, zero), _mm_sub_ps(center, west));
+            flux = _mm_add_ps(flux, _mm_mul_ps(_mm_min_ps(windX, zero), _mm_sub_ps(east, center)));
+            flux = _mm_add_ps(flux, _mm_mul_ps(_mm_max_ps(windY, zero), _mm_sub_ps(center, north)));
+            flux = _mm_add_ps(flux, _mm_mul_ps(_mm_min_ps(windY, zero), _mm_sub_ps(south, center)));
+
+            _mm_storeu_ps(dst + i, _mm_sub_ps(center, flux));
+        }
+#endif
+        for (; x < width - 1; x++) {
+            size_t i = row + x;
+            float windX = std::clamp(u[i], -MAX_WIND, MAX_WIND);
+            float windY = std::clamp(v[i], -MAX_WIND, MAX_WIND);
+            float flux = std::max(windX, 0.0f) * (src[i] - src[i - 1])
+                + std::min(windX, 0.0f) * (src[i + 1] - src[i])
+                + std::max(windY, 0.0f) * (src[i] - src[i - width])
+                + std::min(windY, 0.0f) * (src[i + width] - src[i]);
+            dst[i] = src[i] - flux;
+        }
+    }
+
+    field.swap(scratch);
+}
+
+void WeatherGrid::relaxAndPrecipitate()
+{
+    float* t = temperature.data();
+    float* h = humidity.data();
+    float* p = precipitation.data();
+    const float* climate = climateTemperature.data();
+    const float* source = moistureSource.data();
+    size_t cells = temperature.size();
+    size_t i = 0;
+
+#ifdef OATH_WEATHER_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 relax = _mm_set1_ps(climateRelaxation);
+    const __m128 evaporate = _mm_set1_ps(evaporation);
+    const __m128 saturationBase = _mm_set1_ps(SATURATION_BASE);
+    const __m128 saturationSlope = _mm_set1_ps(SATURATION_SLOPE);
+    const __m128 saturationMin = _mm_set1_ps(SATURATION_MIN);
+    const __m128 saturationMax = _mm_set1_ps(SATURATION_MAX);
+    const __m128 rainScale = _mm_set1_ps(RAIN_PER_EXCESS);
+    const __m128 condensed = _mm_set1_ps(CONDENSED_FRACTION);
+
+    for (; i + 4 <= cells; i += 4) {
+        __m128 temp = _mm_loadu_ps(t + i);
+        __m128 humid = _mm_loadu_ps(h + i);
+        temp = _mm_add_ps(temp, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(climate + i), temp), relax));
+        humid = _mm_add_ps(humid, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(source + i), humid), evaporate));
+
+        __m128 saturation = _mm_add_ps(saturationBase, _mm_mul_ps(saturationSlope, temp));
+        saturation = _mm_min_ps(_mm_max_ps(saturation, saturationMin), saturationMax);
+        __m128 excess = _mm_max_ps(_mm_sub_ps(humid, saturation), zero);
+        humid = _mm_sub_ps(humid, _mm_mul_ps(excess, condensed));
+        humid = _mm_min_ps(_mm_max_ps(humid, zero), one);
+
+        _mm_storeu_ps(t + i, temp);
+        _mm_storeu_ps(h + i, humid);
+        _mm_storeu_ps(p + i, _mm_mul_ps(excess, rainScale));
+    }
+#endif
+    for (; i < cells; i++) {
+        t[i] += (climate[i] - t[i]) * climateRelaxation;
+        h[i] += (source[i] - h[i]) * evaporation;
+
+        float saturation = std::clamp(SATURATION_BASE + SATURATION_SLOPE * t[i], SATURATION_MIN, SATURATION_MAX);
+        float excess = std::max(h[i] - saturation, 0.0f);
+        h[i] = std::clamp(h[i] - excess * CONDENSED_FRACTION, 0.0f, 1.0f);
+        p[i] = excess * RAIN_PER_EXCESS;
+    }
+}
@@ -0,0 +1,109 @@
+// WeatherGrid.hpp
+#pragma once
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "WeatherCondition.hpp"
+
+// Atmosphere averaged over a region's cells
+struct WeatherSample {
+    float temperature; // Degrees Celsius
+    float humidity; // Relative, 0.0 to 1.0
+    float precipitation; // Millimetres per hour
+    float windSpeed; // Cells per hour
+};
+
+// Rectangle of grid cells covered by a region
+struct WeatherRegionArea {
+    int x;
+    int y;
+    int width;
+    int height;
+    std::string regionType; // "plains", "forest", "mountain", "desert" or "coastal"
+};
+
+// A storm system drifting with the prevailing wind, carrying moisture and cold air
+struct WeatherFront {
+    float x; // Centre, in cells
+    float y;
+    float radius; // In cells
+    float moisture; // Humidity added per hour at the centre
+    float cooling; // Degrees removed per hour at the centre
+    float spin; // Cyclonic wind at the rim, cells per hour
+    int hoursRemaining;
+};
+
+// Coarse 2D weather field over the world map. Temperature, humidity and wind
+// live in per-cell arrays; each hour fronts stir the wind, the fields advect
+// upwind with SSE, relax toward the local climate and rain out excess moisture.
+class WeatherGrid {
+public:
+    WeatherGrid();
+
+    // Load size, rates and region placement from the "weatherGrid" config block
+    void configure(const nlohmann::json& gridConfig);
+
+    // Grids under 3x3 are rejected and the current size kept
+    bool resize(int newWidth, int newHeight);
+    void setSeed(unsigned int seed);
+
+    // Place a region on the grid; unplaced regions get a stable spot from their name
+    void setRegionArea(const std::string& regionName, const WeatherRegionArea& area);
+    const WeatherRegionArea& getRegionArea(const std::string& regionName, const std::string& fallbackType = "plains");
+
+    // Set every cell to its climate for the season
+    void resetToClimate(int season);
+
+    // Simulate hours of weather. Stormy global weather makes new fronts more likely.
+    // Only the last detailedHours of a long span are stepped; earlier hours are caught up in closed form.
+    void advance(int hours, int season, WeatherType globalType);
+
+    WeatherSample sampleRegion(const std::string& regionName);
+
+    // Turn a sample into a condition (type, intensity and effects; no description)
+    WeatherCondition deriveCondition(const WeatherSample& sample, const std::string& regionType) const;
+
+    int getWidth() const;
+    int getHeight() const;
+    const std::vector<WeatherFront>& getFronts() const;
+
+private:
+    int width;
+    int height;
+    int climateSeason; // Season the climate arrays were built for, -1 if stale
+
+    // Per-cell fields, row-major
+    std::vector<float> temperature;
+    std::vector<float> humidity;
+    std::vector<float> windU;
+    std::vector<float> windV;
+    std::vector<float> precipitation;
+    std::vector<float> climateTemperature;
+    std::vector<float> moistureSource;
+    std::vector<float> scratch;
+
+    std::vector<WeatherFront> fronts;
+    std::unordered_map<std::string, WeatherRegionArea> regionAreas;
+
+    float prevailingU;
+    float prevailingV;
+    float frontChancePerHour;
+    float climateRelaxation; // Fraction of the gap to climate closed per hour
+    float evaporation; // Fraction of the gap to the moisture source closed per hour
+    int detailedHours; // Hours simulated step by step at the end of a long advance
+    std::mt19937 rng;
+
+    void rebuildClimate(int season);
+    void stepHour(WeatherType globalType);
+    void skipHours(int hours, WeatherType globalType);
+    void spawnFront(bool stormy);
+    void applyFronts();
+    void pruneFronts();
+    void advect(std::vector<float>& field);
+    void relaxAndPrecipitate();
+};
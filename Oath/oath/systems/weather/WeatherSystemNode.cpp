@@ -14,6 +14,33 @@
 #include "../world/RegionNode.hpp"
 #include "../world/TimeNode.hpp"
 
+namespace {
+const int DAYS_PER_SEASON = 90; // As WorldState::advanceDay turns them
+
+// Season index at an hour offset (zero or negative) from the end of a span.
+// The world is already at the span's end; days before it that crossed a
+// season boundary fall in the seasons before.
+int seasonAtOffset(const WorldState& world, int hourOfDay, int offset)
+{
+    int hours = hourOfDay + offset;
+    int daysBack = hours >= 0 ? 0 : (23 - hours) / 24;
+    int day = std::max(0, world.daysPassed - daysBack);
+    int seasonsBack = world.daysPassed / DAYS_PER_SEASON - day / DAYS_PER_SEASON;
+    return ((weatherSeasonIndex(world.currentSeason) - seasonsBack) % WEATHER_SEASON_COUNT + WEATHER_SEASON_COUNT) % WEATHER_SEASON_COUNT;
+}
+
+// Hour offset of the first season boundary after the given offset, or 0 if
+// the span ends first
+int nextSeasonBoundary(const WorldState& world, int hourOfDay, int offset)
+{
+    int hours = hourOfDay + offset;
+    int daysBack = hours >= 0 ? 0 : (23 - hours) / 24;
+    int day = std::max(0, world.daysPassed - daysBack);
+    int boundaryDay = (day / DAYS_PER_SEASON + 1) * DAYS_PER_SEASON;
+    return std::min(0, (boundaryDay - world.daysPassed) * 24 - hourOfDay);
+}
+}
+
 WeatherSystemNode::WeatherSystemNode(const std::string& name)
     : TANode(name)
 {
@@ -25,12 +52,12 @@ WeatherSystemNode::WeatherSystemNode(const std::string& name)
     rng.seed(rd());
 
     // Initialize hours until weather change (from config)
-    int minHours = weatherConfig["weatherChangeInterval"]["min"];
-    int maxHours = weatherConfig["weatherChangeInterval"]["max"];
-    hoursUntilWeatherChange = minHours + (rng() % (maxHours - minHours + 1));
+    auto tables = weatherTables.get();
+    hoursUntilWeatherChange = tables->rollChangeInterval(rng);
 
     // Initialize with default weather
     globalWeather = WeatherCondition(WeatherType::Clear, WeatherIntensity::None, "Clear skies with a gentle breeze.");
+    globalWeather.resolveModifiers(*tables);
 
     // Generate initial forecasts
     generateWeatherForecasts();
@@ -39,322 +66,164 @@ WeatherSystemNode::WeatherSystemNode(const std::string& name)
 void WeatherSystemNode::loadWeatherConfig()
 {
     try {
-        std::ifstream file("resources/json/weather.json");
+        std::ifstream file("resources/json/Weather.json");
         if (!file.is_open()) {
-            std::cerr << "Failed to open weather.json" << std::endl;
+            std::cerr << "Failed to open Weather.json" << std::endl;
             return;
         }
 
-        weatherConfig = nlohmann::json::parse(file);
+        nlohmann::json config = nlohmann::json::parse(file);
         file.close();
+
+        applyWeatherConfig(config);
+
+        if (config.contains("forecast")) {
+            forecaster.configure(config["forecast"]);
+        }
+
+        if (config.contains("weatherGrid")) {
+            weatherGrid.configure(config["weatherGrid"]);
+        }
     } catch (const std::exception& e) {
         std::cerr << "Error loading weather config: " << e.what() << std::endl;
         // Set a basic default configuration if loading fails
-        weatherConfig = nlohmann::json::object();
+        weatherConfig.publish(std::make_shared<const nlohmann::json>(nlohmann::json::object()));
     }
 }
 
-void WeatherSystemNode::generateWeatherForecasts()
+void WeatherSystemNode::applyWeatherConfig(const nlohmann::json& config)
 {
-    weatherForecast.clear();
-
-    std::uniform_real_distribution<float> accuracyDistribution(0.5f, 1.0f);
+    // Compile transition, intensity and description tables once
+    auto tables = std::make_shared<WeatherTables>();
+    tables->compile(config);
 
-    // Generate forecasts for the next 3 days
-    for (int day = 1; day <= 3; day++) {
-        WeatherForecast forecast;
-        forecast.dayOffset = day;
+    weatherTables.publish(std::move(tables));
+    weatherConfig.publish(std::make_shared<const nlohmann::json>(config));
+}
 
-        // Prediction is less accurate the further out it is
-        forecast.accuracy = accuracyDistribution(rng) * (1.0f - (day * 0.1f));
+std::shared_ptr<const WeatherTables> WeatherSystemNode::currentTables()
+{
+    auto tables = weatherTables.get();
+    if (tables != forecastTables) {
+        forecaster.invalidate();
+        forecastTables = tables;
+    }
+    return tables;
+}
 
-        // For now, just predict the current global weather with some randomness
-        // if (rng() % 100 < static_cast<int>(forecast.accuracy * 100)) {
-        if (static_cast<unsigned int>(rng() % 100) < static_cast<unsigned int>(forecast.accuracy * 100)) {
-            forecast.predictedType = globalWeather.type;
-            forecast.predictedIntensity = globalWeather.intensity;
-        } else {
-            // Random prediction from available types
-            std::vector<WeatherType> types = {
-                WeatherType::Clear, WeatherType::Cloudy, WeatherType::Foggy,
-                WeatherType::Rainy, WeatherType::Stormy
-            };
-            std::vector<WeatherIntensity> intensities = {
-                WeatherIntensity::Light, WeatherIntensity::Moderate,
-                WeatherIntensity::Heavy
-            };
-
-            forecast.predictedType = types[rng() % types.size()];
-            forecast.predictedIntensity = intensities[rng() % intensities.size()];
-        }
+void WeatherSystemNode::generateWeatherForecasts()
+{
+    weatherForecast = forecaster.forecast(*currentTables(), forecastSeason, globalWeather.type,
+        globalWeather.intensity, hoursUntilWeatherChange, rng());
+}
 
-        weatherForecast.push_back(forecast);
-    }
+const std::vector<WeatherForecast>& WeatherSystemNode::getRegionalForecast(const std::string& regionName)
+{
+    const WeatherCondition& current = regionalWeather.count(regionName) ? regionalWeather.at(regionName) : globalWeather;
+    return forecaster.forecast(*currentTables(), forecastSeason, current.type, current.intensity, hoursUntilWeatherChange, rng());
 }
 
-void WeatherSystemNode::updateWeather(GameContext* context, int hoursElapsed)
+void WeatherSystemNode::updateWeather(GameContext* context, int hoursElapsed, int hourOfDay)
 {
     if (!context)
         return;
 
+    const WorldState& world = context->worldState;
+    forecastSeason = weatherSeasonIndex(world.currentSeason);
+
+    // Move fronts across the weather grid, one piece per season the span
+    // covered, and re-derive regional weather from it
+    for (int offset = -hoursElapsed; offset < 0;) {
+        int boundary = nextSeasonBoundary(world, hourOfDay, offset);
+        weatherGrid.advance(boundary - offset, seasonAtOffset(world, hourOfDay, offset), globalWeather.type);
+        offset = boundary;
+    }
+    refreshRegionalWeather(context);
+
     // Decrement hours until next weather change
     hoursUntilWeatherChange -= hoursElapsed;
 
     // If it's time for weather to change
     if (hoursUntilWeatherChange <= 0) {
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-
-        // Reset timer for next change
-        int minHours = weatherConfig["weatherChangeInterval"]["min"];
-        int maxHours = weatherConfig["weatherChangeInterval"]["max"];
-        hoursUntilWeatherChange = minHours + (rng() % (maxHours - minHours + 1));
-
-        // Get current season from context
-        std::string currentSeason = context->worldState.currentSeason;
-
-        // Apply season modifiers to transition probabilities
-        float roll = dist(rng);
-        float cumulativeProbability = 0.0f;
-
-        // Get current weather type as string
-        std::string currentTypeStr = weatherTypeToString(globalWeather.type);
-
-        // Get transition probabilities from JSON
-        auto transitionsJson = weatherConfig["weatherTransitionProbabilities"][currentTypeStr];
-
-        // Determine next weather type based on transition probabilities
-        WeatherType nextType = globalWeather.type; // Default to current
-        std::string nextTypeStr = currentTypeStr;
-
-        // Convert JSON transitions to map for processing
-        std::map<std::string, float> transitions;
-        float totalProb = 0.0f;
-
-        for (auto& [type, probability] : transitionsJson.items()) {
-            float prob = probability.get<float>();
-
-            // Skip inappropriate weather for season
-            if ((type == "Snowy" || type == "Blizzard") && currentSeason != "winter") {
-                continue;
-            }
-
-            // Apply seasonal weighting from config
-            if (weatherConfig.contains("seasonalModifiers") && weatherConfig["seasonalModifiers"].contains(currentSeason) && weatherConfig["seasonalModifiers"][currentSeason].contains(type)) {
-                prob *= weatherConfig["seasonalModifiers"][currentSeason][type].get<float>();
-            }
-
-            transitions[type] = prob;
-            totalProb += prob;
-        }
-
-        // Normalize probabilities
-        if (totalProb > 0) {
-            for (auto& [type, prob] : transitions) {
-                prob /= totalProb;
-            }
-        }
-
-        // Select next weather type
-        roll = dist(rng);
-        cumulativeProbability = 0.0f;
-
-        for (const auto& [type, probability] : transitions) {
-            cumulativeProbability += probability;
-            if (roll < cumulativeProbability) {
-                nextTypeStr = type;
-                nextType = stringToWeatherType(type);
-                break;
-            }
-        }
-
-        // Select intensity based on weather type from JSON configuration
-        WeatherIntensity nextIntensity = WeatherIntensity::Light; // Default
-
-        if (weatherConfig.contains("intensityProbabilities") && weatherConfig["intensityProbabilities"].contains(nextTypeStr)) {
-            // Get intensity probabilities
-            auto& intensityData = weatherConfig["intensityProbabilities"][nextTypeStr];
-            std::map<std::string, float> intensityProbs;
-            float totalIntensityProb = 0.0f;
-
-            for (auto& [intensity, prob] : intensityData.items()) {
-                intensityProbs[intensity] = prob.get<float>();
-                totalIntensityProb += prob.get<float>();
-            }
-
-            // Normalize if needed
-            if (totalIntensityProb > 0) {
-                for (auto& [intensity, prob] : intensityProbs) {
-                    prob /= totalIntensityProb;
-                }
-            }
-
-            // Select intensity
-            float intensityRoll = dist(rng);
-            float cumIntensityProb = 0.0f;
-
-            for (const auto& [intensity, probability] : intensityProbs) {
-                cumIntensityProb += probability;
-                if (intensityRoll < cumIntensityProb) {
-                    nextIntensity = stringToWeatherIntensity(intensity);
-                    break;
-                }
-            }
+        auto tables = weatherTables.get();
+
+        // Sample next weather type from the compiled tables. A long span (sleeping,
+        // travelling) walks through every change it covered, each with the table
+        // of the season it fell in; only the last one is applied.
+        WeatherType nextType = globalWeather.type;
+        while (hoursUntilWeatherChange <= 0) {
+            int season = seasonAtOffset(world, hourOfDay, hoursUntilWeatherChange);
+            hoursUntilWeatherChange += tables->rollChangeInterval(rng);
+            nextType = tables->sampleTransition(season, nextType, rng);
         }
+        WeatherIntensity nextIntensity = tables->sampleIntensity(nextType, rng);
+        std::string nextTypeStr = weatherTypeToString(nextType);
 
         // Create the new weather condition
         WeatherCondition newWeather(nextType, nextIntensity);
 
-        // Generate appropriate description from JSON
+        // Generate appropriate description
         std::string nextIntensityStr = weatherIntensityToString(nextIntensity);
-        std::string description;
-
-        if (weatherConfig.contains("weatherDescriptions") && weatherConfig["weatherDescriptions"].contains(nextTypeStr)) {
-            auto& descData = weatherConfig["weatherDescriptions"][nextTypeStr];
-
-            // FIXED: Replaced timeOfDay access with default description
-            // Handle Clear weather with a default description
-            if (nextType == WeatherType::Clear && descData.contains("default")) {
-                description = descData["default"].get<std::string>();
-            }
-            // Try intensity-specific description
-            else if (descData.contains(nextIntensityStr)) {
-                description = descData[nextIntensityStr].get<std::string>();
-            }
-            // Fall back to default
-            else if (descData.contains("default")) {
-                description = descData["default"].get<std::string>();
-            } else {
-                // Generic fallback
-                description = "The weather is " + nextTypeStr + ".";
-            }
-        } else {
-            description = "The weather is " + nextTypeStr + ".";
-        }
+        const std::string& description = tables->getDescription(nextType, nextIntensity);
 
         newWeather.description = description;
 
         // Set up weather effects based on type and intensity
-        if (nextType == WeatherType::Foggy && nextIntensity >= WeatherIntensity::Moderate) {
-            newWeather.activeEffects.push_back(WeatherEffect::ReducedVisibility);
-        }
-
-        if ((nextType == WeatherType::Rainy && nextIntensity >= WeatherIntensity::Heavy) || (nextType == WeatherType::Stormy) || (nextType == WeatherType::Snowy && nextIntensity >= WeatherIntensity::Moderate) || (nextType == WeatherType::Blizzard) || (nextType == WeatherType::SandStorm)) {
-            newWeather.activeEffects.push_back(WeatherEffect::SlowMovement);
-        }
-
-        if ((nextType == WeatherType::Blizzard && nextIntensity == WeatherIntensity::Severe) || (nextType == WeatherType::SandStorm && nextIntensity == WeatherIntensity::Severe)) {
-            newWeather.activeEffects.push_back(WeatherEffect::DamageOverTime);
-        }
-
-        // Add weather-specific bonuses
-        if (nextType == WeatherType::Clear) {
-            newWeather.activeEffects.push_back(WeatherEffect::BonusToSkill); // Perception bonus
-        }
-
-        // Add weather-specific penalties
-        if (nextType == WeatherType::Stormy || nextType == WeatherType::Blizzard || nextType == WeatherType::SandStorm) {
-            newWeather.activeEffects.push_back(WeatherEffect::PenaltyToSkill); // Archery penalty
-        }
+        newWeather.deriveEffects();
+        newWeather.resolveModifiers(*tables);
 
         // Add special weather events from JSON
-        if (weatherConfig.contains("weatherEvents") && weatherConfig["weatherEvents"].contains(nextTypeStr) && weatherConfig["weatherEvents"][nextTypeStr].contains(nextIntensityStr)) {
-            auto& eventsData = weatherConfig["weatherEvents"][nextTypeStr][nextIntensityStr];
+        auto configSnapshot = weatherConfig.get();
+        const nlohmann::json& config = *configSnapshot;
+        if (config.contains("weatherEvents") && config["weatherEvents"].contains(nextTypeStr) && config["weatherEvents"][nextTypeStr].contains(nextIntensityStr)) {
+            const auto& eventsData = config["weatherEvents"][nextTypeStr][nextIntensityStr];
 
             for (auto& eventData : eventsData) {
                 std::string eventName = eventData["name"];
                 std::string eventDesc = eventData["description"];
                 double eventProb = eventData["probability"];
 
-                newWeather.possibleEvents.push_back({ eventName,
-                    eventDesc,
-                    eventProb,
-                    [eventName](GameContext* ctx) {
-                        if (ctx) {
-                            if (eventName == "Lightning Strike") {
-                                // Lightning strike could scare away enemies or damage the player
-                                bool outsideOrInMetal = !ctx->worldState.worldFlags["player_indoors"] || ctx->worldState.worldFlags["player_in_metal_armor"];
-
-                                if (outsideOrInMetal && (rand() % 100 < 25)) {
-                                    // 25% chance of damage if exposed
-                                    std::cout << "The lightning strikes dangerously close, causing damage!" << std::endl;
-                                    ctx->worldState.worldFlags["player_took_lightning_damage"] = true;
-                                } else {
-                                    // Otherwise, just a frightening experience
-                                    std::cout << "Nearby creatures flee from the lightning strike." << std::endl;
-                                    ctx->worldState.worldFlags["enemies_frightened"] = true;
-                                }
-                            } else if (eventName == "Strange Sounds") {
-                                // Fog can hide special encounters
-                                if (rand() % 100 < 50) {
-                                    std::cout << "The mist parts briefly, revealing something you might have otherwise missed." << std::endl;
-                                    ctx->worldState.worldFlags["fog_revealed_secret"] = true;
-                                } else {
-                                    std::cout << "You feel as if something is watching you from within the fog." << std::endl;
-                                    ctx->worldState.worldFlags["fog_hides_danger"] = true;
+                // Script effect from the config if given, e.g. "flag.roads_flooded = true; stamina -= 5"
+                GameEffect eventEffect;
+                if (eventData.contains("effect")) {
+                    eventEffect = GameEffect::fromJson(eventData["effect"]);
+                } else {
+                    eventEffect = [eventName](GameContext* ctx) {
+                            if (ctx) {
+                                if (eventName == "Lightning Strike") {
+                                    // Lightning strike could scare away enemies or damage the player
+                                    bool outsideOrInMetal = !ctx->worldState.worldFlags["player_indoors"] || ctx->worldState.worldFlags["player_in_metal_armor"];
+
+                                    if (outsideOrInMetal && (rand() % 100 < 25)) {
+                                        // 25% chance of damage if exposed
+                                        std::cout << "The lightning strikes dangerously close, causing damage!" << std::endl;
+                                        ctx->worldState.setWorldFlag("player_took_lightning_damage", true);
+                                    } else {
+                                        // Otherwise, just a frightening experience
+                                        std::cout << "Nearby creatures flee from the lightning strike." << std::endl;
+                                        ctx->worldState.setWorldFlag("enemies_frightened", true);
+                                    }
+                                } else if (eventName == "Strange Sounds") {
+                                    // Fog can hide special encounters
+                                    if (rand() % 100 < 50) {
+                                        std::cout << "The mist parts briefly, revealing something you might have otherwise missed." << std::endl;
+                                        ctx->worldState.setWorldFlag("fog_revealed_secret", true);
+                                    } else {
+                                        std::cout << "You feel as if something is watching you from within the fog." << std::endl;
+                                        ctx->worldState.setWorldFlag("fog_hides_danger", true);
+                                    }
                                 }
                             }
-                        }
-                    } });
+                    };
+                }
+
+                newWeather.possibleEvents.push_back({ eventName, eventDesc, eventProb, eventEffect });
             }
         }
 
         // Update global weather
         globalWeather = newWeather;
 
-        // Also update regional weather where appropriate
-        for (auto& [regionName, regionWeather] : regionalWeather) {
-            // Regional weather should be influenced by global weather but maintain some independence
-            // For simplicity, give a 50% chance to sync with global weather
-            if (rand() % 100 < 50) {
-                // Get region type (if available in context)
-                std::string regionType = "default";
-                if (context->worldState.locationStates.find(regionName) != context->worldState.locationStates.end()) {
-                    regionType = context->worldState.locationStates[regionName];
-                }
-
-                // Region-specific adjustments
-                // Desert regions resist rain, mountain regions get more snow, etc.
-                WeatherCondition adjustedWeather = newWeather;
-
-                if (regionType == "desert") {
-                    if (newWeather.type == WeatherType::Rainy || newWeather.type == WeatherType::Snowy) {
-                        // Desert is more likely to be clear regardless of global weather
-                        adjustedWeather.type = (rand() % 100 < 80) ? WeatherType::Clear : WeatherType::Cloudy;
-                        adjustedWeather.intensity = WeatherIntensity::Light;
-                    } else if (rand() % 100 < 15) { // 15% chance of sandstorm in desert
-                        adjustedWeather.type = WeatherType::SandStorm;
-                        adjustedWeather.intensity = (rand() % 100 < 30) ? WeatherIntensity::Severe : WeatherIntensity::Moderate;
-                    }
-                } else if (regionType == "mountain" && currentSeason == "winter") {
-                    // Mountains in winter are more likely to have snow
-                    if (newWeather.type == WeatherType::Rainy) {
-                        adjustedWeather.type = WeatherType::Snowy;
-                    } else if (newWeather.type == WeatherType::Stormy && rand() % 100 < 50) {
-                        adjustedWeather.type = WeatherType::Blizzard;
-                    }
-                } else if (regionType == "forest") {
-                    // Forests are more likely to retain precipitation longer
-                    if (newWeather.type == WeatherType::Clear && (regionWeather.type == WeatherType::Rainy || regionWeather.type == WeatherType::Snowy)) {
-                        adjustedWeather.type = regionWeather.type;
-                        adjustedWeather.intensity = WeatherIntensity::Light;
-                    }
-                } else if (regionType == "coastal") {
-                    // Coastal areas have more fog
-                    if (rand() % 100 < 30 && newWeather.type != WeatherType::Stormy) {
-                        adjustedWeather.type = WeatherType::Foggy;
-                        adjustedWeather.intensity = WeatherIntensity::Moderate;
-                    }
-                }
-
-                // Update description for the region-specific weather
-                std::ostringstream regionDesc;
-                regionDesc << "In " << regionName << ": " << description;
-                adjustedWeather.description = regionDesc.str();
-
-                regionalWeather[regionName] = adjustedWeather;
-            }
-        }
-
         // FIXED: Get current region name from the class variable instead of context->stateData
         std::string currentRegion = currentRegionName;
 
@@ -382,6 +251,14 @@ void WeatherSystemNode::updateWeather(GameContext* context, int hoursElapsed)
         } else {
             context->worldState.setWorldFlag("snowy_weather", false);
         }
+
+        // Publish for script conditions: "weather.stormy", "weather.intensity"
+        for (int type = static_cast<int>(WeatherType::Clear); type <= static_cast<int>(WeatherType::SandStorm); type++) {
+            std::string typeName = weatherTypeToString(static_cast<WeatherType>(type));
+            std::transform(typeName.begin(), typeName.end(), typeName.begin(), ::tolower);
+            context->script.set("weather." + typeName, currentWeather.type == static_cast<WeatherType>(type) ? 1.0f : 0.0f);
+        }
+        context->script.set("weather.intensity", static_cast<float>(currentWeather.intensity));
     }
 }
 
@@ -393,16 +270,19 @@ WeatherCondition WeatherSystemNode::determineRegionalWeather(
     // Combine seasonal and regional probabilities from JSON
     std::map<std::string, float> combinedProbs;
 
+    auto configSnapshot = weatherConfig.get();
+    const nlohmann::json& config = *configSnapshot;
+
     // Start with seasonal probabilities
-    if (weatherConfig.contains("seasonalWeatherProbabilities") && weatherConfig["seasonalWeatherProbabilities"].contains(season)) {
-        for (auto& [type, prob] : weatherConfig["seasonalWeatherProbabilities"][season].items()) {
+    if (config.contains("seasonalWeatherProbabilities") && config["seasonalWeatherProbabilities"].contains(season)) {
+        for (auto& [type, prob] : config["seasonalWeatherProbabilities"][season].items()) {
             combinedProbs[type] = prob.get<float>();
         }
     }
 
     // Modify with region-specific probabilities
-    if (weatherConfig.contains("regionTypeWeatherProbabilities") && weatherConfig["regionTypeWeatherProbabilities"].contains(regionType)) {
-        for (auto& [type, prob] : weatherConfig["regionTypeWeatherProbabilities"][regionType].items()) {
+    if (config.contains("regionTypeWeatherProbabilities") && config["regionTypeWeatherProbabilities"].contains(regionType)) {
+        for (auto& [type, prob] : config["regionTypeWeatherProbabilities"][regionType].items()) {
             // Average the probabilities for a balanced approach
             if (combinedProbs.find(type) != combinedProbs.end()) {
                 combinedProbs[type] = (combinedProbs[type] + prob.get<float>()) / 2.0f;
@@ -475,9 +355,40 @@ WeatherCondition WeatherSystemNode::determineRegionalWeather(
         weather.activeEffects.push_back(WeatherEffect::SlowMovement);
     }
 
+    weather.resolveModifiers(*weatherTables.get());
     return weather;
 }
 
+WeatherCondition WeatherSystemNode::sampleRegionalWeather(const std::string& regionName, const std::string& fallbackType)
+{
+    const WeatherRegionArea& area = weatherGrid.getRegionArea(regionName, fallbackType);
+    WeatherCondition weather = weatherGrid.deriveCondition(weatherGrid.sampleRegion(regionName), area.regionType);
+    auto tables = weatherTables.get();
+    weather.description = "In " + regionName + ": " + tables->getDescription(weather.type, weather.intensity);
+    weather.resolveModifiers(*tables);
+    return weather;
+}
+
+const WeatherModifiers& WeatherSystemNode::getWeatherModifiers(const std::string& regionName) const
+{
+    auto it = regionalWeather.find(regionName);
+    return it != regionalWeather.end() ? it->second.modifiers : globalWeather.modifiers;
+}
+
+void WeatherSystemNode::refreshRegionalWeather(GameContext* context)
+{
+    for (auto& [regionName, regionWeather] : regionalWeather) {
+        // Region type only matters for regions the grid config doesn't place
+        std::string regionType = "plains";
+        auto it = context->worldState.locationStates.find(regionName);
+        if (it != context->worldState.locationStates.end()) {
+            regionType = it->second;
+        }
+
+        regionWeather = sampleRegionalWeather(regionName, regionType);
+    }
+}
+
 void WeatherSystemNode::onRegionEnter(GameContext* context, const std::string& regionName)
 {
     if (!context)
@@ -491,9 +402,8 @@ void WeatherSystemNode::onRegionEnter(GameContext* context, const std::string& r
             regionType = context->worldState.locationStates[regionName];
         }
 
-        // Generate regional weather
-        regionalWeather[regionName] = determineRegionalWeather(
-            regionName, regionType, context->worldState.currentSeason);
+        // Sample regional weather from the grid
+        regionalWeather[regionName] = sampleRegionalWeather(regionName, regionType);
     }
 
     // Get the current weather for this region
@@ -571,9 +481,9 @@ std::string WeatherSystemNode::getWeatherReport(const std::string& regionName) c
     }
 
     // Add movement and visibility information
-    report << "\n\nVisibility: " << static_cast<int>(weather.getVisibilityModifier(weatherConfig) * 100) << "% of normal";
-    report << "\nMovement Speed: " << static_cast<int>(weather.getMovementModifier(weatherConfig) * 100) << "% of normal";
-    report << "\nCombat Effectiveness: " << static_cast<int>(weather.getCombatModifier(weatherConfig) * 100) << "% of normal";
+    report << "\n\nVisibility: " << static_cast<int>(weather.modifiers.visibility * 100) << "% of normal";
+    report << "\nMovement Speed: " << static_cast<int>(weather.modifiers.movement * 100) << "% of normal";
+    report << "\nCombat Effectiveness: " << static_cast<int>(weather.modifiers.combat * 100) << "% of normal";
 
     return report.str();
 }
@@ -614,8 +524,7 @@ void WeatherSystemNode::onEnter(GameContext* context)
                 regionType = context->worldState.locationStates[currentRegion];
             }
 
-            regionalWeather[currentRegion] = determineRegionalWeather(
-                currentRegion, regionType, context->worldState.currentSeason);
+            regionalWeather[currentRegion] = sampleRegionalWeather(currentRegion, regionType);
         }
 
         // Apply effects of current weather
@@ -868,6 +777,7 @@ bool WeatherSystemNode::deserialize(std::ifstream& file)
 
             globalWeather.activeEffects.push_back(static_cast<WeatherEffect>(effectType));
         }
+        globalWeather.resolveModifiers(*weatherTables.get());
 
         // Load hours until next weather change
         if (!file.read(reinterpret_cast<char*>(&hoursUntilWeatherChange), sizeof(hoursUntilWeatherChange))) {
@@ -960,6 +870,7 @@ bool WeatherSystemNode::deserialize(std::ifstream& file)
             }
 
             // Store the region weather
+            regionWeather.resolveModifiers(*weatherTables.get());
             regionalWeather[regionName] = regionWeather;
         }
 
@@ -1000,6 +911,12 @@ bool WeatherSystemNode::deserialize(std::ifstream& file)
                 return false;
             }
 
+            // Only the predicted type's chance is saved
+            std::fill(std::begin(forecast.typeProbability), std::end(forecast.typeProbability), 0.0f);
+            if (forecastType >= 0 && forecastType < WEATHER_TYPE_COUNT) {
+                forecast.typeProbability[static_cast<int>(forecastType)] = forecast.accuracy;
+            }
+
             weatherForecast.push_back(forecast);
         }
 
@@ -1033,21 +950,19 @@ void initializeWeatherSystem(TAController& controller)
 
         if (worldRoot) {
             // Initialize weather for the main region
-            weatherSystem->regionalWeather[worldRoot->regionName] = weatherSystem->determineRegionalWeather(
+            weatherSystem->regionalWeather[worldRoot->regionName] = weatherSystem->sampleRegionalWeather(
                 worldRoot->regionName,
                 worldRoot->regionName.find("Forest") != std::string::npos ? "forest" : worldRoot->regionName.find("Mountain") != std::string::npos ? "mountain"
-                                                                                                                                                   : "plains",
-                controller.gameContext.worldState.currentSeason);
+                                                                                                                                                   : "plains");
 
             // Initialize weather for connected regions
             for (auto* connectedRegion : worldRoot->connectedRegions) {
                 RegionNode* region = dynamic_cast<RegionNode*>(connectedRegion);
                 if (region) {
-                    weatherSystem->regionalWeather[region->regionName] = weatherSystem->determineRegionalWeather(
+                    weatherSystem->regionalWeather[region->regionName] = weatherSystem->sampleRegionalWeather(
                         region->regionName,
                         region->regionName.find("Forest") != std::string::npos ? "forest" : region->regionName.find("Mountain") != std::string::npos ? "mountain"
-                                                                                                                                                     : "plains",
-                        controller.gameContext.worldState.currentSeason);
+                                                                                                                                                     : "plains");
                 }
             }
         }
@@ -1070,27 +985,13 @@ void hookWeatherToTimeSystem(TAController& controller)
         WeatherSystemNode* weatherNode = dynamic_cast<WeatherSystemNode*>(controller.systemRoots["WeatherSystem"]);
 
         if (timeNode && weatherNode) {
-            // Add a hook in the time node to update weather
-            // This would typically be done by modifying the TimeNode class to call
-            // callbacks when time advances, but for this example, we'll just describe it
+            // Update weather once per advance with all the hours that passed
+            timeNode->subscribe("WeatherSystem", TimeCadence::Hour, [weatherNode, timeNode](GameContext* context, int hours) {
+                weatherNode->updateWeather(context, hours, timeNode->hour);
+            });
 
             std::cout << "Weather system hooked to time system." << std::endl;
             std::cout << "Weather will update as time passes." << std::endl;
-
-            // In a real implementation, you would modify the TimeNode::advanceHour method like this:
-            /*
-            void TimeNode::advanceHour(GameContext* context) {
-                hour++;
-                
-                // [... existing time update code ...]
-                
-                // Update weather when time passes
-                if (auto* weatherNode = dynamic_cast<WeatherSystemNode*>(
-                        controller->systemRoots["WeatherSystem"])) {
-                    weatherNode->updateWeather(context, 1); // 1 hour elapsed
-                }
-            }
-            */
         }
     }
 }
@@ -1127,7 +1028,8 @@ void demonstrateWeatherSystem(TAController& controller)
     if (weatherNode) {
         // Force weather change for demonstration
         weatherNode->hoursUntilWeatherChange = 0;
-        weatherNode->updateWeather(&controller.gameContext, 1);
+        TimeNode* timeNode = dynamic_cast<TimeNode*>(controller.systemRoots["TimeSystem"]);
+        weatherNode->updateWeather(&controller.gameContext, 1, timeNode ? timeNode->hour : 0);
 
         // Check the new weather
         controller.processInput("WeatherSystem", checkWeatherInput);
@@ -1135,13 +1037,13 @@ void demonstrateWeatherSystem(TAController& controller)
         // Demonstrate weather effects on travel
         std::cout << "\nWeather Effects on Gameplay:" << std::endl;
         std::cout << "- Movement speed: "
-                  << static_cast<int>(weatherNode->globalWeather.getMovementModifier(weatherNode->weatherConfig) * 100)
+                  << static_cast<int>(weatherNode->globalWeather.modifiers.movement * 100)
                   << "% of normal" << std::endl;
         std::cout << "- Visibility range: "
-                  << static_cast<int>(weatherNode->globalWeather.getVisibilityModifier(weatherNode->weatherConfig) * 100)
+                  << static_cast<int>(weatherNode->globalWeather.modifiers.visibility * 100)
                   << "% of normal" << std::endl;
         std::cout << "- Combat effectiveness: "
-                  << static_cast<int>(weatherNode->globalWeather.getCombatModifier(weatherNode->weatherConfig) * 100)
+                  << static_cast<int>(weatherNode->globalWeather.modifiers.combat * 100)
                   << "% of normal" << std::endl;
 
         // Demonstrate weather-specific events
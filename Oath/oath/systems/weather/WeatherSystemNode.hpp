@@ -2,6 +2,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -13,10 +14,14 @@
 #include "../../core/TAInput.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "../../utils/ConfigSnapshot.hpp"
 #include "../world/RegionNode.hpp"
 #include "../world/TimeNode.hpp"
 
 #include "WeatherCondition.hpp"
+#include "WeatherForecaster.hpp"
+#include "WeatherGrid.hpp"
+#include "WeatherTables.hpp"
 
 class TAController;
 class RegionNode;
@@ -27,8 +32,15 @@ struct TAAction;
 // Main weather system node
 class WeatherSystemNode : public TANode {
 public:
-    // JSON configuration
-    nlohmann::json weatherConfig;
+    // JSON configuration, for the sections read as-is (events, regional odds)
+    ConfigSnapshot<nlohmann::json> weatherConfig;
+
+    // Config compiled into dense lookup tables for weather changes. Each
+    // update takes one snapshot and uses it throughout.
+    ConfigSnapshot<WeatherTables> weatherTables;
+
+    // Gridded weather field that regional weather is sampled from
+    WeatherGrid weatherGrid;
 
     // Add this member variable to track the current region within the weather system
     std::string currentRegionName = "default";
@@ -46,37 +58,59 @@ public:
     int hoursUntilWeatherChange;
 
     // Weather forecast (predictions for next few days)
-    struct WeatherForecast {
-        int dayOffset;
-        WeatherType predictedType;
-        WeatherIntensity predictedIntensity;
-        float accuracy; // 0.0 to 1.0, how likely this forecast is correct
-    };
     std::vector<WeatherForecast> weatherForecast;
 
+    // Monte Carlo forecasts over weatherTables, cached per starting weather
+    WeatherForecaster forecaster;
+
+    // The tables the forecaster's cache was built from
+    std::shared_ptr<const WeatherTables> forecastTables;
+
+    // Season index the forecasts are rolled for, updated as weather advances
+    int forecastSeason = 0;
+
     // Constructor
     WeatherSystemNode(const std::string& name);
 
     // Load weather configuration from JSON file
     void loadWeatherConfig();
 
+    // Compile and swap in new weather tuning; safe while the game thread is
+    // updating, which picks it up on its next update. Forecaster and grid
+    // settings are only read by loadWeatherConfig.
+    void applyWeatherConfig(const nlohmann::json& config);
+
+    // The current tables, dropping cached forecasts made from older ones
+    std::shared_ptr<const WeatherTables> currentTables();
+
     // Generate weather predictions for the next few days
     void generateWeatherForecasts();
 
-    // Update weather when time advances
-    void updateWeather(GameContext* context, int hoursElapsed);
+    // Update weather when time advances. The world state is already at the
+    // end of the span, which ended at hourOfDay; hours before a season
+    // boundary in the span use the earlier season.
+    void updateWeather(GameContext* context, int hoursElapsed, int hourOfDay = 0);
 
     // Determine the appropriate weather for a region based on season and region type
     WeatherCondition determineRegionalWeather(const std::string& region,
         const std::string& regionType,
         const std::string& season);
 
+    // Derive a region's weather from its cells of the weather grid
+    WeatherCondition sampleRegionalWeather(const std::string& regionName, const std::string& fallbackType = "plains");
+
+    // Re-sample every tracked region from the weather grid
+    void refreshRegionalWeather(GameContext* context);
+
     // Apply appropriate weather effects when entering a region
     void onRegionEnter(GameContext* context, const std::string& regionName);
 
     // Get the current weather for a specific region
     WeatherCondition getCurrentWeather(const std::string& regionName) const;
 
+    // Cached modifiers for a region (global weather if untracked); no copies or JSON lookups
+    const WeatherModifiers& getWeatherModifiers(const std::string& regionName) const;
+
     // Get the current weather description for a region
     std::string getWeatherDescription(const std::string& regionName) const;
 
@@ -86,6 +120,9 @@ public:
     // Get the forecast for upcoming days
     std::string getWeatherForecast() const;
 
+    // Forecast starting from a region's current weather (cached until it changes)
+    const std::vector<WeatherForecast>& getRegionalForecast(const std::string& regionName);
+
     // Override TANode methods
     void onEnter(GameContext* context) override;
     void onExit(GameContext* context) override;
@@ -0,0 +1,238 @@
+// WeatherTables.cpp
+#include "WeatherTables.hpp"
+
+int weatherSeasonIndex(const std::string& season)
+{
+    if (season == "summer")
+        return 1;
+    if (season == "autumn")
+        return 2;
+    if (season == "winter")
+        return 3;
+
+    // Spring and unknown seasons
+    return 0;
+}
+
+namespace {
+// One multiplier from a "<section>": { "<Type>": { "<Intensity>" | "default": value } } block
+float compiledModifier(const nlohmann::json& config, const char* section, const std::string& typeName, const std::string& intensityName)
+{
+    if (!config.contains(section) || !config[section].contains(typeName)) {
+        return 1.0f;
+    }
+
+    const auto& typeData = config[section][typeName];
+    if (typeData.contains(intensityName)) {
+        return typeData[intensityName].get<float>();
+    } else if (typeData.contains("default")) {
+        return typeData["default"].get<float>();
+    }
+    return 1.0f;
+}
+}
+
+template <int N>
+void WeatherAliasTable<N>::build(const std::array<float, N>& weights)
+{
+    float total = 0.0f;
+    for (float weight : weights) {
+        total += std::max(0.0f, weight);
+    }
+
+    empty = total <= 0.0f;
+    if (empty) {
+        return;
+    }
+
+    // Vose's method: pair each under-full column with an over-full donor
+    std::array<float, N> scaled;
+    int small[N];
+    int large[N];
+    int smallCount = 0;
+    int largeCount = 0;
+
+    for (int i = 0; i < N; i++) {
+        scaled[i] = std::max(0.0f, weights[i]) * N / total;
+        if (scaled[i] < 1.0f) {
+            small[smallCount++] = i;
+        } else {
+            large[largeCount++] = i;
+        }
+    }
+
+    while (smallCount > 0 && largeCount > 0) {
+        int under = small[--smallCount];
+        int over = large[--largeCount];
+
+        threshold[under] = scaled[under];
+        alias[under] = static_cast<uint8_t>(over);
+
+        scaled[over] -= 1.0f - scaled[under];
+        if (scaled[over] < 1.0f) {
+            small[smallCount++] = over;
+        } else {
+            large[largeCount++] = over;
+        }
+    }
+
+    // Leftovers are full columns (up to rounding)
+    while (largeCount > 0) {
+        int column = large[--largeCount];
+        threshold[column] = 1.0f;
+        alias[column] = static_cast<uint8_t>(column);
+    }
+    while (smallCount > 0) {
+        int column = small[--smallCount];
+        threshold[column] = 1.0f;
+        alias[column] = static_cast<uint8_t>(column);
+    }
+}
+
+template struct WeatherAliasTable<WEATHER_TYPE_COUNT>;
+template struct WeatherAliasTable<WEATHER_INTENSITY_COUNT>;
+
+WeatherTables::WeatherTables()
+    : minChangeHours(4)
+    , maxChangeHours(12)
+{
+    nlohmann::json emptyConfig = nlohmann::json::object();
+    compile(emptyConfig);
+}
+
+void WeatherTables::compile(const nlohmann::json& config)
+{
+    static const char* seasonNames[WEATHER_SEASON_COUNT] = { "spring", "summer", "autumn", "winter" };
+
+    if (config.contains("weatherChangeInterval")) {
+        minChangeHours = config["weatherChangeInterval"].value("min", minChangeHours);
+        maxChangeHours = std::max(minChangeHours, config["weatherChangeInterval"].value("max", maxChangeHours));
+    }
+
+    // Transitions: season modifiers applied and out-of-season snow removed once, here
+    for (int season = 0; season < WEATHER_SEASON_COUNT; season++) {
+        const std::string seasonName = seasonNames[season];
+        bool isWinter = seasonName == "winter";
+
+        for (int from = 0; from < WEATHER_TYPE_COUNT; from++) {
+            std::array<float, WEATHER_TYPE_COUNT> weights {};
+            std::string fromName = weatherTypeToString(static_cast<WeatherType>(from));
+
+            if (config.contains("weatherTransitionProbabilities") && config["weatherTransitionProbabilities"].contains(fromName)) {
+                for (auto& [type, probability] : config["weatherTransitionProbabilities"][fromName].items()) {
+                    if ((type == "Snowy" || type == "Blizzard") && !isWinter) {
+                        continue;
+                    }
+
+                    float prob = probability.get<float>();
+                    if (config.contains("seasonalModifiers") && config["seasonalModifiers"].contains(seasonName) && config["seasonalModifiers"][seasonName].contains(type)) {
+                        prob *= config["seasonalModifiers"][seasonName][type].get<float>();
+                    }
+
+                    weights[static_cast<int>(stringToWeatherType(type))] += prob;
+                }
+            }
+
+            float total = 0.0f;
+            for (float weight : weights) {
+                total += weight;
+            }
+            for (int to = 0; to < WEATHER_TYPE_COUNT; to++) {
+                transitionProbability[season][from][to] = total > 0.0f ? weights[to] / total : 0.0f;
+            }
+            transitionAlias[season][from].build(weights);
+        }
+    }
+
+    // Intensities per weather type
+    for (int type = 0; type < WEATHER_TYPE_COUNT; type++) {
+        std::array<float, WEATHER_INTENSITY_COUNT> weights {};
+        std::string typeName = weatherTypeToString(static_cast<WeatherType>(type));
+
+        if (config.contains("intensityProbabilities") && config["intensityProbabilities"].contains(typeName)) {
+            for (auto& [intensity, probability] : config["intensityProbabilities"][typeName].items()) {
+                weights[static_cast<int>(stringToWeatherIntensity(intensity))] += probability.get<float>();
+            }
+        }
+
+        float total = 0.0f;
+        for (float weight : weights) {
+            total += weight;
+        }
+        for (int intensity = 0; intensity < WEATHER_INTENSITY_COUNT; intensity++) {
+            intensityProbability[type][intensity] = total > 0.0f ? weights[intensity] / total : 0.0f;
+        }
+        intensityAlias[type].build(weights);
+    }
+
+    // Descriptions: clear skies use the default text, others prefer the intensity's own
+    for (int type = 0; type < WEATHER_TYPE_COUNT; type++) {
+        std::string typeName = weatherTypeToString(static_cast<WeatherType>(type));
+
+        for (int intensity = 0; intensity < WEATHER_INTENSITY_COUNT; intensity++) {
+            std::string intensityName = weatherIntensityToString(static_cast<WeatherIntensity>(intensity));
+            std::string& description = descriptions[type][intensity];
+            description = "The weather is " + typeName + ".";
+
+            if (!config.contains("weatherDescriptions") || !config["weatherDescriptions"].contains(typeName)) {
+                continue;
+            }
+
+            const auto& descData = config["weatherDescriptions"][typeName];
+            if (type == static_cast<int>(WeatherType::Clear) && descData.contains("default")) {
+                description = descData["default"].get<std::string>();
+            } else if (descData.contains(intensityName)) {
+                description = descData[intensityName].get<std::string>();
+            } else if (descData.contains("default")) {
+                description = descData["default"].get<std::string>();
+            }
+        }
+    }
+
+    // Gameplay multipliers, same lookup rules as WeatherCondition::getMovementModifier and friends
+    for (int type = 0; type < WEATHER_TYPE_COUNT; type++) {
+        std::string typeName = weatherTypeToString(static_cast<WeatherType>(type));
+
+        for (int intensity = 0; intensity < WEATHER_INTENSITY_COUNT; intensity++) {
+            std::string intensityName = weatherIntensityToString(static_cast<WeatherIntensity>(intensity));
+            WeatherModifiers& entry = modifiers[type][intensity];
+            entry.movement = compiledModifier(config, "movementModifiers", typeName, intensityName);
+            entry.visibility = compiledModifier(config, "visibilityModifiers", typeName, intensityName);
+            entry.combat = compiledModifier(config, "combatModifiers", typeName, intensityName);
+            entry.effects = 0;
+        }
+    }
+}
+
+int WeatherTables::rollChangeInterval(std::mt19937& rng) const
+{
+    return minChangeHours + (rng() % (maxChangeHours - minChangeHours + 1));
+}
+
+WeatherType WeatherTables::sampleTransition(int season, WeatherType from, std::mt19937& rng) const
+{
+    const auto& table = transitionAlias[season][static_cast<int>(from)];
+    if (table.empty) {
+        return from;
+    }
+    return static_cast<WeatherType>(table.sample(rng));
+}
+
+WeatherIntensity WeatherTables::sampleIntensity(WeatherType type, std::mt19937& rng) const
+{
+    const auto& table = intensityAlias[static_cast<int>(type)];
+    if (table.empty) {
+        return WeatherIntensity::Light;
+    }
+    return static_cast<WeatherIntensity>(table.sample(rng));
+}
+
+const std::string& WeatherTables::getDescription(WeatherType type, WeatherIntensity intensity) const
+{
+    return descriptions[static_cast<int>(type)][static_cast<int>(intensity)];
+}
+
+const WeatherModifiers& WeatherTables::getModifiers(WeatherType type, WeatherIntensity intensity) const
+{
+    return modifiers[static_cast<int>(type)][static_cast<int>(intensity)];
+}
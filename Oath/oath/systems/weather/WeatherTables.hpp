@@ -0,0 +1,71 @@
+// WeatherTables.hpp
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "WeatherTypes.hpp"
+
+constexpr int WEATHER_TYPE_COUNT = 8;
+constexpr int WEATHER_INTENSITY_COUNT = 5;
+constexpr int WEATHER_SEASON_COUNT = 4;
+
+// Season name ("spring", "summer", "autumn", "winter") to table index; unknown names map to spring
+int weatherSeasonIndex(const std::string& season);
+
+// Walker alias table over up to N outcomes: one uniform draw picks an outcome in O(1)
+template <int N>
+struct WeatherAliasTable {
+    std::array<float, N> threshold {};
+    std::array<uint8_t, N> alias {};
+    bool empty = true; // No outcome has weight; callers keep their default
+
+    // Build from non-negative weights (normalized internally)
+    void build(const std::array<float, N>& weights);
+
+    template <typename Rng>
+    int sample(Rng& rng) const
+    {
+        std::uniform_real_distribution<float> dist(0.0f, static_cast<float>(N));
+        float scaled = dist(rng);
+        int column = std::min(static_cast<int>(scaled), N - 1);
+        return (scaled - column) < threshold[column] ? column : alias[column];
+    }
+};
+
+// Weather config compiled at load time into dense tables indexed by season and enum
+class WeatherTables {
+public:
+    int minChangeHours;
+    int maxChangeHours;
+
+    // Normalized probabilities, [season][from][to] and [type][intensity]
+    float transitionProbability[WEATHER_SEASON_COUNT][WEATHER_TYPE_COUNT][WEATHER_TYPE_COUNT];
+    float intensityProbability[WEATHER_TYPE_COUNT][WEATHER_INTENSITY_COUNT];
+
+    // Description per type and intensity, with the config's fallbacks already applied
+    std::string descriptions[WEATHER_TYPE_COUNT][WEATHER_INTENSITY_COUNT];
+
+    // Movement, visibility and combat multipliers per type and intensity (effects left empty)
+    WeatherModifiers modifiers[WEATHER_TYPE_COUNT][WEATHER_INTENSITY_COUNT];
+
+    WeatherTables();
+
+    // Compile from the weather JSON; missing sections keep the defaults
+    void compile(const nlohmann::json& config);
+
+    int rollChangeInterval(std::mt19937& rng) const;
+    WeatherType sampleTransition(int season, WeatherType from, std::mt19937& rng) const;
+    WeatherIntensity sampleIntensity(WeatherType type, std::mt19937& rng) const;
+    const std::string& getDescription(WeatherType type, WeatherIntensity intensity) const;
+    const WeatherModifiers& getModifiers(WeatherType type, WeatherIntensity intensity) const;
+
+private:
+    WeatherAliasTable<WEATHER_TYPE_COUNT> transitionAlias[WEATHER_SEASON_COUNT][WEATHER_TYPE_COUNT];
+    WeatherAliasTable<WEATHER_INTENSITY_COUNT> intensityAlias[WEATHER_TYPE_COUNT];
+};
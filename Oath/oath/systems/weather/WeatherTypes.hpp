@@ -1,6 +1,7 @@
 // WeatherTypes.hpp
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 // Weather state enumeration
@@ -35,6 +36,27 @@ enum class WeatherEffect {
     SpecialEncounter
 };
 
+// Weather effects as bit flags so effect checks are a single AND
+using WeatherEffectMask = uint32_t;
+
+inline WeatherEffectMask weatherEffectBit(WeatherEffect effect)
+{
+    return 1u << static_cast<int>(effect);
+}
+
+// Everything travel and combat need from the weather, resolved once per weather change
+struct WeatherModifiers {
+    float movement = 1.0f; // Speed multiplier, 1.0 = normal
+    float visibility = 1.0f; // Sight range multiplier
+    float combat = 1.0f; // Combat effectiveness multiplier
+    WeatherEffectMask effects = 0;
+
+    bool has(WeatherEffect effect) const
+    {
+        return (effects & weatherEffectBit(effect)) != 0;
+    }
+};
+
 // Helper functions to convert string to enum and vice versa
 WeatherType stringToWeatherType(const std::string& type);
 WeatherIntensity stringToWeatherIntensity(const std::string& intensity);
@@ -17,6 +17,22 @@ bool LocationNode::AccessCondition::check(const GameContext& context) const
     return false;
 }
 
+bool LocationNode::AccessCondition::read(StateRead& out) const
+{
+    if (type == "item") {
+        out = { StateField::Item, target };
+    } else if (type == "skill") {
+        out = { StateField::Skill, target };
+    } else if (type == "faction") {
+        out = { StateField::Reputation, target };
+    } else if (type == "worldflag") {
+        out = { StateField::Flag, target };
+    } else {
+        return false;
+    }
+    return true;
+}
+
 LocationNode::LocationNode(const std::string& name, const std::string& location,
     const std::string& initialState)
     : TANode(name)
@@ -26,6 +42,25 @@ LocationNode::LocationNode(const std::string& name, const std::string& location,
 }
 
 bool LocationNode::canAccess(const GameContext& context) const
+{
+    return access.isWatched() ? access(context) : meetsAccessConditions(context);
+}
+
+void LocationNode::watchAccessConditions(TriggerEngine& engine)
+{
+    std::vector<StateRead> reads;
+    for (const auto& condition : accessConditions) {
+        StateRead read;
+        if (condition.read(read)) {
+            reads.push_back(read);
+        }
+    }
+
+    access = GameCondition([this](const GameContext& context) { return meetsAccessConditions(context); });
+    access.watch(engine, reads);
+}
+
+bool LocationNode::meetsAccessConditions(const GameContext& context) const
 {
     for (const auto& condition : accessConditions) {
         if (!condition.check(context)) {
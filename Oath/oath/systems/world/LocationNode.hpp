@@ -3,6 +3,7 @@
 #include "../../core/TAAction.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "../../data/GameScript.hpp"
 #include "../../systems/dialogue/NPC.hpp"
 
 #include <map>
@@ -36,6 +37,9 @@ public:
         int value;
 
         bool check(const GameContext& context) const;
+
+        // What check reads; false for a type it does not know
+        bool read(StateRead& out) const;
     };
     std::vector<AccessCondition> accessConditions;
 
@@ -43,6 +47,15 @@ public:
         const std::string& initialState = "normal");
 
     bool canAccess(const GameContext& context) const;
+
+    // Track the access conditions in a trigger engine so canAccess is only
+    // re-checked after one of them changes
+    void watchAccessConditions(TriggerEngine& engine);
     void onEnter(GameContext* context) override;
     std::vector<TAAction> getAvailableActions() override;
-};
\ No newline at end of file
+
+private:
+    GameCondition access;
+
+    bool meetsAccessConditions(const GameContext& context) const;
+};
@@ -3,6 +3,7 @@
 #include "../../core/TAAction.hpp"
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
+#include "../../data/GameScript.hpp"
 #include "LocationNode.hpp"
 
 #include <functional>
@@ -33,8 +34,8 @@ public:
     struct RegionEvent {
         std::string name;
         std::string description;
-        std::function<bool(const GameContext&)> condition;
-        std::function<void(GameContext*)> effect;
+        GameCondition condition;
+        GameEffect effect;
         double probability;
     };
     std::vector<RegionEvent> possibleEvents;
@@ -1,42 +1,146 @@
 #include "TimeNode.hpp"
+#include "../../data/TriggerEngine.hpp"
 
+#include <future>
 #include <iostream>
 
 TimeNode::TimeNode(const std::string& name)
     : TANode(name)
     , day(1)
     , hour(6)
+    , minute(0)
     , season("spring")
     , timeOfDay("morning")
 {
 }
 
-void TimeNode::advanceHour(GameContext* context)
+void TimeNode::subscribe(const std::string& id, TimeCadence cadence, TimeCallback callback, bool concurrent)
 {
-    hour++;
-
-    if (hour >= 24) {
-        hour = 0;
-        day++;
-
-        // Update season every 90 days
-        if (day % 90 == 0) {
-            if (season == "spring")
-                season = "summer";
-            else if (season == "summer")
-                season = "autumn";
-            else if (season == "autumn")
-                season = "winter";
-            else if (season == "winter")
-                season = "spring";
+    for (auto& subscriber : subscribers) {
+        if (subscriber.id == id) {
+            subscriber.cadence = cadence;
+            subscriber.callback = callback;
+            subscriber.concurrent = concurrent;
+            return;
         }
+    }
+
+    subscribers.push_back({ id, cadence, callback, concurrent });
+}
 
-        if (context) {
+bool TimeNode::unsubscribe(const std::string& id)
+{
+    for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+        if (it->id == id) {
+            subscribers.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::vector<TimeSubscriber>& TimeNode::getSubscribers() const
+{
+    return subscribers;
+}
+
+void TimeNode::advanceMinutes(GameContext* context, int minutes)
+{
+    if (minutes <= 0) {
+        return;
+    }
+
+    // Jump the clock in one step and count the boundaries crossed on the way
+    int totalMinutes = minute + minutes;
+    int totalHours = hour + totalMinutes / 60;
+    int hoursElapsed = totalMinutes / 60;
+    int daysElapsed = totalHours / 24;
+
+    minute = totalMinutes % 60;
+    hour = totalHours % 24;
+
+    // Season changes every 90 days
+    int oldDay = day;
+    day += daysElapsed;
+    int seasonsElapsed = day / 90 - oldDay / 90;
+
+    static const char* seasons[] = { "spring", "summer", "autumn", "winter" };
+    int seasonIndex = 0;
+    for (int i = 0; i < 4; i++) {
+        if (season == seasons[i])
+            seasonIndex = i;
+    }
+    season = seasons[(seasonIndex + seasonsElapsed) % 4];
+
+    updateTimeOfDay();
+
+    if (context) {
+        for (int i = 0; i < daysElapsed; i++) {
             context->worldState.advanceDay();
         }
+
+        // Publish the clock for script conditions before any subscriber runs
+        context->script.set("time.hour", static_cast<float>(hour));
+        context->script.set("time.minute", static_cast<float>(minute));
+    }
+
+    // Each subscriber hears about the whole span once. Independent systems run
+    // on their own threads, without the shared context, while the rest run
+    // here in registration order.
+    std::vector<std::future<void>> running;
+    for (const auto& subscriber : subscribers) {
+        int elapsed = 0;
+        switch (subscriber.cadence) {
+        case TimeCadence::Minute:
+            elapsed = minutes;
+            break;
+        case TimeCadence::Hour:
+            elapsed = hoursElapsed;
+            break;
+        case TimeCadence::Day:
+            elapsed = daysElapsed;
+            break;
+        case TimeCadence::Season:
+            elapsed = seasonsElapsed;
+            break;
+        }
+
+        if (elapsed <= 0 || !subscriber.callback) {
+            continue;
+        }
+
+        if (subscriber.concurrent) {
+            running.push_back(std::async(std::launch::async, subscriber.callback, static_cast<GameContext*>(nullptr), elapsed));
+        } else {
+            subscriber.callback(context, elapsed);
+        }
     }
 
-    // Update time of day
+    for (auto& task : running) {
+        task.get();
+    }
+
+    // End of the tick: re-check only the triggers whose inputs changed
+    if (context && context->triggers) {
+        context->triggers->update(context);
+    }
+
+    std::cout << "Time: Day " << day << ", " << hour << ":" << (minute < 10 ? "0" : "") << minute
+              << ", " << timeOfDay << " (" << season << ")" << std::endl;
+}
+
+void TimeNode::advanceHours(GameContext* context, int hours)
+{
+    advanceMinutes(context, hours * 60);
+}
+
+void TimeNode::advanceHour(GameContext* context)
+{
+    advanceHours(context, 1);
+}
+
+void TimeNode::updateTimeOfDay()
+{
     if (hour >= 5 && hour < 12)
         timeOfDay = "morning";
     else if (hour >= 12 && hour < 17)
@@ -45,9 +149,6 @@ void TimeNode::advanceHour(GameContext* context)
         timeOfDay = "evening";
     else
         timeOfDay = "night";
-
-    std::cout << "Time: Day " << day << ", " << hour << ":00, " << timeOfDay
-              << " (" << season << ")" << std::endl;
 }
 
 std::vector<TAAction> TimeNode::getAvailableActions()
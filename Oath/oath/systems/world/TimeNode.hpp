@@ -4,23 +4,68 @@
 #include "../../core/TANode.hpp"
 #include "../../data/GameContext.hpp"
 
+#include <functional>
 #include <string>
+#include <vector>
 
 // Forward declaration
 class TANode;
 struct TAAction;
 struct GameContext;
 
-// Time/Season system
+// How often a time subscriber wants to hear about passing time
+enum class TimeCadence {
+    Minute,
+    Hour,
+    Day,
+    Season
+};
+
+// Called once per advance with the number of cadence units that elapsed
+using TimeCallback = std::function<void(GameContext*, int elapsed)>;
+
+struct TimeSubscriber {
+    std::string id;
+    TimeCadence cadence;
+    TimeCallback callback;
+    bool concurrent; // Runs on a worker thread; see TimeNode for what it may touch
+};
+
+// Time/Season system. Advancing the clock by any span notifies each subscriber
+// once with the elapsed minutes, hours, days or seasons, so waiting, sleeping
+// or travelling costs one update per system rather than one per hour.
+//
+// Serial subscribers run on the calling thread in registration order and get
+// the game context. Concurrent subscribers each get a worker thread, started
+// as the loop reaches them, and overlap every other subscriber until the
+// advance joins them before the trigger pass. A concurrent subscriber may
+// only touch state that no other subscriber reads or writes, so it is called
+// with a null context and should not write to std::cout; its owner reports
+// what happened afterwards.
 class TimeNode : public TANode {
 public:
     int day;
     int hour;
+    int minute;
     std::string season;
     std::string timeOfDay;
 
     TimeNode(const std::string& name);
+
+    // Register a callback; subscribing again with the same id replaces it
+    void subscribe(const std::string& id, TimeCadence cadence, TimeCallback callback, bool concurrent = false);
+    bool unsubscribe(const std::string& id);
+    const std::vector<TimeSubscriber>& getSubscribers() const;
+
+    void advanceMinutes(GameContext* context, int minutes);
+    void advanceHours(GameContext* context, int hours);
     void advanceHour(GameContext* context);
+
     std::vector<TAAction> getAvailableActions() override;
     bool evaluateTransition(const TAInput& input, TANode*& outNextNode) override;
-};
\ No newline at end of file
+
+private:
+    std::vector<TimeSubscriber> subscribers;
+
+    void updateTimeOfDay();
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+// Holder for settings that are parsed once and then only read. Readers take
+// the current snapshot with get() and keep it for the whole operation; a
+// reload builds a new T and publish() swaps it in, so live tuning never shows
+// a reader half of an update and never frees a snapshot still in use.
+template <typename T>
+class ConfigSnapshot {
+public:
+    ConfigSnapshot()
+        : current(std::make_shared<const T>())
+    {
+    }
+
+    ConfigSnapshot(const ConfigSnapshot&) = delete;
+    ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+    std::shared_ptr<const T> get() const { return std::atomic_load(&current); }
+    void publish(std::shared_ptr<const T> next) { std::atomic_store(&current, std::move(next)); }
+
+private:
+    std::shared_ptr<const T> current;
+};
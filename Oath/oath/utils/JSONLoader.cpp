@@ -1,4 +1,6 @@
 #include "JSONLoader.hpp"
+#include "JSONSerializer.hpp"
+#include "../data/ItemCatalog.hpp"
 #include "../systems/crafting/CraftingNode.hpp"
 #include "../systems/dialogue/DialogueNode.hpp"
 #include "../systems/dialogue/NPC.hpp"
@@ -55,6 +57,16 @@ bool loadGameData(TAController& controller)
             std::cerr << "Failed to open data/skills.json" << std::endl;
         }
 
+        // Load item catalog before any content that references item ids
+        std::ifstream itemsFile("data/items.json");
+        if (itemsFile.is_open()) {
+            nlohmann::json itemsData = nlohmann::json::parse(itemsFile);
+            int loaded = loadItemsFromJSON(itemsData["items"]);
+            std::cout << "Loaded " << loaded << " item definitions" << std::endl;
+        } else {
+            std::cerr << "Failed to open data/items.json" << std::endl;
+        }
+
         // Load crafting recipes
         std::ifstream craftingFile("data/crafting.json");
         if (craftingFile.is_open()) {
@@ -171,6 +183,11 @@ void loadQuestsFromJSON(TAController& controller, const nlohmann::json& questDat
             }
         }
 
+        // Requirements are re-checked only when something they read changes
+        for (const auto& [questId, questNode] : questNodes) {
+            questNode->watchRequirements(controller.triggers);
+        }
+
         // Register the quest system
         if (questEntry["id"] == "MainQuest") {
             controller.setSystemRoot("QuestSystem", quest);
@@ -209,53 +226,23 @@ void loadNPCsFromJSON(TAController& controller, const nlohmann::json& npcData)
             DialogueNode* currentNode = dialogueNodes[dialogueData["id"]];
 
             for (const auto& responseData : dialogueData["responses"]) {
-                // Create response function for requirements and effects
-                std::function<bool(const GameContext&)> reqFunc = [](const GameContext&) { return true; };
-
+                // Requirements and effects are script text or the older typed objects; compiled once here
+                GameCondition requirement;
                 if (responseData.contains("requirements") && !responseData["requirements"].empty()) {
-                    reqFunc = [responseData](const GameContext& ctx) {
-                        for (const auto& req : responseData["requirements"]) {
-                            // Implement requirement checking based on req type
-                            if (req["type"] == "skill") {
-                                if (!ctx.playerStats.hasSkill(req["skill"], req["level"])) {
-                                    return false;
-                                }
-                            } else if (req["type"] == "item") {
-                                if (!ctx.playerInventory.hasItem(req["item"], req["amount"])) {
-                                    return false;
-                                }
-                            }
-                            // Add other requirement types as needed
-                        }
-                        return true;
-                    };
+                    requirement = GameCondition::fromJson(responseData["requirements"]);
                 }
 
-                std::function<void(GameContext*)> effectFunc = [](GameContext*) {};
-
+                GameEffect effect;
                 if (responseData.contains("effects") && !responseData["effects"].empty()) {
-                    effectFunc = [responseData](GameContext* ctx) {
-                        for (const auto& effect : responseData["effects"]) {
-                            // Implement effects based on type
-                            if (effect["type"] == "quest" && effect["action"] == "activate") {
-                                ctx->questJournal[effect["target"]] = "Active";
-                                std::cout << "Quest activated: " << effect["target"] << std::endl;
-                            } else if (effect["type"] == "knowledge" && effect["action"] == "add") {
-                                ctx->playerStats.learnFact(effect["target"]);
-                            } else if (effect["type"] == "faction" && effect["action"] == "change") {
-                                ctx->playerStats.changeFactionRep(effect["target"], effect["amount"]);
-                            }
-                            // Add other effect types as needed
-                        }
-                    };
+                    effect = GameEffect::fromJson(responseData["effects"]);
                 }
 
                 // Add the response with its target, requirements, and effects
                 currentNode->addResponse(
                     responseData["text"],
                     dialogueNodes[responseData["targetNode"]],
-                    reqFunc,
-                    effectFunc);
+                    requirement,
+                    effect);
             }
         }
 
@@ -361,6 +348,10 @@ void loadSkillsFromJSON(TAController& controller, const nlohmann::json& skillsDa
         }
     }
 
+    for (const auto& [skillId, skillNode] : skillNodes) {
+        skillNode->watchRequirements(controller.triggers);
+    }
+
     // Create character classes
     TANode* classSelectionNode = controller.createNode("ClassSelection");
 
@@ -398,6 +389,37 @@ void loadSkillsFromJSON(TAController& controller, const nlohmann::json& skillsDa
 }
 
 // Load crafting from JSON
+int loadItemsFromJSON(const nlohmann::json& itemsData)
+{
+    if (!itemsData.is_array()) {
+        std::cerr << "Item catalog data must be an array" << std::endl;
+        return 0;
+    }
+
+    ItemCatalog& catalog = ItemCatalog::getInstance();
+    size_t before = catalog.size();
+
+    for (const auto& itemData : itemsData) {
+        ItemProperties properties;
+        if (itemData.contains("properties")) {
+            for (const auto& [key, value] : itemData["properties"].items()) {
+                ItemPropertyValue parsed;
+                if (deserializeItemProperty(value, parsed)) {
+                    properties[key] = parsed;
+                }
+            }
+        }
+
+        catalog.intern(itemData["id"],
+            itemData.value("name", itemData["id"].get<std::string>()),
+            itemData.value("type", std::string("misc")),
+            itemData.value("value", 1),
+            properties);
+    }
+
+    return static_cast<int>(catalog.size() - before);
+}
+
 void loadCraftingFromJSON(TAController& controller, const nlohmann::json& craftingData)
 {
     TANode* craftingRoot = controller.createNode("CraftingRoot");
@@ -429,25 +451,21 @@ void loadCraftingFromJSON(TAController& controller, const nlohmann::json& crafti
                 recipe.skillRequirements[skill] = level;
             }
 
-            // Load result
-            recipe.result.itemId = recipeData["result"]["itemId"];
-            recipe.result.name = recipeData["result"]["name"];
-            recipe.result.type = recipeData["result"]["type"];
-            recipe.result.quantity = recipeData["result"]["quantity"];
-
             // Load result properties
-            for (const auto& [key, value] : recipeData["result"]["properties"].items()) {
-                if (value.is_number_integer()) {
-                    recipe.result.properties[key] = value.get<int>();
-                } else if (value.is_number_float()) {
-                    recipe.result.properties[key] = value.get<float>();
-                } else if (value.is_string()) {
-                    recipe.result.properties[key] = value.get<std::string>();
-                } else if (value.is_boolean()) {
-                    recipe.result.properties[key] = value.get<bool>();
+            const auto& resultData = recipeData["result"];
+            ItemProperties resultProperties;
+            for (const auto& [key, value] : resultData["properties"].items()) {
+                ItemPropertyValue parsed;
+                if (deserializeItemProperty(value, parsed)) {
+                    resultProperties[key] = parsed;
                 }
             }
 
+            // Register the result in the item catalog (no-op if items.json defined it)
+            recipe.result.itemIndex = ItemCatalog::getInstance().intern(
+                resultData["itemId"], resultData["name"], resultData["type"], 1, resultProperties);
+            recipe.result.quantity = resultData["quantity"];
+
             station->addRecipe(recipe);
         }
 
@@ -496,6 +514,7 @@ void loadWorldFromJSON(TAController& controller, const nlohmann::json& worldData
                 condition.value = conditionData["value"];
                 location->accessConditions.push_back(condition);
             }
+            location->watchAccessConditions(controller.triggers);
 
             locations[locationData["id"]] = location;
             region->locations.push_back(location);
@@ -508,37 +527,13 @@ void loadWorldFromJSON(TAController& controller, const nlohmann::json& worldData
             event.description = eventData["description"];
             event.probability = eventData["probability"];
 
-            // Set up condition function
-            event.condition = [eventData](const GameContext& ctx) {
-                if (eventData["condition"]["type"] == "worldflag") {
-                    return ctx.worldState.hasFlag(eventData["condition"]["flag"]) == eventData["condition"]["value"].get<bool>();
-                } else if (eventData["condition"]["type"] == "skill") {
-                    return ctx.playerStats.hasSkill(
-                        eventData["condition"]["skill"],
-                        eventData["condition"]["value"]);
-                }
-                return true;
-            };
-
-            // Set up effect function
-            event.effect = [eventData](GameContext* ctx) {
-                if (!ctx)
-                    return;
-
-                if (eventData["effect"]["type"] == "location") {
-                    ctx->worldState.setLocationState(
-                        eventData["effect"]["target"],
-                        eventData["effect"]["state"]);
-                } else if (eventData["effect"]["type"] == "item") {
-                    ctx->playerInventory.addItem(
-                        Item(
-                            eventData["effect"]["item"],
-                            eventData["effect"]["item"],
-                            "event_reward",
-                            1,
-                            eventData["effect"]["quantity"]));
-                }
-            };
+            if (eventData.contains("condition")) {
+                event.condition = GameCondition::fromJson(eventData["condition"]);
+            }
+            if (eventData.contains("effect")) {
+                event.effect = GameEffect::fromJson(eventData["effect"]);
+            }
+            event.condition.watch(controller.triggers);
 
             region->possibleEvents.push_back(event);
         }
@@ -703,6 +698,24 @@ void createDefaultJSONFiles()
         skillsFile << std::setw(4) << skillsData << std::endl;
         skillsFile.close();
     }
+    // Create items.json
+    std::ofstream itemsFile("data/items.json");
+    if (itemsFile.is_open()) {
+        nlohmann::json itemsData;
+        itemsData["items"] = nlohmann::json::array({ { { "id", "iron_ingot" }, { "name", "Iron Ingot" }, { "type", "material" }, { "value", 10 } },
+            { { "id", "leather_strips" }, { "name", "Leather Strips" }, { "type", "material" }, { "value", 5 } },
+            { { "id", "torch" }, { "name", "Torch" }, { "type", "tool" }, { "value", 2 } },
+            { { "id", "red_herb" }, { "name", "Red Herb" }, { "type", "herb" }, { "value", 3 } },
+            { { "id", "water_flask" }, { "name", "Water Flask" }, { "type", "container" }, { "value", 1 } },
+            { { "id", "iron_sword" }, { "name", "Iron Sword" }, { "type", "weapon" }, { "value", 30 }, { "properties", { { "damage", 10 } } } },
+            { { "id", "leather_armor" }, { "name", "Leather Armor" }, { "type", "armor" }, { "value", 25 }, { "properties", { { "defense", 5 } } } },
+            { { "id", "minor_healing_potion" }, { "name", "Minor Healing Potion" }, { "type", "potion" }, { "value", 15 }, { "properties", { { "heal_amount", 25 } } } },
+            { { "id", "hearty_stew" }, { "name", "Hearty Stew" }, { "type", "food" }, { "value", 8 }, { "properties", { { "effect_duration", 300 } } } } });
+
+        itemsFile << std::setw(4) << itemsData << std::endl;
+        itemsFile.close();
+    }
+
     // Create crafting.json
     std::ofstream craftingFile("data/crafting.json");
     if (craftingFile.is_open()) {
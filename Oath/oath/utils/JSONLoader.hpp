@@ -10,7 +10,6 @@
 
 // Forward declaration
 class TAController;
-class json;
 
 // Load game data from JSON files
 bool loadGameData(TAController& controller);
@@ -19,6 +18,7 @@ bool loadGameData(TAController& controller);
 void loadQuestsFromJSON(TAController& controller, const nlohmann::json& questData);
 void loadNPCsFromJSON(TAController& controller, const nlohmann::json& npcData);
 void loadSkillsFromJSON(TAController& controller, const nlohmann::json& skillsData);
+int loadItemsFromJSON(const nlohmann::json& itemsData); // Returns the number of new catalog definitions
 void loadCraftingFromJSON(TAController& controller, const nlohmann::json& craftingData);
 void loadWorldFromJSON(TAController& controller, const nlohmann::json& worldData);
 
@@ -86,20 +86,36 @@ void deserializeWorldState(const nlohmann::json& worldData, WorldState& state)
     state.currentSeason = worldData["currentSeason"];
 }
 
+bool deserializeItemProperty(const nlohmann::json& value, ItemPropertyValue& outValue)
+{
+    if (value.is_number_integer()) {
+        outValue = value.get<int>();
+    } else if (value.is_number_float()) {
+        outValue = value.get<float>();
+    } else if (value.is_string()) {
+        outValue = value.get<std::string>();
+    } else if (value.is_boolean()) {
+        outValue = value.get<bool>();
+    } else {
+        return false;
+    }
+    return true;
+}
+
 nlohmann::json serializeInventory(const Inventory& inventory)
 {
     nlohmann::json inventoryData = nlohmann::json::array();
 
     for (const auto& item : inventory.items) {
         nlohmann::json itemData;
-        itemData["id"] = item.id;
-        itemData["name"] = item.name;
-        itemData["type"] = item.type;
+        itemData["id"] = item.id();
+        itemData["name"] = item.name();
+        itemData["type"] = item.type();
         itemData["value"] = item.value;
         itemData["quantity"] = item.quantity;
 
         nlohmann::json properties;
-        for (const auto& [key, value] : item.properties) {
+        for (const auto& [key, value] : item.getProperties()) {
             if (std::holds_alternative<int>(value)) {
                 properties[key] = std::get<int>(value);
             } else if (std::holds_alternative<float>(value)) {
@@ -130,16 +146,11 @@ void deserializeInventory(const nlohmann::json& inventoryData, Inventory& invent
             itemData["value"],
             itemData["quantity"]);
 
-        // Load properties
+        // Load properties; values matching the catalog stay shared
         for (const auto& [key, value] : itemData["properties"].items()) {
-            if (value.is_number_integer()) {
-                item.properties[key] = value.get<int>();
-            } else if (value.is_number_float()) {
-                item.properties[key] = value.get<float>();
-            } else if (value.is_string()) {
-                item.properties[key] = value.get<std::string>();
-            } else if (value.is_boolean()) {
-                item.properties[key] = value.get<bool>();
+            ItemPropertyValue parsed;
+            if (deserializeItemProperty(value, parsed)) {
+                item.setProperty(key, parsed);
             }
         }
 
@@ -12,7 +12,6 @@ struct CharacterStats;
 class Inventory;
 struct WorldState;
 class TAController;
-class json;
 
 // JSON serialization functions
 nlohmann::json serializeCharacterStats(const CharacterStats& stats);
@@ -21,5 +20,8 @@ void deserializeCharacterStats(const nlohmann::json& statsData, CharacterStats&
 nlohmann::json serializeWorldState(const WorldState& state);
 void deserializeWorldState(const nlohmann::json& worldData, WorldState& state);
 
+// Parse a JSON scalar into an item property value; returns false for unsupported types
+bool deserializeItemProperty(const nlohmann::json& value, ItemPropertyValue& outValue);
+
 nlohmann::json serializeInventory(const Inventory& inventory);
 void deserializeInventory(const nlohmann::json& inventoryData, Inventory& inventory);
\ No newline at end of file
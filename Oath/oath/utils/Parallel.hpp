@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <vector>
+
+// Mixes a 64-bit key into a well-spread hash. The simulation systems roll
+// their chances as splitMix of (seed, day, ids) instead of drawing from a
+// shared generator, so results do not depend on thread count or order.
+inline uint64_t splitMix(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Calls work(worker, begin, end) on contiguous slices of [0, count), one per
+// worker, and returns when all are done. The calling thread takes the first
+// slice itself; with one worker everything runs inline.
+inline void forEachSlice(int count, int workers, const std::function<void(int, int, int)>& work)
+{
+    workers = std::min(std::max(workers, 1), count);
+    if (workers <= 1) {
+        work(0, 0, count);
+        return;
+    }
+
+    std::vector<std::future<void>> running;
+    int slice = (count + workers - 1) / workers;
+    for (int w = 1; w < workers; w++) {
+        int begin = w * slice;
+        int end = std::min(count, begin + slice);
+        if (begin < end) {
+            running.push_back(std::async(std::launch::async, work, w, begin, end));
+        }
+    }
+    work(0, 0, std::min(count, slice));
+    for (auto& task : running) {
+        task.get();
+    }
+}